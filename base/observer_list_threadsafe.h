@@ -5,8 +5,10 @@
 #ifndef BASE_OBSERVER_LIST_THREADSAFE_H_
 #define BASE_OBSERVER_LIST_THREADSAFE_H_
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "base/base_export.h"
 #include "base/bind.h"
@@ -46,7 +48,9 @@
 //   The drawback of the threadsafe observer list is that notifications are not
 //   as real-time as the non-threadsafe version of this class. Notifications
 //   will always be done via PostTask() to another sequence, whereas with the
-//   non-thread-safe ObserverList, notifications happen synchronously.
+//   non-thread-safe ObserverList, notifications happen synchronously. One
+//   task is posted per sequence for each notification, which notifies all of
+//   the observers of that sequence.
 //
 //   Note: this class previously supported synchronous notifications for
 //   same-sequence observers, but it was error-prone and removed in
@@ -196,13 +200,32 @@ class ObserverListThreadSafe : public internal::ObserverListThreadSafeBase {
                       std::forward<Params>(params)...);
 
     AutoLock lock(lock_);
+
+    // The observers of a sequence are notified from a single task, so that a
+    // notification posts one task per sequence rather than one per observer.
+    // There are usually few sequences, hence the linear search.
+    std::vector<SequenceNotification> sequence_notifications;
     for (const auto& observer : observers_) {
-      observer.second.task_runner->PostTask(
+      auto it = std::find_if(
+          sequence_notifications.begin(), sequence_notifications.end(),
+          [&](const SequenceNotification& sequence_notification) {
+            return sequence_notification.task_runner ==
+                   observer.second.task_runner;
+          });
+      if (it == sequence_notifications.end()) {
+        it = sequence_notifications.insert(
+            sequence_notifications.end(),
+            SequenceNotification{observer.second.task_runner});
+      }
+      it->targets.push_back({observer.first, observer.second.observer_id});
+    }
+
+    for (auto& sequence_notification : sequence_notifications) {
+      sequence_notification.task_runner->PostTask(
           from_here,
-          BindOnce(&ObserverListThreadSafe<ObserverType>::NotifyWrapper, this,
-                   observer.first,
-                   NotificationData(this, observer.second.observer_id,
-                                    from_here, method)));
+          BindOnce(&ObserverListThreadSafe<ObserverType>::NotifySequenceWrapper,
+                   this, std::move(sequence_notification.targets), from_here,
+                   method));
     }
   }
 
@@ -222,8 +245,31 @@ class ObserverListThreadSafe : public internal::ObserverListThreadSafeBase {
     size_t observer_id;
   };
 
+  struct NotificationTarget {
+    raw_ptr<ObserverType> observer;
+    size_t observer_id;
+  };
+
+  struct SequenceNotification {
+    scoped_refptr<SequencedTaskRunner> task_runner;
+    std::vector<NotificationTarget> targets;
+  };
+
   ~ObserverListThreadSafe() override = default;
 
+  // Notifies each of |targets|, in order, unless it was removed before its
+  // turn, e.g. by the notification of a previous target.
+  void NotifySequenceWrapper(
+      const std::vector<NotificationTarget>& targets,
+      const Location& from_here,
+      const RepeatingCallback<void(ObserverType*)>& method) {
+    for (const NotificationTarget& target : targets) {
+      NotifyWrapper(target.observer,
+                    NotificationData(this, target.observer_id, from_here,
+                                     method));
+    }
+  }
+
   void NotifyWrapper(ObserverType* observer,
                      const NotificationData& notification) {
     {
@@ -488,6 +488,28 @@ TEST(ObserverListThreadSafeTest, AddRemoveWithPendingNotifications) {
   EXPECT_EQ(30, b.total);
 }
 
+// Observers of the same sequence are notified from one task.
+TEST(ObserverListThreadSafeTest, NotifyObserversOfSequenceInOneTask) {
+  test::TaskEnvironment task_environment;
+
+  scoped_refptr<ObserverListThreadSafe<Foo>> observer_list(
+      new ObserverListThreadSafe<Foo>);
+  Adder a(1);
+  Adder b(1);
+  Adder c(1);
+
+  observer_list->AddObserver(&a);
+  observer_list->AddObserver(&b);
+  observer_list->AddObserver(&c);
+  observer_list->Notify(FROM_HERE, &Foo::Observe, 10);
+  EXPECT_EQ(1u, task_environment.GetPendingMainThreadTaskCount());
+  RunLoop().RunUntilIdle();
+
+  EXPECT_EQ(10, a.total);
+  EXPECT_EQ(10, b.total);
+  EXPECT_EQ(10, c.total);
+}
+
 // Same as ObserverListTest.Existing, but for ObserverListThreadSafe
 TEST(ObserverListThreadSafeTest, Existing) {
   test::TaskEnvironment task_environment;
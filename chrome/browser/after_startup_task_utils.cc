@@ -51,6 +51,15 @@ base::LazyInstance<base::AtomicFlag>::Leaky g_startup_complete_flag;
 base::LazyInstance<base::circular_deque<AfterStartupTask*>>::Leaky
     g_after_startup_tasks;
 
+// Once startup is complete, the queued tasks are released this many at a
+// time, each batch from its own UI thread task, so that they do not all land
+// on their task runners in the same instant.
+constexpr size_t kTasksPerReleaseBatch = 16;
+
+// Whether the queued tasks are being released. May only be accessed on the UI
+// thread.
+bool g_releasing_tasks = false;
+
 bool IsBrowserStartupComplete() {
   // Be sure to initialize the LazyInstance on the main thread since the flag
   // may only be set on it's initializing thread.
@@ -62,6 +71,9 @@ bool IsBrowserStartupComplete() {
 void RunTask(std::unique_ptr<AfterStartupTask> queued_task) {
   // We're careful to delete the caller's |task| on the target runner's thread.
   DCHECK(queued_task->task_runner->RunsTasksInCurrentSequence());
+  // Lets a startup trace attribute the cost of each deferred task.
+  TRACE_EVENT1("startup", "AfterStartupTask", "posted_from",
+               queued_task->from_here.ToString());
   std::move(queued_task->task).Run();
 }
 
@@ -98,14 +110,40 @@ void QueueTask(std::unique_ptr<AfterStartupTask> queued_task) {
   g_after_startup_tasks.Get().push_back(queued_task.release());
 }
 
+// Schedules the next batch of queued tasks. The flag is only set once the
+// queue is empty, so that tasks posted in the meantime queue up behind those
+// already queued rather than overtaking them.
+void ReleaseQueuedTasks() {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  DCHECK(g_releasing_tasks);
+
+  TRACE_EVENT0("startup", "ReleaseQueuedTasks");
+  base::circular_deque<AfterStartupTask*>& queue = g_after_startup_tasks.Get();
+  for (size_t i = 0; i < kTasksPerReleaseBatch && !queue.empty(); ++i) {
+    ScheduleTask(base::WrapUnique(queue.front()));
+    queue.pop_front();
+  }
+  if (!queue.empty()) {
+    // Not BEST_EFFORT, as those tasks may themselves wait for startup to be
+    // complete.
+    content::GetUIThreadTaskRunner({base::TaskPriority::USER_VISIBLE})
+        ->PostTask(FROM_HERE, base::BindOnce(&ReleaseQueuedTasks));
+    return;
+  }
+  queue.shrink_to_fit();
+  g_startup_complete_flag.Get().Set();
+  g_releasing_tasks = false;
+}
+
 void SetBrowserStartupIsComplete() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
-  if (IsBrowserStartupComplete())
+  if (IsBrowserStartupComplete() || g_releasing_tasks)
     return;
 
   TRACE_EVENT0("startup", "SetBrowserStartupIsComplete");
-  g_startup_complete_flag.Get().Set();
+  // Initializes the flag on the UI thread, see IsBrowserStartupComplete().
+  g_startup_complete_flag.Get();
 #if BUILDFLAG(IS_MAC) || BUILDFLAG(IS_WIN) || BUILDFLAG(IS_LINUX) || \
     BUILDFLAG(IS_CHROMEOS)
   // Process::Current().CreationTime() is not available on all platforms.
@@ -119,10 +157,8 @@ void SetBrowserStartupIsComplete() {
         // BUILDFLAG(IS_CHROMEOS)
   UMA_HISTOGRAM_COUNTS_10000("Startup.AfterStartupTaskCount",
                              g_after_startup_tasks.Get().size());
-  for (AfterStartupTask* queued_task : g_after_startup_tasks.Get())
-    ScheduleTask(base::WrapUnique(queued_task));
-  g_after_startup_tasks.Get().clear();
-  g_after_startup_tasks.Get().shrink_to_fit();
+  g_releasing_tasks = true;
+  ReleaseQueuedTasks();
 }
 
 // Observes the first visible page load and sets the startup complete
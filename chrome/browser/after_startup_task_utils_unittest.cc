@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
 #include "base/callback_helpers.h"
@@ -208,3 +209,33 @@ TEST_F(AfterStartupTaskTest, PostTask) {
   EXPECT_EQ(2, background_sequence_->ran_task_count());
   EXPECT_EQ(2, ui_thread_->ran_task_count());
 }
+
+TEST_F(AfterStartupTaskTest, PostManyTasks) {
+  constexpr int kTaskCount = 40;
+  std::vector<int> order;
+  for (int i = 0; i < kTaskCount; ++i) {
+    AfterStartupTaskUtils::PostTask(
+        FROM_HERE, ui_thread_,
+        base::BindOnce(
+            [](std::vector<int>* order, int i) { order->push_back(i); },
+            &order, i));
+  }
+
+  // The queued tasks are released in batches, and startup is only reported
+  // complete once all of them are.
+  AfterStartupTaskUtils::SetBrowserStartupIsCompleteForTesting();
+  EXPECT_LT(ui_thread_->posted_task_count(), kTaskCount);
+  EXPECT_FALSE(AfterStartupTaskUtils::IsBrowserStartupComplete());
+
+  // A task posted meanwhile does not overtake the queued ones.
+  AfterStartupTaskUtils::PostTask(
+      FROM_HERE, ui_thread_,
+      base::BindOnce([](std::vector<int>* order) { order->push_back(-1); },
+                     &order));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(AfterStartupTaskUtils::IsBrowserStartupComplete());
+  ASSERT_EQ(static_cast<size_t>(kTaskCount + 1), order.size());
+  for (int i = 0; i < kTaskCount; ++i)
+    EXPECT_EQ(i, order[i]);
+  EXPECT_EQ(-1, order.back());
+}
@@ -0,0 +1,162 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "chrome/browser/android/request_block_list_updater.h"
+
+#include <string.h>
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file.h"
+#include "base/files/file_util.h"
+#include "base/logging.h"
+#include "base/ranges/algorithm.h"
+#include "base/task/thread_pool.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/content_settings/core/common/content_settings.h"
+#include "components/content_settings/core/common/content_settings_types.h"
+#include "components/version_info/version_info_values.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
+#include "net/traffic_annotation/network_traffic_annotation.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "services/network/public/cpp/simple_url_loader.h"
+#include "url/gurl.h"
+
+const base::FilePath::CharType kRequestBlockListFileName[] =
+    FILE_PATH_LITERAL("request_block_list.bin");
+
+namespace {
+
+// The list compiled for this version of the browser, see the server contract
+// in the header.
+constexpr char kRequestBlockListURL[] =
+    "https://settings.kiwibrowser.com/request_block_list/"
+    "request_block_list.bin?version=" PRODUCT_VERSION;
+
+// The first bytes of every list, kRequestBlockListMagic in
+// request_block_list_format.h.
+constexpr char kRequestBlockListMagic[] = {'K', 'R', 'B', 'L'};
+
+// Lists are far smaller; a larger download is not one.
+constexpr int64_t kMaxRequestBlockListSize = 8 * 1024 * 1024;
+
+constexpr int kMaxRetries = 3;
+
+constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
+    net::DefineNetworkTrafficAnnotation("request_block_list_updater", R"(
+        semantics {
+          sender: "Request Block List Updater"
+          description:
+            "Downloads the list of trackers, ads and annoyances whose "
+            "requests are blocked, so that it can be updated without a new "
+            "version of the browser."
+          trigger: "Once per browser start, a minute after startup."
+          data: "The version of the browser."
+          destination: OTHER
+          destination_other: "The Kiwi settings server."
+        }
+        policy {
+          cookies_allowed: NO
+          setting:
+            "Nothing is downloaded while ads are allowed on all sites in "
+            "the Ads site setting."
+          policy_exception_justification:
+            "Not implemented. Only public data is downloaded."
+        })");
+
+// Replaces the installed list with the downloaded one, unless the download
+// is not a list at all, e.g. an error page. Renderers check the rest.
+void InstallDownloadedList(const base::FilePath& downloaded_path,
+                           const base::FilePath& list_path) {
+  char magic[sizeof(kRequestBlockListMagic)];
+  base::File file(downloaded_path,
+                  base::File::FLAG_OPEN | base::File::FLAG_READ);
+  bool is_list = file.IsValid() &&
+                 file.ReadAtCurrentPos(magic, sizeof(magic)) ==
+                     static_cast<int>(sizeof(magic)) &&
+                 !memcmp(magic, kRequestBlockListMagic, sizeof(magic));
+  file.Close();
+  // The installed file may be open for this browser run, which keeps using
+  // it: the rename only changes what the next run opens.
+  if (!is_list ||
+      !base::ReplaceFile(downloaded_path, list_path, /*error=*/nullptr)) {
+    DLOG(WARNING) << "Failed to install the request block list";
+    base::DeleteFile(downloaded_path);
+  }
+}
+
+}  // namespace
+
+RequestBlockListUpdater::RequestBlockListUpdater(
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+    scoped_refptr<HostContentSettingsMap> settings_map,
+    const base::FilePath& app_data_path)
+    : url_loader_factory_(std::move(url_loader_factory)),
+      settings_map_(std::move(settings_map)),
+      list_path_(app_data_path.Append(kRequestBlockListFileName)),
+      download_path_(list_path_.AddExtension(FILE_PATH_LITERAL("download"))) {}
+
+RequestBlockListUpdater::~RequestBlockListUpdater() = default;
+
+void RequestBlockListUpdater::Start(base::TimeDelta delay) {
+  content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT})
+      ->PostDelayedTask(FROM_HERE,
+                        base::BindOnce(&RequestBlockListUpdater::Download,
+                                       weak_ptr_factory_.GetWeakPtr()),
+                        delay);
+}
+
+bool RequestBlockListUpdater::IsAdBlockingEnabled() const {
+  if (settings_map_->GetDefaultContentSetting(ContentSettingsType::ADS,
+                                              /*provider_id=*/nullptr) !=
+      CONTENT_SETTING_ALLOW) {
+    return true;
+  }
+  ContentSettingsForOneType settings;
+  settings_map_->GetSettingsForOneType(ContentSettingsType::ADS, &settings);
+  return base::ranges::any_of(
+      settings, [](const ContentSettingPatternSource& setting) {
+        return setting.GetContentSetting() == CONTENT_SETTING_BLOCK;
+      });
+}
+
+void RequestBlockListUpdater::Download() {
+  DCHECK(!url_loader_);
+  if (!IsAdBlockingEnabled())
+    return;
+  auto resource_request = std::make_unique<network::ResourceRequest>();
+  resource_request->url = GURL(kRequestBlockListURL);
+  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
+
+  url_loader_ = network::SimpleURLLoader::Create(std::move(resource_request),
+                                                 kTrafficAnnotation);
+  url_loader_->SetRetryOptions(
+      kMaxRetries, network::SimpleURLLoader::RETRY_ON_5XX |
+                       network::SimpleURLLoader::RETRY_ON_NETWORK_CHANGE);
+  // With the validators the server sends, the HTTP cache revalidates a list
+  // already downloaded, so an unchanged list costs little more than the
+  // request.
+  url_loader_->DownloadToFile(
+      url_loader_factory_.get(),
+      base::BindOnce(&RequestBlockListUpdater::OnDownloadComplete,
+                     weak_ptr_factory_.GetWeakPtr()),
+      download_path_, kMaxRequestBlockListSize);
+}
+
+void RequestBlockListUpdater::OnDownloadComplete(
+    base::FilePath downloaded_path) {
+  url_loader_.reset();
+  // The loader already removed the partial file of a failed download.
+  if (downloaded_path.empty())
+    return;
+  base::ThreadPool::PostTask(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&InstallDownloadedList, std::move(downloaded_path),
+                     list_path_));
+}
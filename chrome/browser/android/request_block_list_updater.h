@@ -0,0 +1,75 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CHROME_BROWSER_ANDROID_REQUEST_BLOCK_LIST_UPDATER_H_
+#define CHROME_BROWSER_ANDROID_REQUEST_BLOCK_LIST_UPDATER_H_
+
+#include <memory>
+
+#include "base/files/file_path.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+
+class HostContentSettingsMap;
+
+namespace network {
+class SharedURLLoaderFactory;
+class SimpleURLLoader;
+}  // namespace network
+
+// The name of the compiled request block list in the app data directory.
+// ChromeContentBrowserClient shares it with every renderer, which uses it in
+// place of the list built into Blink; see blink::SetRequestBlockListFile().
+extern const base::FilePath::CharType kRequestBlockListFileName[];
+
+// Downloads the latest compiled request block list, once per browser run,
+// and installs it as kRequestBlockListFileName. The file shared with
+// renderers is opened once per run, so an installed list is used from the
+// next browser start. Renderers validate the list and fall back to their
+// built-in one if it is malformed or of another format version. Nothing is
+// downloaded while the ADS content setting allows ads everywhere, as the list
+// then goes unused.
+//
+// The server contract:
+// - The list is requested from kRequestBlockListURL, without cookies, with
+//   the version of the browser as the "version" query parameter.
+// - The server answers with the list for that version, as written by
+//   //third_party/blink/renderer/core:request_block_list_generator from a
+//   tree of the same list format version (kRequestBlockListVersion). Any
+//   status but 200, e.g. a 404 for a version without a list, leaves the
+//   installed list in place.
+// - Responses carry an ETag or Last-Modified validator, so that the HTTP
+//   cache revalidates an unchanged list instead of downloading it again.
+// - A list larger than 8 MiB is not downloaded.
+class RequestBlockListUpdater {
+ public:
+  RequestBlockListUpdater(
+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+      scoped_refptr<HostContentSettingsMap> settings_map,
+      const base::FilePath& app_data_path);
+  RequestBlockListUpdater(const RequestBlockListUpdater&) = delete;
+  RequestBlockListUpdater& operator=(const RequestBlockListUpdater&) = delete;
+  ~RequestBlockListUpdater();
+
+  // Downloads the list after |delay|, so that startup is not slowed down.
+  void Start(base::TimeDelta delay);
+
+ private:
+  // Whether the ADS content setting blocks ads on some site.
+  bool IsAdBlockingEnabled() const;
+
+  void Download();
+  void OnDownloadComplete(base::FilePath downloaded_path);
+
+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  scoped_refptr<HostContentSettingsMap> settings_map_;
+  const base::FilePath list_path_;
+  const base::FilePath download_path_;
+  std::unique_ptr<network::SimpleURLLoader> url_loader_;
+
+  base::WeakPtrFactory<RequestBlockListUpdater> weak_ptr_factory_{this};
+};
+
+#endif  // CHROME_BROWSER_ANDROID_REQUEST_BLOCK_LIST_UPDATER_H_
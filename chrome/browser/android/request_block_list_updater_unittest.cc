@@ -0,0 +1,113 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "chrome/browser/android/request_block_list_updater.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/http/http_status_code.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace {
+
+// A list as far as the updater checks: renderers validate the rest.
+constexpr char kList[] = "KRBL\x01\x00\x00\x00 the rest of the list";
+
+class RequestBlockListUpdaterTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    list_path_ = temp_dir_.GetPath().Append(kRequestBlockListFileName);
+  }
+
+  HostContentSettingsMap* settings_map() {
+    return HostContentSettingsMapFactory::GetForProfile(&profile_);
+  }
+
+  // Runs an update, answering its request with |status| and |content|.
+  // Returns whether a request was made.
+  bool Update(net::HttpStatusCode status, const std::string& content) {
+    RequestBlockListUpdater updater(
+        base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+            &url_loader_factory_),
+        settings_map(), temp_dir_.GetPath());
+    updater.Start(base::TimeDelta());
+    task_environment_.RunUntilIdle();
+    if (url_loader_factory_.NumPending() != 1)
+      return false;
+    GURL url = url_loader_factory_.GetPendingRequest(0)->request.url;
+    EXPECT_TRUE(base::StartsWith(url.query(), "version="));
+    url_loader_factory_.SimulateResponseForPendingRequest(url.spec(), content,
+                                                          status);
+    task_environment_.RunUntilIdle();
+    return true;
+  }
+
+  std::string InstalledList() {
+    std::string list;
+    base::ReadFileToString(list_path_, &list);
+    return list;
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+  TestingProfile profile_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  base::ScopedTempDir temp_dir_;
+  base::FilePath list_path_;
+};
+
+TEST_F(RequestBlockListUpdaterTest, InstallsDownloadedList) {
+  const std::string list(kList, sizeof(kList) - 1);
+  ASSERT_TRUE(Update(net::HTTP_OK, list));
+  EXPECT_EQ(list, InstalledList());
+  EXPECT_FALSE(
+      base::PathExists(list_path_.AddExtension(FILE_PATH_LITERAL("download"))));
+}
+
+TEST_F(RequestBlockListUpdaterTest, KeepsListOnInvalidDownload) {
+  const std::string list(kList, sizeof(kList) - 1);
+  ASSERT_TRUE(Update(net::HTTP_OK, list));
+
+  // An error page served as a list is not installed.
+  ASSERT_TRUE(Update(net::HTTP_OK, "<html>Not a list</html>"));
+  EXPECT_EQ(list, InstalledList());
+  EXPECT_FALSE(
+      base::PathExists(list_path_.AddExtension(FILE_PATH_LITERAL("download"))));
+
+  // Nor is anything the server failed to serve.
+  ASSERT_TRUE(Update(net::HTTP_NOT_FOUND, "KRBL"));
+  EXPECT_EQ(list, InstalledList());
+}
+
+TEST_F(RequestBlockListUpdaterTest, NoListWithoutValidDownload) {
+  // Renderers fall back to their built-in list while none is installed.
+  ASSERT_TRUE(Update(net::HTTP_OK, "KRB"));
+  EXPECT_FALSE(base::PathExists(list_path_));
+}
+
+TEST_F(RequestBlockListUpdaterTest, DownloadsOnlyWhileAdsAreBlocked) {
+  settings_map()->SetDefaultContentSetting(ContentSettingsType::ADS,
+                                           CONTENT_SETTING_ALLOW);
+  EXPECT_FALSE(Update(net::HTTP_OK, std::string(kList, sizeof(kList) - 1)));
+  EXPECT_FALSE(base::PathExists(list_path_));
+
+  // Ads blocked on a single site are enough.
+  settings_map()->SetContentSettingDefaultScope(
+      GURL("https://example.com/"), GURL(), ContentSettingsType::ADS,
+      CONTENT_SETTING_BLOCK);
+  EXPECT_TRUE(Update(net::HTTP_OK, std::string(kList, sizeof(kList) - 1)));
+}
+
+}  // namespace
@@ -4,8 +4,10 @@
 
 #include "chrome/browser/autocomplete/chrome_autocomplete_scheme_classifier.h"
 
+#include "base/metrics/histogram_macros.h"
 #include "base/notreached.h"
 #include "base/strings/string_util.h"
+#include "base/trace_event/trace_event.h"
 #include "build/build_config.h"
 #include "chrome/browser/custom_handlers/protocol_handler_registry_factory.h"
 #include "chrome/browser/external_protocol/external_protocol_handler.h"
@@ -52,6 +54,12 @@ ChromeAutocompleteSchemeClassifier::~ChromeAutocompleteSchemeClassifier() {
 metrics::OmniboxInputType
 ChromeAutocompleteSchemeClassifier::GetInputTypeForScheme(
     const std::string& scheme) const {
+  // Runs for every keystroke that looks like it starts with a scheme, and the
+  // external protocol checks below may query the OS.
+  TRACE_EVENT0("omnibox",
+               "ChromeAutocompleteSchemeClassifier::GetInputTypeForScheme");
+  SCOPED_UMA_HISTOGRAM_TIMER_MICROS(
+      "Omnibox.SchemeClassifier.GetInputTypeForSchemeTime");
   if (scheme.empty()) {
     return metrics::OmniboxInputType::EMPTY;
   }
@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "base/base_paths.h"
 #include "base/bind.h"
 #include "base/path_service.h"
 #include "base/task/current_thread.h"
@@ -14,8 +15,10 @@
 #include "chrome/browser/android/chrome_backup_watcher.h"
 #include "chrome/browser/android/mojo/chrome_interface_registrar_android.h"
 #include "chrome/browser/android/preferences/clipboard_android.h"
+#include "chrome/browser/android/request_block_list_updater.h"
 #include "chrome/browser/android/seccomp_support_detector.h"
 #include "chrome/browser/browser_process.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/data_saver/data_saver.h"
 #include "chrome/browser/profiles/profile_manager.h"
 #include "chrome/browser/profiles/profile_manager_android.h"
@@ -80,6 +83,15 @@ void ChromeBrowserMainPartsAndroid::PostProfileInit(Profile* profile,
   // messages can be processed (and dropped) because the handler wasn't
   // installed in time.
   webauthn::authenticator::RegisterForCloudMessages();
+
+  // The list is only updated while the profile blocks ads somewhere.
+  base::FilePath app_data_path;
+  if (base::PathService::Get(base::DIR_ANDROID_APP_DATA, &app_data_path)) {
+    request_block_list_updater_ = std::make_unique<RequestBlockListUpdater>(
+        g_browser_process->shared_url_loader_factory(),
+        HostContentSettingsMapFactory::GetForProfile(profile), app_data_path);
+    request_block_list_updater_->Start(base::Minutes(1));
+  }
 }
 
 int ChromeBrowserMainPartsAndroid::PreEarlyInitialization() {
@@ -18,6 +18,7 @@ class ChildExitObserver;
 }
 
 class ProfileManagerAndroid;
+class RequestBlockListUpdater;
 
 class ChromeBrowserMainPartsAndroid : public ChromeBrowserMainParts {
  public:
@@ -44,6 +45,7 @@ class ChromeBrowserMainPartsAndroid : public ChromeBrowserMainParts {
   std::unique_ptr<crash_reporter::ChildExitObserver> child_exit_observer_;
   std::unique_ptr<android::ChromeBackupWatcher> backup_watcher_;
   std::unique_ptr<ProfileManagerAndroid> profile_manager_android_;
+  std::unique_ptr<RequestBlockListUpdater> request_block_list_updater_;
 };
 
 #endif  // CHROME_BROWSER_CHROME_BROWSER_MAIN_ANDROID_H_
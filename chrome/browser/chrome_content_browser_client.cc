@@ -16,6 +16,8 @@
 #include "base/callback.h"
 #include "base/command_line.h"
 #include "base/dcheck_is_on.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
 #include "base/i18n/base_i18n_switches.h"
 #include "base/i18n/character_encoding.h"
 #include "base/memory/raw_ptr.h"
@@ -397,6 +399,7 @@
 #include "chrome/browser/android/customtabs/client_data_header_web_contents_observer.h"
 #include "chrome/browser/android/devtools_manager_delegate_android.h"
 #include "chrome/browser/android/ntp/new_tab_page_url_handler.h"
+#include "chrome/browser/android/request_block_list_updater.h"
 #include "chrome/browser/android/service_tab_launcher.h"
 #include "chrome/browser/android/tab_android.h"
 #include "chrome/browser/android/tab_web_contents_delegate_android.h"
@@ -930,6 +933,18 @@ blink::mojom::AutoplayPolicy GetAutoplayPolicyForWebContents(
 int GetCrashSignalFD(const base::CommandLine& command_line) {
   return crashpad::CrashHandlerHost::Get()->GetDeathSignalSocket();
 }
+
+// The compiled request block list installed into the app data directory by
+// RequestBlockListUpdater. It is opened once and kept open, so that every
+// renderer maps the same file and shares its pages; an update takes effect on
+// the next browser start. Invalid if no list was installed yet, in which case
+// renderers use their built-in list.
+const base::File& GetRequestBlockListFile(const base::FilePath& app_data_path) {
+  static const base::NoDestructor<base::File> file(
+      app_data_path.Append(kRequestBlockListFileName),
+      base::File::FLAG_OPEN | base::File::FLAG_READ);
+  return *file;
+}
 #elif BUILDFLAG(IS_POSIX) && !BUILDFLAG(IS_MAC)
 breakpad::CrashHandlerHostLinux* CreateCrashHandlerHost(
     const std::string& process_type) {
@@ -4100,6 +4115,16 @@ void ChromeContentBrowserClient::GetAdditionalMappedFilesForChildProcess(
   base::FilePath app_data_path;
   base::PathService::Get(base::DIR_ANDROID_APP_DATA, &app_data_path);
   DCHECK(!app_data_path.empty());
+
+  if (command_line.GetSwitchValueASCII(switches::kProcessType) ==
+      switches::kRendererProcess) {
+    const base::File& request_block_list =
+        GetRequestBlockListFile(app_data_path);
+    if (request_block_list.IsValid()) {
+      mappings->Share(kRequestBlockListDescriptor,
+                      request_block_list.GetPlatformFile());
+    }
+  }
 #endif  // BUILDFLAG(IS_ANDROID)
   int crash_signal_fd = GetCrashSignalFD(command_line);
   if (crash_signal_fd >= 0) {
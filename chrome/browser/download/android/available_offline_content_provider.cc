@@ -9,10 +9,13 @@
 
 #include "base/base64.h"
 #include "base/bind.h"
+#include "base/containers/lru_cache.h"
 #include "base/memory/ref_counted_memory.h"
+#include "base/memory/weak_ptr.h"
 #include "base/numerics/safe_conversions.h"
 #include "base/strings/strcat.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/supports_user_data.h"
 #include "base/time/time.h"
 #include "chrome/browser/download/android/download_open_source.h"
 #include "chrome/browser/download/android/download_utils.h"
@@ -205,6 +208,54 @@ class ThumbnailFetch {
   size_t callback_count_ = 0;
 };
 
+// Keeps the data URIs of the visuals of the items last listed for a profile.
+// Each error page tends to suggest the same few items, and fetching and PNG
+// encoding their visuals again is what delays the list.
+class VisualsCache : public base::SupportsUserData::Data {
+ public:
+  VisualsCache() = default;
+  VisualsCache(const VisualsCache&) = delete;
+  VisualsCache& operator=(const VisualsCache&) = delete;
+  ~VisualsCache() override = default;
+
+  static VisualsCache* GetOrCreate(Profile* profile) {
+    auto* cache =
+        static_cast<VisualsCache*>(profile->GetUserData(kUserDataKey));
+    if (!cache) {
+      auto new_cache = std::make_unique<VisualsCache>();
+      cache = new_cache.get();
+      profile->SetUserData(kUserDataKey, std::move(new_cache));
+    }
+    return cache;
+  }
+
+  // Returns the cached visuals of |id|, or nullptr.
+  const ThumbnailFetch::VisualsDataUris* Get(
+      const offline_items_collection::ContentId& id) {
+    auto it = cache_.Get(id);
+    return it == cache_.end() ? nullptr : &it->second;
+  }
+
+  // Caches |visuals| of |id| unless there are none, as they may come later.
+  void Put(const offline_items_collection::ContentId& id,
+           const ThumbnailFetch::VisualsDataUris& visuals) {
+    if (!visuals.thumbnail.is_empty() || !visuals.favicon.is_empty())
+      cache_.Put(id, visuals);
+  }
+
+  base::WeakPtr<VisualsCache> GetWeakPtr() {
+    return weak_ptr_factory_.GetWeakPtr();
+  }
+
+ private:
+  static constexpr char kUserDataKey[] = "AvailableOfflineContentVisuals";
+
+  base::LRUCache<offline_items_collection::ContentId,
+                 ThumbnailFetch::VisualsDataUris>
+      cache_{2 * kMaxListItemsToReturn};
+  base::WeakPtrFactory<VisualsCache> weak_ptr_factory_{this};
+};
+
 chrome::mojom::AvailableOfflineContentPtr CreateAvailableOfflineContent(
     const OfflineItem& item,
     ThumbnailFetch::VisualsDataUris visuals_data_uris) {
@@ -310,9 +361,23 @@ void AvailableOfflineContentProvider::ListFinalize(
     selected.resize(kMaxListItemsToReturn);
   }
 
-  std::vector<offline_items_collection::ContentId> selected_ids;
-  for (const OfflineItem& item : selected)
-    selected_ids.push_back(item.id);
+  // Only the visuals that are not cached are fetched. |fetched_indices| maps
+  // each fetched item back to its place in |selected|.
+  VisualsCache* visuals_cache = VisualsCache::GetOrCreate(profile);
+  std::vector<ThumbnailFetch::VisualsDataUris> visuals_data_uris(
+      selected.size());
+  std::vector<offline_items_collection::ContentId> fetched_ids;
+  std::vector<size_t> fetched_indices;
+  for (size_t i = 0; i < selected.size(); ++i) {
+    const ThumbnailFetch::VisualsDataUris* cached =
+        visuals_cache->Get(selected[i].id);
+    if (cached) {
+      visuals_data_uris[i] = *cached;
+    } else {
+      fetched_ids.push_back(selected[i].id);
+      fetched_indices.push_back(i);
+    }
+  }
 
   bool list_visible_by_prefs =
       profile->GetPrefs()->GetBoolean(feed::prefs::kArticlesListVisible);
@@ -320,7 +385,17 @@ void AvailableOfflineContentProvider::ListFinalize(
   auto complete =
       [](AvailableOfflineContentProvider::ListCallback callback,
          std::vector<OfflineItem> selected, bool list_visible_by_prefs,
-         std::vector<ThumbnailFetch::VisualsDataUris> visuals_data_uris) {
+         std::vector<ThumbnailFetch::VisualsDataUris> visuals_data_uris,
+         std::vector<size_t> fetched_indices,
+         base::WeakPtr<VisualsCache> visuals_cache,
+         std::vector<ThumbnailFetch::VisualsDataUris> fetched_data_uris) {
+        for (size_t i = 0; i < fetched_indices.size(); ++i) {
+          const size_t index = fetched_indices[i];
+          if (visuals_cache)
+            visuals_cache->Put(selected[index].id, fetched_data_uris[i]);
+          visuals_data_uris[index] = std::move(fetched_data_uris[i]);
+        }
+
         // Translate OfflineItem to AvailableOfflineContentPtr.
         std::vector<chrome::mojom::AvailableOfflineContentPtr> result;
         for (size_t i = 0; i < selected.size(); ++i) {
@@ -331,10 +406,18 @@ void AvailableOfflineContentProvider::ListFinalize(
         std::move(callback).Run(list_visible_by_prefs, std::move(result));
       };
 
-  ThumbnailFetch::Start(
-      aggregator, selected_ids,
+  auto bound_complete =
       base::BindOnce(complete, std::move(callback), std::move(selected),
-                     list_visible_by_prefs));
+                     list_visible_by_prefs, std::move(visuals_data_uris),
+                     std::move(fetched_indices), visuals_cache->GetWeakPtr());
+  // Most error pages have nothing to suggest, or only cached visuals. Reply
+  // right away rather than through the tasks a ThumbnailFetch posts.
+  if (fetched_ids.empty()) {
+    std::move(bound_complete).Run({});
+    return;
+  }
+  ThumbnailFetch::Start(aggregator, std::move(fetched_ids),
+                        std::move(bound_complete));
 }
 
 Profile* AvailableOfflineContentProvider::GetProfile() {
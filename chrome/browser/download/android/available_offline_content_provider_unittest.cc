@@ -262,5 +262,24 @@ TEST_F(AvailableOfflineContentTest, ListVisibilityChanges) {
   EXPECT_TRUE(list_visible_by_prefs);
 }
 
+TEST_F(AvailableOfflineContentTest, VisualsAreCached) {
+  content_provider_->SetItems({UninterestingImageItem(), VideoItem(),
+                               SuggestedOfflinePageItem(), AudioItem(),
+                               OfflinePageItem()});
+  content_provider_->SetVisuals(
+      {{SuggestedOfflinePageItem().id, TestThumbnail()}});
+  auto [list_visible_by_prefs, suggestions] = ListAndWait();
+  ASSERT_EQ(3ul, suggestions.size());
+  const GURL thumbnail_data_uri = suggestions[0]->thumbnail_data_uri;
+  EXPECT_FALSE(thumbnail_data_uri.is_empty());
+
+  // The next list reuses the visuals of the first, even if the provider's
+  // are gone.
+  content_provider_->SetVisuals({});
+  std::tie(list_visible_by_prefs, suggestions) = ListAndWait();
+  ASSERT_EQ(3ul, suggestions.size());
+  EXPECT_EQ(thumbnail_data_uri, suggestions[0]->thumbnail_data_uri);
+}
+
 }  // namespace
 }  // namespace android
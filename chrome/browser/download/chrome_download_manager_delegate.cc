@@ -1261,9 +1261,10 @@ void ChromeDownloadManagerDelegate::GetFileMimeType(
     const base::FilePath& path,
     GetFileMimeTypeCallback callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  // Target determination, and so the download, waits on the result.
   base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()}, base::BindOnce(&GetMimeType, path),
-      std::move(callback));
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&GetMimeType, path), std::move(callback));
 }
 
 #if BUILDFLAG(FULL_SAFE_BROWSING)
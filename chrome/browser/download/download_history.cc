@@ -36,6 +36,7 @@
 #include "base/memory/ptr_util.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/observer_list.h"
+#include "base/time/time.h"
 #include "build/build_config.h"
 #include "chrome/browser/download/download_crx_util.h"
 #include "chrome/browser/profiles/profile.h"
@@ -64,6 +65,11 @@ namespace {
 // Max data url size to be stored in history DB.
 const size_t kMaxDataURLSize = 1024u;
 
+// While a download is in progress, an update that only moves its progress is
+// written at most this often, unless this many more bytes have arrived.
+constexpr base::TimeDelta kProgressWriteInterval = base::Seconds(5);
+constexpr int64_t kProgressWriteBytes = 16 * 1024 * 1024;
+
 // If there is a data URL at the end of the url chain, truncate it if it is too
 // long.
 void TruncatedDataUrlAtTheEndIfNeeded(std::vector<GURL>* url_chain) {
@@ -128,11 +134,21 @@ class DownloadHistoryData : public base::SupportsUserData::Data {
     info_.reset();
   }
 
+  // When the row was last written to the database.
+  base::TimeTicks last_write_time() const { return last_write_time_; }
+  void set_last_write_time(base::TimeTicks time) { last_write_time_ = time; }
+
+  // The number of progress updates not written since the item was created.
+  int skipped_progress_writes() const { return skipped_progress_writes_; }
+  void increment_skipped_progress_writes() { ++skipped_progress_writes_; }
+
  private:
   static const char kKey[];
 
   PersistenceState state_ = NOT_PERSISTED;
   std::unique_ptr<history::DownloadRow> info_;
+  base::TimeTicks last_write_time_;
+  int skipped_progress_writes_ = 0;
 };
 
 const char DownloadHistoryData::kKey[] =
@@ -233,6 +249,21 @@ ShouldUpdateHistoryResult ShouldUpdateHistory(
   return ShouldUpdateHistoryResult::NO_UPDATE;
 }
 
+// Returns true if |current| differs from |previous| only in how much of the
+// download has been received.
+bool IsProgressOnlyUpdate(const history::DownloadRow& previous,
+                          const history::DownloadRow& current) {
+  if (previous.state != history::DownloadState::IN_PROGRESS ||
+      current.state != history::DownloadState::IN_PROGRESS) {
+    return false;
+  }
+  history::DownloadRow progressed = previous;
+  progressed.received_bytes = current.received_bytes;
+  progressed.download_slice_info = current.download_slice_info;
+  return ShouldUpdateHistory(&progressed, current) ==
+         ShouldUpdateHistoryResult::NO_UPDATE;
+}
+
 // Counts how many times a target file path exists in |rows| and stores
 // the result into |file_path_count|.
 void CountFilePathOccurences(const std::vector<history::DownloadRow>& rows,
@@ -572,18 +603,38 @@ void DownloadHistory::OnDownloadUpdated(content::DownloadManager* manager,
   history::DownloadRow current_info(GetDownloadRow(item));
   ShouldUpdateHistoryResult should_update_result =
       ShouldUpdateHistory(data->info(), current_info);
+  const base::TimeTicks now = base::TimeTicks::Now();
+  // Progress arrives several times a second, and each write of it rewrites
+  // the row and all of its slices. A download resumes fine from an older
+  // received byte count, so progress alone is only written now and then.
+  // |data->info()| then keeps the last written row to diff against.
+  if (should_update_result == ShouldUpdateHistoryResult::UPDATE &&
+      IsProgressOnlyUpdate(*data->info(), current_info) &&
+      now - data->last_write_time() < kProgressWriteInterval &&
+      current_info.received_bytes - data->info()->received_bytes <
+          kProgressWriteBytes &&
+      !item->IsPaused()) {
+    data->increment_skipped_progress_writes();
+    return;
+  }
+
   bool should_update =
       (should_update_result != ShouldUpdateHistoryResult::NO_UPDATE);
   if (should_update) {
     history_->UpdateDownload(
         current_info,
         should_update_result == ShouldUpdateHistoryResult::UPDATE_IMMEDIATELY);
+    data->set_last_write_time(now);
     for (Observer& observer : observers_)
       observer.OnDownloadStored(item, current_info);
   }
   if (item->GetState() == download::DownloadItem::IN_PROGRESS) {
     data->set_info(current_info);
   } else {
+    if (data->info()) {
+      UMA_HISTOGRAM_COUNTS_10000("Download.History.SkippedProgressWrites",
+                                 data->skipped_progress_writes());
+    }
     data->clear_info();
   }
 }
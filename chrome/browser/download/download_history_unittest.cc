@@ -848,6 +848,41 @@ TEST_F(DownloadHistoryTest, CreateHistoryItemInDownloadDB) {
   ExpectDownloadUpdated(row, true);
 }
 
+// Test that progress of an in-progress download is not written on every
+// update. Of in-progress downloads, only save package ones are in history.
+TEST_F(DownloadHistoryTest, ThrottleProgressUpdates) {
+  history::DownloadRow row;
+  InitBasicItem(FILE_PATH_LITERAL("/foo/bar.pdf"), "http://example.com/bar.pdf",
+                "http://example.com/referrer.html",
+                download::DownloadItem::IN_PROGRESS, &row);
+  EXPECT_CALL(item(0), IsSavePackageDownload()).WillRepeatedly(Return(true));
+  EXPECT_CALL(item(0), IsPaused()).WillRepeatedly(Return(false));
+  std::vector<CreateDownloadHistoryEntry> entries = {
+      CreateDownloadHistoryEntry(row)};
+  CreateDownloadHistory(std::move(entries));
+  EXPECT_TRUE(DownloadHistory::IsPersisted(&item(0)));
+
+  // The first progress update is written.
+  EXPECT_CALL(item(0), GetReceivedBytes()).WillRepeatedly(Return(200));
+  item(0).NotifyObserversDownloadUpdated();
+  row.received_bytes = 200;
+  ExpectDownloadUpdated(row, false);
+
+  // A small one right after it is not.
+  EXPECT_CALL(item(0), GetReceivedBytes()).WillRepeatedly(Return(300));
+  item(0).NotifyObserversDownloadUpdated();
+  ExpectNoDownloadUpdated();
+
+  // A state change is written right away, with the progress held back.
+  EXPECT_CALL(item(0), GetState())
+      .WillRepeatedly(Return(download::DownloadItem::COMPLETE));
+  EXPECT_CALL(item(0), IsDone()).WillRepeatedly(Return(true));
+  item(0).NotifyObserversDownloadUpdated();
+  row.received_bytes = 300;
+  row.state = history::DownloadState::COMPLETE;
+  ExpectDownloadUpdated(row, false);
+}
+
 // Test that new in-progress download will not be added to history.
 TEST_F(DownloadHistoryTest, CreateInProgressDownload) {
   // Create an in-progress download.
@@ -183,6 +183,37 @@ template <typename ValueType> DownloadQuery::FilterCallback BuildFilter(
                              base::BindRepeating(accessor));
 }
 
+// Reads |in| as the time that TimeToISO8601() formats as it, in milliseconds
+// since the epoch. Returns false for a string TimeToISO8601() would not give,
+// whose order as a string need not be its order in time.
+bool GetAsTimeMsEpoch(const base::Value& in, int64_t* out) {
+  std::string time_str;
+  base::Time time;
+  if (!GetAs(in, &time_str) ||
+      !base::Time::FromUTCString(time_str.c_str(), &time) ||
+      base::TimeToISO8601(time) != time_str) {
+    return false;
+  }
+  *out = (time - base::Time::UnixEpoch()).InMilliseconds();
+  return true;
+}
+
+// Helper for building a Callback to FieldMatches<>() for a time field. The
+// time filters take ISO 8601 strings, and |string_accessor| would format the
+// time of every item for every comparison. A time that formats back to the
+// filter string is instead compared as a number, with the same result.
+DownloadQuery::FilterCallback BuildTimeFilter(
+    const base::Value& value,
+    ComparisonType cmptype,
+    int64_t (*ms_epoch_accessor)(const DownloadItem&),
+    std::string (*string_accessor)(const DownloadItem&)) {
+  int64_t ms_epoch = 0;
+  if (!GetAsTimeMsEpoch(value, &ms_epoch))
+    return BuildFilter<std::string>(value, cmptype, string_accessor);
+  return base::BindRepeating(&FieldMatches<int64_t>, ms_epoch, cmptype,
+                             base::BindRepeating(ms_epoch_accessor));
+}
+
 // Returns true if |accessor.Run(item)| matches |pattern|.
 bool FindRegex(
     RE2* pattern,
@@ -305,17 +336,23 @@ bool DownloadQuery::AddFilter(DownloadQuery::FilterType type,
               AddFilter(base::BindRepeating(&MatchesQuery, query_terms)));
     }
     case FILTER_ENDED_AFTER:
-      return AddFilter(BuildFilter<std::string>(value, GT, &GetEndTime));
+      return AddFilter(BuildTimeFilter(value, GT, &GetEndTimeMsEpoch,
+                                       &GetEndTime));
     case FILTER_ENDED_BEFORE:
-      return AddFilter(BuildFilter<std::string>(value, LT, &GetEndTime));
+      return AddFilter(BuildTimeFilter(value, LT, &GetEndTimeMsEpoch,
+                                       &GetEndTime));
     case FILTER_END_TIME:
-      return AddFilter(BuildFilter<std::string>(value, EQ, &GetEndTime));
+      return AddFilter(BuildTimeFilter(value, EQ, &GetEndTimeMsEpoch,
+                                       &GetEndTime));
     case FILTER_STARTED_AFTER:
-      return AddFilter(BuildFilter<std::string>(value, GT, &GetStartTime));
+      return AddFilter(BuildTimeFilter(value, GT, &GetStartTimeMsEpoch,
+                                       &GetStartTime));
     case FILTER_STARTED_BEFORE:
-      return AddFilter(BuildFilter<std::string>(value, LT, &GetStartTime));
+      return AddFilter(BuildTimeFilter(value, LT, &GetStartTimeMsEpoch,
+                                       &GetStartTime));
     case FILTER_START_TIME:
-      return AddFilter(BuildFilter<std::string>(value, EQ, &GetStartTime));
+      return AddFilter(BuildTimeFilter(value, EQ, &GetStartTimeMsEpoch,
+                                       &GetStartTime));
     case FILTER_TOTAL_BYTES:
       return AddFilter(BuildFilter<double>(value, EQ, &GetTotalBytes));
     case FILTER_TOTAL_BYTES_GREATER:
@@ -524,6 +524,18 @@ TEST_F(DownloadQueryTest, DownloadQueryTest_FilterStartedBefore) {
   ExpectStandardFilterResults();
 }
 
+TEST_F(DownloadQueryTest, DownloadQueryTest_FilterStartedBeforeNonCanonical) {
+  CreateMocks(2);
+  EXPECT_CALL(mock(0), GetStartTime()).WillRepeatedly(Return(
+      base::Time::FromTimeT(kSomeKnownTime + 2)));
+  EXPECT_CALL(mock(1), GetStartTime()).WillRepeatedly(Return(
+      base::Time::FromTimeT(kSomeKnownTime + 4)));
+  // Without milliseconds, the time is compared as a string.
+  AddFilter(DownloadQuery::FILTER_STARTED_BEFORE,
+            std::string(kSomeKnownTime8601) + "3Z");
+  ExpectStandardFilterResults();
+}
+
 TEST_F(DownloadQueryTest, DownloadQueryTest_FilterStartTime) {
   CreateMocks(2);
   EXPECT_CALL(mock(0), GetStartTime()).WillRepeatedly(Return(
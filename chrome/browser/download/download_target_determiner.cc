@@ -9,7 +9,9 @@
 
 #include "base/bind.h"
 #include "base/location.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/rand_util.h"
+#include "base/strings/strcat.h"
 #include "base/strings/stringprintf.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/task/task_runner_util.h"
@@ -137,10 +139,24 @@ DownloadTargetDeterminer::~DownloadTargetDeterminer() {
 }
 
 void DownloadTargetDeterminer::DoLoop() {
+  // Each resumption of DoLoop() ends the step that quit it. The steps that
+  // probe the file system are timed, since the download waits on them.
+  if (timed_state_ != STATE_NONE) {
+    const char* suffix = GetTimedStateHistogramSuffix(timed_state_);
+    if (suffix) {
+      base::UmaHistogramTimes(
+          base::StrCat({"Download.TargetDeterminer.StateTime.", suffix}),
+          base::TimeTicks::Now() - timed_state_start_);
+    }
+    timed_state_ = STATE_NONE;
+  }
+
   Result result = CONTINUE;
   do {
     State current_state = next_state_;
     next_state_ = STATE_NONE;
+    timed_state_ = current_state;
+    timed_state_start_ = base::TimeTicks::Now();
 
     switch (current_state) {
       case STATE_GENERATE_TARGET_PATH:
@@ -192,6 +208,21 @@ void DownloadTargetDeterminer::DoLoop() {
     ScheduleCallbackAndDeleteSelf(download::DOWNLOAD_INTERRUPT_REASON_NONE);
 }
 
+// static
+const char* DownloadTargetDeterminer::GetTimedStateHistogramSuffix(
+    State state) {
+  switch (state) {
+    case STATE_RESERVE_VIRTUAL_PATH:
+      return "ReserveVirtualPath";
+    case STATE_DETERMINE_LOCAL_PATH:
+      return "DetermineLocalPath";
+    case STATE_DETERMINE_MIME_TYPE:
+      return "DetermineMimeType";
+    default:
+      return nullptr;
+  }
+}
+
 DownloadTargetDeterminer::Result
     DownloadTargetDeterminer::DoGenerateTargetPath() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
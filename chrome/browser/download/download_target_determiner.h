@@ -157,6 +157,10 @@ class DownloadTargetDeterminer : public download::DownloadItem::Observer {
   // should not be accessed after calling DoLoop().
   void DoLoop();
 
+  // Returns the histogram suffix for the time taken by |state|, or nullptr if
+  // |state| is not timed.
+  static const char* GetTimedStateHistogramSuffix(State state);
+
   // === Main workflow ===
 
   // Generates an initial target path. This target is based only on the state of
@@ -351,6 +355,10 @@ class DownloadTargetDeterminer : public download::DownloadItem::Observer {
 
   // state
   State next_state_;
+  // The last state that DoLoop() ran, and when it started. Lets DoLoop()
+  // time the asynchronous steps once it is resumed.
+  State timed_state_ = STATE_NONE;
+  base::TimeTicks timed_state_start_;
   DownloadConfirmationReason confirmation_reason_;
   bool should_notify_extensions_;
   bool create_target_directory_;
@@ -94,11 +94,17 @@ int OfflineItemModel::PercentComplete() const {
 
 bool OfflineItemModel::WasUINotified() const {
   const OfflineItemModelData* data =
-      manager_->GetOrCreateOfflineItemModelData(offline_item_->id);
-  return data->was_ui_notified_;
+      manager_->GetOfflineItemModelData(offline_item_->id);
+  return data && data->was_ui_notified_;
 }
 
 void OfflineItemModel::SetWasUINotified(bool was_ui_notified) {
+  // Data is only kept for items that differ from the default, so that listing
+  // many items does not leave an entry behind for each of them.
+  if (!was_ui_notified &&
+      !manager_->GetOfflineItemModelData(offline_item_->id)) {
+    return;
+  }
   OfflineItemModelData* data =
       manager_->GetOrCreateOfflineItemModelData(offline_item_->id);
   data->was_ui_notified_ = was_ui_notified;
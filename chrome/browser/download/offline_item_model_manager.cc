@@ -19,6 +19,12 @@ OfflineItemModelData* OfflineItemModelManager::GetOrCreateOfflineItemModelData(
   return offline_item_model_data_[id].get();
 }
 
+const OfflineItemModelData* OfflineItemModelManager::GetOfflineItemModelData(
+    const ContentId& id) const {
+  auto it = offline_item_model_data_.find(id);
+  return it != offline_item_model_data_.end() ? it->second.get() : nullptr;
+}
+
 void OfflineItemModelManager::RemoveOfflineItemModelData(const ContentId& id) {
   offline_item_model_data_.erase(id);
 }
@@ -34,6 +34,11 @@ class OfflineItemModelManager : public KeyedService {
   // OfflineItemModel will be created and returned.
   OfflineItemModelData* GetOrCreateOfflineItemModelData(const ContentId& id);
 
+  // Returns the OfflineItemModelData for the ContentId, or nullptr if none has
+  // been created. Items without data have the default state.
+  const OfflineItemModelData* GetOfflineItemModelData(
+      const ContentId& id) const;
+
   void RemoveOfflineItemModelData(const ContentId& id);
 
   content::BrowserContext* browser_context() { return browser_context_; }
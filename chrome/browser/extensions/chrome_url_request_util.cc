@@ -8,15 +8,19 @@
 #include <utility>
 
 #include "base/bind.h"
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
+#include "base/no_destructor.h"
 #include "base/path_service.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/task/thread_pool.h"
 #include "chrome/common/chrome_paths.h"
 #include "chrome/common/extensions/chrome_manifest_url_handlers.h"
+#include "content/public/browser/browser_thread.h"
 #include "extensions/browser/component_extension_resource_manager.h"
 #include "extensions/browser/extension_protocols.h"
 #include "extensions/browser/extensions_browser_client.h"
@@ -53,12 +57,84 @@ void DetermineCharset(const std::string& mime_type,
   }
 }
 
+// Keeps the decompressed bytes of recently loaded resources, up to
+// kMaxBytes in total. Compressed resources are decompressed on each
+// ResourceBundle load, and component extensions load the same shared
+// scripts on every page. Emptied on memory pressure.
+class DecompressedResourceCache {
+ public:
+  static constexpr size_t kMaxBytes = 2 * 1024 * 1024;
+
+  DecompressedResourceCache()
+      : memory_pressure_listener_(
+            FROM_HERE,
+            base::BindRepeating(&DecompressedResourceCache::OnMemoryPressure,
+                                base::Unretained(this))) {}
+  DecompressedResourceCache(const DecompressedResourceCache&) = delete;
+  DecompressedResourceCache& operator=(const DecompressedResourceCache&) =
+      delete;
+
+  static DecompressedResourceCache& Get() {
+    static base::NoDestructor<DecompressedResourceCache> cache;
+    return *cache;
+  }
+
+  scoped_refptr<base::RefCountedMemory> Find(int resource_id) {
+    auto it = cache_.Get(resource_id);
+    return it == cache_.end() ? nullptr : it->second;
+  }
+
+  void Add(int resource_id, scoped_refptr<base::RefCountedMemory> bytes) {
+    // A resource of a quarter of the budget would evict most others.
+    if (bytes->size() > kMaxBytes / 4)
+      return;
+    total_bytes_ += bytes->size();
+    cache_.Put(resource_id, std::move(bytes));
+    while (total_bytes_ > kMaxBytes) {
+      auto oldest = cache_.rbegin();
+      total_bytes_ -= oldest->second->size();
+      cache_.Erase(oldest);
+    }
+  }
+
+ private:
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel level) {
+    cache_.Clear();
+    total_bytes_ = 0;
+  }
+
+  using Cache =
+      base::HashingLRUCache<int, scoped_refptr<base::RefCountedMemory>>;
+  Cache cache_{Cache::NO_AUTO_EVICT};
+  size_t total_bytes_ = 0;
+  base::MemoryPressureListener memory_pressure_listener_;
+};
+
+// Returns the bytes of |resource_id|, from DecompressedResourceCache if the
+// resource is compressed.
+scoped_refptr<base::RefCountedMemory> LoadDataResourceBytes(int resource_id) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  const ui::ResourceBundle& rb = ui::ResourceBundle::GetSharedInstance();
+  if (!rb.IsGzipped(resource_id) && !rb.IsBrotli(resource_id))
+    return rb.LoadDataResourceBytes(resource_id);
+
+  DecompressedResourceCache& cache = DecompressedResourceCache::Get();
+  scoped_refptr<base::RefCountedMemory> bytes = cache.Find(resource_id);
+  if (bytes)
+    return bytes;
+
+  bytes = rb.LoadDataResourceBytes(resource_id);
+  if (bytes)
+    cache.Add(resource_id, bytes);
+  return bytes;
+}
+
 scoped_refptr<base::RefCountedMemory> GetResource(
     int resource_id,
     const std::string& extension_id) {
-  const ui::ResourceBundle& rb = ui::ResourceBundle::GetSharedInstance();
   scoped_refptr<base::RefCountedMemory> bytes =
-      rb.LoadDataResourceBytes(resource_id);
+      LoadDataResourceBytes(resource_id);
   auto* replacements =
       ExtensionsBrowserClient::Get()->GetComponentExtensionResourceManager()
           ? ExtensionsBrowserClient::Get()
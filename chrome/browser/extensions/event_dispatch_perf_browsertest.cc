@@ -0,0 +1,116 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/strings/stringprintf.h"
+#include "base/timer/elapsed_timer.h"
+#include "base/values.h"
+#include "chrome/browser/extensions/extension_browsertest.h"
+#include "content/public/test/browser_test.h"
+#include "extensions/browser/event_router.h"
+#include "extensions/browser/extension_event_histogram_value.h"
+#include "extensions/common/mojom/event_dispatcher.mojom.h"
+#include "extensions/test/extension_test_message_listener.h"
+#include "extensions/test/test_extension_dir.h"
+#include "url/gurl.h"
+
+namespace extensions {
+namespace {
+
+// Like those of api_binding_perf_browsertest.cc, these tests measure the
+// browser side of dispatching events to many extensions and are meant to be
+// run locally. To run them, append the --gtest_also_run_disabled_tests flag
+// to the test executable.
+#define LOCAL_TEST(TestName) DISABLED_##TestName
+
+// Roughly the number of extensions of a heavy user.
+constexpr int kExtensionCount = 24;
+constexpr int kDispatchCount = 1000;
+
+constexpr char kListenerManifest[] =
+    R"({
+         "name": "Event listener %d",
+         "version": "0",
+         "manifest_version": 2,
+         "background": {"scripts": ["background.js"], "persistent": true},
+         "permissions": ["tabs", "webNavigation"]
+       })";
+
+constexpr char kListenerBackground[] =
+    R"(chrome.tabs.onUpdated.addListener(() => {});
+       chrome.webNavigation.onCompleted.addListener(
+           () => {}, {url: [{hostSuffix: 'example.com'}]});
+       chrome.webNavigation.onCommitted.addListener(
+           () => {}, {url: [{pathContains: 'article'}]});
+       chrome.test.sendMessage('ready');)";
+
+class EventDispatchPerfBrowserTest : public ExtensionBrowserTest {
+ public:
+  EventDispatchPerfBrowserTest() = default;
+  EventDispatchPerfBrowserTest(const EventDispatchPerfBrowserTest&) = delete;
+  EventDispatchPerfBrowserTest& operator=(
+      const EventDispatchPerfBrowserTest&) = delete;
+  ~EventDispatchPerfBrowserTest() override = default;
+
+ protected:
+  void LoadListenerExtensions() {
+    for (int i = 0; i < kExtensionCount; ++i) {
+      ExtensionTestMessageListener listener("ready");
+      auto& dir = extension_dirs_.emplace_back(
+          std::make_unique<TestExtensionDir>());
+      dir->WriteManifest(base::StringPrintf(kListenerManifest, i));
+      dir->WriteFile(FILE_PATH_LITERAL("background.js"), kListenerBackground);
+      ASSERT_TRUE(LoadExtension(dir->UnpackedPath()));
+      ASSERT_TRUE(listener.WaitUntilSatisfied());
+    }
+  }
+
+  // Broadcasts |kDispatchCount| events named |event_name|, each for |url|,
+  // and returns the mean time of one broadcast.
+  base::TimeDelta TimeBroadcasts(const std::string& event_name,
+                                 const GURL& url) {
+    EventRouter* event_router = EventRouter::Get(profile());
+    base::ElapsedTimer timer;
+    for (int i = 0; i < kDispatchCount; ++i) {
+      auto filter_info = mojom::EventFilteringInfo::New();
+      filter_info->url = url;
+      event_router->BroadcastEvent(std::make_unique<Event>(
+          events::FOR_TEST, event_name, base::Value::List(), profile(), GURL(),
+          EventRouter::USER_GESTURE_UNKNOWN, std::move(filter_info)));
+    }
+    return timer.Elapsed() / kDispatchCount;
+  }
+
+ private:
+  std::vector<std::unique_ptr<TestExtensionDir>> extension_dirs_;
+};
+
+IN_PROC_BROWSER_TEST_F(EventDispatchPerfBrowserTest,
+                       LOCAL_TEST(UnfilteredEventToManyExtensions)) {
+  LoadListenerExtensions();
+  base::TimeDelta time_per_event =
+      TimeBroadcasts("tabs.onUpdated", GURL("https://www.example.com/"));
+  LOG(INFO) << "Dispatched in " << time_per_event.InMicrosecondsF()
+            << " us per event";
+}
+
+IN_PROC_BROWSER_TEST_F(EventDispatchPerfBrowserTest,
+                       LOCAL_TEST(FilteredEventsForOneURL)) {
+  LoadListenerExtensions();
+  // The webNavigation events of one navigation are for the same URL.
+  const GURL url("https://news.example.com/article/1");
+  base::TimeDelta time_per_event =
+      (TimeBroadcasts("webNavigation.onCommitted", url) +
+       TimeBroadcasts("webNavigation.onCompleted", url)) /
+      2;
+  LOG(INFO) << "Dispatched in " << time_per_event.InMicrosecondsF()
+            << " us per event";
+}
+
+}  // namespace
+}  // namespace extensions
@@ -21,6 +21,7 @@
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "base/time/time.h"
 #include "chrome/browser/extensions/extension_garbage_collector_factory.h"
@@ -51,15 +52,38 @@ constexpr base::TimeDelta kGarbageCollectRetryDelay = base::Seconds(30);
 // garbage collected.
 constexpr base::TimeDelta kGarbageCollectStartupDelay = base::Seconds(30);
 
+// Directories found to be garbage are moved here, inside the install
+// directory, and deleted later at background priority. Garbage collection
+// skips it when checking the install directory, and posts a separate task
+// that deletes it, including whatever a previous run left there.
+constexpr base::FilePath::CharType kGarbageDirectoryName[] =
+    FILE_PATH_LITERAL("Garbage");
+
 typedef std::multimap<std::string, base::FilePath> ExtensionPathsMultimap;
 
+// Moves |path| into |garbage_dir|, which is on the same volume, so that it
+// is gone from the install directory at the cost of a rename. Deletes |path|
+// right away if it can't be moved.
+void DiscardPath(const base::FilePath& path,
+                 const base::FilePath& garbage_dir) {
+  base::FilePath target_dir;
+  if (base::CreateDirectory(garbage_dir) &&
+      base::CreateTemporaryDirInDir(garbage_dir, FILE_PATH_LITERAL(""),
+                                    &target_dir) &&
+      base::Move(path, target_dir.Append(path.BaseName()))) {
+    return;
+  }
+  base::DeletePathRecursively(path);
+}
+
 void CheckExtensionDirectory(const base::FilePath& path,
-                             const ExtensionPathsMultimap& extension_paths) {
+                             const ExtensionPathsMultimap& extension_paths,
+                             const base::FilePath& garbage_dir) {
   base::FilePath basename = path.BaseName();
   // Clean up temporary files left if Chrome crashed or quit in the middle
   // of an extension install.
   if (basename.value() == file_util::kTempDirectoryName) {
-    base::DeletePathRecursively(path);
+    DiscardPath(path, garbage_dir);
     return;
   }
 
@@ -73,7 +97,7 @@ void CheckExtensionDirectory(const base::FilePath& path,
 
   // Delete directories that aren't valid IDs.
   if (extension_id.empty()) {
-    base::DeletePathRecursively(path);
+    DiscardPath(path, garbage_dir);
     return;
   }
 
@@ -84,7 +108,7 @@ void CheckExtensionDirectory(const base::FilePath& path,
   // move on. This can legitimately happen when an uninstall does not
   // complete, for example, when a plugin is in use at uninstall time.
   if (iter_pair.first == iter_pair.second) {
-    base::DeletePathRecursively(path);
+    DiscardPath(path, garbage_dir);
     return;
   }
 
@@ -102,7 +126,7 @@ void CheckExtensionDirectory(const base::FilePath& path,
       }
     }
     if (!known_version)
-      base::DeletePathRecursively(version_dir);
+      DiscardPath(version_dir, garbage_dir);
   }
 }
 
@@ -159,10 +183,25 @@ void ExtensionGarbageCollector::GarbageCollectExtensionsOnFileThread(
                                   false,  // Not recursive.
                                   base::FileEnumerator::DIRECTORIES);
 
+  const base::FilePath garbage_dir =
+      install_directory.Append(kGarbageDirectoryName);
   for (base::FilePath extension_path = enumerator.Next();
        !extension_path.empty();
        extension_path = enumerator.Next()) {
-    CheckExtensionDirectory(extension_path, extension_paths);
+    if (extension_path != garbage_dir)
+      CheckExtensionDirectory(extension_path, extension_paths, garbage_dir);
+  }
+
+  // Deleting whole extension versions can take a while on slow storage. It
+  // doesn't need the extension file sequence, which installs and loads wait
+  // on, so it is left to a background task. Whatever is left at shutdown is
+  // deleted by the next run.
+  if (base::DirectoryExists(garbage_dir)) {
+    base::ThreadPool::PostTask(
+        FROM_HERE,
+        {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+         base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN},
+        base::GetDeletePathRecursivelyCallback(garbage_dir));
   }
 }
 
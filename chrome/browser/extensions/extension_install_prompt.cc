@@ -659,10 +659,10 @@ class CloseDialogCallbackWrapper
            bool success,
            const std::u16string& user_input) {
     if (success) {
-      LOG(INFO) << "[EXTENSIONS] We received result from extension dialog (ACCEPTED)";
+      DVLOG(1) << "[EXTENSIONS] We received result from extension dialog (ACCEPTED)";
       std::move(callback_).Run(ExtensionInstallPrompt::DoneCallbackPayload(ExtensionInstallPrompt::Result::ACCEPTED));
     } else {
-      LOG(INFO) << "[EXTENSIONS] We received result from extension dialog (REJECTED)";
+      DVLOG(1) << "[EXTENSIONS] We received result from extension dialog (REJECTED)";
       std::move(callback_).Run(ExtensionInstallPrompt::DoneCallbackPayload(ExtensionInstallPrompt::Result::USER_CANCELED));
     }
   }
@@ -708,7 +708,7 @@ void ExtensionInstallPrompt::ShowConfirmation() {
   prompt_->OnDialogOpened();
 
   if (contents_ && contents_->GetPrimaryMainFrame() != nullptr) {
-    LOG(INFO) << "[EXTENSIONS] contents_ is not empty, displaying prompt";
+    DVLOG(1) << "[EXTENSIONS] contents_ is not empty, displaying prompt";
     scoped_refptr<CloseDialogCallbackWrapper> wrapper = new CloseDialogCallbackWrapper(std::move(done_callback_));
 
     if (permissions_to_display) {
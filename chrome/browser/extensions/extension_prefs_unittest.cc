@@ -11,6 +11,7 @@
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/test/bind.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "base/time/time.h"
 #include "base/values.h"
@@ -1393,4 +1394,47 @@ TEST_F(ExtensionPrefsSimpleTest, ExtensionSpecificPrefsMapTest) {
   EXPECT_EQ(time, prefs.prefs()->ReadPrefAsTime(extension_id, kTestTimePref));
 }
 
+// Tests that updates which leave an extension's prefs unchanged do not touch
+// the extensions dictionary, so that they do not cause a Preferences write.
+TEST_F(ExtensionPrefsSimpleTest, UnchangedPrefUpdatesAreDropped) {
+  constexpr PrefMap kTestIntegerPref = {"test.integer", PrefType::kInteger,
+                                        PrefScope::kExtensionSpecific};
+  constexpr char kTestKey[] = "test_key";
+
+  content::BrowserTaskEnvironment task_environment_;
+  TestExtensionPrefs prefs(base::ThreadTaskRunnerHandle::Get());
+  std::string extension_id = prefs.AddExtensionAndReturnId("1");
+
+  int change_count = 0;
+  PrefChangeRegistrar registrar;
+  registrar.Init(prefs.pref_service());
+  registrar.Add(pref_names::kExtensions,
+                base::BindLambdaForTesting([&change_count]() {
+                  ++change_count;
+                }));
+
+  prefs.prefs()->SetIntegerPref(extension_id, kTestIntegerPref, 1);
+  EXPECT_EQ(1, change_count);
+  prefs.prefs()->SetIntegerPref(extension_id, kTestIntegerPref, 1);
+  EXPECT_EQ(1, change_count);
+  prefs.prefs()->SetIntegerPref(extension_id, kTestIntegerPref, 2);
+  EXPECT_EQ(2, change_count);
+
+  prefs.prefs()->UpdateExtensionPref(extension_id, kTestKey,
+                                     std::make_unique<base::Value>("foo"));
+  EXPECT_EQ(3, change_count);
+  prefs.prefs()->UpdateExtensionPref(extension_id, kTestKey,
+                                     std::make_unique<base::Value>("foo"));
+  EXPECT_EQ(3, change_count);
+  prefs.prefs()->UpdateExtensionPref(extension_id, kTestKey, nullptr);
+  EXPECT_EQ(4, change_count);
+  prefs.prefs()->UpdateExtensionPref(extension_id, kTestKey, nullptr);
+  EXPECT_EQ(4, change_count);
+
+  int int_value = 0;
+  EXPECT_TRUE(prefs.prefs()->ReadPrefAsInteger(extension_id, kTestIntegerPref,
+                                               &int_value));
+  EXPECT_EQ(2, int_value);
+}
+
 }  // namespace extensions
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include "base/containers/contains.h"
@@ -40,6 +41,7 @@
 #include "chrome/common/extensions/api/tabs.h"
 #include "chrome/common/url_constants.h"
 #include "components/sessions/content/session_tab_helper.h"
+#include "components/sessions/core/session_id.h"
 #include "components/tab_groups/tab_group_id.h"
 #include "components/url_formatter/url_fixer.h"
 #include "content/public/browser/back_forward_cache.h"
@@ -112,6 +114,21 @@ ExtensionTabUtil::Delegate* GetExtensionTabUtilDelegate() {
   return GetExtensionTabUtilDelegateWrapper().get();
 }
 
+// Where a tab was last seen by GetTabById().
+struct TabLocation {
+  SessionID window_id;
+  int index;
+};
+
+// Maps tab ids to their last known location, so that the repeated lookups of
+// extensions that manage many tabs don't each walk every tab of every window.
+// The entries are only hints, checked against the tab strip before use, and
+// the map is rebuilt whenever one turns out to be stale.
+std::unordered_map<int, TabLocation>& GetTabLocationHints() {
+  static base::NoDestructor<std::unordered_map<int, TabLocation>> hints;
+  return *hints;
+}
+
 ExtensionTabUtil::ScrubTabBehaviorType GetScrubTabBehaviorImpl(
     const Extension* extension,
     Feature::Context context,
@@ -714,28 +731,61 @@ bool ExtensionTabUtil::GetTabById(int tab_id,
       include_incognito
           ? profile->GetPrimaryOTRProfile(/*create_if_needed=*/false)
           : nullptr;
+  auto found_tab = [&](Browser* target_browser, int index) {
+    TabStripModel* target_tab_strip = target_browser->tab_strip_model();
+    if (browser)
+      *browser = target_browser;
+    if (tab_strip)
+      *tab_strip = target_tab_strip;
+    if (contents)
+      *contents = target_tab_strip->GetWebContentsAt(index);
+    if (tab_index)
+      *tab_index = index;
+  };
+
+  std::unordered_map<int, TabLocation>& hints = GetTabLocationHints();
+  auto hint = hints.find(tab_id);
+  if (hint != hints.end()) {
+    for (auto* target_browser : *BrowserList::GetInstance()) {
+      if (target_browser->session_id() != hint->second.window_id)
+        continue;
+      if (target_browser->profile() != profile &&
+          target_browser->profile() != incognito_profile) {
+        break;
+      }
+      TabStripModel* target_tab_strip = target_browser->tab_strip_model();
+      int index = hint->second.index;
+      if (index < target_tab_strip->count() &&
+          sessions::SessionTabHelper::IdForTab(
+              target_tab_strip->GetWebContentsAt(index))
+                  .id() == tab_id) {
+        found_tab(target_browser, index);
+        return true;
+      }
+      break;
+    }
+  }
+
+  // Rebuild the hints while looking, so that lookups of the other tabs hit.
+  hints.clear();
+  bool found = false;
   for (auto* target_browser : *BrowserList::GetInstance()) {
     if (target_browser->profile() == profile ||
         target_browser->profile() == incognito_profile) {
       TabStripModel* target_tab_strip = target_browser->tab_strip_model();
       for (int i = 0; i < target_tab_strip->count(); ++i) {
-        WebContents* target_contents = target_tab_strip->GetWebContentsAt(i);
-        if (sessions::SessionTabHelper::IdForTab(target_contents).id() ==
-            tab_id) {
-          if (browser)
-            *browser = target_browser;
-          if (tab_strip)
-            *tab_strip = target_tab_strip;
-          if (contents)
-            *contents = target_contents;
-          if (tab_index)
-            *tab_index = i;
-          return true;
+        int target_tab_id = sessions::SessionTabHelper::IdForTab(
+                                target_tab_strip->GetWebContentsAt(i))
+                                .id();
+        hints[target_tab_id] = {target_browser->session_id(), i};
+        if (!found && target_tab_id == tab_id) {
+          found_tab(target_browser, i);
+          found = true;
         }
       }
     }
   }
-  return false;
+  return found;
 }
 
 // static
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/base_switches.h"
 #include "base/bind.h"
@@ -423,23 +424,28 @@ bool InstallVerifier::IsVerified(const std::string& id) const {
 void InstallVerifier::BeginFetch() {
   DCHECK(ShouldFetchSignature());
 
-  // TODO(asargent) - It would be possible to coalesce all operations in the
-  // queue into one fetch - we'd probably just need to change the queue to
-  // hold (set of ids, list of operation type) pairs.
+  // All of the queued operations are coalesced into one fetch, so that the
+  // adds and removes requested while the previous one was running (e.g. at
+  // startup) don't each wait for their own round trip.
   CHECK(!operation_queue_.empty());
-  const PendingOperation& operation = *operation_queue_.front();
+  fetched_operation_count_ = operation_queue_.size();
 
   ExtensionIdSet ids_to_sign;
   if (signature_.get()) {
     ids_to_sign.insert(signature_->ids.begin(), signature_->ids.end());
   }
-  if (operation.type == InstallVerifier::REMOVE) {
-    for (auto i = operation.ids.begin(); i != operation.ids.end(); ++i) {
-      if (base::Contains(ids_to_sign, *i))
-        ids_to_sign.erase(*i);
+  // base::queue doesn't allow iteration, so rotate through it once.
+  for (size_t i = 0; i < fetched_operation_count_; ++i) {
+    std::unique_ptr<PendingOperation> operation =
+        std::move(operation_queue_.front());
+    operation_queue_.pop();
+    if (operation->type == InstallVerifier::REMOVE) {
+      for (const std::string& id : operation->ids)
+        ids_to_sign.erase(id);
+    } else {  // All other operation types are some form of "ADD".
+      ids_to_sign.insert(operation->ids.begin(), operation->ids.end());
     }
-  } else {  // All other operation types are some form of "ADD".
-    ids_to_sign.insert(operation.ids.begin(), operation.ids.end());
+    operation_queue_.push(std::move(operation));
   }
 
   auto url_loader_factory = context_->GetDefaultStoragePartition()
@@ -473,9 +479,12 @@ void InstallVerifier::SaveToPrefs() {
 
 void InstallVerifier::SignatureCallback(
     std::unique_ptr<InstallSignature> signature) {
-  std::unique_ptr<PendingOperation> operation =
-      std::move(operation_queue_.front());
-  operation_queue_.pop();
+  std::vector<std::unique_ptr<PendingOperation>> operations;
+  for (size_t i = 0; i < fetched_operation_count_; ++i) {
+    operations.push_back(std::move(operation_queue_.front()));
+    operation_queue_.pop();
+  }
+  fetched_operation_count_ = 0;
 
   bool success = signature.get() && InstallSigner::VerifySignature(*signature);
   if (success) {
@@ -491,7 +500,8 @@ void InstallVerifier::SignatureCallback(
 
   // TODO(asargent) - if this was something like a network error, we need to
   // do retries with exponential back off.
-  OnVerificationComplete(success, operation->type);
+  for (const auto& operation : operations)
+    OnVerificationComplete(success, operation->type);
   if (!operation_queue_.empty())
     BeginFetch();
 }
@@ -145,9 +145,9 @@ class InstallVerifier : public KeyedService,
   // timestamp of our signature.
   bool WasInstalledAfterSignature(const std::string& id) const;
 
-  // Begins the process of fetching a new signature, based on applying the
-  // operation at the head of the queue to the current set of ids in
-  // |signature_| (if any) and then sending a request to sign that.
+  // Begins the process of fetching a new signature, based on applying all of
+  // the queued operations, in order, to the current set of ids in
+  // |signature_| (if any) and then sending one request to sign that.
   void BeginFetch();
 
   // Saves the current value of |signature_| to the prefs;
@@ -174,6 +174,10 @@ class InstallVerifier : public KeyedService,
   // A queue of operations to apply to the current set of allowed ids.
   base::queue<std::unique_ptr<PendingOperation>> operation_queue_;
 
+  // The number of operations at the head of |operation_queue_| that the
+  // running signature request covers.
+  size_t fetched_operation_count_ = 0;
+
   // A set of ids that have been provisionally added, which we're willing to
   // consider allowed until we hear back from the server signature request.
   ExtensionIdSet provisional_;
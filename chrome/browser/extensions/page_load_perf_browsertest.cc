@@ -0,0 +1,278 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "base/bind.h"
+#include "base/command_line.h"
+#include "base/json/json_reader.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/values.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/extensions/extension_browsertest.h"
+#include "chrome/browser/profiles/profile.h"
+#include "chrome/browser/ui/browser.h"
+#include "chrome/browser/ui/tabs/tab_strip_model.h"
+#include "chrome/common/pref_names.h"
+#include "chrome/test/base/ui_test_utils.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/prefs/pref_service.h"
+#include "content/public/browser/web_contents.h"
+#include "content/public/common/content_switches.h"
+#include "content/public/test/browser_test.h"
+#include "content/public/test/browser_test_utils.h"
+#include "extensions/common/extension.h"
+#include "extensions/common/extension_id.h"
+#include "extensions/test/test_extension_dir.h"
+#include "net/dns/mock_host_resolver.h"
+#include "net/test/embedded_test_server/http_request.h"
+#include "net/test/embedded_test_server/http_response.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+namespace extensions {
+namespace {
+
+// Measures page loads of a fixed corpus with each combination of the
+// features Kiwi adds to page loading: ad blocking, forced dark mode and an
+// extension with a content script. Night mode is an Android UI setting with
+// no browser test equivalent. Like the other perf browser tests, these are
+// meant to be run locally. To run them, append the
+// --gtest_also_run_disabled_tests flag to the test executable.
+//
+// The split of the main thread time between the content blocking checks and
+// the rest of Blink is recorded per document as the Kiwi.ContentBlocking UKM
+// event, and can be seen in a trace of the same loads.
+#define LOCAL_TEST(TestName) DISABLED_##TestName
+
+constexpr int kLoadsPerPage = 5;
+
+enum Feature {
+  kAdBlocking = 1 << 0,
+  kForceDarkMode = 1 << 1,
+  kContentScript = 1 << 2,
+};
+constexpr int kAllFeatures = kAdBlocking | kForceDarkMode | kContentScript;
+
+// The hosts of the corpus' third-party scripts, which a block list is
+// expected to match.
+constexpr const char* kAdHosts[] = {
+    "pagead2.googlesyndication.com",
+    "securepubads.g.doubleclick.net",
+    "www.googletagmanager.com",
+};
+
+constexpr char kContentScriptManifest[] =
+    R"({
+         "name": "Page load perf content script",
+         "version": "0",
+         "manifest_version": 2,
+         "content_scripts": [ {
+           "all_frames": true,
+           "matches": [ "<all_urls>" ],
+           "run_at": "document_idle",
+           "js": [ "content_script.js" ]
+         } ]
+       })";
+
+// Walks the document once, as typical content scripts do.
+constexpr char kContentScript[] =
+    R"(let textLength = 0;
+       for (const node of document.querySelectorAll('p, img, div'))
+         textLength += node.textContent.length;)";
+
+// Sends the paint timings, load time and used JS heap of the page as JSON.
+// LCP entries are only delivered to observers, after the page has painted.
+constexpr char kMetricsScript[] =
+    R"(let lcp = 0;
+       new PerformanceObserver(list => {
+         for (const entry of list.getEntries())
+           lcp = entry.startTime;
+       }).observe({type: 'largest-contentful-paint', buffered: true});
+       requestAnimationFrame(() => setTimeout(() => {
+         const fcp = performance.getEntriesByName('first-contentful-paint')[0];
+         const navigation = performance.getEntriesByType('navigation')[0];
+         window.domAutomationController.send(JSON.stringify({
+           fcp: fcp ? fcp.startTime : 0,
+           lcp: lcp,
+           load: navigation.loadEventEnd,
+           heap: performance.memory.usedJSHeapSize,
+         }));
+       }, 100));)";
+
+std::string ArticleBody() {
+  std::string body = "<h1>Benchmark article</h1>";
+  for (int i = 0; i < 100; ++i) {
+    base::StrAppend(&body, {"<p>Paragraph ", base::NumberToString(i),
+                            ". Lorem ipsum dolor sit amet, consectetur "
+                            "adipiscing elit, sed do eiusmod tempor.</p>"});
+    if (i % 10 == 0) {
+      base::StrAppend(&body, {"<img width=600 height=300 src='/image.svg?",
+                              base::NumberToString(i), "'>"});
+    }
+  }
+  return body;
+}
+
+struct Metrics {
+  double fcp_ms = 0;
+  double lcp_ms = 0;
+  double load_ms = 0;
+  double heap_bytes = 0;
+};
+
+class PageLoadPerfBrowserTest : public ExtensionBrowserTest {
+ public:
+  PageLoadPerfBrowserTest() = default;
+  PageLoadPerfBrowserTest(const PageLoadPerfBrowserTest&) = delete;
+  PageLoadPerfBrowserTest& operator=(const PageLoadPerfBrowserTest&) = delete;
+  ~PageLoadPerfBrowserTest() override = default;
+
+  void SetUpCommandLine(base::CommandLine* command_line) override {
+    ExtensionBrowserTest::SetUpCommandLine(command_line);
+    // Unquantized performance.memory values.
+    command_line->AppendSwitch(switches::kEnablePreciseMemoryInfo);
+  }
+
+  void SetUpOnMainThread() override {
+    ExtensionBrowserTest::SetUpOnMainThread();
+    host_resolver()->AddRule("*", "127.0.0.1");
+    embedded_test_server()->RegisterRequestHandler(base::BindRepeating(
+        &PageLoadPerfBrowserTest::HandleRequest, base::Unretained(this)));
+    ASSERT_TRUE(embedded_test_server()->Start());
+  }
+
+ protected:
+  // Loads each page of the corpus with each combination of features and
+  // reports the mean metrics of each.
+  void RunCorpus() {
+    for (int features = 0; features <= kAllFeatures; ++features) {
+      SetFeatures(features);
+      if (HasFatalFailure())
+        return;
+      for (const char* page : {"/article", "/ads"}) {
+        MeasurePage(embedded_test_server()->GetURL("news.example", page),
+                    base::StrCat({page + 1, "_", StoryName(features)}));
+        if (HasFatalFailure())
+          return;
+      }
+    }
+  }
+
+ private:
+  static std::string StoryName(int features) {
+    if (!features)
+      return "Baseline";
+    std::string name;
+    if (features & kAdBlocking)
+      name += "AdBlocking";
+    if (features & kForceDarkMode)
+      name += "DarkMode";
+    if (features & kContentScript)
+      name += "ContentScript";
+    return name;
+  }
+
+  void SetFeatures(int features) {
+    HostContentSettingsMapFactory::GetForProfile(profile())
+        ->SetDefaultContentSetting(ContentSettingsType::ADS,
+                                   features & kAdBlocking
+                                       ? CONTENT_SETTING_BLOCK
+                                       : CONTENT_SETTING_ALLOW);
+    profile()->GetPrefs()->SetBoolean(prefs::kWebKitForceDarkModeEnabled,
+                                      (features & kForceDarkMode) != 0);
+    browser()
+        ->tab_strip_model()
+        ->GetActiveWebContents()
+        ->OnWebPreferencesChanged();
+
+    if ((features & kContentScript) && content_script_extension_id_.empty()) {
+      content_script_dir_.WriteManifest(kContentScriptManifest);
+      content_script_dir_.WriteFile(FILE_PATH_LITERAL("content_script.js"),
+                                    kContentScript);
+      const Extension* extension =
+          LoadExtension(content_script_dir_.UnpackedPath());
+      ASSERT_TRUE(extension);
+      content_script_extension_id_ = extension->id();
+    } else if (!(features & kContentScript) &&
+               !content_script_extension_id_.empty()) {
+      UnloadExtension(content_script_extension_id_);
+      content_script_extension_id_.clear();
+    }
+  }
+
+  void MeasurePage(const GURL& url, const std::string& story) {
+    Metrics total;
+    for (int i = 0; i < kLoadsPerPage; ++i) {
+      ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
+      std::string json;
+      ASSERT_TRUE(content::ExecuteScriptAndExtractString(
+          browser()->tab_strip_model()->GetActiveWebContents(),
+          kMetricsScript, &json));
+      absl::optional<base::Value> value = base::JSONReader::Read(json);
+      ASSERT_TRUE(value && value->is_dict());
+      const base::Value::Dict& dict = value->GetDict();
+      total.fcp_ms += dict.FindDouble("fcp").value_or(0);
+      total.lcp_ms += dict.FindDouble("lcp").value_or(0);
+      total.load_ms += dict.FindDouble("load").value_or(0);
+      total.heap_bytes += dict.FindDouble("heap").value_or(0);
+    }
+
+    perf_test::PerfResultReporter reporter("KiwiPageLoad", story);
+    reporter.RegisterImportantMetric("FirstContentfulPaint", "ms");
+    reporter.RegisterImportantMetric("LargestContentfulPaint", "ms");
+    reporter.RegisterImportantMetric("LoadEventEnd", "ms");
+    reporter.RegisterImportantMetric("UsedJSHeapSize", "bytes");
+    reporter.AddResult("FirstContentfulPaint", total.fcp_ms / kLoadsPerPage);
+    reporter.AddResult("LargestContentfulPaint", total.lcp_ms / kLoadsPerPage);
+    reporter.AddResult("LoadEventEnd", total.load_ms / kLoadsPerPage);
+    reporter.AddResult("UsedJSHeapSize", total.heap_bytes / kLoadsPerPage);
+  }
+
+  // Serves the corpus: an article, the same article with third-party ad
+  // scripts, and its images and scripts.
+  std::unique_ptr<net::test_server::HttpResponse> HandleRequest(
+      const net::test_server::HttpRequest& request) {
+    const std::string path = request.GetURL().path();
+    auto response = std::make_unique<net::test_server::BasicHttpResponse>();
+    if (path == "/article" || path == "/ads") {
+      std::string body = ArticleBody();
+      if (path == "/ads") {
+        for (const char* host : kAdHosts) {
+          base::StrAppend(
+              &body, {"<div class='ad-banner'><script src='",
+                      embedded_test_server()->GetURL(host, "/ad.js").spec(),
+                      "'></script></div>"});
+        }
+      }
+      response->set_content_type("text/html");
+      response->set_content(base::StrCat({"<!doctype html><body>", body}));
+    } else if (path == "/image.svg") {
+      response->set_content_type("image/svg+xml");
+      response->set_content(
+          "<svg xmlns='http://www.w3.org/2000/svg' width='600' height='300'>"
+          "<rect width='600' height='300' fill='#8ab4f8'/></svg>");
+    } else if (path == "/ad.js") {
+      response->set_content_type("text/javascript");
+      response->set_content(
+          "document.currentScript.parentElement.insertAdjacentHTML("
+          "'beforeend', '<iframe width=300 height=250></iframe>');");
+    } else {
+      return nullptr;
+    }
+    return response;
+  }
+
+  TestExtensionDir content_script_dir_;
+  ExtensionId content_script_extension_id_;
+};
+
+IN_PROC_BROWSER_TEST_F(PageLoadPerfBrowserTest, LOCAL_TEST(Corpus)) {
+  RunCorpus();
+}
+
+}  // namespace
+}  // namespace extensions
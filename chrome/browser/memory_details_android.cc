@@ -26,19 +26,19 @@ namespace {
 
 // A helper for |CollectProcessData()| to include the chrome sandboxed
 // processes in android which are not running as a child of the browser
-// process.
+// process. |all_processes| are those of the system.
 void AddNonChildChromeProcesses(
+    const std::vector<ProcessEntry>& all_processes,
     std::vector<ProcessMemoryInformation>* processes) {
-  base::ProcessIterator process_iter(NULL);
-  while (const ProcessEntry* process_entry = process_iter.NextProcessEntry()) {
-    const std::vector<std::string>& cmd_args = process_entry->cmd_line_args();
+  for (const ProcessEntry& process_entry : all_processes) {
+    const std::vector<std::string>& cmd_args = process_entry.cmd_line_args();
     if (cmd_args.empty() ||
         cmd_args[0].find(chrome::kHelperProcessExecutableName) ==
             std::string::npos) {
       continue;
     }
     ProcessMemoryInformation info;
-    info.pid = process_entry->pid();
+    info.pid = process_entry.pid();
     processes->push_back(info);
   }
 }
@@ -115,15 +115,17 @@ void MemoryDetails::CollectProcessData(
   base::ScopedBlockingCall scoped_blocking_call(FROM_HERE,
                                                 base::BlockingType::WILL_BLOCK);
 
-  std::vector<ProcessMemoryInformation> all_processes(chrome_processes);
-  AddNonChildChromeProcesses(&all_processes);
-
+  // Walking /proc reads the stat and command line of every process on the
+  // system, so it is only done once.
   std::vector<ProcessEntry> processes;
   base::ProcessIterator process_iter(NULL);
   while (const ProcessEntry* process_entry = process_iter.NextProcessEntry()) {
     processes.push_back(*process_entry);
   }
 
+  std::vector<ProcessMemoryInformation> all_processes(chrome_processes);
+  AddNonChildChromeProcesses(processes, &all_processes);
+
   std::set<ProcessId> roots;
   roots.insert(base::GetCurrentProcId());
   for (std::vector<ProcessMemoryInformation>::const_iterator
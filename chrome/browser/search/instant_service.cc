@@ -57,6 +57,13 @@
 #include "ui/gfx/color_palette.h"
 #include "ui/gfx/color_utils.h"
 
+namespace {
+
+// How long the Most Visited tiles are considered fresh after a refresh.
+constexpr base::TimeDelta kMostVisitedRefreshInterval = base::Seconds(30);
+
+}  // namespace
+
 InstantService::InstantService(Profile* profile)
     : profile_(profile),
       most_visited_info_(std::make_unique<InstantMostVisitedInfo>()),
@@ -120,12 +127,20 @@ void InstantService::RemoveObserver(InstantServiceObserver* observer) {
 }
 
 void InstantService::OnNewTabPageOpened() {
-  LOG(INFO) << "[Kiwi] InstantService::OnNewTabPageOpened";
-  if (most_visited_sites_) {
-    LOG(INFO) << "[Kiwi] InstantService::OnNewTabPageOpened - most_visited_sites_";
-    most_visited_sites_->Refresh();
-    most_visited_sites_->RefreshTiles();
+  if (!most_visited_sites_)
+    return;
+
+  // The tiles in |most_visited_info_| are kept current by OnURLsAvailable(),
+  // so NTPs opened in quick succession are served from them, and only the
+  // first open after the freshness window forces a sync with history.
+  const base::TimeTicks now = base::TimeTicks::Now();
+  if (!last_most_visited_refresh_.is_null() &&
+      now - last_most_visited_refresh_ < kMostVisitedRefreshInterval) {
+    return;
   }
+  last_most_visited_refresh_ = now;
+  most_visited_sites_->Refresh();
+  most_visited_sites_->RefreshTiles();
 }
 
 void InstantService::OnThemeChanged() {
@@ -221,7 +236,6 @@ void InstantService::OnURLsAvailable(
   // Use only personalized tiles for instant service.
   const ntp_tiles::NTPTilesVector& tiles =
       sections.at(ntp_tiles::SectionType::PERSONALIZED);
-  LOG(INFO) << "[Kiwi] InstantService::OnURLsAvailable - tiles: " << tiles.size();
   for (const ntp_tiles::NTPTile& tile : tiles) {
     InstantMostVisitedItem item;
     item.url = tile.url;
@@ -236,7 +250,6 @@ void InstantService::OnURLsAvailable(
 void InstantService::OnIconMadeAvailable(const GURL& site_url) {}
 
 void InstantService::NotifyAboutMostVisitedInfo() {
-  LOG(INFO) << "[Kiwi] InstantService::NotifyAboutMostVisitedInfo";
   for (InstantServiceObserver& observer : observers_)
     observer.MostVisitedInfoChanged(*most_visited_info_);
 }
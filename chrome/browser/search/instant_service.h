@@ -91,7 +91,7 @@ class InstantService : public KeyedService,
 #endif
 
   // Invoked whenever an NTP is opened. Causes an async refresh of Most Visited
-  // items.
+  // items, unless they were refreshed recently.
   void OnNewTabPageOpened();
 
   // ThemeServiceObserver implementation.
@@ -190,6 +190,9 @@ class InstantService : public KeyedService,
 
   base::TimeTicks background_updated_timestamp_;
 
+  // When OnNewTabPageOpened() last refreshed the Most Visited items.
+  base::TimeTicks last_most_visited_refresh_;
+
   base::WeakPtrFactory<InstantService> weak_ptr_factory_{this};
 };
 
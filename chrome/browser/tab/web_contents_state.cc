@@ -17,6 +17,7 @@
 #include "base/android/jni_string.h"
 #include "base/logging.h"
 #include "base/pickle.h"
+#include "base/strings/string_piece.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/profiles/profile_manager.h"
 #include "chrome/browser/tab/jni_headers/WebContentsStateBridge_jni.h"
@@ -90,15 +91,15 @@ void UpgradeNavigationFromV0ToV2(
     base::PickleIterator* iterator) {
   for (int i = 0; i < entry_count; ++i) {
     base::Pickle v2_pickle;
-    std::string virtual_url_spec;
-    std::string str_referrer;
-    std::u16string title;
-    std::string content_state;
+    base::StringPiece virtual_url_spec;
+    base::StringPiece str_referrer;
+    base::StringPiece16 title;
+    base::StringPiece content_state;
     int transition_type_int;
-    if (!iterator->ReadString(&virtual_url_spec) ||
-        !iterator->ReadString(&str_referrer) ||
-        !iterator->ReadString16(&title) ||
-        !iterator->ReadString(&content_state) ||
+    if (!iterator->ReadStringPiece(&virtual_url_spec) ||
+        !iterator->ReadStringPiece(&str_referrer) ||
+        !iterator->ReadStringPiece16(&title) ||
+        !iterator->ReadStringPiece(&content_state) ||
         !iterator->ReadInt(&transition_type_int))
       return;
 
@@ -127,7 +128,7 @@ void UpgradeNavigationFromV0ToV2(
     base::PickleIterator tab_navigation_pickle_iterator(v2_pickle);
     sessions::SerializedNavigationEntry nav;
     if (nav.ReadFromPickle(&tab_navigation_pickle_iterator)) {
-      navigations->push_back(nav);
+      navigations->push_back(std::move(nav));
     } else {
       LOG(ERROR) << "Failed to read SerializedNavigationEntry from pickle "
                  << "(index=" << i << ", url=" << virtual_url_spec;
@@ -135,9 +136,9 @@ void UpgradeNavigationFromV0ToV2(
   }
 
   for (int i = 0; i < entry_count; ++i) {
-    std::string initial_url;
+    base::StringPiece initial_url;
     bool user_agent_overridden;
-    if (!iterator->ReadString(&initial_url) ||
+    if (!iterator->ReadStringPiece(&initial_url) ||
         !iterator->ReadBool(&user_agent_overridden)) {
       break;
     }
@@ -176,14 +177,14 @@ void UpgradeNavigationFromV1ToV2(
     base::Pickle v2_pickle;
 
     int index;
-    std::string virtual_url_spec;
-    std::u16string title;
-    std::string content_state;
+    base::StringPiece virtual_url_spec;
+    base::StringPiece16 title;
+    base::StringPiece content_state;
     int transition_type_int;
     if (!iterator->ReadInt(&index) ||
-        !iterator->ReadString(&virtual_url_spec) ||
-        !iterator->ReadString16(&title) ||
-        !iterator->ReadString(&content_state) ||
+        !iterator->ReadStringPiece(&virtual_url_spec) ||
+        !iterator->ReadStringPiece16(&title) ||
+        !iterator->ReadStringPiece(&content_state) ||
         !iterator->ReadInt(&transition_type_int))
       return;
 
@@ -199,16 +200,16 @@ void UpgradeNavigationFromV1ToV2(
       continue;
     v2_pickle.WriteInt(type_mask);
 
-    std::string referrer_spec;
-    if (iterator->ReadString(&referrer_spec))
+    base::StringPiece referrer_spec;
+    if (iterator->ReadStringPiece(&referrer_spec))
       v2_pickle.WriteString(referrer_spec);
 
     int policy_int;
     if (iterator->ReadInt(&policy_int))
       v2_pickle.WriteInt(policy_int);
 
-    std::string original_request_url_spec;
-    if (iterator->ReadString(&original_request_url_spec))
+    base::StringPiece original_request_url_spec;
+    if (iterator->ReadStringPiece(&original_request_url_spec))
       v2_pickle.WriteString(original_request_url_spec);
 
     bool is_overriding_user_agent;
@@ -225,7 +226,7 @@ void UpgradeNavigationFromV1ToV2(
     base::PickleIterator tab_navigation_pickle_iterator(v2_pickle);
     sessions::SerializedNavigationEntry nav;
     if (nav.ReadFromPickle(&tab_navigation_pickle_iterator)) {
-      navigations->push_back(nav);
+      navigations->push_back(std::move(nav));
     } else {
       LOG(ERROR) << "Failed to read SerializedNavigationEntry from pickle "
                  << "(index=" << i << ", url=" << virtual_url_spec;
@@ -283,7 +284,7 @@ bool ExtractNavigationEntries(
       if (!nav.ReadFromPickle(&tab_navigation_pickle_iterator))
         return false;  // If we failed to read a navigation, give up on others.
 
-      navigations->push_back(nav);
+      navigations->push_back(std::move(nav));
     }
   }
 
@@ -295,6 +296,55 @@ bool ExtractNavigationEntries(
   return true;
 }
 
+// Extracts only the current navigation entry from the given Pickle data and
+// returns whether un-pickling it succeeded. From version 2, each entry is its
+// own pickle, so the entries before the current one are skipped unread and
+// those after it are not reached.
+bool ExtractCurrentNavigationEntry(void* data,
+                                   int size,
+                                   int saved_state_version,
+                                   sessions::SerializedNavigationEntry* nav) {
+  bool is_off_the_record;
+  int current_entry_index;
+  if (saved_state_version < 2) {
+    std::vector<sessions::SerializedNavigationEntry> navigations;
+    if (!ExtractNavigationEntries(data, size, saved_state_version,
+                                  &is_off_the_record, &current_entry_index,
+                                  &navigations)) {
+      return false;
+    }
+    *nav = std::move(navigations[current_entry_index]);
+    return true;
+  }
+
+  int entry_count;
+  base::Pickle pickle(static_cast<char*>(data), size);
+  base::PickleIterator iter(pickle);
+  if (!iter.ReadBool(&is_off_the_record) || !iter.ReadInt(&entry_count) ||
+      !iter.ReadInt(&current_entry_index)) {
+    LOG(ERROR) << "Failed to restore state from byte array (length=" << size
+               << ").";
+    return false;
+  }
+  if (current_entry_index < 0 || current_entry_index >= entry_count)
+    return false;
+
+  size_t tab_navigation_data_length = 0;
+  const char* tab_navigation_data = nullptr;
+  for (int i = 0; i <= current_entry_index; ++i) {
+    if (!iter.ReadData(&tab_navigation_data, &tab_navigation_data_length)) {
+      LOG(ERROR) << "Failed to restore tab entry from byte array. "
+                 << "(SerializedNavigationEntry size="
+                 << tab_navigation_data_length << ").";
+      return false;
+    }
+  }
+  base::Pickle tab_navigation_pickle(tab_navigation_data,
+                                     tab_navigation_data_length);
+  base::PickleIterator tab_navigation_pickle_iterator(tab_navigation_pickle);
+  return nav->ReadFromPickle(&tab_navigation_pickle_iterator);
+}
+
 ScopedJavaLocalRef<jobject> WriteSerializedNavigationsAsByteBuffer(
     JNIEnv* env,
     bool is_off_the_record,
@@ -454,17 +504,11 @@ ScopedJavaLocalRef<jstring> WebContentsState::GetDisplayTitleFromByteBuffer(
     void* data,
     int size,
     int saved_state_version) {
-  bool is_off_the_record;
-  int current_entry_index;
-  std::vector<sessions::SerializedNavigationEntry> navigations;
-  bool success = ExtractNavigationEntries(data, size, saved_state_version,
-                                          &is_off_the_record,
-                                          &current_entry_index, &navigations);
-  if (!success)
+  sessions::SerializedNavigationEntry nav_entry;
+  if (!ExtractCurrentNavigationEntry(data, size, saved_state_version,
+                                     &nav_entry)) {
     return ScopedJavaLocalRef<jstring>();
-
-  sessions::SerializedNavigationEntry nav_entry =
-      navigations.at(current_entry_index);
+  }
   return ConvertUTF16ToJavaString(env, nav_entry.title());
 }
 
@@ -473,17 +517,11 @@ ScopedJavaLocalRef<jstring> WebContentsState::GetVirtualUrlFromByteBuffer(
     void* data,
     int size,
     int saved_state_version) {
-  bool is_off_the_record;
-  int current_entry_index;
-  std::vector<sessions::SerializedNavigationEntry> navigations;
-  bool success = ExtractNavigationEntries(data, size, saved_state_version,
-                                          &is_off_the_record,
-                                          &current_entry_index, &navigations);
-  if (!success)
+  sessions::SerializedNavigationEntry nav_entry;
+  if (!ExtractCurrentNavigationEntry(data, size, saved_state_version,
+                                     &nav_entry)) {
     return ScopedJavaLocalRef<jstring>();
-
-  sessions::SerializedNavigationEntry nav_entry =
-      navigations.at(current_entry_index);
+  }
   return ConvertUTF8ToJavaString(env, nav_entry.virtual_url().spec());
 }
 
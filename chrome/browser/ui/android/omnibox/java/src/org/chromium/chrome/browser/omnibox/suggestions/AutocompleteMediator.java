@@ -21,6 +21,7 @@ import androidx.annotation.VisibleForTesting;
 import org.chromium.base.ActivityState;
 import org.chromium.base.Callback;
 import org.chromium.base.ThreadUtils;
+import org.chromium.base.TraceEvent;
 import org.chromium.base.jank_tracker.JankScenario;
 import org.chromium.base.jank_tracker.JankTracker;
 import org.chromium.base.metrics.RecordUserAction;
@@ -128,6 +129,11 @@ class AutocompleteMediator implements OnSuggestionsReceivedListener,
     // The timestamp (using SystemClock.elapsedRealtime()) at the point when the user started
     // modifying the omnibox with new input.
     private long mNewOmniboxEditSessionTimestamp = -1;
+    // The timestamp (using SystemClock.elapsedRealtime()) of the most recent text change that has
+    // not yet received its final set of suggestions, or -1 if there is none.
+    private long mLastTextChangeTimestamp = -1;
+    // Whether a set of suggestions was received since the most recent text change.
+    private boolean mSuggestionsReceivedSinceTextChange;
     // Set at the end of the Omnibox interaction to indicate whether the user selected an item
     // from the list (true) or left the Omnibox and suggestions list with no action taken (false).
     private boolean mOmniboxFocusResultedInNavigation;
@@ -662,6 +668,8 @@ class AutocompleteMediator implements OnSuggestionsReceivedListener,
         }
 
         stopAutocomplete(false);
+        mLastTextChangeTimestamp = SystemClock.elapsedRealtime();
+        mSuggestionsReceivedSinceTextChange = false;
         if (TextUtils.isEmpty(textWithoutAutocomplete)) {
             hideSuggestions();
             postAutocompleteRequest(this::startZeroSuggest, SCHEDULE_FOR_IMMEDIATE_EXECUTION);
@@ -696,6 +704,35 @@ class AutocompleteMediator implements OnSuggestionsReceivedListener,
             return;
         }
 
+        try (TraceEvent tracing = TraceEvent.scoped("AutocompleteMediator.onSuggestionsReceived")) {
+            recordTextChangeToSuggestionsTime(isFinal);
+            updateSuggestions(autocompleteResult, inlineAutocompleteText, isFinal);
+        }
+    }
+
+    /**
+     * Records how long the suggestions for the most recent text change took to arrive.
+     *
+     * @param isFinal Whether the suggestions being received are final.
+     */
+    private void recordTextChangeToSuggestionsTime(boolean isFinal) {
+        if (mLastTextChangeTimestamp == -1) return;
+        long elapsedMillis = SystemClock.elapsedRealtime() - mLastTextChangeTimestamp;
+        if (!mSuggestionsReceivedSinceTextChange) {
+            mSuggestionsReceivedSinceTextChange = true;
+            SuggestionsMetrics.recordTextChangeToFirstSuggestionsTime(elapsedMillis);
+        }
+        if (isFinal) {
+            SuggestionsMetrics.recordTextChangeToFinalSuggestionsTime(elapsedMillis);
+            mLastTextChangeTimestamp = -1;
+        }
+    }
+
+    /**
+     * Updates the suggestions list and the URL bar with newly received suggestions.
+     */
+    private void updateSuggestions(
+            AutocompleteResult autocompleteResult, String inlineAutocompleteText, boolean isFinal) {
         if (mShouldCacheSuggestions) {
             CachedZeroSuggestionsManager.saveToCache(autocompleteResult);
         }
@@ -39,6 +39,8 @@ import org.robolectric.shadows.ShadowLooper;
 import org.chromium.base.ActivityState;
 import org.chromium.base.ContextUtils;
 import org.chromium.base.jank_tracker.DummyJankTracker;
+import org.chromium.base.metrics.RecordHistogram;
+import org.chromium.base.metrics.UmaRecorderHolder;
 import org.chromium.base.supplier.ObservableSupplierImpl;
 import org.chromium.base.test.BaseRobolectricTestRunner;
 import org.chromium.base.test.util.JniMocker;
@@ -387,6 +389,33 @@ public class AutocompleteMediatorUnitTest {
                 .start(any(), anyInt(), any(), anyInt(), anyBoolean());
     }
 
+    @Test
+    @SmallTest
+    public void onSuggestionsReceived_recordsTextChangeToSuggestionsTime() {
+        UmaRecorderHolder.resetForTesting();
+        String url = "http://www.example.com";
+        int pageClassification = PageClassification.BLANK_VALUE;
+        setUpLocationBarDataProvider(url, url, pageClassification);
+
+        mMediator.onNativeInitialized();
+        mMediator.onTextChanged("test", "testing");
+        ShadowLooper.runUiThreadTasksIncludingDelayedTasks();
+        mMediator.onSuggestionsReceived(
+                AutocompleteResult.fromCache(mSuggestionsList, null), "", false);
+        mMediator.onSuggestionsReceived(
+                AutocompleteResult.fromCache(mSuggestionsList, null), "", true);
+        // Suggestions that arrive once the final ones are in are not attributed to the change.
+        mMediator.onSuggestionsReceived(
+                AutocompleteResult.fromCache(mSuggestionsList, null), "", true);
+
+        Assert.assertEquals(1,
+                RecordHistogram.getHistogramTotalCountForTesting(
+                        "Android.Omnibox.SuggestionList.TextChangeToFirstSuggestions"));
+        Assert.assertEquals(1,
+                RecordHistogram.getHistogramTotalCountForTesting(
+                        "Android.Omnibox.SuggestionList.TextChangeToFinalSuggestions"));
+    }
+
     @Test
     @SmallTest
     public void onUrlFocusChange_onlyOneZeroSuggestRequestIsInvoked() {
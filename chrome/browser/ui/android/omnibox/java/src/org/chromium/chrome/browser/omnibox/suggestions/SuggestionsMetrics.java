@@ -60,6 +60,28 @@ public class SuggestionsMetrics {
         return TimingMetric.shortThreadTime("Android.Omnibox.SuggestionView.CreateTime2");
     }
 
+    /**
+     * Record the time from a change of the Omnibox text to the first set of suggestions received
+     * for it, including the delay before the autocomplete request is started.
+     *
+     * @param elapsedMillis The elapsed time, in milliseconds.
+     */
+    static final void recordTextChangeToFirstSuggestionsTime(long elapsedMillis) {
+        RecordHistogram.recordTimesHistogram(
+                "Android.Omnibox.SuggestionList.TextChangeToFirstSuggestions", elapsedMillis);
+    }
+
+    /**
+     * Record the time from a change of the Omnibox text to the final set of suggestions received
+     * for it, i.e. once every autocomplete provider is done.
+     *
+     * @param elapsedMillis The elapsed time, in milliseconds.
+     */
+    static final void recordTextChangeToFinalSuggestionsTime(long elapsedMillis) {
+        RecordHistogram.recordTimesHistogram(
+                "Android.Omnibox.SuggestionList.TextChangeToFinalSuggestions", elapsedMillis);
+    }
+
     /**
      * Record whether suggestion view was successfully reused.
      *
@@ -5,6 +5,7 @@
 #include "chrome/browser/ui/android/omnibox/omnibox_view_util.h"
 
 #include "base/android/jni_string.h"
+#include "base/trace_event/trace_event.h"
 #include "chrome/browser/ui/android/omnibox/jni_headers/OmniboxViewUtil_jni.h"
 #include "components/omnibox/browser/omnibox_view.h"
 
@@ -15,6 +16,7 @@ using base::android::ScopedJavaLocalRef;
 ScopedJavaLocalRef<jstring> JNI_OmniboxViewUtil_SanitizeTextForPaste(
     JNIEnv* env,
     const JavaParamRef<jstring>& jtext) {
+  TRACE_EVENT0("omnibox", "JNI_OmniboxViewUtil_SanitizeTextForPaste");
   std::u16string pasted_text(
       base::android::ConvertJavaStringToUTF16(env, jtext));
   pasted_text = OmniboxView::SanitizeTextForPaste(pasted_text);
@@ -4,9 +4,13 @@
 
 #include "chrome/browser/unexpire_flags.h"
 
+#include <utility>
+#include <vector>
+
 #include "base/containers/contains.h"
 #include "base/containers/flat_map.h"
 #include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "chrome/browser/expired_flags_list.h"
 #include "chrome/browser/unexpire_flags_gen.h"
 #include "chrome/common/chrome_version.h"
@@ -23,26 +27,49 @@ static FlagNameToExpirationMap* GetFlagExpirationOverrideMap() {
   return map.get();
 }
 
+using ExpiredFlagsIndex = base::flat_map<base::StringPiece, int>;
+
+ExpiredFlagsIndex MakeExpiredFlagsIndex() {
+  std::vector<std::pair<base::StringPiece, int>> entries;
+  for (int i = 0; kExpiredFlags[i].name; ++i)
+    entries.emplace_back(kExpiredFlags[i].name, kExpiredFlags[i].mstone);
+  // Like a scan of kExpiredFlags, the index keeps the first of duplicates.
+  return ExpiredFlagsIndex(std::move(entries));
+}
+
+// IsFlagExpired() is called for every feature entry whenever flags are
+// converted to switches, so kExpiredFlags is indexed by name on first use
+// rather than scanned for each entry.
+const ExpiredFlagsIndex& GetExpiredFlagsIndex() {
+  static const base::NoDestructor<ExpiredFlagsIndex> index(
+      MakeExpiredFlagsIndex());
+  return *index;
+}
+
 int ExpirationMilestoneForFlag(const char* flag) {
-  if (base::Contains(*GetFlagExpirationOverrideMap(), flag))
-    return GetFlagExpirationOverrideMap()->at(flag);
-  for (int i = 0; kExpiredFlags[i].name; ++i) {
-    const ExpiredFlag* f = &kExpiredFlags[i];
-    if (strcmp(f->name, flag))
-      continue;
-
-    // To keep the size of the expired flags list down,
-    // //tools/flags/generate_expired_flags.py doesn't emit flags with expiry
-    // mstone -1; it makes no sense for these flags to be in the expiry list
-    // anyway. However, if a bug did cause that to happen, and this function
-    // didn't handle that case, all flags with expiration -1 would immediately
-    // expire, which would be very bad. As such there's an extra error-check
-    // here: a DCHECK to catch bugs in the script, and a regular if to ensure we
-    // never expire flags that should never expire.
-    DCHECK_NE(f->mstone, -1);
-    return f->mstone;
+  // Overrides only exist in tests; skip building a std::string otherwise.
+  const FlagNameToExpirationMap& overrides = *GetFlagExpirationOverrideMap();
+  if (!overrides.empty()) {
+    auto override_it = overrides.find(flag);
+    if (override_it != overrides.end())
+      return override_it->second;
   }
-  return -1;
+
+  const ExpiredFlagsIndex& expired_flags = GetExpiredFlagsIndex();
+  auto it = expired_flags.find(flag);
+  if (it == expired_flags.end())
+    return -1;
+
+  // To keep the size of the expired flags list down,
+  // //tools/flags/generate_expired_flags.py doesn't emit flags with expiry
+  // mstone -1; it makes no sense for these flags to be in the expiry list
+  // anyway. However, if a bug did cause that to happen, and this function
+  // didn't handle that case, all flags with expiration -1 would immediately
+  // expire, which would be very bad. As such there's an extra error-check
+  // here: a DCHECK to catch bugs in the script, and a regular if to ensure we
+  // never expire flags that should never expire.
+  DCHECK_NE(it->second, -1);
+  return it->second;
 }
 
 // This function is a nasty hack - normally, the logic to turn flags into
@@ -156,6 +156,7 @@
 #include "third_party/blink/public/web/web_plugin.h"
 #include "third_party/blink/public/web/web_plugin_container.h"
 #include "third_party/blink/public/web/web_plugin_params.h"
+#include "third_party/blink/public/web/web_request_block_list.h"
 #include "third_party/blink/public/web/web_script_controller.h"
 #include "third_party/blink/public/web/web_security_policy.h"
 #include "third_party/blink/public/web/web_view.h"
@@ -167,6 +168,9 @@
 #include "v8/include/v8-isolate.h"
 
 #if BUILDFLAG(IS_ANDROID)
+#include "base/files/file.h"
+#include "base/posix/global_descriptors.h"
+#include "chrome/common/chrome_descriptors.h"
 #include "chrome/renderer/sandbox_status_extension_android.h"
 #include "components/commerce/core/commerce_feature_list.h"
 #include "chrome/renderer/searchbox/searchbox.h"
@@ -425,6 +429,19 @@ void ChromeContentRendererClient::RenderThreadStarted() {
     InitSpellCheck();
 #endif
 
+#if BUILDFLAG(IS_ANDROID)
+  // Use the block list shared by the browser, if any, in place of the one
+  // built into Blink.
+  base::GlobalDescriptors* descriptors = base::GlobalDescriptors::GetInstance();
+  int request_block_list_fd =
+      descriptors->MaybeGet(kRequestBlockListDescriptor);
+  if (request_block_list_fd != -1) {
+    blink::SetRequestBlockListFile(
+        base::File(request_block_list_fd),
+        descriptors->GetRegion(kRequestBlockListDescriptor));
+  }
+#endif
+
   subresource_filter_ruleset_dealer_ =
       std::make_unique<subresource_filter::UnverifiedRulesetDealer>();
 
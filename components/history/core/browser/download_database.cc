@@ -628,13 +628,13 @@ bool DownloadDatabase::UpdateDownload(const DownloadRow& data) {
   if (!statement.Run())
     return false;
 
-  if (data.download_slice_info.size() == 0) {
-    RemoveDownloadSlices(data.id);
-  } else {
-    for (size_t i = 0; i < data.download_slice_info.size(); ++i) {
-      if (!CreateOrUpdateDownloadSlice(data.download_slice_info[i]))
-        return false;
-    }
+  // |download_slice_info| is the whole current layout. Slices that were
+  // merged away or re-split at another offset must not survive to be handed
+  // back on resumption, so the old rows are replaced rather than updated.
+  RemoveDownloadSlices(data.id);
+  for (const DownloadSliceInfo& slice : data.download_slice_info) {
+    if (!CreateOrUpdateDownloadSlice(slice))
+      return false;
   }
 
   if (data.reroute_info_serialized.empty()) {
@@ -21,7 +21,9 @@
 #include "base/location.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/power_monitor/power_monitor.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/timer/elapsed_timer.h"
 #include "build/build_config.h"
 #include "components/favicon/core/favicon_database.h"
 #include "components/history/core/browser/history_backend_client.h"
@@ -108,6 +110,11 @@ class AutoSubframeVisitsReader : public ExpiringVisitsReader {
 // Prevents us from doing too much work any given time.
 const int kNumExpirePerIteration = 32;
 
+// The time one periodic iteration should take at most, including the deletion
+// of the rows that depend on the expired visits. History queries wait behind
+// it on the history sequence.
+constexpr base::TimeDelta kExpirationIterationBudget = base::Milliseconds(50);
+
 // The number of seconds between checking for items that should be expired when
 // we think there might be more items to expire. This timeout is used when the
 // last expiration found at least kNumExpirePerIteration and we want to check
@@ -137,6 +144,13 @@ bool IsAnyURLPinned(HistoryBackendClient* backend_client,
   return false;
 }
 
+// Whether a backlog of expired visits should be worked off slowly, as the
+// device runs on battery.
+bool ShouldDeferExpiration() {
+  return base::PowerMonitor::IsInitialized() &&
+         base::PowerMonitor::IsOnBatteryPower();
+}
+
 }  // namespace
 
 namespace internal {
@@ -150,6 +164,14 @@ constexpr bool kClearOldOnDemandFaviconsEnabled = false;
 
 const int kOnDemandFaviconIsOldAfterDays = 30;
 
+int NextExpirationBatchSize(int batch_size, base::TimeDelta batch_duration) {
+  if (batch_duration > kExpirationIterationBudget)
+    return std::max(1, batch_size / 2);
+  if (batch_duration < kExpirationIterationBudget / 4)
+    return std::min(kNumExpirePerIteration, batch_size * 2);
+  return batch_size;
+}
+
 }  // namespace internal
 
 // ExpireHistoryBackend::DeleteEffects ----------------------------------------
@@ -400,6 +422,8 @@ void ExpireHistoryBackend::StartExpiringOldStuff(
   readers_.push_back(GetAllVisitsReader());
   readers_.push_back(GetAutoSubframeVisitsReader());
 
+  batch_size_ = kNumExpirePerIteration;
+
   // Initialize the queue with all tasks for the first set of iterations.
   InitWorkQueue();
   ScheduleExpire();
@@ -576,6 +600,10 @@ void ExpireHistoryBackend::ScheduleExpire() {
     // schedule next iteration after a longer delay.
     InitWorkQueue();
     delay = base::Minutes(kExpirationEmptyDelayMin);
+  } else if (ShouldDeferExpiration()) {
+    // On battery, spread the remaining iterations out as if there were nothing
+    // left to expire.
+    delay = base::Minutes(kExpirationEmptyDelayMin);
   } else {
     delay = base::Seconds(kExpirationDelaySec);
   }
@@ -607,8 +635,14 @@ void ExpireHistoryBackend::DoExpireIteration() {
   }
 
   const ExpiringVisitsReader* reader = work_queue_.front();
-  bool more_to_expire = ExpireSomeOldHistory(
-      GetCurrentExpirationTime(), reader, kNumExpirePerIteration);
+  base::ElapsedTimer timer;
+  bool more_to_expire =
+      ExpireSomeOldHistory(GetCurrentExpirationTime(), reader, batch_size_);
+  base::TimeDelta iteration_duration = timer.Elapsed();
+  UMA_HISTOGRAM_TIMES("History.ExpireVisits.IterationDuration",
+                      iteration_duration);
+  batch_size_ =
+      internal::NextExpirationBatchSize(batch_size_, iteration_duration);
 
   work_queue_.pop();
   if (more_to_expire) {
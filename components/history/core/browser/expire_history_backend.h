@@ -49,6 +49,12 @@ typedef std::vector<const ExpiringVisitsReader*> ExpiringVisitsReaders;
 namespace internal {
 // The minimum number of days since last use for an icon to be considered old.
 extern const int kOnDemandFaviconIsOldAfterDays;
+
+// Returns the number of visits the next periodic expiration iteration may
+// delete, given the number the last one could delete and how long it took.
+// Iterations over their time budget halve the batch; quick ones let it grow
+// back to the default.
+int NextExpirationBatchSize(int batch_size, base::TimeDelta batch_duration);
 }  // namespace internal
 
 // Helper component to HistoryBackend that manages expiration and deleting of
@@ -281,6 +287,10 @@ class ExpireHistoryBackend {
   // The time at which we expect the expiration code to run.
   base::Time expected_expiration_time_;
 
+  // The number of visits the next periodic iteration may delete. See
+  // internal::NextExpirationBatchSize().
+  int batch_size_ = 0;
+
   // The lastly used threshold for "old" on-demand favicons.
   base::Time last_on_demand_expiration_threshold_;
 
@@ -1367,6 +1367,19 @@ TEST_F(ExpireHistoryTest, DeleteVisitButNotActualReferers) {
   EXPECT_FALSE(main_db_->GetURLRow(url2, &u));
 }
 
+TEST(ExpireHistoryBatchSizeTest, NextExpirationBatchSize) {
+  // Slow iterations halve the batch, down to a single visit.
+  EXPECT_EQ(16, internal::NextExpirationBatchSize(32, base::Seconds(1)));
+  EXPECT_EQ(1, internal::NextExpirationBatchSize(1, base::Seconds(1)));
+
+  // Quick ones grow it back, up to the default of 32.
+  EXPECT_EQ(8, internal::NextExpirationBatchSize(4, base::Milliseconds(1)));
+  EXPECT_EQ(32, internal::NextExpirationBatchSize(32, base::Milliseconds(1)));
+
+  // Others keep it.
+  EXPECT_EQ(8, internal::NextExpirationBatchSize(8, base::Milliseconds(30)));
+}
+
 // TODO(brettw) add some visits with no URL to make sure everything is updated
 // properly. Have the visits also refer to nonexistent FTS rows.
 //
@@ -36,4 +36,16 @@ const base::FeatureParam<bool> kPrivilegeRepeatableQueries(
     "PrivilegeRepeatableQueries",
     false);
 
+// If enabled, the in-memory URL database is first loaded with only the most
+// typed URLs, so that inline autocomplete is usable sooner on large profiles.
+// The rest of the typed URLs are added afterwards in batches.
+const base::Feature kTieredInMemoryDatabaseLoad{
+    "TieredInMemoryDatabaseLoad", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// The number of typed URLs in the first tier of the in-memory URL database.
+const base::FeatureParam<int> kInMemoryDatabaseInitialURLCount(
+    &kTieredInMemoryDatabaseLoad,
+    "InMemoryDatabaseInitialURLCount",
+    2000);
+
 }  // namespace history
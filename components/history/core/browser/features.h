@@ -16,6 +16,10 @@ extern const base::FeatureParam<int> kMaxNumRepeatableQueries;
 extern const base::FeatureParam<bool> kScaleRepeatableQueriesScores;
 extern const base::FeatureParam<bool> kPrivilegeRepeatableQueries;
 
+// Tiered loading of the in-memory URL database.
+extern const base::Feature kTieredInMemoryDatabaseLoad;
+extern const base::FeatureParam<int> kInMemoryDatabaseInitialURLCount;
+
 }  // namespace history
 
 #endif  // COMPONENTS_HISTORY_CORE_BROWSER_FEATURES_H_
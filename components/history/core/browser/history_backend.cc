@@ -41,6 +41,7 @@
 #include "components/favicon/core/favicon_backend.h"
 #include "components/history/core/browser/download_constants.h"
 #include "components/history/core/browser/download_row.h"
+#include "components/history/core/browser/features.h"
 #include "components/history/core/browser/history_backend_client.h"
 #include "components/history/core/browser/history_backend_observer.h"
 #include "components/history/core/browser/history_constants.h"
@@ -159,6 +160,10 @@ const int kExpireDaysThreshold = 60;
 // each time HistoryBackend::GetDomainDiversity() is called.
 constexpr int kDomainDiversityMaxBacktrackedDays = 7;
 
+// The number of typed URLs sent to a partially loaded in-memory backend at a
+// time.
+constexpr size_t kInMemoryBackendBatchSize = 1000;
+
 // An offset that corrects possible error in date/time arithmetic caused by
 // fluctuation of day length due to Daylight Saving Time (DST). For example,
 // given midnight M, its next midnight can be computed as (M + 24 hour
@@ -353,7 +358,7 @@ void HistoryBackend::Closing() {
   CancelScheduledCommit();
 }
 
-#if BUILDFLAG(IS_IOS)
+#if BUILDFLAG(IS_IOS) || BUILDFLAG(IS_ANDROID)
 void HistoryBackend::PersistState() {
   TRACE_EVENT0("browser", "HistoryBackend::PersistState");
   Commit();
@@ -977,10 +982,26 @@ void HistoryBackend::InitImpl(
   // Fill the in-memory database and send it back to the history service on the
   // main thread.
   {
+    size_t max_typed_urls = 0;
+    if (base::FeatureList::IsEnabled(kTieredInMemoryDatabaseLoad)) {
+      max_typed_urls = static_cast<size_t>(
+          std::max(1, kInMemoryDatabaseInitialURLCount.Get()));
+    }
+    TimeTicks mem_backend_load_start = TimeTicks::Now();
     std::unique_ptr<InMemoryHistoryBackend> mem_backend(
         new InMemoryHistoryBackend);
-    if (mem_backend->Init(history_name))
+    if (mem_backend->Init(history_name, max_typed_urls)) {
+      UMA_HISTOGRAM_TIMES("History.InMemoryDBInitialLoadTime",
+                          TimeTicks::Now() - mem_backend_load_start);
+      // The rest of the typed URLs are read from `db_` once it is open.
+      if (!mem_backend->IsFullyLoaded()) {
+        task_runner_->PostTask(
+            FROM_HERE,
+            base::BindOnce(&HistoryBackend::LoadInMemoryBackendBatch, this,
+                           0, mem_backend_load_start));
+      }
       delegate_->SetInMemoryBackend(std::move(mem_backend));
+    }
   }
   db_->BeginExclusiveMode();  // Must be after the mem backend read the data.
 
@@ -1015,6 +1036,27 @@ void HistoryBackend::InitImpl(
   LOCAL_HISTOGRAM_TIMES("History.InitTime", TimeTicks::Now() - beginning_time);
 }
 
+void HistoryBackend::LoadInMemoryBackendBatch(URLID after_id,
+                                              TimeTicks load_start) {
+  if (!db_)
+    return;
+
+  URLRows rows;
+  db_->GetTypedURLsAfterID(after_id, kInMemoryBackendBatchSize, &rows);
+  bool last_batch = rows.size() < kInMemoryBackendBatchSize;
+  URLID last_id = rows.empty() ? after_id : rows.back().id();
+  delegate_->AddTypedURLsToInMemoryBackend(rows, last_batch);
+  if (last_batch) {
+    UMA_HISTOGRAM_MEDIUM_TIMES("History.InMemoryDBFullLoadTime",
+                               TimeTicks::Now() - load_start);
+    return;
+  }
+  // Let other history tasks run between batches.
+  task_runner_->PostTask(
+      FROM_HERE, base::BindOnce(&HistoryBackend::LoadInMemoryBackendBatch,
+                                this, last_id, load_start));
+}
+
 void HistoryBackend::OnMemoryPressure(
     base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
   // TODO(sebmarchand): Check if MEMORY_PRESSURE_LEVEL_MODERATE should also be
@@ -1986,35 +2028,50 @@ void HistoryBackend::QueryHistoryText(const std::u16string& text_query,
                 text_query, options.matching_algorithm.value_or(
                                 query_parser::MatchingAlgorithm::DEFAULT));
 
-  std::vector<URLResult> matching_visits;
+  // Only a page of at most `max_count` visits is returned, so pick the page
+  // from the bare visit rows and only build the results, with their content
+  // annotations, for the visits on it.
+  std::vector<std::pair<size_t, VisitRow>> matching_visits;
   VisitVector visits;  // Declare outside loop to prevent re-construction.
-  for (const auto& text_match : text_matches) {
+  for (size_t i = 0; i < text_matches.size(); ++i) {
     // Get all visits for given URL match.
-    db_->GetVisibleVisitsForURL(text_match.id(), options, &visits);
-    for (const auto& visit : visits) {
-      URLResult url_result(text_match);
-      url_result.set_visit_time(visit.visit_time);
-
-      VisitContentAnnotations content_annotations;
-      db_->GetContentAnnotationsForVisit(visit.visit_id, &content_annotations);
-      url_result.set_content_annotations(content_annotations);
-
-      matching_visits.push_back(url_result);
-    }
+    db_->GetVisibleVisitsForURL(text_matches[i].id(), options, &visits);
+    for (const auto& visit : visits)
+      matching_visits.emplace_back(i, visit);
   }
 
-  std::sort(matching_visits.begin(), matching_visits.end(),
-            URLResult::CompareVisitTime);
-
   size_t max_results = options.max_count == 0
                            ? std::numeric_limits<size_t>::max()
                            : static_cast<int>(options.max_count);
+  auto most_recent_first = [](const std::pair<size_t, VisitRow>& lhs,
+                              const std::pair<size_t, VisitRow>& rhs) {
+    return lhs.second.visit_time > rhs.second.visit_time;
+  };
   bool has_more_results = false;
   if (matching_visits.size() > max_results) {
     has_more_results = true;
+    std::partial_sort(matching_visits.begin(),
+                      matching_visits.begin() + max_results,
+                      matching_visits.end(), most_recent_first);
     matching_visits.resize(max_results);
+  } else {
+    std::sort(matching_visits.begin(), matching_visits.end(),
+              most_recent_first);
+  }
+
+  std::vector<URLResult> page;
+  page.reserve(matching_visits.size());
+  for (const auto& [url_index, visit] : matching_visits) {
+    URLResult url_result(text_matches[url_index]);
+    url_result.set_visit_time(visit.visit_time);
+
+    VisitContentAnnotations content_annotations;
+    db_->GetContentAnnotationsForVisit(visit.visit_id, &content_annotations);
+    url_result.set_content_annotations(content_annotations);
+
+    page.push_back(std::move(url_result));
   }
-  result->SetURLResults(std::move(matching_visits));
+  result->SetURLResults(std::move(page));
 
   if (!has_more_results && options.begin_time <= first_recorded_time_)
     result->set_reached_beginning(true);
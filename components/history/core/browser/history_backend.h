@@ -143,6 +143,12 @@ class HistoryBackend : public base::RefCountedThreadSafe<HistoryBackend>,
     virtual void SetInMemoryBackend(
         std::unique_ptr<InMemoryHistoryBackend> backend) = 0;
 
+    // Sends a batch of the typed URLs that a partially loaded in-memory
+    // backend is missing. `last_batch` is true for the last one. This is only
+    // called after SetInMemoryBackend().
+    virtual void AddTypedURLsToInMemoryBackend(const URLRows& rows,
+                                               bool last_batch) = 0;
+
     // Notify HistoryService that the favicons for the given page URLs (e.g.
     // http://www.google.com) and the given icon URL (e.g.
     // http://www.google.com/favicon.ico) have changed. HistoryService notifies
@@ -225,7 +231,7 @@ class HistoryBackend : public base::RefCountedThreadSafe<HistoryBackend>,
   // actually be deleted.
   void Closing();
 
-#if BUILDFLAG(IS_IOS)
+#if BUILDFLAG(IS_IOS) || BUILDFLAG(IS_ANDROID)
   // Persists any in-flight state, without actually shutting down the history
   // system. This is intended for use when the application is backgrounded.
   void PersistState();
@@ -690,6 +696,11 @@ class HistoryBackend : public base::RefCountedThreadSafe<HistoryBackend>,
   // Does the work of Init.
   void InitImpl(const HistoryDatabaseParams& history_database_params);
 
+  // Sends the typed URLs with an ID greater than `after_id` to the in-memory
+  // backend, one batch per task. `load_start` is when the in-memory backend
+  // started loading.
+  void LoadInMemoryBackendBatch(URLID after_id, base::TimeTicks load_start);
+
   // Called when the system is under memory pressure.
   void OnMemoryPressure(
       base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
@@ -1219,6 +1219,36 @@ TEST_F(HistoryBackendDBTest, DownloadNukeRecordsMissingURLs) {
   }
 }
 
+// Test that slices no longer in a download's layout are dropped on update.
+TEST_F(HistoryBackendDBTest, UpdateDownloadReplacesSlices) {
+  CreateBackendAndDatabase();
+
+  DownloadId id = 1;
+  AddDownload(id, "05AF6C8E-E4E0-45D7-B5CE-BC99F7019918",
+              DownloadState::IN_PROGRESS, base::Time::Now());
+  std::vector<DownloadRow> results;
+  db_->QueryDownloads(&results);
+  ASSERT_EQ(1u, results.size());
+  results[0].download_slice_info.push_back(
+      DownloadSliceInfo(id, 0, 100, false));
+  results[0].download_slice_info.push_back(
+      DownloadSliceInfo(id, 500, 100, false));
+  ASSERT_TRUE(db_->UpdateDownload(results[0]));
+
+  // The second slice was merged into the first.
+  results[0].download_slice_info.clear();
+  results[0].download_slice_info.push_back(
+      DownloadSliceInfo(id, 0, 600, false));
+  ASSERT_TRUE(db_->UpdateDownload(results[0]));
+
+  results.clear();
+  db_->QueryDownloads(&results);
+  ASSERT_EQ(1u, results.size());
+  ASSERT_EQ(1u, results[0].download_slice_info.size());
+  EXPECT_EQ(0, results[0].download_slice_info[0].offset);
+  EXPECT_EQ(600, results[0].download_slice_info[0].received_bytes);
+}
+
 TEST_F(HistoryBackendDBTest, ConfirmDownloadInProgressCleanup) {
   // Create the DB.
   CreateBackendAndDatabase();
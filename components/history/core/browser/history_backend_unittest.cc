@@ -31,12 +31,14 @@
 #include "base/strings/utf_string_conversions.h"
 #include "base/test/gtest_util.h"
 #include "base/test/metrics/histogram_tester.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "base/time/time.h"
 #include "build/build_config.h"
 #include "components/favicon/core/favicon_backend.h"
 #include "components/favicon_base/favicon_usage_data.h"
+#include "components/history/core/browser/features.h"
 #include "components/history/core/browser/history_backend_client.h"
 #include "components/history/core/browser/history_constants.h"
 #include "components/history/core/browser/history_database_params.h"
@@ -142,6 +144,8 @@ class HistoryBackendTestDelegate : public HistoryBackend::Delegate {
                           const std::string& diagnostics) override {}
   void SetInMemoryBackend(
       std::unique_ptr<InMemoryHistoryBackend> backend) override;
+  void AddTypedURLsToInMemoryBackend(const URLRows& rows,
+                                     bool last_batch) override;
   void NotifyFaviconsChanged(const std::set<GURL>& page_urls,
                              const GURL& icon_url) override;
   void NotifyURLVisited(ui::PageTransition transition,
@@ -335,6 +339,12 @@ void HistoryBackendTestDelegate::SetInMemoryBackend(
   test_->SetInMemoryBackend(std::move(backend));
 }
 
+void HistoryBackendTestDelegate::AddTypedURLsToInMemoryBackend(
+    const URLRows& rows,
+    bool last_batch) {
+  test_->mem_backend_->AddTypedURLs(rows, last_batch);
+}
+
 void HistoryBackendTestDelegate::NotifyFaviconsChanged(
     const std::set<GURL>& page_urls,
     const GURL& icon_url) {
@@ -3441,6 +3451,41 @@ TEST_F(InMemoryHistoryBackendTest, OnURLsVisisted) {
       &SimulateNotificationURLVisited, base::Unretained(mem_backend_.get())));
 }
 
+TEST_F(InMemoryHistoryBackendTest, TieredLoad) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeatureWithParameters(
+      kTieredInMemoryDatabaseLoad, {{"InMemoryDatabaseInitialURLCount", "1"}});
+
+  URLRow row1(CreateTestTypedURL());
+  URLRow row2(CreateAnotherTestTypedURL());
+  URLRows rows;
+  rows.push_back(row1);
+  rows.push_back(row2);
+  backend_->AddPagesWithDetails(rows, SOURCE_BROWSED);
+
+  // Reopen the backend so that the in-memory database is loaded from disk.
+  backend_->Closing();
+  backend_ = nullptr;
+  mem_backend_.reset();
+  backend_ = base::MakeRefCounted<TestHistoryBackend>(
+      std::make_unique<HistoryBackendTestDelegate>(this),
+      history_client_.CreateBackendClient(),
+      base::ThreadTaskRunnerHandle::Get());
+  backend_->Init(false, TestHistoryDatabaseParamsForPath(test_dir()));
+
+  // At first, only the most typed URL is loaded.
+  ASSERT_TRUE(mem_backend_);
+  EXPECT_FALSE(mem_backend_->IsFullyLoaded());
+  EXPECT_TRUE(mem_backend_->db()->GetRowForURL(row2.url(), nullptr));
+  EXPECT_FALSE(mem_backend_->db()->GetRowForURL(row1.url(), nullptr));
+
+  // The rest follows in batches.
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(mem_backend_->IsFullyLoaded());
+  EXPECT_TRUE(mem_backend_->db()->GetRowForURL(row1.url(), nullptr));
+  EXPECT_TRUE(mem_backend_->db()->GetRowForURL(row2.url(), nullptr));
+}
+
 TEST_F(InMemoryHistoryBackendTest, OnURLsDeletedPiecewise) {
   // Add two typed and one non-typed URLRow to the in-memory database.
   URLRow row1(CreateTestTypedURL());
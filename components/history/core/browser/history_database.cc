@@ -39,8 +39,8 @@ namespace {
 // Current version number. We write databases at the "current" version number,
 // but any previous version that can read the "compatible" one can make do with
 // our database without *too* many bad effects.
-const int kCurrentVersionNumber = 56;
-const int kCompatibleVersionNumber = 16;
+const int kCurrentVersionNumber = 57;
+const int kCompatibleVersionNumber = 57;
 const char kEarlyExpirationThresholdKey[] = "early_expiration_threshold";
 
 // Logs a migration failure to UMA and logging. The return value will be
@@ -715,6 +715,16 @@ sql::InitStatus HistoryDatabase::EnsureCurrentVersion() {
     meta_table_.SetVersionNumber(cur_version);
   }
 
+  if (cur_version == 56) {
+    if (!MigrateContentAnnotationsInternEntities())
+      return LogMigrationFailure(56);
+    cur_version++;
+    meta_table_.SetVersionNumber(cur_version);
+    // Older versions would read the entity references as entity IDs.
+    meta_table_.SetCompatibleVersionNumber(
+        std::min(cur_version, kCompatibleVersionNumber));
+  }
+
   // =========================       ^^ new migration code goes here ^^
   // ADDING NEW MIGRATION CODE
   // =========================
@@ -91,6 +91,14 @@ class HistoryService::BackendDelegate : public HistoryBackend::Delegate {
                                   history_service_, std::move(backend)));
   }
 
+  void AddTypedURLsToInMemoryBackend(const URLRows& rows,
+                                     bool last_batch) override {
+    service_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&HistoryService::AddTypedURLsToInMemoryBackend,
+                       history_service_, rows, last_batch));
+  }
+
   void NotifyFaviconsChanged(const std::set<GURL>& page_urls,
                              const GURL& icon_url) override {
     // Send the notification to the history service on the main thread.
@@ -175,19 +183,30 @@ bool HistoryService::BackendLoaded() {
   return backend_loaded_;
 }
 
-#if BUILDFLAG(IS_IOS)
+#if BUILDFLAG(IS_IOS) || BUILDFLAG(IS_ANDROID)
 void HistoryService::HandleBackgrounding() {
   TRACE_EVENT0("browser", "HistoryService::HandleBackgrounding");
 
   if (!backend_task_runner_ || !history_backend_.get())
     return;
 
-  ScheduleTask(
-      PRIORITY_NORMAL,
-      base::MakeCriticalClosure(
-          "HistoryService::HandleBackgrounding",
-          base::BindOnce(&HistoryBackend::PersistState, history_backend_.get()),
-          /*is_immediate=*/true));
+  base::OnceClosure persist_state =
+      base::BindOnce(&HistoryBackend::PersistState, history_backend_.get());
+#if BUILDFLAG(IS_IOS)
+  persist_state = base::MakeCriticalClosure(
+      "HistoryService::HandleBackgrounding", std::move(persist_state),
+      /*is_immediate=*/true);
+#endif
+  ScheduleTask(PRIORITY_NORMAL, std::move(persist_state));
+}
+#endif
+
+#if BUILDFLAG(IS_ANDROID)
+void HistoryService::OnApplicationStateChange(
+    base::android::ApplicationState state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (state == base::android::APPLICATION_STATE_HAS_STOPPED_ACTIVITIES)
+    HandleBackgrounding();
 }
 #endif
 
@@ -1083,6 +1102,10 @@ void HistoryService::Cleanup() {
 
   NotifyHistoryServiceBeingDeleted();
 
+#if BUILDFLAG(IS_ANDROID)
+  app_status_listener_.reset();
+#endif
+
   weak_ptr_factory_.InvalidateWeakPtrs();
 
   // Inform the HistoryClient that we are shuting down.
@@ -1132,6 +1155,12 @@ bool HistoryService::Init(
       base::BindRepeating(base::IgnoreResult(&HistoryService::ScheduleDBTask),
                           base::Unretained(this)));
 
+#if BUILDFLAG(IS_ANDROID)
+  app_status_listener_ = base::android::ApplicationStatusListener::New(
+      base::BindRepeating(&HistoryService::OnApplicationStateChange,
+                          base::Unretained(this)));
+#endif
+
   if (visit_delegate_ && !visit_delegate_->Init(this)) {
     // This is rare enough that it's worth logging.
     LOG(WARNING) << "HistoryService::Init() failed by way of "
@@ -1219,6 +1248,13 @@ void HistoryService::SetInMemoryBackend(
   in_memory_backend_->AttachToHistoryService(this);
 }
 
+void HistoryService::AddTypedURLsToInMemoryBackend(const URLRows& rows,
+                                                   bool last_batch) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (in_memory_backend_)
+    in_memory_backend_->AddTypedURLs(rows, last_batch);
+}
+
 void HistoryService::NotifyProfileError(sql::InitStatus init_status,
                                         const std::string& diagnostics) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
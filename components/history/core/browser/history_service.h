@@ -37,6 +37,10 @@
 #include "sql/init_status.h"
 #include "ui/base/page_transition_types.h"
 
+#if BUILDFLAG(IS_ANDROID)
+#include "base/android/application_status_listener.h"
+#endif
+
 class GURL;
 class HistoryQuickProviderTest;
 class HistoryURLProvider;
@@ -113,9 +117,10 @@ class HistoryService : public KeyedService {
   // Returns true if the backend has finished loading.
   bool backend_loaded() const { return backend_loaded_; }
 
-#if BUILDFLAG(IS_IOS)
+#if BUILDFLAG(IS_IOS) || BUILDFLAG(IS_ANDROID)
   // Causes the history backend to commit any in-progress transactions. Called
-  // when the application is being backgrounded.
+  // when the application is being backgrounded. On Android, the service
+  // listens for that itself.
   void HandleBackgrounding();
 #endif
 
@@ -946,6 +951,17 @@ class HistoryService : public KeyedService {
   // database is loaded to make it available.
   void SetInMemoryBackend(std::unique_ptr<InMemoryHistoryBackend> mem_backend);
 
+  // Adds typed URLs that the in-memory URL database was loaded without. This is
+  // called by the backend after SetInMemoryBackend().
+  void AddTypedURLsToInMemoryBackend(const URLRows& rows, bool last_batch);
+
+#if BUILDFLAG(IS_ANDROID)
+  // Calls HandleBackgrounding() once the app has no running activity left.
+  // HistoryBackend commits its open transaction every kCommitIntervalSeconds
+  // only, and a killed app would lose the visits added since.
+  void OnApplicationStateChange(base::android::ApplicationState state);
+#endif
+
   // Called by our BackendDelegate when there is a problem reading the database.
   void NotifyProfileError(sql::InitStatus init_status,
                           const std::string& diagnostics);
@@ -997,6 +1013,11 @@ class HistoryService : public KeyedService {
 
   std::unique_ptr<DeleteDirectiveHandler> delete_directive_handler_;
 
+#if BUILDFLAG(IS_ANDROID)
+  std::unique_ptr<base::android::ApplicationStatusListener>
+      app_status_listener_;
+#endif
+
   base::OnceClosure origin_queried_closure_for_testing_;
 
   // All vended weak pointers are invalidated in Cleanup().
@@ -4,11 +4,13 @@
 
 #include "components/history/core/browser/in_memory_database.h"
 
+#include <string>
 #include <tuple>
 
 #include "base/files/file_path.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/notreached.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/time/time.h"
 #include "build/build_config.h"
@@ -56,7 +58,8 @@ bool InMemoryDatabase::InitFromScratch() {
   return true;
 }
 
-bool InMemoryDatabase::InitFromDisk(const base::FilePath& history_name) {
+bool InMemoryDatabase::InitFromDisk(const base::FilePath& history_name,
+                                    size_t max_typed_urls) {
   if (!InitDB())
     return false;
 
@@ -83,17 +86,29 @@ bool InMemoryDatabase::InitFromDisk(const base::FilePath& history_name) {
   //   "INSERT INTO urls SELECT * FROM history.urls WHERE typed_count > 0"
   // which does not require us to keep the list of columns in sync. However,
   // we may still want to keep the explicit columns as a safety measure.
-  if (!db_.Execute(
+  //
+  // When only some of the typed URLs are copied, they are the ones inline
+  // autocomplete ranks first; see URLDatabase::AutocompleteForPrefix().
+  std::string copy_typed_urls =
       "INSERT INTO urls "
       "(id, url, title, visit_count, typed_count, last_visit_time, hidden) "
       "SELECT "
       "id, url, title, visit_count, typed_count, last_visit_time, hidden "
-      "FROM history.urls WHERE typed_count > 0")) {
+      "FROM history.urls WHERE typed_count > 0";
+  if (max_typed_urls) {
+    copy_typed_urls +=
+        " ORDER BY typed_count DESC, visit_count DESC, last_visit_time DESC "
+        "LIMIT " +
+        base::NumberToString(max_typed_urls);
+  }
+  if (!db_.Execute(copy_typed_urls.c_str())) {
     // Unable to get data from the history database. This is OK, the file may
     // just not exist yet.
   }
-  UMA_HISTOGRAM_COUNTS_1M("History.InMemoryDBItemCount",
-                          db_.GetLastChangeCount());
+  int typed_url_count = db_.GetLastChangeCount();
+  is_partial_ =
+      max_typed_urls && static_cast<size_t>(typed_url_count) >= max_typed_urls;
+  UMA_HISTOGRAM_COUNTS_1M("History.InMemoryDBItemCount", typed_url_count);
 
   // Insert keyword search related URLs.
   if (!db_.Execute("INSERT OR IGNORE INTO urls SELECT u.id, u.url, u.title, "
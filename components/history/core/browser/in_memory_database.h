@@ -33,7 +33,16 @@ class InMemoryDatabase : public URLDatabase {
   // file. Conceptually, the InMemoryHistoryBackend should do the populating
   // after this object does some common initialization, but that would be
   // much slower.
-  bool InitFromDisk(const base::FilePath& history_name);
+  //
+  // If `max_typed_urls` is non-zero, only that many of the most typed URLs are
+  // copied, and is_partial() tells whether some were left out. The keyword
+  // search terms and their URLs are always copied.
+  bool InitFromDisk(const base::FilePath& history_name,
+                    size_t max_typed_urls = 0);
+
+  // Whether InitFromDisk() left out some of the typed URLs. They are added
+  // later by the history backend; see InMemoryHistoryBackend::AddURLRows().
+  bool is_partial() const { return is_partial_; }
 
  protected:
   // Implemented for URLDatabase.
@@ -45,6 +54,7 @@ class InMemoryDatabase : public URLDatabase {
   bool InitDB();
 
   sql::Database db_;
+  bool is_partial_ = false;
 };
 
 }  // namespace history
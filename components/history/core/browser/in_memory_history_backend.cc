@@ -18,9 +18,25 @@ namespace history {
 InMemoryHistoryBackend::InMemoryHistoryBackend() = default;
 InMemoryHistoryBackend::~InMemoryHistoryBackend() = default;
 
-bool InMemoryHistoryBackend::Init(const base::FilePath& history_filename) {
+bool InMemoryHistoryBackend::Init(const base::FilePath& history_filename,
+                                  size_t max_typed_urls) {
   db_ = std::make_unique<InMemoryDatabase>();
-  return db_->InitFromDisk(history_filename);
+  if (!db_->InitFromDisk(history_filename, max_typed_urls))
+    return false;
+  fully_loaded_ = !db_->is_partial();
+  return true;
+}
+
+void InMemoryHistoryBackend::AddTypedURLs(const URLRows& rows,
+                                          bool last_batch) {
+  DCHECK(!fully_loaded_);
+  // The rows were read after any change that was already sent to this
+  // backend, so they may overwrite the copies loaded by Init().
+  if (db_) {
+    for (const auto& row : rows)
+      db_->InsertOrUpdateURLRowByID(row);
+  }
+  fully_loaded_ = last_batch;
 }
 
 void InMemoryHistoryBackend::AttachToHistoryService(
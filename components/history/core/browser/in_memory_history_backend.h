@@ -50,8 +50,18 @@ class InMemoryHistoryBackend : public HistoryServiceObserver {
   ~InMemoryHistoryBackend() override;
 
   // Initializes the backend from the history database pointed to by the
-  // full path in `history_filename`.
-  bool Init(const base::FilePath& history_filename);
+  // full path in `history_filename`. If `max_typed_urls` is non-zero, only
+  // that many of the most typed URLs are loaded; the history backend then
+  // sends the rest through AddTypedURLs().
+  bool Init(const base::FilePath& history_filename, size_t max_typed_urls = 0);
+
+  // Adds a batch of the typed URLs that Init() left out. `last_batch` is true
+  // once all of them have been sent.
+  void AddTypedURLs(const URLRows& rows, bool last_batch);
+
+  // Whether all the typed URLs of the history database have been loaded.
+  // Inline autocomplete may miss some of the less typed URLs until then.
+  bool IsFullyLoaded() const { return fully_loaded_; }
 
   // Does initialization work when this object is attached to the history
   // system on the main thread. The argument is the profile with which the
@@ -92,6 +102,7 @@ class InMemoryHistoryBackend : public HistoryServiceObserver {
   void OnURLVisitedOrModified(const URLRow& url_row);
 
   std::unique_ptr<InMemoryDatabase> db_;
+  bool fully_loaded_ = true;
 
   base::ScopedObservation<HistoryService, HistoryServiceObserver>
       history_service_observation_{this};
@@ -9,6 +9,7 @@
 
 #include "base/callback.h"
 #include "base/observer_list.h"
+#include "base/time/time.h"
 #include "components/history/core/browser/history_types.h"
 #include "components/history/core/browser/top_sites_observer.h"
 #include "components/keyed_service/core/refcounted_keyed_service.h"
@@ -85,6 +86,10 @@ class TopSites : public RefcountedKeyedService {
 
   virtual bool loaded() const = 0;
 
+  // Returns when URLs were last deleted from history, or a null time. Data
+  // derived from history before then may still show the deleted URLs.
+  virtual base::Time GetLastHistoryDeletionTime() const = 0;
+
   // Returns the set of prepopulated pages.
   virtual PrepopulatedPageList GetPrepopulatedPages() = 0;
 
@@ -101,6 +101,15 @@ constexpr base::TimeDelta kDelayForUpdates = base::Minutes(60);
 // TODO(sky): rename actual value to 'most_visited_blocked_urls.'
 const char kBlockedUrlsPrefsKey[] = "ntp.most_visited_blacklist";
 
+// Key for preference holding the time of the last history deletion, so that
+// data derived from history and kept elsewhere, e.g. a snapshot of the New
+// Tab Page tiles, can be dropped even if it was not around for the deletion.
+const char kLastHistoryDeletionPrefsKey[] =
+    "ntp.most_visited_last_history_deletion";
+
+// The domain of the Chrome Web Store, whose pages are left out of the tiles.
+const char kWebStoreDomain[] = "chrome.google.com";
+
 void RecordDBMetrics(const base::TimeTicks db_query_time,
                      const size_t result_size) {
   base::UmaHistogramTimes("History.TopSites.SearchTermsExtractionTime",
@@ -244,6 +253,10 @@ bool TopSitesImpl::loaded() const {
   return loaded_;
 }
 
+base::Time TopSitesImpl::GetLastHistoryDeletionTime() const {
+  return pref_service_->GetTime(kLastHistoryDeletionPrefsKey);
+}
+
 void TopSitesImpl::OnNavigationCommitted(const GURL& url) {
   DCHECK(thread_checker_.CalledOnValidThread());
   if (!loaded_)
@@ -267,6 +280,7 @@ void TopSitesImpl::ShutdownOnUIThread() {
 // static
 void TopSitesImpl::RegisterPrefs(PrefRegistrySimple* registry) {
   registry->RegisterDictionaryPref(kBlockedUrlsPrefsKey);
+  registry->RegisterTimePref(kLastHistoryDeletionPrefsKey, base::Time());
 }
 
 TopSitesImpl::~TopSitesImpl() = default;
@@ -434,7 +448,6 @@ MostVisitedURLList TopSitesImpl::AddMostRepeatedQueries(
 }
 
 bool TopSitesImpl::AddPrepopulatedPages(MostVisitedURLList* urls) const {
-  LOG(INFO) << "[Kiwi] TopSitesImpl::AddPrepopulatedPages: " << prepopulated_pages_.size();
   bool added = false;
   for (const auto& prepopulated_page : prepopulated_pages_) {
     if (urls->size() >= kTopSitesNumber)
@@ -444,16 +457,25 @@ bool TopSitesImpl::AddPrepopulatedPages(MostVisitedURLList* urls) const {
       added = true;
     }
   }
-  LOG(INFO) << "[Kiwi] TopSitesImpl::AddPrepopulatedPages, added: " << added;
   return added;
 }
 
 MostVisitedURLList TopSitesImpl::ApplyBlockedUrls(
     const MostVisitedURLList& urls) {
+  DCHECK(thread_checker_.CalledOnValidThread());
+  // Look the prefs up once, and skip hashing the URLs if none are blocked.
+  const base::Value* blocked_urls =
+      pref_service_->GetDictionary(kBlockedUrlsPrefsKey);
+  if (blocked_urls && blocked_urls->DictEmpty())
+    blocked_urls = nullptr;
+
   MostVisitedURLList result;
   for (const auto& url : urls) {
-    if (IsBlocked(url.url) || url.url.spec().find("chrome.google.com") != std::string::npos)
+    // The web store is never offered as a top site.
+    if (url.url.DomainIs(kWebStoreDomain) ||
+        (blocked_urls && blocked_urls->FindKey(GetURLHash(url.url)))) {
       continue;
+    }
     if (result.size() >= kTopSitesNumber)
       break;
     result.push_back(url);
@@ -505,12 +527,14 @@ void TopSitesImpl::SetTopSites(MostVisitedURLList top_sites,
   if (!should_notify_observers)
     should_notify_observers = DoTitlesDiffer(top_sites_, top_sites);
 
-  // We always do the following steps (setting top sites in cache, and resetting
-  // thread safe cache ...) as this method is invoked during startup at which
-  // point the caches haven't been updated yet.
+  // We always set the top sites in the cache, as this method is invoked during
+  // startup, before loading, at which point the caches haven't been updated
+  // yet. Once loaded, the thread safe cache only needs to be rebuilt when
+  // something changed.
   top_sites_ = std::move(top_sites);
 
-  ResetThreadSafeCache();
+  if (should_notify_observers || !loaded_)
+    ResetThreadSafeCache();
 
   if (should_notify_observers)
     NotifyTopSitesChanged(TopSitesObserver::ChangeReason::MOST_VISITED);
@@ -593,6 +617,8 @@ void TopSitesImpl::OnURLsDeleted(HistoryService* history_service,
   if (!loaded_)
     return;
 
+  pref_service_->SetTime(kLastHistoryDeletionPrefsKey, base::Time::Now());
+
   if (deletion_info.IsAllHistory()) {
     SetTopSites(MostVisitedURLList(), CALL_LOCATION_FROM_OTHER_PLACES);
     backend_->ResetDatabase();
@@ -83,6 +83,7 @@ class TopSitesImpl : public TopSites, public HistoryServiceObserver {
   bool IsFull() override;
   PrepopulatedPageList GetPrepopulatedPages() override;
   bool loaded() const override;
+  base::Time GetLastHistoryDeletionTime() const override;
   void OnNavigationCommitted(const GURL& url) override;
 
   // RefcountedKeyedService:
@@ -696,6 +696,7 @@ TEST_F(TopSitesImplTest, DeleteNotifications) {
 
     ASSERT_EQ(GetPrepopulatedPages().size() + 2, querier.urls().size());
   }
+  EXPECT_TRUE(top_sites()->GetLastHistoryDeletionTime().is_null());
 
   DeleteURL(news_url);
 
@@ -704,6 +705,7 @@ TEST_F(TopSitesImplTest, DeleteNotifications) {
   // The deletion called back to TopSitesImpl (on the main thread), which
   // triggers a history query. Wait for that to complete.
   WaitForHistory();
+  EXPECT_FALSE(top_sites()->GetLastHistoryDeletionTime().is_null());
 
   {
     TopSitesQuerier querier;
@@ -869,6 +871,25 @@ TEST_F(TopSitesImplTest, CancelingRequestsForTopSites) {
   EXPECT_EQ(0, querier2.number_of_callbacks());
 }
 
+// Makes sure the web store is not returned as a top site.
+TEST_F(TopSitesImplTest, WebStoreIsNotReturned) {
+  MostVisitedURLList pages;
+  MostVisitedURL url, web_store;
+  url.url = GURL("http://bbc.com/");
+  pages.push_back(url);
+  web_store.url = GURL("https://chrome.google.com/webstore/");
+  pages.push_back(web_store);
+
+  SetTopSites(pages);
+
+  TopSitesQuerier q;
+  q.QueryTopSites(top_sites(), true);
+  ASSERT_FALSE(q.urls().empty());
+  EXPECT_EQ("http://bbc.com/", q.urls()[0].url.spec());
+  for (const auto& top_site : q.urls())
+    EXPECT_NE(web_store.url, top_site.url);
+}
+
 // Tests variations of blocked urls.
 TEST_F(TopSitesImplTest, BlockedUrlsWithoutPrepopulated) {
   MostVisitedURLList pages;
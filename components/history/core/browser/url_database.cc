@@ -352,6 +352,25 @@ bool URLDatabase::AutocompleteForPrefix(const std::string& prefix,
   return !results->empty();
 }
 
+bool URLDatabase::GetTypedURLsAfterID(URLID after_id,
+                                      size_t max_results,
+                                      URLRows* results) {
+  results->clear();
+  sql::Statement statement(GetDB().GetCachedStatement(
+      SQL_FROM_HERE,
+      "SELECT" HISTORY_URL_ROW_FIELDS "FROM urls "
+      "WHERE id > ? AND typed_count > 0 ORDER BY id LIMIT ?"));
+  statement.BindInt64(0, after_id);
+  statement.BindInt(1, static_cast<int>(max_results));
+
+  while (statement.Step()) {
+    URLRow info;
+    FillURLRow(statement, &info);
+    results->push_back(info);
+  }
+  return !results->empty();
+}
+
 bool URLDatabase::IsTypedHost(const std::string& host, std::string* scheme) {
   const char* schemes[] = {
     url::kHttpScheme,
@@ -415,9 +434,29 @@ URLRows URLDatabase::GetTextMatchesWithAlgorithm(
   query_parser::QueryNodeVector query_nodes;
   query_parser::QueryParser::ParseQueryNodes(query, algorithm, &query_nodes);
 
+  // Each query word is a prefix of a word of a matching URL or title, so the
+  // ASCII ones can be looked for in SQLite first. That saves the lowering and
+  // word extraction below for most rows. Non-ASCII words are left to
+  // DoesQueryMatch(), since SQLite's lower() only folds ASCII and they may
+  // match the decoded IDN host only.
+  std::vector<std::u16string> query_words;
+  query_parser::QueryParser::ParseQueryWords(query, algorithm, &query_words);
+  std::vector<std::string> prefilter_words;
+  for (const auto& word : query_words) {
+    if (base::IsStringASCII(word))
+      prefilter_words.push_back(base::ToLowerASCII(base::UTF16ToASCII(word)));
+  }
+  std::string sql("SELECT" HISTORY_URL_ROW_FIELDS "FROM urls WHERE hidden = 0");
+  for (size_t i = 0; i < prefilter_words.size(); ++i)
+    sql.append(" AND (instr(lower(url), ?) OR instr(lower(title), ?))");
+
   URLRows results;
-  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
-      "SELECT" HISTORY_URL_ROW_FIELDS "FROM urls WHERE hidden = 0"));
+  sql::Statement statement(GetDB().GetUniqueStatement(sql.c_str()));
+  int param = 0;
+  for (const auto& word : prefilter_words) {
+    statement.BindString(param++, word);
+    statement.BindString(param++, word);
+  }
 
   while (statement.Step()) {
     query_parser::QueryWordVector query_words;
@@ -166,6 +166,14 @@ class URLDatabase {
                              bool typed_only,
                              URLRows* results);
 
+  // Fills the given array with up to `max_results` URLs that have been typed at
+  // least once and whose ID is greater than `after_id`, in ID order. Lets the
+  // in-memory database be filled in batches. Returns whether any results were
+  // found.
+  bool GetTypedURLsAfterID(URLID after_id,
+                           size_t max_results,
+                           URLRows* results);
+
   // Returns true if the database holds some past typed navigation to a URL on
   // the provided hostname. If the return value is true and `scheme` is not
   // nullptr, `scheme` holds the scheme of one of the corresponding entries in
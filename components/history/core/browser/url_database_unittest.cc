@@ -600,6 +600,71 @@ TEST_F(URLDatabaseTest, EnumeratorForSignificant) {
   EXPECT_EQ(6, row_count);
 }
 
+TEST_F(URLDatabaseTest, GetTypedURLsAfterID) {
+  URLRow typed1(GURL("http://www.typed1.com/"));
+  typed1.set_typed_count(1);
+  URLID typed1_id = AddURL(typed1);
+  EXPECT_TRUE(typed1_id);
+
+  URLRow not_typed(GURL("http://www.not_typed.com/"));
+  EXPECT_TRUE(AddURL(not_typed));
+
+  URLRow typed2(GURL("http://www.typed2.com/"));
+  typed2.set_typed_count(3);
+  URLID typed2_id = AddURL(typed2);
+  EXPECT_TRUE(typed2_id);
+
+  URLRow typed3(GURL("http://www.typed3.com/"));
+  typed3.set_typed_count(2);
+  URLID typed3_id = AddURL(typed3);
+  EXPECT_TRUE(typed3_id);
+
+  // The URLs come in ID order, in batches of at most `max_results`.
+  URLRows results;
+  EXPECT_TRUE(GetTypedURLsAfterID(0, 2, &results));
+  ASSERT_EQ(2u, results.size());
+  EXPECT_EQ(typed1_id, results[0].id());
+  EXPECT_EQ(typed2_id, results[1].id());
+
+  EXPECT_TRUE(GetTypedURLsAfterID(typed2_id, 2, &results));
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(typed3_id, results[0].id());
+
+  EXPECT_FALSE(GetTypedURLsAfterID(typed3_id, 2, &results));
+  EXPECT_TRUE(results.empty());
+}
+
+TEST_F(URLDatabaseTest, GetTextMatches) {
+  URLRow news(GURL("http://news.example.com/world"));
+  news.set_title(u"World News Today");
+  EXPECT_TRUE(AddURL(news));
+
+  URLRow idn(GURL("http://xn--bcher-kva.de/"));
+  idn.set_title(u"Books");
+  EXPECT_TRUE(AddURL(idn));
+
+  URLRow hidden(GURL("http://news.example.com/hidden"));
+  hidden.set_title(u"Hidden News");
+  hidden.set_hidden(true);
+  EXPECT_TRUE(AddURL(hidden));
+
+  // Words match the URL or the title, regardless of case.
+  URLRows results = GetTextMatches(u"NEWS tod");
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(news.url(), results[0].url());
+
+  results = GetTextMatches(u"world example");
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(news.url(), results[0].url());
+
+  EXPECT_TRUE(GetTextMatches(u"news yesterday").empty());
+
+  // Non-ASCII words still match the decoded host.
+  results = GetTextMatches(u"b\u00fccher");
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(idn.url(), results[0].url());
+}
+
 // Test GetKeywordSearchTermRows and DeleteSearchTerm
 TEST_F(URLDatabaseTest, GetAndDeleteKeywordSearchTermByTerm) {
   URLRow url_info1(GURL("http://www.google.com/"));
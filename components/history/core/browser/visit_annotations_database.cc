@@ -5,6 +5,7 @@
 #include "components/history/core/browser/visit_annotations_database.h"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/logging.h"
@@ -174,6 +175,16 @@ bool VisitAnnotationsDatabase::InitVisitAnnotationsTables() {
     return false;
   }
 
+  // The entity IDs referenced by the entities column of content_annotations.
+  // `ref_count` is the number of references to the entity in that column, so
+  // that unreferenced entities are found without scanning it.
+  if (!GetDB().Execute("CREATE TABLE IF NOT EXISTS content_annotation_entities("
+                       "id INTEGER PRIMARY KEY,"
+                       "entity_id VARCHAR NOT NULL UNIQUE,"
+                       "ref_count INTEGER NOT NULL DEFAULT 0)")) {
+    return false;
+  }
+
   // See `AnnotatedVisitRow` and `VisitContextAnnotations` for details about
   // these fields.
   if (!GetDB().Execute("CREATE TABLE IF NOT EXISTS context_annotations("
@@ -215,6 +226,7 @@ bool VisitAnnotationsDatabase::InitVisitAnnotationsTables() {
 bool VisitAnnotationsDatabase::DropVisitAnnotationsTables() {
   // Dropping the tables will implicitly delete the indices.
   return GetDB().Execute("DROP TABLE content_annotations") &&
+         GetDB().Execute("DROP TABLE content_annotation_entities") &&
          GetDB().Execute("DROP TABLE context_annotations") &&
          GetDB().Execute("DROP TABLE clusters") &&
          GetDB().Execute("DROP TABLE clusters_and_visits");
@@ -239,7 +251,7 @@ void VisitAnnotationsDatabase::AddContentAnnotationsForVisit(
       3, visit_content_annotations.model_annotations.page_topics_model_version);
   statement.BindInt64(4, visit_content_annotations.annotation_flags);
   statement.BindString(
-      5, ConvertCategoriesToStringColumn(
+      5, ConvertEntitiesToStringColumn(
              visit_content_annotations.model_annotations.entities));
   statement.BindString(6, ConvertRelatedSearchesToStringColumn(
                               visit_content_annotations.related_searches));
@@ -281,6 +293,8 @@ void VisitAnnotationsDatabase::UpdateContentAnnotationsForVisit(
     VisitID visit_id,
     const VisitContentAnnotations& visit_content_annotations) {
   DCHECK_GT(visit_id, 0);
+  const std::vector<int64_t> old_entity_references =
+      GetEntityReferencesForVisit(visit_id);
   sql::Statement statement(GetDB().GetCachedStatement(
       SQL_FROM_HERE,
       "UPDATE content_annotations SET "
@@ -300,7 +314,7 @@ void VisitAnnotationsDatabase::UpdateContentAnnotationsForVisit(
       2, visit_content_annotations.model_annotations.page_topics_model_version);
   statement.BindInt64(3, visit_content_annotations.annotation_flags);
   statement.BindString(
-      4, ConvertCategoriesToStringColumn(
+      4, ConvertEntitiesToStringColumn(
              visit_content_annotations.model_annotations.entities));
   statement.BindString(5, ConvertRelatedSearchesToStringColumn(
                               visit_content_annotations.related_searches));
@@ -314,7 +328,9 @@ void VisitAnnotationsDatabase::UpdateContentAnnotationsForVisit(
     DVLOG(0)
         << "Failed to execute visit 'content_annotations' update statement:  "
         << "visit_id = " << visit_id;
+    return;
   }
+  ReleaseEntityReferences(old_entity_references);
 }
 
 bool VisitAnnotationsDatabase::GetContextAnnotationsForVisit(
@@ -368,7 +384,7 @@ bool VisitAnnotationsDatabase::GetContentAnnotationsForVisit(
       statement.ColumnInt64(3);
   out_content_annotations->annotation_flags = statement.ColumnInt64(4);
   out_content_annotations->model_annotations.entities =
-      GetCategoriesFromStringColumn(statement.ColumnString(5));
+      GetEntitiesFromStringColumn(statement.ColumnString(5));
   out_content_annotations->related_searches =
       GetRelatedSearchesFromStringColumn(statement.ColumnString(6));
   out_content_annotations->search_normalized_url =
@@ -381,12 +397,16 @@ bool VisitAnnotationsDatabase::GetContentAnnotationsForVisit(
 void VisitAnnotationsDatabase::DeleteAnnotationsForVisit(VisitID visit_id) {
   sql::Statement statement;
 
+  const std::vector<int64_t> entity_references =
+      GetEntityReferencesForVisit(visit_id);
   statement.Assign(GetDB().GetCachedStatement(
       SQL_FROM_HERE, "DELETE FROM content_annotations WHERE visit_id=?"));
   statement.BindInt64(0, visit_id);
   if (!statement.Run()) {
     DVLOG(0) << "Failed to execute content_annotations delete statement:  "
              << "visit_id = " << visit_id;
+  } else {
+    ReleaseEntityReferences(entity_references);
   }
 
   statement.Assign(GetDB().GetCachedStatement(
@@ -692,4 +712,137 @@ bool VisitAnnotationsDatabase::MigrateContentAnnotationsAddAlternativeTitle() {
       "ADD COLUMN alternative_title");
 }
 
+bool VisitAnnotationsDatabase::MigrateContentAnnotationsInternEntities() {
+  if (!GetDB().DoesTableExist("content_annotations") ||
+      !GetDB().DoesTableExist("content_annotation_entities")) {
+    NOTREACHED() << "Content annotations tables should exist before migration";
+    return false;
+  }
+
+  std::vector<std::pair<VisitID, std::string>> rows;
+  sql::Statement select(GetDB().GetUniqueStatement(
+      "SELECT visit_id,entities FROM content_annotations "
+      "WHERE entities IS NOT NULL AND entities!=''"));
+  while (select.Step())
+    rows.emplace_back(select.ColumnInt64(0), select.ColumnString(1));
+  if (!select.Succeeded())
+    return false;
+
+  sql::Statement update(GetDB().GetUniqueStatement(
+      "UPDATE content_annotations SET entities=? WHERE visit_id=?"));
+  for (const auto& [visit_id, entities] : rows) {
+    update.Reset(true);
+    update.BindString(0, ConvertEntitiesToStringColumn(
+                             GetCategoriesFromStringColumn(entities)));
+    update.BindInt64(1, visit_id);
+    if (!update.Run())
+      return false;
+  }
+  return true;
+}
+
+int64_t VisitAnnotationsDatabase::AddEntityReference(
+    const std::string& entity_id) {
+  sql::Statement select(GetDB().GetCachedStatement(
+      SQL_FROM_HERE,
+      "SELECT id FROM content_annotation_entities WHERE entity_id=?"));
+  select.BindString(0, entity_id);
+  if (select.Step()) {
+    const int64_t reference = select.ColumnInt64(0);
+    sql::Statement update(GetDB().GetCachedStatement(
+        SQL_FROM_HERE,
+        "UPDATE content_annotation_entities SET ref_count=ref_count+1 "
+        "WHERE id=?"));
+    update.BindInt64(0, reference);
+    return update.Run() ? reference : 0;
+  }
+
+  sql::Statement insert(GetDB().GetCachedStatement(
+      SQL_FROM_HERE,
+      "INSERT INTO content_annotation_entities(entity_id,ref_count)"
+      "VALUES(?,1)"));
+  insert.BindString(0, entity_id);
+  if (!insert.Run())
+    return 0;
+  return GetDB().GetLastInsertRowId();
+}
+
+std::vector<int64_t> VisitAnnotationsDatabase::GetEntityReferencesForVisit(
+    VisitID visit_id) {
+  std::vector<int64_t> references;
+  sql::Statement statement(GetDB().GetCachedStatement(
+      SQL_FROM_HERE,
+      "SELECT entities FROM content_annotations WHERE visit_id=?"));
+  statement.BindInt64(0, visit_id);
+  if (!statement.Step())
+    return references;
+
+  for (const auto& entity :
+       GetCategoriesFromStringColumn(statement.ColumnString(0))) {
+    int64_t reference;
+    if (base::StringToInt64(entity.id, &reference))
+      references.push_back(reference);
+  }
+  return references;
+}
+
+void VisitAnnotationsDatabase::ReleaseEntityReferences(
+    const std::vector<int64_t>& references) {
+  sql::Statement update(GetDB().GetCachedStatement(
+      SQL_FROM_HERE,
+      "UPDATE content_annotation_entities SET ref_count=ref_count-1 "
+      "WHERE id=?"));
+  sql::Statement delete_statement(GetDB().GetCachedStatement(
+      SQL_FROM_HERE,
+      "DELETE FROM content_annotation_entities WHERE id=? AND ref_count<=0"));
+  for (int64_t reference : references) {
+    update.Reset(true);
+    update.BindInt64(0, reference);
+    delete_statement.Reset(true);
+    delete_statement.BindInt64(0, reference);
+    if (!update.Run() || !delete_statement.Run()) {
+      DVLOG(0) << "Failed to release content_annotation_entities reference:  "
+               << "id = " << reference;
+    }
+  }
+}
+
+std::string VisitAnnotationsDatabase::ConvertEntitiesToStringColumn(
+    const std::vector<VisitContentModelAnnotations::Category>& entities) {
+  std::vector<std::string> serialized_entities;
+  for (const auto& entity : entities) {
+    int64_t reference = AddEntityReference(entity.id);
+    if (!reference)
+      continue;
+    serialized_entities.emplace_back(
+        base::StrCat({base::NumberToString(reference), ":",
+                      base::NumberToString(entity.weight)}));
+  }
+  return base::JoinString(serialized_entities, ",");
+}
+
+std::vector<VisitContentModelAnnotations::Category>
+VisitAnnotationsDatabase::GetEntitiesFromStringColumn(
+    const std::string& column_value) {
+  std::vector<VisitContentModelAnnotations::Category> entities;
+  if (column_value.empty())
+    return entities;
+
+  sql::Statement statement(GetDB().GetCachedStatement(
+      SQL_FROM_HERE,
+      "SELECT entity_id FROM content_annotation_entities WHERE id=?"));
+  for (auto& entity : GetCategoriesFromStringColumn(column_value)) {
+    int64_t reference;
+    if (!base::StringToInt64(entity.id, &reference))
+      continue;
+    statement.Reset(true);
+    statement.BindInt64(0, reference);
+    if (!statement.Step())
+      continue;
+    entity.id = statement.ColumnString(0);
+    entities.push_back(std::move(entity));
+  }
+  return entities;
+}
+
 }  // namespace history
@@ -5,6 +5,7 @@
 #ifndef COMPONENTS_HISTORY_CORE_BROWSER_VISIT_ANNOTATIONS_DATABASE_H_
 #define COMPONENTS_HISTORY_CORE_BROWSER_VISIT_ANNOTATIONS_DATABASE_H_
 
+#include <string>
 #include <vector>
 
 #include "base/time/time.h"
@@ -22,7 +23,9 @@ struct VisitContentAnnotations;
 // `VisitAnnotationsDatabase` must also be a `VisitDatabase`, as this joins with
 // the `visits` table. The `content_annotations` and `context_annotations` use
 // `visit_id` as their primary key; each row in the `visits` table will be
-// associated with 0 or 1 rows in each annotation table.
+// associated with 0 or 1 rows in each annotation table. Entity IDs, which
+// repeat across many visits, are stored once in `content_annotation_entities`
+// and referenced by their row ID from `content_annotations`.
 class VisitAnnotationsDatabase {
  public:
   // Must call `InitAnnotationsTables()` before using any other part of this
@@ -140,6 +143,36 @@ class VisitAnnotationsDatabase {
   // Called by the derived classes to migrate the older content_annotations
   // table by adding the alternative_title column.
   bool MigrateContentAnnotationsAddAlternativeTitle();
+
+  // Called by the derived classes to migrate the entities column of the older
+  // content_annotations table from entity IDs to references into the
+  // content_annotation_entities table.
+  bool MigrateContentAnnotationsInternEntities();
+
+ private:
+  // Returns the ID of `entity_id` in the content_annotation_entities table,
+  // adding it if needed, and counts one more reference to it. Returns 0 on
+  // failure.
+  int64_t AddEntityReference(const std::string& entity_id);
+
+  // Returns the content_annotation_entities references of the content
+  // annotations of `visit_id`.
+  std::vector<int64_t> GetEntityReferencesForVisit(VisitID visit_id);
+
+  // Counts one reference less to each of `references`, deleting the entities
+  // no content annotations row references anymore.
+  void ReleaseEntityReferences(const std::vector<int64_t>& references);
+
+  // Converts entities to the "reference:weight" list of the entities column,
+  // interning their IDs. The caller stores the list, so each entity gets one
+  // more reference.
+  std::string ConvertEntitiesToStringColumn(
+      const std::vector<VisitContentModelAnnotations::Category>& entities);
+
+  // Converts the entities column back into a vector of (`id`, `weight`)
+  // pairs. References that do not resolve are dropped.
+  std::vector<VisitContentModelAnnotations::Category>
+  GetEntitiesFromStringColumn(const std::string& column_value);
 };
 
 }  // namespace history
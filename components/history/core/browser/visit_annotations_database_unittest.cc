@@ -11,6 +11,7 @@
 #include "components/history/core/browser/visit_database.h"
 #include "components/history/core/test/visit_annotations_test_utils.h"
 #include "sql/database.h"
+#include "sql/statement.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -44,6 +45,27 @@ class VisitAnnotationsDatabaseTest : public testing::Test,
     AddClusters({CreateCluster(visit_ids)});
   }
 
+  int64_t CountInternedEntities() {
+    sql::Statement statement(db_.GetUniqueStatement(
+        "SELECT COUNT(*) FROM content_annotation_entities"));
+    return statement.Step() ? statement.ColumnInt64(0) : -1;
+  }
+
+  std::string GetEntitiesColumn(VisitID visit_id) {
+    sql::Statement statement(db_.GetUniqueStatement(
+        "SELECT entities FROM content_annotations WHERE visit_id=?"));
+    statement.BindInt64(0, visit_id);
+    return statement.Step() ? statement.ColumnString(0) : std::string();
+  }
+
+  void SetEntitiesColumn(VisitID visit_id, const std::string& entities) {
+    sql::Statement statement(db_.GetUniqueStatement(
+        "UPDATE content_annotations SET entities=? WHERE visit_id=?"));
+    statement.BindString(0, entities);
+    statement.BindInt64(1, visit_id);
+    ASSERT_TRUE(statement.Run());
+  }
+
   void ExpectContextAnnotations(VisitContextAnnotations actual,
                                 VisitContextAnnotations expected) {
     EXPECT_EQ(actual.omnibox_url_copied, expected.omnibox_url_copied);
@@ -215,6 +237,90 @@ TEST_F(VisitAnnotationsDatabaseTest, UpdateContentAnnotationsForVisit) {
   EXPECT_EQ(final.alternative_title, "New alternative title");
 }
 
+TEST_F(VisitAnnotationsDatabaseTest, EntitiesAreInterned) {
+  VisitContentAnnotations content_annotations;
+  content_annotations.model_annotations.entities = {
+      {/*id=*/"/m/entity1", /*weight=*/10},
+      {/*id=*/"/m/entity2", /*weight=*/20}};
+  AddContentAnnotationsForVisit(1, content_annotations);
+  content_annotations.model_annotations.entities = {
+      {/*id=*/"/m/entity2", /*weight=*/30}};
+  AddContentAnnotationsForVisit(2, content_annotations);
+
+  // Each entity ID is stored once and referenced from the rows.
+  EXPECT_EQ(2, CountInternedEntities());
+  EXPECT_EQ("1:10,2:20", GetEntitiesColumn(1));
+  EXPECT_EQ("2:30", GetEntitiesColumn(2));
+
+  VisitContentAnnotations got_content_annotations;
+  ASSERT_TRUE(GetContentAnnotationsForVisit(2, &got_content_annotations));
+  EXPECT_THAT(got_content_annotations.model_annotations.entities,
+              ElementsAre(VisitContentModelAnnotations::Category(
+                  /*id=*/"/m/entity2", /*weight=*/30)));
+}
+
+TEST_F(VisitAnnotationsDatabaseTest, UnreferencedEntitiesAreDeleted) {
+  VisitContentAnnotations content_annotations;
+  content_annotations.model_annotations.entities = {
+      {/*id=*/"/m/entity1", /*weight=*/10},
+      {/*id=*/"/m/entity2", /*weight=*/20}};
+  AddContentAnnotationsForVisit(1, content_annotations);
+  content_annotations.model_annotations.entities = {
+      {/*id=*/"/m/entity2", /*weight=*/30}};
+  AddContentAnnotationsForVisit(2, content_annotations);
+  EXPECT_EQ(2, CountInternedEntities());
+
+  // Entities still referenced by another visit are kept.
+  DeleteAnnotationsForVisit(1);
+  EXPECT_EQ(1, CountInternedEntities());
+  EXPECT_EQ("2:30", GetEntitiesColumn(2));
+
+  // Updates drop the entities they no longer reference.
+  content_annotations.model_annotations.entities = {
+      {/*id=*/"/m/entity3", /*weight=*/40}};
+  UpdateContentAnnotationsForVisit(2, content_annotations);
+  EXPECT_EQ(1, CountInternedEntities());
+
+  // An update keeping an entity keeps it, however often it is referenced.
+  content_annotations.model_annotations.entities = {
+      {/*id=*/"/m/entity3", /*weight=*/40},
+      {/*id=*/"/m/entity3", /*weight=*/50}};
+  UpdateContentAnnotationsForVisit(2, content_annotations);
+  EXPECT_EQ(1, CountInternedEntities());
+
+  DeleteAnnotationsForVisit(2);
+  EXPECT_EQ(0, CountInternedEntities());
+}
+
+TEST_F(VisitAnnotationsDatabaseTest, MigrateContentAnnotationsInternEntities) {
+  AddContentAnnotationsForVisit(1, {});
+  AddContentAnnotationsForVisit(2, {});
+  // Rows written before the migration hold the entity IDs themselves.
+  SetEntitiesColumn(1, "/m/entity1:10,/m/entity2:20");
+  SetEntitiesColumn(2, "/m/entity2:30");
+
+  ASSERT_TRUE(MigrateContentAnnotationsInternEntities());
+  EXPECT_EQ(2, CountInternedEntities());
+
+  VisitContentAnnotations got_content_annotations;
+  ASSERT_TRUE(GetContentAnnotationsForVisit(1, &got_content_annotations));
+  EXPECT_THAT(got_content_annotations.model_annotations.entities,
+              ElementsAre(VisitContentModelAnnotations::Category(
+                              /*id=*/"/m/entity1", /*weight=*/10),
+                          VisitContentModelAnnotations::Category(
+                              /*id=*/"/m/entity2", /*weight=*/20)));
+  ASSERT_TRUE(GetContentAnnotationsForVisit(2, &got_content_annotations));
+  EXPECT_THAT(got_content_annotations.model_annotations.entities,
+              ElementsAre(VisitContentModelAnnotations::Category(
+                  /*id=*/"/m/entity2", /*weight=*/30)));
+
+  // The migration counts the references it creates.
+  DeleteAnnotationsForVisit(1);
+  EXPECT_EQ(1, CountInternedEntities());
+  DeleteAnnotationsForVisit(2);
+  EXPECT_EQ(0, CountInternedEntities());
+}
+
 TEST_F(VisitAnnotationsDatabaseTest, GetRecentClusterIds) {
   AddCluster(
       {AddVisitWithTime(IntToTime(11)), AddVisitWithTime(IntToTime(12))});
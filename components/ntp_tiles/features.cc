@@ -21,4 +21,7 @@ const base::Feature kNtpMostLikelyFaviconsFromServerFeature{
 const base::Feature kUsePopularSitesSuggestions{
     "UsePopularSitesSuggestions", base::FEATURE_ENABLED_BY_DEFAULT};
 
+const base::Feature kNtpTileSnapshot{"NTPTileSnapshot",
+                                     base::FEATURE_ENABLED_BY_DEFAULT};
+
 }  // namespace ntp_tiles
@@ -26,6 +26,10 @@ extern const base::Feature kNtpMostLikelyFaviconsFromServerFeature;
 // If this feature is enabled, we enable popular sites in the suggestions UI.
 extern const base::Feature kUsePopularSitesSuggestions;
 
+// If this feature is enabled, the tiles last shown are kept and shown again
+// right away on a cold start, until fresh tiles are available.
+extern const base::Feature kNtpTileSnapshot;
+
 }  // namespace ntp_tiles
 
 #endif  // COMPONENTS_NTP_TILES_FEATURES_H_
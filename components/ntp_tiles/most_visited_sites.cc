@@ -13,6 +13,7 @@
 #include "base/bind.h"
 #include "base/callback.h"
 #include "base/callback_helpers.h"
+#include "base/containers/cxx20_erase.h"
 #include "base/feature_list.h"
 #include "base/logging.h"
 #include "base/metrics/user_metrics.h"
@@ -129,6 +130,7 @@ MostVisitedSites::MostVisitedSites(
     std::unique_ptr<MostVisitedSitesSupervisor> supervisor,
     bool is_default_chrome_app_migrated)
     : prefs_(prefs),
+      tile_snapshot_store_(prefs),
       top_sites_(top_sites),
       popular_sites_(std::move(popular_sites)),
       custom_links_(std::move(custom_links)),
@@ -230,6 +232,16 @@ void MostVisitedSites::AddMostVisitedURLsObserver(Observer* observer,
     }
   }
 
+  // On a cold start, show the tiles last shown until the current set is built.
+  if (!current_tiles_.has_value() && !IsCustomLinksInitialized() &&
+      base::FeatureList::IsEnabled(kNtpTileSnapshot)) {
+    NTPTilesVector snapshot = GetTileSnapshot();
+    if (!snapshot.empty()) {
+      SaveTilesAndNotify(std::move(snapshot),
+                         std::map<SectionType, NTPTilesVector>());
+    }
+  }
+
   // Immediately build the current set of tiles, getting suggestions from
   // TopSites.
   BuildCurrentTiles();
@@ -431,11 +443,14 @@ void MostVisitedSites::OnBlockedSitesChanged() {
 void MostVisitedSites::RegisterProfilePrefs(
     user_prefs::PrefRegistrySyncable* registry) {
   registry->RegisterIntegerPref(prefs::kNumPersonalTiles, 0);
+  TileSnapshotStore::RegisterProfilePrefs(registry);
 }
 
 // static
 void MostVisitedSites::ResetProfilePrefs(PrefService* prefs) {
   prefs->SetInteger(prefs::kNumPersonalTiles, 0);
+  prefs->ClearPref(prefs::kTileSnapshot);
+  prefs->ClearPref(prefs::kTileSnapshotTime);
 }
 
 size_t MostVisitedSites::GetMaxNumSites() const {
@@ -462,9 +477,9 @@ void MostVisitedSites::OnMostVisitedURLsAvailable(
 
   NTPTilesVector tiles;
   size_t num_tiles = std::min(visited_list.size(), GetMaxNumSites());
-  LOG(INFO) << "[Kiwi] MostVisitedSites::OnMostVisitedURLsAvailable - Step 2: " << num_tiles;
-  LOG(INFO) << "[Kiwi] MostVisitedSites::OnMostVisitedURLsAvailable - Step 2a: " << visited_list.size();
-  LOG(INFO) << "[Kiwi] MostVisitedSites::OnMostVisitedURLsAvailable - Step 2b: " << GetMaxNumSites();
+  DVLOG(1) << "[Kiwi] MostVisitedSites::OnMostVisitedURLsAvailable - Step 2: " << num_tiles;
+  DVLOG(1) << "[Kiwi] MostVisitedSites::OnMostVisitedURLsAvailable - Step 2a: " << visited_list.size();
+  DVLOG(1) << "[Kiwi] MostVisitedSites::OnMostVisitedURLsAvailable - Step 2b: " << GetMaxNumSites();
   for (size_t i = 0; i < num_tiles; ++i) {
     const history::MostVisitedURL& visited = visited_list[i];
     if (visited.url.is_empty())
@@ -489,6 +504,28 @@ void MostVisitedSites::OnMostVisitedURLsAvailable(
   InitiateNotificationForNewTiles(std::move(tiles));
 }
 
+NTPTilesVector MostVisitedSites::GetTileSnapshot() {
+  NTPTilesVector snapshot = tile_snapshot_store_.RetrieveTiles();
+  if (snapshot.empty())
+    return snapshot;
+  // Once TopSites has loaded, its tiles are available right away and replace
+  // the snapshot. Before that, only its blocked URLs can be checked.
+  if (!top_sites_ || top_sites_->loaded())
+    return NTPTilesVector();
+  // History deletions made while no New Tab Page was around did not clear the
+  // snapshot, which may show the deleted pages.
+  if (tile_snapshot_store_.GetStoreTime() <=
+      top_sites_->GetLastHistoryDeletionTime()) {
+    tile_snapshot_store_.ClearTiles();
+    return NTPTilesVector();
+  }
+  base::EraseIf(snapshot, [this](const NTPTile& tile) {
+    return top_sites_->IsBlocked(tile.url) ||
+           (supervisor_ && supervisor_->IsBlocked(tile.url));
+  });
+  return snapshot;
+}
+
 void MostVisitedSites::BuildCurrentTiles() {
   if (IsCustomLinksInitialized()) {
     BuildCustomLinks(custom_links_->GetLinks());
@@ -736,7 +773,7 @@ void MostVisitedSites::SaveTilesAndNotify(
     metrics::RecordsMigratedDefaultAppDeleted(
         DeletedTileType::kMostVisitedSite);
   }
-  LOG(INFO) << "[Kiwi] MostVisitedSites::SaveTilesAndNotify - Step 1";
+  DVLOG(1) << "[Kiwi] MostVisitedSites::SaveTilesAndNotify - Step 1";
   if (!current_tiles_.has_value() || (*current_tiles_ != fixed_tiles)) {
     current_tiles_.emplace(std::move(fixed_tiles));
 
@@ -748,14 +785,16 @@ void MostVisitedSites::SaveTilesAndNotify(
       }
     }
     prefs_->SetInteger(prefs::kNumPersonalTiles, num_personal_tiles);
+    if (base::FeatureList::IsEnabled(kNtpTileSnapshot))
+      tile_snapshot_store_.StoreTiles(*current_tiles_);
   }
 
-  LOG(INFO) << "[Kiwi] MostVisitedSites::SaveTilesAndNotify - Step 2";
+  DVLOG(1) << "[Kiwi] MostVisitedSites::SaveTilesAndNotify - Step 2";
 
   if (observers_.empty())
     return;
   sections[SectionType::PERSONALIZED] = *current_tiles_;
-  LOG(INFO) << "[Kiwi] MostVisitedSites::SaveTilesAndNotify - Step 3";
+  DVLOG(1) << "[Kiwi] MostVisitedSites::SaveTilesAndNotify - Step 3";
   for (auto& observer : observers_)
     observer.OnURLsAvailable(sections);
 }
@@ -834,6 +873,10 @@ void MostVisitedSites::TopSitesLoaded(TopSites* top_sites) {}
 
 void MostVisitedSites::TopSitesChanged(TopSites* top_sites,
                                        ChangeReason change_reason) {
+  // This is how history deletions reach us. Drop the snapshot, as it may show
+  // deleted pages, until the tiles rebuilt from TopSites store it again.
+  if (base::FeatureList::IsEnabled(kNtpTileSnapshot))
+    tile_snapshot_store_.ClearTiles();
   if (mv_source_ == TileSource::TOP_SITES) {
     // The displayed tiles are invalidated.
     InitiateTopSitesQuery();
@@ -29,6 +29,7 @@
 #include "components/ntp_tiles/ntp_tile.h"
 #include "components/ntp_tiles/popular_sites.h"
 #include "components/ntp_tiles/section_type.h"
+#include "components/ntp_tiles/tile_snapshot_store.h"
 #include "components/ntp_tiles/tile_source.h"
 #include "components/webapps/common/constants.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -270,6 +271,10 @@ class MostVisitedSites : public history::TopSitesObserver,
   // observer.
   void BuildCurrentTiles();
 
+  // Returns the tiles last shown if they may be shown until the current set is
+  // built, without the URLs blocked since.
+  NTPTilesVector GetTileSnapshot();
+
   // Creates tiles for all popular site sections. Uses |num_actual_tiles| and
   // |used_hosts| to restrict results for the PERSONALIZED section.
   std::map<SectionType, NTPTilesVector> CreatePopularSitesSections(
@@ -338,6 +343,7 @@ class MostVisitedSites : public history::TopSitesObserver,
                        ChangeReason change_reason) override;
 
   raw_ptr<PrefService> prefs_;
+  TileSnapshotStore tile_snapshot_store_;
 
   scoped_refptr<history::TopSites> top_sites_;
   std::unique_ptr<PopularSites> const popular_sites_;
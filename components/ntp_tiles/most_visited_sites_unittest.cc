@@ -36,6 +36,7 @@
 #include "components/ntp_tiles/pref_names.h"
 #include "components/ntp_tiles/section_type.h"
 #include "components/ntp_tiles/switches.h"
+#include "components/ntp_tiles/tile_snapshot_store.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
 #include "components/webapps/common/constants.h"
 #include "extensions/buildflags/buildflags.h"
@@ -168,6 +169,7 @@ class MockTopSites : public TopSites {
                      const std::string&(const GURL& url));
   MOCK_METHOD0(IsFull, bool());
   MOCK_CONST_METHOD0(loaded, bool());
+  MOCK_CONST_METHOD0(GetLastHistoryDeletionTime, base::Time());
   MOCK_METHOD0(GetPrepopulatedPages, history::PrepopulatedPageList());
   MOCK_METHOD1(OnNavigationCommitted, void(const GURL& url));
 
@@ -993,6 +995,58 @@ TEST_P(MostVisitedSitesTest, ShouldHandleTopSitesCacheHit) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST_P(MostVisitedSitesTest, ShouldShowTileSnapshotUntilTopSitesLoads) {
+  TileSnapshotStore(&pref_service_)
+      .StoreTiles(
+          {MakeTile(u"Site 1", "http://site1/", TileSource::TOP_SITES),
+           MakeTile(u"Blocked", "http://blocked/", TileSource::TOP_SITES)});
+  EXPECT_CALL(*mock_top_sites_, loaded()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*mock_top_sites_, GetLastHistoryDeletionTime())
+      .WillRepeatedly(Return(base::Time()));
+  EXPECT_CALL(*mock_top_sites_, IsBlocked(_)).WillRepeatedly(Return(false));
+  EXPECT_CALL(*mock_top_sites_, IsBlocked(Eq(GURL("http://blocked/"))))
+      .WillRepeatedly(Return(true));
+  // TopSites only answers once it has loaded.
+  EXPECT_CALL(*mock_top_sites_, GetMostVisitedURLs(_));
+  EXPECT_CALL(*mock_top_sites_, SyncWithHistory());
+
+  // The snapshot is shown without the URLs blocked since it was stored.
+  EXPECT_CALL(mock_observer_,
+              OnURLsAvailable(Contains(
+                  Pair(SectionType::PERSONALIZED,
+                       ElementsAre(MatchesTile(u"Site 1", "http://site1/",
+                                               TileSource::TOP_SITES))))));
+  most_visited_sites_->AddMostVisitedURLsObserver(&mock_observer_,
+                                                  /*max_num_sites=*/3);
+  VerifyAndClearExpectations();
+
+  // A change of TopSites, such as a history deletion, drops the snapshot.
+  EXPECT_CALL(*mock_top_sites_, GetMostVisitedURLs(_));
+  mock_top_sites_->NotifyTopSitesChanged(
+      history::TopSitesObserver::ChangeReason::MOST_VISITED);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(TileSnapshotStore(&pref_service_).RetrieveTiles().empty());
+}
+
+TEST_P(MostVisitedSitesTest, ShouldDropTileSnapshotOlderThanHistoryDeletion) {
+  TileSnapshotStore(&pref_service_)
+      .StoreTiles(
+          {MakeTile(u"Site 1", "http://site1/", TileSource::TOP_SITES)});
+  EXPECT_CALL(*mock_top_sites_, loaded()).WillRepeatedly(Return(false));
+  // History was deleted after the snapshot was stored, while no New Tab Page
+  // was observing TopSites.
+  EXPECT_CALL(*mock_top_sites_, GetLastHistoryDeletionTime())
+      .WillRepeatedly(Return(base::Time::Now() + base::Seconds(1)));
+  EXPECT_CALL(*mock_top_sites_, GetMostVisitedURLs(_));
+  EXPECT_CALL(*mock_top_sites_, SyncWithHistory());
+
+  EXPECT_CALL(mock_observer_, OnURLsAvailable(_)).Times(0);
+  most_visited_sites_->AddMostVisitedURLsObserver(&mock_observer_,
+                                                  /*max_num_sites=*/3);
+  VerifyAndClearExpectations();
+  EXPECT_TRUE(TileSnapshotStore(&pref_service_).RetrieveTiles().empty());
+}
+
 // Tests that multiple observers can be added to the MostVisitedSites.
 TEST_P(MostVisitedSitesTest, MultipleObservers) {
   EXPECT_CALL(*mock_top_sites_, GetMostVisitedURLs(_))
@@ -32,12 +32,15 @@
 #include "components/variations/service/variations_service.h"
 #include "components/variations/variations_associated_data.h"
 #include "net/base/load_flags.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
 #include "net/http/http_status_code.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "services/data_decoder/public/cpp/data_decoder.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
 
 #if BUILDFLAG(IS_ANDROID) || BUILDFLAG(IS_IOS)
 #include "base/json/json_reader.h"
@@ -297,6 +300,10 @@ bool PopularSitesImpl::MaybeStartFetch(bool force_download,
   const bool url_changed =
       pending_url_.spec() != prefs_->GetString(prefs::kPopularSitesURLPref);
 
+  // Unless forced, a periodic refresh of the same file only has to confirm
+  // that the cached copy is current, which typically is an empty 304.
+  revalidate_ = !force_download && !url_changed && !download_time_is_future;
+
   // Download forced, or we need to download a new file.
   if (force_download || download_time_is_future ||
       (time_since_last_download > redownload_interval) || url_changed) {
@@ -423,6 +430,9 @@ void PopularSitesImpl::RegisterProfilePrefs(
   int version;
   base::StringToInt(kPopularSitesDefaultVersion, &version);
   user_prefs->RegisterIntegerPref(prefs::kPopularSitesVersionPref, version);
+  user_prefs->RegisterStringPref(prefs::kPopularSitesETagPref, std::string());
+  user_prefs->RegisterStringPref(prefs::kPopularSitesLastModifiedPref,
+                                 std::string());
 }
 
 void PopularSitesImpl::FetchPopularSites() {
@@ -449,8 +459,24 @@ void PopularSitesImpl::FetchPopularSites() {
   auto resource_request = std::make_unique<network::ResourceRequest>();
   resource_request->url = pending_url_;
   resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
+  if (revalidate_ &&
+      pending_url_.spec() == prefs_->GetString(prefs::kPopularSitesURLPref)) {
+    const std::string& etag = prefs_->GetString(prefs::kPopularSitesETagPref);
+    if (!etag.empty()) {
+      resource_request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                          etag);
+    }
+    const std::string& last_modified =
+        prefs_->GetString(prefs::kPopularSitesLastModifiedPref);
+    if (!last_modified.empty()) {
+      resource_request->headers.SetHeader(
+          net::HttpRequestHeaders::kIfModifiedSince, last_modified);
+    }
+  }
   simple_url_loader_ = network::SimpleURLLoader::Create(
       std::move(resource_request), traffic_annotation);
+  // Needed to see 304 responses, which are otherwise reported as failures.
+  simple_url_loader_->SetAllowHttpErrorResults(true);
   simple_url_loader_->SetRetryOptions(
       1, network::SimpleURLLoader::RETRY_ON_NETWORK_CHANGE);
   simple_url_loader_->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
@@ -461,9 +487,26 @@ void PopularSitesImpl::FetchPopularSites() {
 
 void PopularSitesImpl::OnSimpleLoaderComplete(
     std::unique_ptr<std::string> response_body) {
+  int response_code = -1;
+  pending_etag_.clear();
+  pending_last_modified_.clear();
+  const network::mojom::URLResponseHead* response_info =
+      simple_url_loader_->ResponseInfo();
+  if (response_info && response_info->headers) {
+    response_code = response_info->headers->response_code();
+    response_info->headers->GetNormalizedHeader("ETag", &pending_etag_);
+    response_info->headers->GetNormalizedHeader("Last-Modified",
+                                                &pending_last_modified_);
+  }
   simple_url_loader_.reset();
 
-  if (!response_body) {
+  if (response_code == net::HTTP_NOT_MODIFIED && revalidate_) {
+    OnNotModified();
+    return;
+  }
+
+  // Non-HTTP URLs, e.g. an overridden file: URL, come without a response code.
+  if (!response_body || (response_code != -1 && response_code / 100 != 2)) {
     OnDownloadFailed();
     return;
   }
@@ -493,10 +536,19 @@ void PopularSitesImpl::OnJsonParsed(
                    base::Time::Now().ToInternalValue());
   prefs_->SetInteger(prefs::kPopularSitesVersionPref, version_in_pending_url_);
   prefs_->SetString(prefs::kPopularSitesURLPref, pending_url_.spec());
+  prefs_->SetString(prefs::kPopularSitesETagPref, pending_etag_);
+  prefs_->SetString(prefs::kPopularSitesLastModifiedPref,
+                    pending_last_modified_);
 
   std::move(callback_).Run(true);
 }
 
+void PopularSitesImpl::OnNotModified() {
+  prefs_->SetInt64(prefs::kPopularSitesLastDownloadPref,
+                   base::Time::Now().ToInternalValue());
+  std::move(callback_).Run(true);
+}
+
 void PopularSitesImpl::OnDownloadFailed() {
   if (!is_fallback_) {
     DLOG(WARNING) << "Download country site list failed";
@@ -65,7 +65,8 @@ class PopularSitesImpl : public PopularSites {
 
  private:
   // Fetch the popular sites at the given URL, overwriting any cache in prefs
-  // that already exists.
+  // that already exists. If |revalidate_| is set, a fetch of the cached URL
+  // is made conditional on the cached ETag and Last-Modified values.
   void FetchPopularSites();
 
   // Called once SimpleURLLoader completes the network request.
@@ -73,6 +74,8 @@ class PopularSitesImpl : public PopularSites {
 
   void OnJsonParsed(data_decoder::DataDecoder::ValueOrError result);
   void OnDownloadFailed();
+  // Called when the server confirmed that the cached sites are still current.
+  void OnNotModified();
 
   // Parameters set from constructor.
   const raw_ptr<PrefService> prefs_;
@@ -88,6 +91,11 @@ class PopularSitesImpl : public PopularSites {
   std::map<SectionType, SitesVector> sections_;
   GURL pending_url_;
   int version_in_pending_url_;
+  // Whether the pending fetch may only revalidate the cache.
+  bool revalidate_ = false;
+  // The validators of the pending response, saved with its sites.
+  std::string pending_etag_;
+  std::string pending_last_modified_;
 
   base::WeakPtrFactory<PopularSitesImpl> weak_ptr_factory_{this};
 };
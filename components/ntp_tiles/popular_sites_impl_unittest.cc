@@ -16,6 +16,7 @@
 #include "base/run_loop.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/threading/thread_task_runner_handle.h"
@@ -27,11 +28,16 @@
 #include "components/ntp_tiles/tile_source.h"
 #include "components/pref_registry/pref_registry_syncable.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
 #include "net/http/http_status_code.h"
 #include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
+#include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
 #include "services/network/test/test_url_loader_factory.h"
+#include "services/network/test/test_utils.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -368,6 +374,40 @@ TEST_F(PopularSitesTest, UsesCachedJson) {
   EXPECT_THAT(sites[0].url, URLEq("https://zz.m.wikipedia.org/"));
 }
 
+TEST_F(PopularSitesTest, RevalidatesCachedJson) {
+  SetCountryAndVersion("ZZ", "5");
+  const std::string url =
+      "https://www.gstatic.com/chrome/ntp/suggested_sites_ZZ_5.json";
+  std::string sites_string;
+  base::JSONWriter::Write(CreateListFromTestSites({kWikipedia}), &sites_string);
+  auto head = network::CreateURLResponseHead(net::HTTP_OK);
+  head->headers->AddHeader("ETag", "\"v1\"");
+  test_url_loader_factory_.AddResponse(GURL(url), std::move(head),
+                                       sites_string,
+                                       network::URLLoaderCompletionStatus());
+
+  // First request succeeds and gets cached with its ETag.
+  PopularSites::SitesVector sites;
+  ASSERT_THAT(FetchPopularSites(/*force_download=*/false, &sites),
+              Eq(absl::optional<bool>(true)));
+  EXPECT_EQ("\"v1\"", prefs_->GetString(prefs::kPopularSitesETagPref));
+
+  // Once the cache is stale, it is only revalidated.
+  prefs_->SetInt64(prefs::kPopularSitesLastDownloadPref, 0);
+  std::string if_none_match;
+  test_url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        request.headers.GetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                  &if_none_match);
+      }));
+  test_url_loader_factory_.AddResponse(url, "", net::HTTP_NOT_MODIFIED);
+  EXPECT_THAT(FetchPopularSites(/*force_download=*/false, &sites),
+              Eq(absl::optional<bool>(true)));
+  EXPECT_EQ("\"v1\"", if_none_match);
+  EXPECT_THAT(sites[0].url, URLEq("https://zz.m.wikipedia.org/"));
+  EXPECT_NE(0, prefs_->GetInt64(prefs::kPopularSitesLastDownloadPref));
+}
+
 TEST_F(PopularSitesTest, CachesEmptyFile) {
   SetCountryAndVersion("ZZ", "5");
   RespondWithData(
@@ -31,6 +31,11 @@ const char kPopularSitesURLPref[] = "popular_sites_url";
 const char kPopularSitesJsonPref[] = "suggested_sites_json";
 const char kPopularSitesVersionPref[] = "suggested_sites_version";
 
+// The ETag and Last-Modified response headers of the cached suggested sites,
+// used to revalidate them instead of downloading them again.
+const char kPopularSitesETagPref[] = "popular_sites_etag";
+const char kPopularSitesLastModifiedPref[] = "popular_sites_last_modified";
+
 // Prefs used to cache custom links.
 const char kCustomLinksList[] = "custom_links.list";
 const char kCustomLinksInitialized[] = "custom_links.initialized";
@@ -40,5 +45,10 @@ const char kCustomLinksInitialized[] = "custom_links.initialized";
 const char kCustomLinksForPreinstalledAppsRemoved[] =
     "custom_links.preinstalledremoved";
 
+// The tiles last shown on the New Tab Page. See TileSnapshotStore.
+const char kTileSnapshot[] = "ntp.tile_snapshot";
+// When the tiles of kTileSnapshot were stored.
+const char kTileSnapshotTime[] = "ntp.tile_snapshot_time";
+
 }  // namespace prefs
 }  // namespace ntp_tiles
@@ -19,11 +19,16 @@ extern const char kPopularSitesLastDownloadPref[];
 extern const char kPopularSitesURLPref[];
 extern const char kPopularSitesJsonPref[];
 extern const char kPopularSitesVersionPref[];
+extern const char kPopularSitesETagPref[];
+extern const char kPopularSitesLastModifiedPref[];
 
 extern const char kCustomLinksList[];
 extern const char kCustomLinksInitialized[];
 extern const char kCustomLinksForPreinstalledAppsRemoved[];
 
+extern const char kTileSnapshot[];
+extern const char kTileSnapshotTime[];
+
 }  // namespace prefs
 }  // namespace ntp_tiles
 
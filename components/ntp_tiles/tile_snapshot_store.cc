@@ -0,0 +1,109 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "components/ntp_tiles/tile_snapshot_store.h"
+
+#include <string>
+#include <utility>
+
+#include "base/strings/utf_string_conversions.h"
+#include "components/ntp_tiles/pref_names.h"
+#include "components/ntp_tiles/tile_source.h"
+#include "components/ntp_tiles/tile_title_source.h"
+#include "components/pref_registry/pref_registry_syncable.h"
+#include "components/prefs/pref_service.h"
+
+namespace ntp_tiles {
+
+namespace {
+
+const char kDictionaryKeyUrl[] = "url";
+const char kDictionaryKeyTitle[] = "title";
+const char kDictionaryKeySource[] = "source";
+const char kDictionaryKeyTitleSource[] = "titleSource";
+const char kDictionaryKeyFaviconUrl[] = "faviconUrl";
+
+}  // namespace
+
+TileSnapshotStore::TileSnapshotStore(PrefService* prefs) : prefs_(prefs) {
+  DCHECK(prefs);
+}
+
+TileSnapshotStore::~TileSnapshotStore() = default;
+
+NTPTilesVector TileSnapshotStore::RetrieveTiles() {
+  NTPTilesVector tiles;
+
+  const base::Value::List& stored_tiles =
+      prefs_->GetValueList(prefs::kTileSnapshot);
+
+  for (const base::Value& stored_tile : stored_tiles) {
+    const base::Value::Dict* dict = stored_tile.GetIfDict();
+    const std::string* url_string =
+        dict ? dict->FindString(kDictionaryKeyUrl) : nullptr;
+    const std::string* title_string =
+        dict ? dict->FindString(kDictionaryKeyTitle) : nullptr;
+    absl::optional<int> source =
+        dict ? dict->FindInt(kDictionaryKeySource) : absl::nullopt;
+    absl::optional<int> title_source =
+        dict ? dict->FindInt(kDictionaryKeyTitleSource) : absl::nullopt;
+
+    GURL url = GURL(url_string ? *url_string : std::string());
+    if (!url_string || !title_string || !url.is_valid() || !source ||
+        *source < 0 || *source > static_cast<int>(TileSource::LAST) ||
+        !title_source || *title_source < 0 ||
+        *title_source > static_cast<int>(TileTitleSource::LAST)) {
+      ClearTiles();
+      tiles.clear();
+      return tiles;
+    }
+
+    NTPTile tile;
+    tile.url = std::move(url);
+    tile.title = base::UTF8ToUTF16(*title_string);
+    tile.source = static_cast<TileSource>(*source);
+    tile.title_source = static_cast<TileTitleSource>(*title_source);
+    if (const std::string* favicon_url =
+            dict->FindString(kDictionaryKeyFaviconUrl)) {
+      tile.favicon_url = GURL(*favicon_url);
+    }
+    tiles.push_back(std::move(tile));
+  }
+  return tiles;
+}
+
+void TileSnapshotStore::StoreTiles(const NTPTilesVector& tiles) {
+  base::Value::List new_tile_list;
+  for (const NTPTile& tile : tiles) {
+    base::Value::Dict new_tile;
+    new_tile.Set(kDictionaryKeyUrl, tile.url.spec());
+    new_tile.Set(kDictionaryKeyTitle, tile.title);
+    new_tile.Set(kDictionaryKeySource, static_cast<int>(tile.source));
+    new_tile.Set(kDictionaryKeyTitleSource,
+                 static_cast<int>(tile.title_source));
+    if (tile.favicon_url.is_valid())
+      new_tile.Set(kDictionaryKeyFaviconUrl, tile.favicon_url.spec());
+    new_tile_list.Append(std::move(new_tile));
+  }
+  prefs_->SetList(prefs::kTileSnapshot, std::move(new_tile_list));
+  prefs_->SetTime(prefs::kTileSnapshotTime, base::Time::Now());
+}
+
+base::Time TileSnapshotStore::GetStoreTime() const {
+  return prefs_->GetTime(prefs::kTileSnapshotTime);
+}
+
+void TileSnapshotStore::ClearTiles() {
+  prefs_->ClearPref(prefs::kTileSnapshot);
+  prefs_->ClearPref(prefs::kTileSnapshotTime);
+}
+
+// static
+void TileSnapshotStore::RegisterProfilePrefs(
+    user_prefs::PrefRegistrySyncable* user_prefs) {
+  user_prefs->RegisterListPref(prefs::kTileSnapshot);
+  user_prefs->RegisterTimePref(prefs::kTileSnapshotTime, base::Time());
+}
+
+}  // namespace ntp_tiles
@@ -0,0 +1,57 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef COMPONENTS_NTP_TILES_TILE_SNAPSHOT_STORE_H_
+#define COMPONENTS_NTP_TILES_TILE_SNAPSHOT_STORE_H_
+
+#include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "components/ntp_tiles/ntp_tile.h"
+
+class PrefService;
+
+namespace user_prefs {
+class PrefRegistrySyncable;
+}  // namespace user_prefs
+
+namespace ntp_tiles {
+
+// Keeps the tiles last shown on the New Tab Page in the profile's preferences,
+// so that MostVisitedSites can show them right away on a cold start, before
+// TopSites has loaded and popular sites have been fetched.
+class TileSnapshotStore {
+ public:
+  explicit TileSnapshotStore(PrefService* prefs);
+
+  TileSnapshotStore(const TileSnapshotStore&) = delete;
+  TileSnapshotStore& operator=(const TileSnapshotStore&) = delete;
+
+  ~TileSnapshotStore();
+
+  // Returns the stored tiles. If there is a problem with retrieval, the pref
+  // value is cleared and an empty list is returned.
+  NTPTilesVector RetrieveTiles();
+
+  // Returns when the stored tiles were stored, or a null time if there are
+  // none.
+  base::Time GetStoreTime() const;
+
+  // Stores the URL, title, sources and favicon URL of each of |tiles|, along
+  // with the current time.
+  void StoreTiles(const NTPTilesVector& tiles);
+
+  // Clears the stored tiles.
+  void ClearTiles();
+
+  // Registers the snapshot pref in the Profile prefs.
+  static void RegisterProfilePrefs(
+      user_prefs::PrefRegistrySyncable* user_prefs);
+
+ private:
+  raw_ptr<PrefService> prefs_;
+};
+
+}  // namespace ntp_tiles
+
+#endif  // COMPONENTS_NTP_TILES_TILE_SNAPSHOT_STORE_H_
@@ -0,0 +1,85 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "components/ntp_tiles/tile_snapshot_store.h"
+
+#include <memory>
+
+#include "base/values.h"
+#include "components/ntp_tiles/pref_names.h"
+#include "components/ntp_tiles/tile_source.h"
+#include "components/ntp_tiles/tile_title_source.h"
+#include "components/sync_preferences/testing_pref_service_syncable.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_tiles {
+
+namespace {
+
+NTPTile MakeTile(const char* url, const char16_t* title, TileSource source) {
+  NTPTile tile;
+  tile.url = GURL(url);
+  tile.title = title;
+  tile.source = source;
+  tile.title_source = TileTitleSource::TITLE_TAG;
+  return tile;
+}
+
+}  // namespace
+
+class TileSnapshotStoreTest : public testing::Test {
+ public:
+  TileSnapshotStoreTest() {
+    TileSnapshotStore::RegisterProfilePrefs(prefs_.registry());
+    store_ = std::make_unique<TileSnapshotStore>(&prefs_);
+  }
+
+  TileSnapshotStoreTest(const TileSnapshotStoreTest&) = delete;
+  TileSnapshotStoreTest& operator=(const TileSnapshotStoreTest&) = delete;
+
+ protected:
+  sync_preferences::TestingPrefServiceSyncable prefs_;
+  std::unique_ptr<TileSnapshotStore> store_;
+};
+
+TEST_F(TileSnapshotStoreTest, StoreAndRetrieveTiles) {
+  NTPTilesVector tiles;
+  tiles.push_back(
+      MakeTile("http://foo1.com/", u"Foo1", TileSource::TOP_SITES));
+  tiles.push_back(MakeTile("http://foo2.com/", u"Foo2", TileSource::POPULAR));
+  tiles[1].favicon_url = GURL("http://foo2.com/favicon.ico");
+
+  store_->StoreTiles(tiles);
+  EXPECT_EQ(tiles, store_->RetrieveTiles());
+
+  store_->StoreTiles(NTPTilesVector());
+  EXPECT_TRUE(store_->RetrieveTiles().empty());
+}
+
+TEST_F(TileSnapshotStoreTest, ClearTiles) {
+  store_->StoreTiles(
+      {MakeTile("http://foo1.com/", u"Foo1", TileSource::TOP_SITES)});
+  ASSERT_EQ(1u, store_->RetrieveTiles().size());
+  EXPECT_FALSE(store_->GetStoreTime().is_null());
+
+  store_->ClearTiles();
+  EXPECT_TRUE(store_->RetrieveTiles().empty());
+  EXPECT_TRUE(store_->GetStoreTime().is_null());
+}
+
+TEST_F(TileSnapshotStoreTest, InvalidSnapshotIsCleared) {
+  base::Value::Dict tile;
+  tile.Set("url", "http://foo1.com/");
+  tile.Set("title", "Foo1");
+  tile.Set("source", 100);
+  tile.Set("titleSource", 0);
+  base::Value::List tiles;
+  tiles.Append(std::move(tile));
+  prefs_.SetList(prefs::kTileSnapshot, std::move(tiles));
+
+  EXPECT_TRUE(store_->RetrieveTiles().empty());
+  EXPECT_TRUE(prefs_.GetValueList(prefs::kTileSnapshot).empty());
+}
+
+}  // namespace ntp_tiles
@@ -6,7 +6,6 @@
 
 #include "base/bind.h"
 #include "components/version_info/version_info_values.h"
-#include "base/json/json_string_value_serializer.h"
 #include "net/base/url_util.h"
 #include "net/base/load_flags.h"
 #include "base/android/sys_utils.h"
@@ -21,11 +20,20 @@
 #include "net/base/network_change_notifier.h"
 #include "url/gurl.h"
 #include "services/network/public/cpp/resource_request.h"
+#include "services/data_decoder/public/cpp/data_decoder.h"
 
 #include "components/search_engines/template_url_service.h"
 #include "components/search_engines/template_url_data_util.h"
 
 #include "services/network/public/mojom/url_response_head.mojom.h"
+#include "net/http/http_response_headers.h"
+
+namespace {
+
+// The search engine list is a few kilobytes; anything far larger is not one.
+constexpr size_t kMaxSearchEnginesListSize = 1024 * 1024;
+
+}  // namespace
 
 const char SearchURLFetcher::kSearchDomainCheckURL[] =
     "https://settings.kiwibrowser.com/search/getrecommendedsearch?format=domain&serie=next&type=chrome&version=" PRODUCT_VERSION "&release_name=" RELEASE_NAME "&release_version=" RELEASE_VERSION;
@@ -47,23 +55,26 @@ SearchURLFetcher::SearchURLFetcher(
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory, PrefService* prefs, TemplateURLService* template_url_service)
     : url_loader_factory_(url_loader_factory),
       prefs_(prefs),
-      template_url_service_(template_url_service) {
-  LOG(INFO) << "[Kiwi] List of search engines is initializing";
+      template_url_service_(template_url_service),
+      search_version_(
+          prefs->GetInteger(prefs::kSearchProviderOverridesVersion)) {
+  DVLOG(1) << "[Kiwi] List of search engines is initializing";
   net::NetworkChangeNotifier::AddNetworkChangeObserver(this);
 }
 
 SearchURLFetcher::~SearchURLFetcher() {}
 
 void SearchURLFetcher::FetchURL() {
-  // Don't allow a fetch if one is pending.
-  if (already_loaded_)
+  // Don't allow a fetch if one is pending or the list was already received.
+  if (already_loaded_ || url_loader_)
     return;
   DCHECK(!url_loader_);
   url_loader_ = CreateURLFetcher();
-  url_loader_->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
+  url_loader_->DownloadToString(
       url_loader_factory_.get(),
       base::BindOnce(&SearchURLFetcher::OnURLLoadComplete,
-                     base::Unretained(this)));
+                     base::Unretained(this)),
+      kMaxSearchEnginesListSize);
 }
 
 std::unique_ptr<network::SimpleURLLoader> SearchURLFetcher::CreateURLFetcher() {
@@ -100,10 +111,11 @@ std::unique_ptr<network::SimpleURLLoader> SearchURLFetcher::CreateURLFetcher() {
   std::string referrerString = base::android::SysUtils::ReferrerStringFromJni();
   resource_request->url = net::AppendOrReplaceQueryParameter(resource_request->url, "ref", referrerString);
 
-  LOG(INFO) << "[Kiwi] List of search engines is requesting";
+  DVLOG(1) << "[Kiwi] List of search engines is requesting";
 
-  resource_request->load_flags =
-      (net::LOAD_DISABLE_CACHE | net::LOAD_DO_NOT_SAVE_COOKIES);
+  // Let the HTTP cache revalidate the list with the validators it stored, so
+  // that an unchanged one only costs a 304.
+  resource_request->load_flags = net::LOAD_DO_NOT_SAVE_COOKIES;
 
   auto url_loader = network::SimpleURLLoader::Create(
       std::move(resource_request), traffic_annotation);
@@ -117,168 +129,174 @@ std::unique_ptr<network::SimpleURLLoader> SearchURLFetcher::CreateURLFetcher() {
 void SearchURLFetcher::OnURLLoadComplete(
     std::unique_ptr<std::string> response_body) {
   int version_code = -1;
-  int enable_server_suggestions = -1;
-
-  LOG(INFO) << "[Kiwi] We received response from SearchURLFetcher - A";
-
-  if (response_body)
-    LOG(INFO) << "[Kiwi] List of search engines returned with body";
-  else
-    LOG(INFO) << "[Kiwi] List of search engines returned without body";
-  if (!response_body) {
-    LOG(INFO) << "[Kiwi] We received response from SearchURLFetcher - Empty response";
-    url_loader_.reset();
-    already_loaded_ = false;
+  const network::mojom::URLResponseHead* response_info =
+      url_loader_->ResponseInfo();
+  if (response_info && response_info->headers &&
+      response_info->headers->HasHeader("se-version-code")) {
+    version_code =
+        response_info->headers->GetInt64HeaderValue("se-version-code");
+  }
+  url_loader_.reset();
+
+  // A list the HTTP cache revalidated arrives as the cached response, and is
+  // caught by the version check below.
+  if (!response_body || version_code == -1) {
+    DVLOG(1) << "[Kiwi] List of search engines returned without body";
     return;
   }
-  std::string body;
-  if (url_loader_->ResponseInfo() && url_loader_->ResponseInfo()->headers && url_loader_->ResponseInfo()->headers->HasHeader("se-version-code")) {
-    version_code = url_loader_->ResponseInfo()->headers->GetInt64HeaderValue("se-version-code");
-  } else {
-    // Delete the loader.
-    url_loader_.reset();
-    already_loaded_ = false;
+
+  std::string body = std::move(*response_body);
+  if (!base::StartsWith(body, "{", base::CompareCase::INSENSITIVE_ASCII)) {
+    DVLOG(1) << "[Kiwi] Received invalid search-engines info with ["
+             << body.length() << "]";
     return;
   }
-  body = std::move(*response_body);
-  LOG(INFO) << "[Kiwi] version_code: [" << version_code << "], response_body: [" << body.length() << "]";
-  LOG(INFO) << "[Kiwi] List of search engines returned with body:" << body;
-  if (!base::StartsWith(body, "{",
-                        base::CompareCase::INSENSITIVE_ASCII)) {
-    LOG(INFO) << "[Kiwi] Received invalid search-engines info with [" << body.length() << "]";
-    url_loader_.reset();
-    already_loaded_ = false;
+
+  if (version_code <= 0 || search_version_ == version_code ||
+      body.length() <= 10) {
+    DVLOG(1) << "[Kiwi] Received search-engines [" << version_code
+             << "] settings from server-side: " << body.length()
+             << " chars but we already have it";
+    already_loaded_ = true;
     return;
   }
 
-  if (version_code != -1 && search_version_ != version_code && version_code > 0 && body.length() > 10) {
-    search_version_ = version_code;
-    LOG(INFO) << "[Kiwi] Received search-engines version: [" << version_code << "] settings from server-side: " << body.length() << " chars";
+  DVLOG(1) << "[Kiwi] Received search-engines version: [" << version_code
+           << "] settings from server-side: " << body.length() << " chars";
+  data_decoder::DataDecoder::ParseJsonIsolated(
+      body, base::BindOnce(&SearchURLFetcher::OnJsonParsed,
+                           weak_ptr_factory_.GetWeakPtr(), version_code));
+}
 
-    std::unique_ptr<base::DictionaryValue> master_dictionary_;
+void SearchURLFetcher::OnJsonParsed(
+    int version_code,
+    data_decoder::DataDecoder::ValueOrError result) {
+  if (!result.has_value()) {
+    LOG(ERROR) << "[Kiwi] Failed to parse search-engines JSON: "
+               << result.error();
+    return;
+  }
+  if (!result->is_dict()) {
+    LOG(ERROR) << "[Kiwi] Failed to parse search-engines JSON: "
+               << "Root item must be a dictionary.";
+    return;
+  }
+  search_version_ = version_code;
 
-    JSONStringValueDeserializer json(body);
-    std::string error;
-    std::unique_ptr<base::Value> root(json.Deserialize(NULL, &error));
-    if (!root.get()) {
-      LOG(ERROR) << "[Kiwi] Failed to parse brandcode prefs file: " << error;
-      url_loader_.reset();
-      already_loaded_ = false;
-      return;
-    }
-    if (!root->is_dict()) {
-      LOG(ERROR) << "[Kiwi] Failed to parse brandcode prefs file: "
-                 << "Root item must be a dictionary.";
-      url_loader_.reset();
-      already_loaded_ = false;
-      return;
-    }
+  const TemplateURL* default_search =
+      template_url_service_->GetDefaultSearchProvider();
+  int current_default_search_prepopulated_id = 1;
+  std::u16string current_default_search_prepopulated_keyword = u"kiwi";
+  if (default_search)
+    current_default_search_prepopulated_id = default_search->prepopulate_id();
+  if (default_search)
+    current_default_search_prepopulated_keyword = default_search->keyword();
 
-    const TemplateURL* default_search = template_url_service_->GetDefaultSearchProvider();
-    int current_default_search_prepopulated_id = 1;
-    std::u16string current_default_search_prepopulated_keyword = u"kiwi";
-    if (default_search)
-      current_default_search_prepopulated_id = default_search->prepopulate_id();
-    if (default_search)
-      current_default_search_prepopulated_keyword = default_search->keyword();
-
-    LOG(INFO) << "[Kiwi] search_url_fetcher - Trying to find template for search engine keyword: " << current_default_search_prepopulated_keyword;
-    TemplateURL *t = template_url_service_->FindPrepopulatedTemplateURLByKeyword(current_default_search_prepopulated_keyword);
-    if (!t) {
-      LOG(INFO) << "[Kiwi] search_url_fetcher - Trying to find template for search engine : " << current_default_search_prepopulated_id;
-      t = template_url_service_->FindPrepopulatedTemplateURL(current_default_search_prepopulated_id);
-    }
-    if (!t) {
-      LOG(INFO) << "[Kiwi] search_url_fetcher - Template not found, trying to find template for search engine ID 1";
-      t = template_url_service_->FindPrepopulatedTemplateURL(1);
-    }
-    if (!t) {
-      LOG(INFO) << "[Kiwi] search_url_fetcher - Template not found, trying to find template for search engine keyword kiwi";
-      t = template_url_service_->FindPrepopulatedTemplateURLByKeyword(u"kiwi");
-    }
-    if (!t) {
-      LOG(ERROR) << "[Kiwi] search_url_fetcher - Error, cannot find default template";
-      return ;
-    }
-    const TemplateURLData *new_dse = &(t->data());
-    if (!new_dse) {
-      LOG(ERROR) << "[Kiwi] search_url_fetcher - Error, cannot find new dse";
-      return ;
-    }
-    std::unique_ptr<base::DictionaryValue> saved_dse = TemplateURLDataToDictionary(*new_dse);
+  DVLOG(1) << "[Kiwi] search_url_fetcher - Trying to find template for search "
+              "engine keyword: "
+           << current_default_search_prepopulated_keyword;
+  TemplateURL* t = template_url_service_->FindPrepopulatedTemplateURLByKeyword(
+      current_default_search_prepopulated_keyword);
+  if (!t) {
+    DVLOG(1) << "[Kiwi] search_url_fetcher - Trying to find template for "
+                "search engine : "
+             << current_default_search_prepopulated_id;
+    t = template_url_service_->FindPrepopulatedTemplateURL(
+        current_default_search_prepopulated_id);
+  }
+  if (!t) {
+    DVLOG(1) << "[Kiwi] search_url_fetcher - Template not found, trying to "
+                "find template for search engine ID 1";
+    t = template_url_service_->FindPrepopulatedTemplateURL(1);
+  }
+  if (!t) {
+    DVLOG(1) << "[Kiwi] search_url_fetcher - Template not found, trying to "
+                "find template for search engine keyword kiwi";
+    t = template_url_service_->FindPrepopulatedTemplateURLByKeyword(u"kiwi");
+  }
+  if (!t) {
+    LOG(ERROR)
+        << "[Kiwi] search_url_fetcher - Error, cannot find default template";
+    return;
+  }
+  const TemplateURLData* new_dse = &(t->data());
+  if (!new_dse) {
+    LOG(ERROR) << "[Kiwi] search_url_fetcher - Error, cannot find new dse";
+    return;
+  }
+  std::unique_ptr<base::DictionaryValue> saved_dse =
+      TemplateURLDataToDictionary(*new_dse);
 
-    master_dictionary_.reset(
-        static_cast<base::DictionaryValue*>(root.release()));
+  std::unique_ptr<base::DictionaryValue> master_dictionary_ =
+      base::DictionaryValue::From(
+          base::Value::ToUniquePtrValue(std::move(*result)));
 
-    const base::ListValue* value = NULL;
-    if (master_dictionary_ &&
-        master_dictionary_->GetList(prefs::kSearchProviderOverrides, &value) &&
-        value && value->GetList().size() >= 2) {
-      LOG(INFO) << "[Kiwi] Search engine list contains " << value->GetList().size() << " elements";
+  const base::ListValue* value = NULL;
+  if (master_dictionary_ &&
+      master_dictionary_->GetList(prefs::kSearchProviderOverrides, &value) &&
+      value && value->GetList().size() >= 2) {
+    DVLOG(1) << "[Kiwi] Search engine list contains "
+             << value->GetList().size() << " elements";
 
-      prefs_->ClearPref(prefs::kSearchProviderOverrides);
-      prefs_->SetInteger(prefs::kSearchProviderOverridesVersion,
-                                     -1);
-      prefs_->SetInteger(prefs::kLastKnownSearchVersion,
-                                     -1);
-      base::Value overrides(base::Value::Type::LIST);
-      bool found_existing_search_engine = false;
-      bool success = false;
-      size_t num_engines = value->GetList().size();
-      for (size_t i = 0; i != num_engines; ++i) {
-        const base::DictionaryValue* engine;
-        if (value->GetDictionary(i, &engine)) {
-          success = true;
-          LOG(INFO) << "[Kiwi] Adding to the list one search engine: " << engine;
-          std::u16string name;
-          engine->GetString("name", &name);
-          std::u16string keyword;
-          engine->GetString("keyword", &keyword);
-          LOG(INFO) << "[Kiwi] Adding to the list one search engine: " << engine << " is " << name << " (keyword: " << keyword << ")";
-          if (keyword == new_dse->keyword())
-            found_existing_search_engine = true;
-          base::Value entry(base::Value::Type::DICTIONARY);
-          overrides.Append(engine->Clone());
-        }
+    prefs_->ClearPref(prefs::kSearchProviderOverrides);
+    prefs_->SetInteger(prefs::kSearchProviderOverridesVersion, -1);
+    prefs_->SetInteger(prefs::kLastKnownSearchVersion, -1);
+    base::Value overrides(base::Value::Type::LIST);
+    bool found_existing_search_engine = false;
+    bool success = false;
+    size_t num_engines = value->GetList().size();
+    for (size_t i = 0; i != num_engines; ++i) {
+      const base::DictionaryValue* engine;
+      if (value->GetDictionary(i, &engine)) {
+        success = true;
+        DVLOG(1) << "[Kiwi] Adding to the list one search engine: " << engine;
+        std::u16string name;
+        engine->GetString("name", &name);
+        std::u16string keyword;
+        engine->GetString("keyword", &keyword);
+        DVLOG(1) << "[Kiwi] Adding to the list one search engine: " << engine
+                 << " is " << name << " (keyword: " << keyword << ")";
+        if (keyword == new_dse->keyword())
+          found_existing_search_engine = true;
+        base::Value entry(base::Value::Type::DICTIONARY);
+        overrides.Append(engine->Clone());
       }
+    }
 
-      if (found_existing_search_engine || new_dse->id == 1 || new_dse->prepopulate_id == 1) {
-        LOG(INFO) << "[Kiwi] Search engine " << new_dse->keyword() << " was already present";
-      } else {
-        LOG(INFO) << "[Kiwi] Search engine " << new_dse->keyword() << " was not already present";
-        overrides.Append(saved_dse->Clone());
-      }
+    if (found_existing_search_engine || new_dse->id == 1 ||
+        new_dse->prepopulate_id == 1) {
+      DVLOG(1) << "[Kiwi] Search engine " << new_dse->keyword()
+               << " was already present";
+    } else {
+      DVLOG(1) << "[Kiwi] Search engine " << new_dse->keyword()
+               << " was not already present";
+      overrides.Append(saved_dse->Clone());
+    }
 
-      if (success) {
-        LOG(INFO) << "[Kiwi] Search engines processing is a success";
-        prefs_->SetUserPrefValue(prefs::kSearchProviderOverrides,
-                        std::move(overrides));
-        prefs_->SetInteger(prefs::kSearchProviderOverridesVersion,
-                                       version_code);
-        prefs_->SetInteger(prefs::kLastKnownSearchVersion,
-                                       version_code);
-        template_url_service_->SearchEnginesChanged();
-      } else {
-        LOG(ERROR) << "[Kiwi] Failure, no search engine found";
-      }
-      url_loader_.reset();
-      already_loaded_ = false;
-      return ;
+    if (success) {
+      DVLOG(1) << "[Kiwi] Search engines processing is a success";
+      prefs_->SetUserPrefValue(prefs::kSearchProviderOverrides,
+                               std::move(overrides));
+      prefs_->SetInteger(prefs::kSearchProviderOverridesVersion,
+                         version_code);
+      prefs_->SetInteger(prefs::kLastKnownSearchVersion, version_code);
+      template_url_service_->SearchEnginesChanged();
+    } else {
+      LOG(ERROR) << "[Kiwi] Failure, no search engine found";
     }
-    LOG(ERROR) << "[Kiwi] Failed to parse search-engines JSON";
-  } else {
-    LOG(INFO) << "[Kiwi] Received search-engines [" << version_code << "] settings from server-side: " << body.length() << " chars but we already have it";
+    already_loaded_ = true;
+    return;
   }
-  url_loader_.reset();
-  already_loaded_ = false;
+  LOG(ERROR) << "[Kiwi] Failed to parse search-engines JSON";
 }
 
 void SearchURLFetcher::OnNetworkChanged(net::NetworkChangeNotifier::ConnectionType type) {
   // Ignore destructive signals.
-  LOG(INFO) << "[Kiwi] SearchURLFetcher::OnNetworkChanged";
   if (type == net::NetworkChangeNotifier::CONNECTION_NONE)
     return;
-  already_loaded_ = false;
-  url_loader_.reset();
+  // Pending loads already retry on network changes, and a list received once
+  // stays current for this run.
+  if (already_loaded_ || url_loader_)
+    return;
   FetchURL();
 }
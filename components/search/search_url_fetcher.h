@@ -10,7 +10,9 @@
 #include "components/pref_registry/pref_registry_syncable.h"
 #include "components/prefs/pref_service.h"
 #include "components/search_engines/template_url_service.h"
+#include "services/data_decoder/public/cpp/data_decoder.h"
 #include "base/callback.h"
+#include "base/memory/weak_ptr.h"
 #include "net/base/network_change_notifier.h"
 
 namespace network {
@@ -56,17 +58,24 @@ class SearchURLFetcher
  private:
   PrefService* prefs_;
   TemplateURLService* template_url_service_;
+  // The version of the list last applied.
   int search_version_;
-  bool already_loaded_;    // True if we've already loaded a URL once this run;
-                           // we won't load again until after a restart.
+  bool already_loaded_ = false;  // True if we've already loaded a URL once this
+                                 // run; we won't load again until after a
+                                 // restart.
   int search_version() const { return search_version_; }
 
   void OnURLLoadComplete(std::unique_ptr<std::string> response_body);
+  // Applies the list of version |version_code|, parsed out of process.
+  void OnJsonParsed(int version_code,
+                    data_decoder::DataDecoder::ValueOrError result);
   void OnNetworkChanged(net::NetworkChangeNotifier::ConnectionType type);
 
   static const char kSearchDomainCheckURL[];
   std::unique_ptr<network::SimpleURLLoader> url_loader_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+
+  base::WeakPtrFactory<SearchURLFetcher> weak_ptr_factory_{this};
 };
 
 #endif  // COMPONENTS_SEARCH_CORE_DISTILLER_URL_FETCHER_H_
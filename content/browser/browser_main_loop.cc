@@ -1250,9 +1250,11 @@ void BrowserMainLoop::PostCreateThreadsImpl() {
   bool always_uses_gpu = true;
   bool established_gpu_channel = false;
 #if BUILDFLAG(IS_ANDROID)
-  // TODO(crbug.com/439322): This should be set to |true|.
-  established_gpu_channel = false;
+  // When the GPU process is launched at startup anyway, also ask for the
+  // browser's channel to it right away. The first frame then finds the
+  // channel established, or pending, rather than starting the request.
   always_uses_gpu = ShouldStartGpuProcessOnBrowserStartup();
+  established_gpu_channel = always_uses_gpu;
   BrowserGpuChannelHostFactory::Initialize(established_gpu_channel);
 #else
   established_gpu_channel = true;
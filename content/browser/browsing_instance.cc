@@ -48,8 +48,11 @@ bool BrowsingInstance::HasSiteInstance(const SiteInfo& site_info) {
 scoped_refptr<SiteInstanceImpl> BrowsingInstance::GetSiteInstanceForURL(
     const UrlInfo& url_info,
     bool allow_default_instance) {
+  // Computing a SiteInfo can involve effective URL and isolated origin
+  // lookups, so it is done once here and shared with the helper.
+  const SiteInfo site_info = ComputeSiteInfoForURL(url_info);
   scoped_refptr<SiteInstanceImpl> site_instance =
-      GetSiteInstanceForURLHelper(url_info, allow_default_instance);
+      GetSiteInstanceForURLHelper(url_info, site_info, allow_default_instance);
 
   if (site_instance)
     return site_instance;
@@ -60,22 +63,24 @@ scoped_refptr<SiteInstanceImpl> BrowsingInstance::GetSiteInstanceForURL(
   // Set the site of this new SiteInstance, which will register it with us.
   // Some URLs should leave the SiteInstance's site unassigned, though if
   // `instance` is for a guest, we should always set the site to ensure that it
-  // carries guest information contained within SiteInfo.
+  // carries guest information contained within SiteInfo. No SiteInstance is
+  // registered for `site_info`, so it is what SetSite(url_info) would use.
   if (SiteInstance::ShouldAssignSiteForURL(url_info.url) ||
       isolation_context_.is_guest())
-    instance->SetSite(url_info);
+    instance->SetSiteForComputedSiteInfo(url_info, site_info);
   return instance;
 }
 
 SiteInfo BrowsingInstance::GetSiteInfoForURL(const UrlInfo& url_info,
                                              bool allow_default_instance) {
+  SiteInfo site_info = ComputeSiteInfoForURL(url_info);
   scoped_refptr<SiteInstanceImpl> site_instance =
-      GetSiteInstanceForURLHelper(url_info, allow_default_instance);
+      GetSiteInstanceForURLHelper(url_info, site_info, allow_default_instance);
 
   if (site_instance)
     return site_instance->GetSiteInfo();
 
-  return ComputeSiteInfoForURL(url_info);
+  return site_info;
 }
 
 scoped_refptr<SiteInstanceImpl> BrowsingInstance::GetSiteInstanceForSiteInfo(
@@ -91,8 +96,8 @@ scoped_refptr<SiteInstanceImpl> BrowsingInstance::GetSiteInstanceForSiteInfo(
 
 scoped_refptr<SiteInstanceImpl> BrowsingInstance::GetSiteInstanceForURLHelper(
     const UrlInfo& url_info,
+    const SiteInfo& site_info,
     bool allow_default_instance) {
-  const SiteInfo site_info = ComputeSiteInfoForURL(url_info);
   auto i = site_instance_map_.find(site_info);
   if (i != site_instance_map_.end())
     return i->second;
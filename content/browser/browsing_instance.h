@@ -163,11 +163,13 @@ class CONTENT_EXPORT BrowsingInstance final
   // returns |default_site_instance_| if |allow_default_instance| is true and
   // other conditions are met. If there is no existing SiteInstance that is
   // appropriate for |url_info|, |allow_default_instance| combination, then a
-  // nullptr is returned.
+  // nullptr is returned. |site_info| must be ComputeSiteInfoForURL(url_info),
+  // which callers reuse rather than compute again.
   //
   // Note: This method is not intended to be called by code outside this object.
   scoped_refptr<SiteInstanceImpl> GetSiteInstanceForURLHelper(
       const UrlInfo& url_info,
+      const SiteInfo& site_info,
       bool allow_default_instance);
 
   // Adds the given SiteInstance to our map, to ensure that we do not create
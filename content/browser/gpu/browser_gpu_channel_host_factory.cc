@@ -11,11 +11,13 @@
 #include "base/command_line.h"
 #include "base/compiler_specific.h"
 #include "base/location.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/process/process_handle.h"
 #include "base/synchronization/waitable_event.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
 #include "base/timer/timer.h"
 #include "base/trace_event/memory_dump_manager.h"
 #include "base/trace_event/trace_event.h"
@@ -117,6 +119,7 @@ class BrowserGpuChannelHostFactory::EstablishRequest
   scoped_refptr<gpu::GpuChannelHost> gpu_channel_;
   bool finished_;
   scoped_refptr<base::SingleThreadTaskRunner> main_task_runner_;
+  const base::TimeTicks start_time_ = base::TimeTicks::Now();
 };
 
 scoped_refptr<BrowserGpuChannelHostFactory::EstablishRequest>
@@ -218,6 +221,10 @@ void BrowserGpuChannelHostFactory::EstablishRequest::
 
 void BrowserGpuChannelHostFactory::EstablishRequest::FinishOnMain() {
   if (!finished_) {
+    if (gpu_channel_) {
+      UMA_HISTOGRAM_TIMES("GPU.EstablishGpuChannelTime",
+                          base::TimeTicks::Now() - start_time_);
+    }
     BrowserGpuChannelHostFactory* factory =
         BrowserGpuChannelHostFactory::instance();
     factory->GpuChannelEstablished(this);
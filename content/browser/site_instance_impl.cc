@@ -445,6 +445,15 @@ void SiteInstanceImpl::SetSite(const UrlInfo& url_info) {
       url_info, /* allow_default_instance */ false));
 }
 
+void SiteInstanceImpl::SetSiteForComputedSiteInfo(const UrlInfo& url_info,
+                                                  const SiteInfo& site_info) {
+  TRACE_EVENT2("navigation", "SiteInstanceImpl::SetSite", "site id",
+               id_.value(), "url", url_info.url.possibly_invalid_spec());
+  DCHECK(!has_site_);
+  original_url_ = url_info.url;
+  SetSiteInfoInternal(site_info);
+}
+
 void SiteInstanceImpl::SetSite(const SiteInfo& site_info) {
   TRACE_EVENT2("navigation", "SiteInstanceImpl::SetSite", "site id",
                id_.value(), "siteinfo", site_info.GetDebugString());
@@ -445,6 +445,11 @@ class CONTENT_EXPORT SiteInstanceImpl final : public SiteInstance {
   void SetSiteInfoToDefault(
       const StoragePartitionConfig& storage_partition_config);
 
+  // Same as SetSite(url_info), for a |site_info| that |browsing_instance_|
+  // has just computed for |url_info|. Saves computing it again.
+  void SetSiteForComputedSiteInfo(const UrlInfo& url_info,
+                                  const SiteInfo& site_info);
+
   // Sets |site_info_| with |site_info| and registers this object with
   // |browsing_instance_|. SetSite() calls this method to set the site and lock
   // for a user provided URL. This method should only be called by code that
@@ -1285,11 +1285,6 @@ void StoragePartitionImpl::Initialize(
   payment_app_context_ = new PaymentAppContextImpl();
   payment_app_context_->Init(service_worker_context_);
 
-  broadcast_channel_service_ = std::make_unique<BroadcastChannelService>();
-
-  bluetooth_allowed_devices_map_ =
-      std::make_unique<BluetoothAllowedDevicesMap>();
-
   url_loader_factory_getter_ = new URLLoaderFactoryGetter();
   url_loader_factory_getter_->Initialize(this);
 
@@ -1370,8 +1365,6 @@ void StoragePartitionImpl::Initialize(
                                                settings.size_in_bytes());
   }
 
-  font_access_manager_ = FontAccessManager::Create();
-
   if (base::FeatureList::IsEnabled(kPrivacySandboxAggregationService)) {
     aggregation_service_ =
         std::make_unique<AggregationServiceImpl>(is_in_memory(), path, this);
@@ -1604,14 +1597,24 @@ PaymentAppContextImpl* StoragePartitionImpl::GetPaymentAppContext() {
   return payment_app_context_.get();
 }
 
+// The broadcast channel service, the Bluetooth allowed devices map and the
+// font access manager hold no storage and register no quota client, and most
+// partitions never use them, so they are only created on first use. Like
+// their users, they live on the UI thread.
 BroadcastChannelService* StoragePartitionImpl::GetBroadcastChannelService() {
   DCHECK(initialized_);
+  if (!broadcast_channel_service_)
+    broadcast_channel_service_ = std::make_unique<BroadcastChannelService>();
   return broadcast_channel_service_.get();
 }
 
 BluetoothAllowedDevicesMap*
 StoragePartitionImpl::GetBluetoothAllowedDevicesMap() {
   DCHECK(initialized_);
+  if (!bluetooth_allowed_devices_map_) {
+    bluetooth_allowed_devices_map_ =
+        std::make_unique<BluetoothAllowedDevicesMap>();
+  }
   return bluetooth_allowed_devices_map_.get();
 }
 
@@ -1665,6 +1668,8 @@ AttributionManager* StoragePartitionImpl::GetAttributionManager() {
 
 FontAccessManager* StoragePartitionImpl::GetFontAccessManager() {
   DCHECK(initialized_);
+  if (!font_access_manager_)
+    font_access_manager_ = FontAccessManager::Create();
   return font_access_manager_.get();
 }
 
@@ -2657,7 +2662,8 @@ void StoragePartitionImpl::ResetURLLoaderFactories() {
 
 void StoragePartitionImpl::ClearBluetoothAllowedDevicesMapForTesting() {
   DCHECK(initialized_);
-  bluetooth_allowed_devices_map_->Clear();
+  if (bluetooth_allowed_devices_map_)
+    bluetooth_allowed_devices_map_->Clear();
 }
 
 void StoragePartitionImpl::ResetAttributionManagerForTesting(
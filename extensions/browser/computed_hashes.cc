@@ -169,6 +169,7 @@ absl::optional<ComputedHashes> ComputedHashes::CreateFromFile(
     base::FilePath relative_path =
         base::FilePath::FromUTF8Unsafe(*relative_path_utf8);
     std::vector<std::string> hashes;
+    hashes.reserve(block_hashes->GetListDeprecated().size());
 
     for (const base::Value& value : block_hashes->GetListDeprecated()) {
       if (!value.is_string()) {
@@ -236,7 +237,7 @@ absl::optional<ComputedHashes::Data> ComputedHashes::Compute(
 bool ComputedHashes::GetHashes(const base::FilePath& relative_path,
                                int* block_size,
                                std::vector<std::string>* hashes) const {
-  const Data::HashInfo* hash_info = data_.GetItem(relative_path);
+  const Data::HashInfo* hash_info = GetHashInfo(relative_path);
   if (!hash_info)
     return false;
 
@@ -245,6 +246,11 @@ bool ComputedHashes::GetHashes(const base::FilePath& relative_path,
   return true;
 }
 
+const ComputedHashes::Data::HashInfo* ComputedHashes::GetHashInfo(
+    const base::FilePath& relative_path) const {
+  return data_.GetItem(relative_path);
+}
+
 bool ComputedHashes::WriteToFile(const base::FilePath& path) const {
   // Make sure the directory exists.
   if (!base::CreateDirectoryAndGetError(path.DirName(), nullptr))
@@ -136,6 +136,11 @@ class ComputedHashes {
                  int* block_size,
                  std::vector<std::string>* hashes) const;
 
+  // Same as GetHashes, but returns the hash info for |relative_path| without
+  // copying it, or nullptr if the resource was not found. The result is owned
+  // by |this|.
+  const Data::HashInfo* GetHashInfo(const base::FilePath& relative_path) const;
+
   // Returns the SHA256 hash of each |block_size| chunk in |contents|.
   static std::vector<std::string> GetHashesForContent(
       const std::string& contents,
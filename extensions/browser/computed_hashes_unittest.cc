@@ -100,6 +100,14 @@ TEST(ComputedHashesTest, ComputedHashes) {
   EXPECT_EQ(hashes1, read_hashes1);
   EXPECT_EQ(hashes2, read_hashes2);
 
+  const ComputedHashes::Data::HashInfo* hash_info =
+      computed_hashes.GetHashInfo(path2);
+  ASSERT_TRUE(hash_info);
+  EXPECT_EQ(kBlockSize2, hash_info->block_size);
+  EXPECT_EQ(hashes2, hash_info->hashes);
+  EXPECT_FALSE(computed_hashes.GetHashInfo(
+      base::FilePath(FILE_PATH_LITERAL("missing.txt"))));
+
   // Make sure we can lookup hashes for a file using incorrect case
   base::FilePath path1_badcase(FILE_PATH_LITERAL("FoO.txt"));
   std::vector<std::string> read_hashes1_badcase;
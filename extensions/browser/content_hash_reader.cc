@@ -41,13 +41,12 @@ std::unique_ptr<const ContentHashReader> ContentHashReader::Create(
   const ComputedHashes& computed_hashes = content_hash->computed_hashes();
   absl::optional<std::string> root;
 
-  int block_size;
-  std::vector<std::string> block_hashes;
+  const ComputedHashes::Data::HashInfo* hash_info =
+      computed_hashes.GetHashInfo(relative_path);
 
-  if (computed_hashes.GetHashes(relative_path, &block_size, &block_hashes) &&
-      block_size % crypto::kSHA256Length == 0) {
-    root =
-        ComputeTreeHashRoot(block_hashes, block_size / crypto::kSHA256Length);
+  if (hash_info && hash_info->block_size % crypto::kSHA256Length == 0) {
+    root = ComputeTreeHashRoot(hash_info->hashes,
+                               hash_info->block_size / crypto::kSHA256Length);
   }
 
   ContentHash::TreeHashVerificationResult verification =
@@ -79,15 +78,17 @@ std::unique_ptr<const ContentHashReader> ContentHashReader::Create(
         new ContentHashReader(InitStatus::NO_HASHES_FOR_RESOURCE));
   }
 
+  DCHECK(hash_info);
   auto hash_reader =
       base::WrapUnique(new ContentHashReader(InitStatus::SUCCESS));
-  hash_reader->block_size_ = block_size;
-  hash_reader->hashes_ = std::move(block_hashes);
+  hash_reader->block_size_ = hash_info->block_size;
+  hash_reader->content_hash_ = content_hash;
+  hash_reader->hashes_ = &hash_info->hashes;
   return hash_reader;  // Success.
 }
 
 int ContentHashReader::block_count() const {
-  return hashes_.size();
+  return hashes_ ? hashes_->size() : 0;
 }
 
 int ContentHashReader::block_size() const {
@@ -100,9 +101,9 @@ bool ContentHashReader::GetHashForBlock(int block_index,
     return false;
   DCHECK(block_index >= 0);
 
-  if (static_cast<unsigned>(block_index) >= hashes_.size())
+  if (static_cast<unsigned>(block_index) >= hashes_->size())
     return false;
-  *result = &hashes_[block_index];
+  *result = &(*hashes_)[block_index];
 
   return true;
 }
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/memory/raw_ptr.h"
 #include "base/memory/ref_counted.h"
 #include "base/version.h"
 #include "extensions/browser/computed_hashes.h"
@@ -76,7 +77,10 @@ class ContentHashReader {
   // The blocksize used for generating the hashes.
   int block_size_ = 0;
 
-  std::vector<std::string> hashes_;
+  // Keeps |hashes_| alive. The block hashes are shared by all the readers of
+  // an extension rather than copied for each resource.
+  scoped_refptr<const ContentHash> content_hash_;
+  raw_ptr<const std::vector<std::string>> hashes_ = nullptr;
 };
 
 }  // namespace extensions
@@ -32,6 +32,7 @@
 #include "extensions/common/permissions/permissions_data.h"
 #include "extensions/common/trace_util.h"
 #include "extensions/common/user_script.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 using perfetto::protos::pbzero::ChromeTrackEvent;
 
@@ -224,6 +225,39 @@ GURL GetEffectiveDocumentURL(
       kAllowInaccessibleParents);
 }
 
+// Memoizes GetEffectiveDocumentURL() for one `frame` and `url`. The result
+// only depends on the script's MatchOriginAsFallbackBehavior, while the same
+// frame is checked against the content scripts of every enabled extension.
+class EffectiveDocumentUrlCache {
+ public:
+  EffectiveDocumentUrlCache(content::RenderFrameHost* frame, const GURL& url)
+      : frame_(frame), url_(url) {}
+
+  EffectiveDocumentUrlCache(const EffectiveDocumentUrlCache&) = delete;
+  EffectiveDocumentUrlCache& operator=(const EffectiveDocumentUrlCache&) =
+      delete;
+
+  content::RenderFrameHost* frame() const { return frame_; }
+
+  const GURL& Get(MatchOriginAsFallbackBehavior match_origin_as_fallback) {
+    absl::optional<GURL>& effective_url =
+        effective_urls_[static_cast<size_t>(match_origin_as_fallback)];
+    if (!effective_url)
+      effective_url = GetEffectiveDocumentURL(frame_, url_,
+                                              match_origin_as_fallback);
+    return *effective_url;
+  }
+
+ private:
+  static constexpr size_t kBehaviorCount =
+      static_cast<size_t>(MatchOriginAsFallbackBehavior::kMaxValue) + 1;
+
+  const raw_ptr<content::RenderFrameHost> frame_;
+  const GURL& url_;
+  // Indexed by MatchOriginAsFallbackBehavior.
+  absl::optional<GURL> effective_urls_[kBehaviorCount];
+};
+
 // If `user_script` will inject JavaScript content script into the target of
 // `navigation`, then DoesContentScriptMatch returns true.  Otherwise it may
 // return either true or false.  Note that this function ignores CSS content
@@ -238,9 +272,8 @@ GURL GetEffectiveDocumentURL(
 // This is okay, because the top-level doc comment for ContentScriptTracker
 // documents that false positives are expected and why they are okay.
 bool DoesContentScriptMatch(const UserScript& user_script,
-                            content::RenderFrameHost* frame,
-                            const GURL& url) {
-  content::RenderProcessHost& process = *frame->GetProcess();
+                            EffectiveDocumentUrlCache& effective_urls) {
+  content::RenderProcessHost& process = *effective_urls.frame()->GetProcess();
   const ExtensionId& extension_id = user_script.extension_id();
 
   // ContentScriptTracker only needs to track Javascript content scripts (e.g.
@@ -255,8 +288,8 @@ bool DoesContentScriptMatch(const UserScript& user_script,
     return false;
   }
 
-  GURL effective_url = GetEffectiveDocumentURL(
-      frame, url, user_script.match_origin_as_fallback());
+  const GURL& effective_url =
+      effective_urls.Get(user_script.match_origin_as_fallback());
   if (user_script.url_patterns().MatchesSecurityOrigin(effective_url)) {
     TRACE_EVENT_INSTANT("extensions",
                         "ContentScriptTracker/DoesContentScriptMatch=true",
@@ -296,12 +329,11 @@ void HandleProgrammaticContentScriptInjection(
 }
 
 bool DoContentScriptsMatch(const UserScriptList& content_script_list,
-                           content::RenderFrameHost* frame,
-                           const GURL& url) {
+                           EffectiveDocumentUrlCache& effective_urls) {
   return base::ranges::any_of(
       content_script_list.begin(), content_script_list.end(),
-      [frame, &url](const std::unique_ptr<UserScript>& script) {
-        return DoesContentScriptMatch(*script, frame, url);
+      [&effective_urls](const std::unique_ptr<UserScript>& script) {
+        return DoesContentScriptMatch(*script, effective_urls);
       });
 }
 
@@ -314,8 +346,8 @@ bool DoContentScriptsMatch(const UserScriptList& content_script_list,
 //
 // Note that this method ignores CSS content scripts.
 bool DoContentScriptsMatch(const Extension& extension,
-                           content::RenderFrameHost* frame,
-                           const GURL& url) {
+                           EffectiveDocumentUrlCache& effective_urls) {
+  content::RenderFrameHost* frame = effective_urls.frame();
   TRACE_EVENT("extensions", "ContentScriptTracker/DoContentScriptsMatch",
               ChromeTrackEvent::kRenderProcessHost, *frame->GetProcess(),
               ChromeTrackEvent::kChromeExtensionId,
@@ -363,7 +395,7 @@ bool DoContentScriptsMatch(const Extension& extension,
     // Return true if manifest-declared content scripts match.
     const UserScriptList& manifest_scripts =
         ContentScriptsInfo::GetContentScripts(&extension);
-    if (DoContentScriptsMatch(manifest_scripts, frame, url)) {
+    if (DoContentScriptsMatch(manifest_scripts, effective_urls)) {
       TRACE_EVENT_INSTANT(
           "extensions",
           "ContentScriptTracker/DoContentScriptsMatch=true(manifest)",
@@ -382,7 +414,7 @@ bool DoContentScriptsMatch(const Extension& extension,
       const UserScriptList& dynamic_scripts =
           manager->GetUserScriptLoaderForExtension(extension.id())
               ->GetLoadedDynamicScripts();
-      if (DoContentScriptsMatch(dynamic_scripts, frame, url)) {
+      if (DoContentScriptsMatch(dynamic_scripts, effective_urls)) {
         TRACE_EVENT_INSTANT(
             "extensions",
             "ContentScriptTracker/DoContentScriptsMatch=true(dynamic)",
@@ -403,6 +435,13 @@ bool DoContentScriptsMatch(const Extension& extension,
   return false;
 }
 
+bool DoContentScriptsMatch(const Extension& extension,
+                           content::RenderFrameHost* frame,
+                           const GURL& url) {
+  EffectiveDocumentUrlCache effective_urls(frame, url);
+  return DoContentScriptsMatch(extension, effective_urls);
+}
+
 std::vector<const Extension*> GetExtensionsInjectingContentScripts(
     content::NavigationHandle* navigation) {
   content::RenderFrameHost* frame = navigation->GetRenderFrameHost();
@@ -412,9 +451,10 @@ std::vector<const Extension*> GetExtensionsInjectingContentScripts(
   const ExtensionRegistry* registry =
       ExtensionRegistry::Get(frame->GetProcess()->GetBrowserContext());
   DCHECK(registry);  // This method shouldn't be called during shutdown.
+  EffectiveDocumentUrlCache effective_urls(frame, url);
   for (const auto& it : registry->enabled_extensions()) {
     const Extension& extension = *it;
-    if (!DoContentScriptsMatch(extension, frame, url))
+    if (!DoContentScriptsMatch(extension, effective_urls))
       continue;
 
     extensions_injecting_content_scripts.push_back(&extension);
@@ -10,6 +10,7 @@
 #include "base/lazy_instance.h"
 #include "base/memory/raw_ptr.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/strings/string_piece.h"
 #include "base/task/thread_pool.h"
 #include "base/timer/elapsed_timer.h"
 #include "content/public/browser/browser_thread.h"
@@ -159,14 +160,31 @@ void ContentVerifyJob::ReadImpl(const char* data,
     if (current_block_ >= hash_reader_->block_count())
       return DispatchFailureCallback(HASH_MISMATCH);
 
+    // Hash whole blocks straight out of |data| in one shot. This skips
+    // creating an incremental hasher for each block, which is most of the
+    // per-block cost for large resources read in big chunks.
+    const int block_size = hash_reader_->block_size();
+    if (!current_hash_ && count - bytes_added >= block_size) {
+      uint8_t block_hash[crypto::kSHA256Length];
+      crypto::SHA256HashString(
+          base::StringPiece(data + bytes_added, block_size), block_hash,
+          sizeof(block_hash));
+      bytes_added += block_size;
+      total_bytes_read_ += block_size;
+      if (!MatchesExpectedHash(block_hash)) {
+        DispatchFailureCallback(HASH_MISMATCH);
+        return;
+      }
+      continue;
+    }
+
     if (!current_hash_) {
       current_hash_byte_count_ = 0;
       current_hash_ = crypto::SecureHash::Create(crypto::SecureHash::SHA256);
     }
     // Compute how many bytes we should hash, and add them to the current hash.
     int bytes_to_hash =
-        std::min(hash_reader_->block_size() - current_hash_byte_count_,
-                 count - bytes_added);
+        std::min(block_size - current_hash_byte_count_, count - bytes_added);
     DCHECK_GT(bytes_to_hash, 0);
     current_hash_->Update(data + bytes_added, bytes_to_hash);
     bytes_added += bytes_to_hash;
@@ -175,8 +193,7 @@ void ContentVerifyJob::ReadImpl(const char* data,
 
     // If we finished reading a block worth of data, finish computing the hash
     // for it and make sure the expected hash matches.
-    if (current_hash_byte_count_ == hash_reader_->block_size() &&
-        !FinishBlock()) {
+    if (current_hash_byte_count_ == block_size && !FinishBlock()) {
       DispatchFailureCallback(HASH_MISMATCH);
       return;
     }
@@ -197,20 +214,23 @@ bool ContentVerifyJob::FinishBlock() {
     // hash in this case.
     current_hash_ = crypto::SecureHash::Create(crypto::SecureHash::SHA256);
   }
-  std::string final(crypto::kSHA256Length, 0);
-  current_hash_->Finish(std::data(final), final.size());
+  uint8_t final[crypto::kSHA256Length];
+  current_hash_->Finish(final, sizeof(final));
   current_hash_.reset();
   current_hash_byte_count_ = 0;
 
-  int block = current_block_++;
+  return MatchesExpectedHash(final);
+}
 
-  const std::string* expected_hash = NULL;
-  if (!hash_reader_->GetHashForBlock(block, &expected_hash) ||
-      *expected_hash != final) {
-    return false;
-  }
+bool ContentVerifyJob::MatchesExpectedHash(
+    const uint8_t (&hash)[crypto::kSHA256Length]) {
+  int block = current_block_++;
 
-  return true;
+  const std::string* expected_hash = nullptr;
+  return hash_reader_->GetHashForBlock(block, &expected_hash) &&
+         base::StringPiece(*expected_hash) ==
+             base::StringPiece(reinterpret_cast<const char*>(hash),
+                               sizeof(hash));
 }
 
 void ContentVerifyJob::OnHashesReady(
@@ -16,6 +16,7 @@
 #include "base/synchronization/lock.h"
 #include "base/time/time.h"
 #include "base/version.h"
+#include "crypto/sha2.h"
 #include "extensions/browser/content_verifier/content_verifier_key.h"
 #include "extensions/common/extension_id.h"
 #include "mojo/public/c/system/types.h"
@@ -125,6 +126,10 @@ class ContentVerifyJob : public base::RefCountedThreadSafe<ContentVerifyJob> {
   // still ok so far, or false if a mismatch was detected.
   bool FinishBlock();
 
+  // Moves on to the next block, returning whether |hash| is the one expected
+  // for the block just finished.
+  bool MatchesExpectedHash(const uint8_t (&hash)[crypto::kSHA256Length]);
+
   // Dispatches the failure callback with the given reason.
   void DispatchFailureCallback(FailureReason reason);
 
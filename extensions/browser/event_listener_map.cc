@@ -312,21 +312,28 @@ void EventListenerMap::LoadFilteredLazyListeners(
   }
 }
 
-std::set<const EventListener*> EventListenerMap::GetEventListeners(
+std::vector<const EventListener*> EventListenerMap::GetEventListeners(
     const Event& event) {
-  std::set<const EventListener*> interested_listeners;
+  std::vector<const EventListener*> interested_listeners;
   if (IsFilteredEvent(event)) {
     // Look up the interested listeners via the EventFilter.
     std::set<MatcherID> ids = event_filter_.MatchEvent(
         event.event_name, *event.filter_info, MSG_ROUTING_NONE);
+    interested_listeners.reserve(ids.size());
     for (const MatcherID& id : ids) {
-      EventListener* listener = listeners_by_matcher_id_[id];
-      CHECK(listener);
-      interested_listeners.insert(listener);
+      auto listener = listeners_by_matcher_id_.find(id);
+      CHECK(listener != listeners_by_matcher_id_.end());
+      interested_listeners.push_back(listener->second);
     }
   } else {
-    for (const auto& listener : listeners_[event.event_name])
-      interested_listeners.insert(listener.get());
+    // AddListener() keeps the listeners of an event unique, so they can be
+    // copied as they are.
+    auto it = listeners_.find(event.event_name);
+    if (it == listeners_.end())
+      return interested_listeners;
+    interested_listeners.reserve(it->second.size());
+    for (const auto& listener : it->second)
+      interested_listeners.push_back(listener.get());
   }
 
   return interested_listeners;
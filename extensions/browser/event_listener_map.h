@@ -177,8 +177,9 @@ class EventListenerMap {
   // Get the map of all EventListeners.
   const ListenerMap& listeners() const { return listeners_; }
 
-  // Returns the set of listeners that want to be notified of |event|.
-  std::set<const EventListener*> GetEventListeners(const Event& event);
+  // Returns the listeners that want to be notified of |event|, each once, in
+  // no particular order.
+  std::vector<const EventListener*> GetEventListeners(const Event& event);
 
   const ListenerList& GetEventListenersByName(const std::string& event_name) {
     return listeners_[event_name];
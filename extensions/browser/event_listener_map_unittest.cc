@@ -207,7 +207,8 @@ TEST_F(EventListenerMapTest, FilteredEventsGoToAllMatchingListeners) {
 
   std::unique_ptr<Event> event(CreateNamedEvent(kEvent1Name));
   event->filter_info->url = GURL("http://www.google.com");
-  std::set<const EventListener*> targets(listeners_->GetEventListeners(*event));
+  std::vector<const EventListener*> targets(
+      listeners_->GetEventListeners(*event));
   ASSERT_EQ(4u, targets.size());
 }
 
@@ -235,7 +236,7 @@ TEST_P(EventListenerMapWithContextTest,
                                     test_case.url_of_event.c_str()));
     std::unique_ptr<Event> event(
         CreateEvent(kEvent1Name, GURL(test_case.url_of_event)));
-    std::set<const EventListener*> targets(
+    std::vector<const EventListener*> targets(
         listeners_->GetEventListeners(*event));
     ASSERT_EQ(1u, targets.size());
     EXPECT_TRUE(
@@ -249,7 +250,7 @@ TEST_P(EventListenerMapWithContextTest,
   {
     std::unique_ptr<Event> event(
         CreateEvent(kEvent1Name, GURL("http://does_not_match.com")));
-    std::set<const EventListener*> targets(
+    std::vector<const EventListener*> targets(
         listeners_->GetEventListeners(*event));
     EXPECT_TRUE(targets.empty());
   }
@@ -265,7 +266,8 @@ TEST_F(EventListenerMapTest, LazyAndUnlazyListenersGetReturned) {
 
   std::unique_ptr<Event> event(CreateNamedEvent(kEvent1Name));
   event->filter_info->url = GURL("http://www.google.com");
-  std::set<const EventListener*> targets(listeners_->GetEventListeners(*event));
+  std::vector<const EventListener*> targets(
+      listeners_->GetEventListeners(*event));
   ASSERT_EQ(2u, targets.size());
 }
 
@@ -347,7 +349,8 @@ TEST_P(EventListenerMapWithContextTest, TestLazyDoubleAddIsUndoneByRemove) {
 
   std::unique_ptr<Event> event(CreateNamedEvent(kEvent1Name));
   event->filter_info->url = GURL("http://www.google.com");
-  std::set<const EventListener*> targets(listeners_->GetEventListeners(*event));
+  std::vector<const EventListener*> targets(
+      listeners_->GetEventListeners(*event));
   ASSERT_EQ(0u, targets.size());
 }
 
@@ -373,7 +376,7 @@ TEST_F(EventListenerMapTest, RemoveListenersForExtension) {
 
   std::unique_ptr<Event> event1(CreateNamedEvent(kEvent1Name));
   event1->filter_info->url = GURL("http://www.google.com");
-  std::set<const EventListener*> targets(
+  std::vector<const EventListener*> targets(
       listeners_->GetEventListeners(*event1));
   ASSERT_EQ(0u, targets.size());
 
@@ -532,7 +535,7 @@ TEST_P(EventListenerMapWithContextTest, AddLazyListenersFromPreferences) {
                                     test_case.url_of_event.c_str()));
     std::unique_ptr<Event> event(
         CreateEvent(kEvent1Name, GURL(test_case.url_of_event)));
-    std::set<const EventListener*> targets(
+    std::vector<const EventListener*> targets(
         listeners_->GetEventListeners(*event));
     ASSERT_EQ(1u, targets.size());
     EXPECT_TRUE(
@@ -546,7 +549,7 @@ TEST_P(EventListenerMapWithContextTest, AddLazyListenersFromPreferences) {
   {
     std::unique_ptr<Event> event(
         CreateEvent(kEvent1Name, GURL("http://does_not_match.com")));
-    std::set<const EventListener*> targets(
+    std::vector<const EventListener*> targets(
         listeners_->GetEventListeners(*event));
     EXPECT_EQ(0u, targets.size());
   }
@@ -562,7 +565,8 @@ TEST_F(EventListenerMapTest, CorruptedExtensionPrefsShouldntCrash) {
 
   std::unique_ptr<Event> event(
       CreateEvent(kEvent1Name, GURL("http://www.google.com")));
-  std::set<const EventListener*> targets(listeners_->GetEventListeners(*event));
+  std::vector<const EventListener*> targets(
+      listeners_->GetEventListeners(*event));
   ASSERT_EQ(0u, targets.size());
 }
 
@@ -842,7 +842,6 @@ void EventRouter::DispatchEventWithLazyListener(const std::string& extension_id,
 
 void EventRouter::DispatchEventImpl(const std::string& restrict_to_extension_id,
                                     std::unique_ptr<Event> event) {
-  LOG(INFO) << "[Kiwi] EventRouter::DispatchEventImpl: " << restrict_to_extension_id;
   DCHECK(event);
   // We don't expect to get events from a completely different browser context.
   DCHECK(!event->restrict_to_browser_context ||
@@ -856,7 +855,7 @@ void EventRouter::DispatchEventImpl(const std::string& restrict_to_extension_id,
   for (TestObserver& observer : test_observers_)
     observer.OnWillDispatchEvent(*event);
 
-  std::set<const EventListener*> listeners(
+  std::vector<const EventListener*> listeners(
       listeners_.GetEventListeners(*event));
 
   LazyEventDispatcher lazy_event_dispatcher(
@@ -5,8 +5,8 @@
 #ifndef EXTENSIONS_BROWSER_EXTENSION_FUNCTION_REGISTRY_H_
 #define EXTENSIONS_BROWSER_EXTENSION_FUNCTION_REGISTRY_H_
 
-#include <map>
 #include <string>
+#include <unordered_map>
 
 #include "base/memory/scoped_refptr.h"
 #include "extensions/browser/extension_function_histogram_value.h"
@@ -42,7 +42,9 @@ class ExtensionFunctionRegistry {
     extensions::functions::HistogramValue histogram_value_ =
         extensions::functions::UNKNOWN;
   };
-  using FactoryMap = std::map<std::string, FactoryEntry>;
+  // Looked up by name for every extension API call, so hashed rather than
+  // ordered.
+  using FactoryMap = std::unordered_map<std::string, FactoryEntry>;
 
   static ExtensionFunctionRegistry& GetInstance();
   ExtensionFunctionRegistry();
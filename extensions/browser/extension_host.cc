@@ -120,6 +120,14 @@ void ExtensionHost::CreateRendererSoon() {
     // frame synchronously. The process creation is the real meaty part that we
     // want to defer.
     CreateRendererNow();
+  } else if (extension_host_type_ == mojom::ViewType::kOffscreenDocument ||
+             (extension_host_type_ ==
+                  mojom::ViewType::kExtensionBackgroundPage &&
+              BackgroundInfo::HasLazyBackgroundPage(extension_))) {
+    // Offscreen documents are opened by a waiting API call, and event pages
+    // are mostly woken up to handle an event. Neither should wait for the
+    // persistent background pages that are started with the profile.
+    ExtensionHostQueue::GetInstance().AddUrgent(this);
   } else {
     ExtensionHostQueue::GetInstance().Add(this);
   }
@@ -5,6 +5,7 @@
 #include "extensions/browser/extension_host_queue.h"
 
 #include <algorithm>
+#include <iterator>
 
 #include "base/bind.h"
 #include "base/location.h"
@@ -31,10 +32,19 @@ void ExtensionHostQueue::Add(DeferredStartRenderHost* host) {
   PostTask();
 }
 
+void ExtensionHostQueue::AddUrgent(DeferredStartRenderHost* host) {
+  queue_.insert(std::next(queue_.begin(), urgent_count_), host);
+  ++urgent_count_;
+  PostTask();
+}
+
 void ExtensionHostQueue::Remove(DeferredStartRenderHost* host) {
   auto it = std::find(queue_.begin(), queue_.end(), host);
-  if (it != queue_.end())
-    queue_.erase(it);
+  if (it == queue_.end())
+    return;
+  if (static_cast<size_t>(std::distance(queue_.begin(), it)) < urgent_count_)
+    --urgent_count_;
+  queue_.erase(it);
 }
 
 void ExtensionHostQueue::PostTask() {
@@ -53,8 +63,11 @@ void ExtensionHostQueue::ProcessOneHost() {
   if (queue_.empty())
     return;  // can happen on shutdown
 
-  queue_.front()->CreateRendererNow();
+  DeferredStartRenderHost* host = queue_.front();
   queue_.pop_front();
+  if (urgent_count_)
+    --urgent_count_;
+  host->CreateRendererNow();
 
   if (!queue_.empty())
     PostTask();
@@ -31,6 +31,11 @@ class ExtensionHostQueue {
   // Adds a host to the queue for RenderView creation.
   void Add(DeferredStartRenderHost* host);
 
+  // Like Add(), but the host is started ahead of those added with Add(), for
+  // hosts that something is already waiting on. Such hosts are started in
+  // the order they're added among themselves.
+  void AddUrgent(DeferredStartRenderHost* host);
+
   // Removes a host from the queue (for example, it may be deleted before
   // having a chance to start)
   void Remove(DeferredStartRenderHost* host);
@@ -58,6 +63,10 @@ class ExtensionHostQueue {
   // The list of DeferredStartRenderHosts waiting to be started.
   std::list<DeferredStartRenderHost*> queue_;
 
+  // The number of hosts at the front of |queue_| that were added with
+  // AddUrgent().
+  size_t urgent_count_ = 0;
+
   base::WeakPtrFactory<ExtensionHostQueue> ptr_factory_{this};
 };
 
@@ -54,8 +54,10 @@ void ExtensionPrefValueMap::SetExtensionPref(const std::string& ext_id,
                                              ExtensionPrefsScope scope,
                                              base::Value value) {
   PrefValueMap* prefs = GetExtensionPrefValueMap(ext_id, scope);
-  if (prefs->SetValue(key, std::move(value)))
+  if (prefs->SetValue(key, std::move(value))) {
+    InvalidateControllers(key);
     NotifyPrefValueChanged(key);
+  }
 }
 
 void ExtensionPrefValueMap::RemoveExtensionPref(
@@ -63,8 +65,10 @@ void ExtensionPrefValueMap::RemoveExtensionPref(
     const std::string& key,
     ExtensionPrefsScope scope) {
   PrefValueMap* prefs = GetExtensionPrefValueMap(ext_id, scope);
-  if (prefs->RemoveValue(key))
+  if (prefs->RemoveValue(key)) {
+    InvalidateControllers(key);
     NotifyPrefValueChanged(key);
+  }
 }
 
 bool ExtensionPrefValueMap::CanExtensionControlPref(
@@ -101,6 +105,7 @@ void ExtensionPrefValueMap::ClearAllIncognitoSessionOnlyPreferences() {
       deleted_keys.insert(pref.first);
     inc_prefs.Clear();
   }
+  InvalidateAllControllers();
 
   for (const auto& key : deleted_keys)
     NotifyPrefValueChanged(key);
@@ -131,6 +136,7 @@ void ExtensionPrefValueMap::RegisterExtension(const std::string& ext_id,
 
   entries_[ext_id]->enabled = is_enabled;
   entries_[ext_id]->incognito_enabled = is_incognito_enabled;
+  InvalidateAllControllers();
 }
 
 void ExtensionPrefValueMap::UnregisterExtension(const std::string& ext_id) {
@@ -141,6 +147,7 @@ void ExtensionPrefValueMap::UnregisterExtension(const std::string& ext_id) {
   GetExtensionControlledKeys(*(i->second.get()), &keys);
 
   entries_.erase(i);
+  InvalidateAllControllers();
 
   NotifyPrefValueChanged(keys);
 }
@@ -157,6 +164,7 @@ void ExtensionPrefValueMap::SetExtensionState(const std::string& ext_id,
   std::set<std::string> keys;  // keys set by this extension
   GetExtensionControlledKeys(*(i->second), &keys);
   i->second->enabled = is_enabled;
+  InvalidateAllControllers();
   NotifyPrefValueChanged(keys);
 }
 
@@ -173,6 +181,7 @@ void ExtensionPrefValueMap::SetExtensionIncognitoState(
   std::set<std::string> keys;  // keys set by this extension
   GetExtensionControlledKeys(*(i->second), &keys);
   i->second->incognito_enabled = is_incognito_enabled;
+  InvalidateAllControllers();
   NotifyPrefValueChanged(keys);
 }
 
@@ -288,6 +297,26 @@ ExtensionPrefValueMap::GetEffectivePrefValueController(
     const std::string& key,
     bool incognito,
     bool* from_incognito) const {
+  auto cached = controller_cache_.find(std::make_pair(key, incognito));
+  if (cached == controller_cache_.end()) {
+    CachedController controller;
+    controller.winner = ComputeEffectivePrefValueController(
+        key, incognito, &controller.from_incognito);
+    cached = controller_cache_
+                 .emplace(std::make_pair(key, incognito), controller)
+                 .first;
+  }
+  // Like the uncached lookup, only set |from_incognito| if there is a winner.
+  if (from_incognito && cached->second.winner != entries_.cend())
+    *from_incognito = cached->second.from_incognito;
+  return cached->second.winner;
+}
+
+ExtensionPrefValueMap::ExtensionEntryMap::const_iterator
+ExtensionPrefValueMap::ComputeEffectivePrefValueController(
+    const std::string& key,
+    bool incognito,
+    bool* from_incognito) const {
   auto winner = entries_.cend();
   base::Time winners_install_time;
 
@@ -348,6 +377,15 @@ ExtensionPrefValueMap::GetEffectivePrefValueController(
   return winner;
 }
 
+void ExtensionPrefValueMap::InvalidateControllers(const std::string& key) {
+  controller_cache_.erase(std::make_pair(key, false));
+  controller_cache_.erase(std::make_pair(key, true));
+}
+
+void ExtensionPrefValueMap::InvalidateAllControllers() {
+  controller_cache_.clear();
+}
+
 void ExtensionPrefValueMap::AddObserver(
     ExtensionPrefValueMap::Observer* observer) {
   observers_.AddObserver(observer);
@@ -9,6 +9,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 
 #include "base/observer_list.h"
 #include "components/keyed_service/core/keyed_service.h"
@@ -187,11 +188,22 @@ class ExtensionPrefValueMap : public KeyedService {
   // if |from_incognito| is not NULL, it is set to true if the effective pref
   // value is coming from the incognito preferences, false if it is coming from
   // the normal ones.
+  // The result is cached until the next change to |entries_|.
   ExtensionEntryMap::const_iterator GetEffectivePrefValueController(
       const std::string& key,
       bool incognito,
       bool* from_incognito) const;
 
+  // Same as above, without the cache. Walks all extensions.
+  ExtensionEntryMap::const_iterator ComputeEffectivePrefValueController(
+      const std::string& key,
+      bool incognito,
+      bool* from_incognito) const;
+
+  // Drops the cached controllers of |key|, or of all keys.
+  void InvalidateControllers(const std::string& key);
+  void InvalidateAllControllers();
+
   void NotifyOfDestruction();
   void NotifyPrefValueChanged(const std::string& key);
   void NotifyPrefValueChanged(const std::set<std::string>& keys);
@@ -201,6 +213,16 @@ class ExtensionPrefValueMap : public KeyedService {
   // are stored in ExtensionPrefStores.
   ExtensionEntryMap entries_;
 
+  // The controller of each (key, incognito) that has been looked up since
+  // the last change to |entries_|. The network and search code look up the
+  // same few keys often, while extensions rarely change them.
+  struct CachedController {
+    ExtensionEntryMap::const_iterator winner;
+    bool from_incognito = false;
+  };
+  mutable std::map<std::pair<std::string, bool>, CachedController>
+      controller_cache_;
+
   // In normal Profile shutdown, Shutdown() notifies observers that we are
   // being destroyed. In tests, it isn't called, so the notification must
   // be done in the destructor. This bit tracks whether it has been done yet.
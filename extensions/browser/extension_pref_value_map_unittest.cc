@@ -294,6 +294,29 @@ TEST_F(ExtensionPrefValueMapTest, ReenableExt) {
   EXPECT_EQ("val1", GetValue(kPref1, false));
 }
 
+// Tests that looked up controllers follow later changes to the extensions.
+TEST_F(ExtensionPrefValueMapTest, CachedControllerFollowsChanges) {
+  RegisterExtension(kExt1, CreateTime(10));
+  epvm_.SetExtensionPref(kExt1, kPref1, kRegular, CreateVal("val1"));
+  EXPECT_EQ("val1", GetValue(kPref1, false));
+  EXPECT_EQ(kExt1, epvm_.GetExtensionControllingPref(kPref1));
+
+  RegisterExtension(kExt2, CreateTime(20));
+  epvm_.SetExtensionPref(kExt2, kPref1, kRegular, CreateVal("val2"));
+  EXPECT_EQ("val2", GetValue(kPref1, false));
+  EXPECT_EQ(kExt2, epvm_.GetExtensionControllingPref(kPref1));
+
+  epvm_.SetExtensionState(kExt2, false);
+  EXPECT_EQ("val1", GetValue(kPref1, false));
+
+  epvm_.SetExtensionState(kExt2, true);
+  EXPECT_EQ("val2", GetValue(kPref1, false));
+
+  epvm_.UnregisterExtension(kExt2);
+  EXPECT_EQ("val1", GetValue(kPref1, false));
+  EXPECT_EQ(kExt1, epvm_.GetExtensionControllingPref(kPref1));
+}
+
 struct OverrideIncognitoTestCase {
   OverrideIncognitoTestCase(bool enable_ext1_in_incognito,
                             bool enable_ext2_in_incognito,
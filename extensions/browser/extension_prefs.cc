@@ -556,6 +556,8 @@ void ExtensionPrefs::UpdateExtensionPref(
   DCHECK_EQ(PrefScope::kExtensionSpecific, pref.scope);
   DCHECK(CheckPrefType(pref.type, data_value.get()));
   DCHECK(crx_file::id_util::IdIsValid(extension_id));
+  if (ExtensionPrefValueEquals(extension_id, pref.name, data_value.get()))
+    return;
   ScopedExtensionPrefUpdate update(prefs_, extension_id);
   update->Set(pref.name, std::move(data_value));
 }
@@ -568,6 +570,8 @@ void ExtensionPrefs::UpdateExtensionPref(
     NOTREACHED() << "Invalid extension_id " << extension_id;
     return;
   }
+  if (ExtensionPrefValueEquals(extension_id, key, data_value.get()))
+    return;
   ScopedExtensionPrefUpdate update(prefs_, extension_id);
   if (data_value)
     update->Set(key, std::move(data_value));
@@ -575,6 +579,19 @@ void ExtensionPrefs::UpdateExtensionPref(
     update->Remove(key);
 }
 
+bool ExtensionPrefs::ExtensionPrefValueEquals(const std::string& extension_id,
+                                              base::StringPiece key,
+                                              const base::Value* value) const {
+  // Updates of an extension without prefs still create its dictionary.
+  const base::DictionaryValue* extension = GetExtensionPref(extension_id);
+  if (!extension)
+    return false;
+  const base::Value* current = extension->FindPath(key);
+  if (!current || !value)
+    return current == value;
+  return *current == *value;
+}
+
 void ExtensionPrefs::DeleteExtensionPrefs(const std::string& extension_id) {
   extension_pref_value_map_->UnregisterExtension(extension_id);
   for (auto& observer : observer_list_)
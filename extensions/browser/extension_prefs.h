@@ -854,6 +854,14 @@ class ExtensionPrefs : public KeyedService {
   // doesn't exist.
   const base::DictionaryValue* GetExtensionPref(const std::string& id) const;
 
+  // Returns true if extension |extension_id| already has |value| stored at
+  // |key|, or has nothing there if |value| is null. Updates that would not
+  // change anything are dropped, since each one schedules a rewrite of the
+  // whole Preferences file.
+  bool ExtensionPrefValueEquals(const std::string& extension_id,
+                                base::StringPiece key,
+                                const base::Value* value) const;
+
   // Modifies the extensions disable reasons to add a new reason, remove an
   // existing reason, or clear all reasons. Notifies observers if the set of
   // DisableReasons has changed.
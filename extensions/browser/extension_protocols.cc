@@ -205,21 +205,19 @@ void GenerateBackgroundPageContents(const Extension* extension,
   }
 }
 
+// GetFileInfo() fails for missing files, so there is no need for a separate
+// PathExists() stat on this per-request path.
 base::Time GetFileLastModifiedTime(const base::FilePath& filename) {
-  if (base::PathExists(filename)) {
-    base::File::Info info;
-    if (base::GetFileInfo(filename, &info))
-      return info.last_modified;
-  }
+  base::File::Info info;
+  if (base::GetFileInfo(filename, &info))
+    return info.last_modified;
   return base::Time();
 }
 
 base::Time GetFileCreationTime(const base::FilePath& filename) {
-  if (base::PathExists(filename)) {
-    base::File::Info info;
-    if (base::GetFileInfo(filename, &info))
-      return info.creation_time;
-  }
+  base::File::Info info;
+  if (base::GetFileInfo(filename, &info))
+    return info.creation_time;
   return base::Time();
 }
 
@@ -892,8 +890,9 @@ class ExtensionURLLoader : public network::mojom::URLLoader {
     if (follow_symlinks_anywhere)
       resource.set_follow_symlinks_anywhere();
 
+    // The page that made the request can't go on until this resolves.
     base::ThreadPool::PostTaskAndReplyWithResult(
-        FROM_HERE, {base::MayBlock()},
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
         base::BindOnce(&ReadResourceFilePathAndLastModifiedTime, resource,
                        directory_path),
         base::BindOnce(&ExtensionURLLoader::OnFilePathAndLastModifiedTimeRead,
@@ -328,7 +328,7 @@ void ExtensionRegistrar::ReloadExtension(
     LoadErrorBehavior load_error_behavior) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
-  LOG(INFO) << "[EXTENSIONS] We are reloading extension: " << extension_id;
+  DVLOG(1) << "[EXTENSIONS] We are reloading extension: " << extension_id;
 
   base::FilePath path;
 
@@ -407,7 +407,7 @@ void ExtensionRegistrar::TerminateExtension(const ExtensionId& extension_id) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
   const ExtensionId saved_extension_id = extension_id;
-  LOG(INFO) << "[EXTENSIONS] Calling ExtensionRegistrar::TerminateExtension on id: " << extension_id;
+  DVLOG(1) << "[EXTENSIONS] Calling ExtensionRegistrar::TerminateExtension on id: " << extension_id;
   scoped_refptr<const Extension> extension =
       registry_->enabled_extensions().GetByID(extension_id);
   if (!extension)
@@ -6,6 +6,7 @@
 
 #include <stddef.h>
 
+#include <cinttypes>
 #include <map>
 #include <utility>
 #include <vector>
@@ -15,12 +16,19 @@
 #include "base/compiler_specific.h"
 #include "base/files/file_util.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
 #include "base/task/thread_pool.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "base/trace_event/memory_allocator_dump.h"
+#include "base/trace_event/memory_dump_manager.h"
+#include "base/trace_event/process_memory_dump.h"
 #include "content/public/browser/browser_thread.h"
 #include "extensions/browser/component_extension_resource_manager.h"
 #include "extensions/browser/extensions_browser_client.h"
 #include "extensions/browser/image_loader_factory.h"
 #include "extensions/common/extension.h"
+#include "extensions/common/manifest.h"
 #include "extensions/common/manifest_handlers/icons_handler.h"
 #include "skia/ext/image_operations.h"
 #include "ui/base/layout.h"
@@ -38,6 +46,10 @@ namespace extensions {
 
 namespace {
 
+// Enough for the action and app icons of a few dozen extensions at two scale
+// factors.
+constexpr size_t kMaxCacheBytes = 4 * 1024 * 1024;
+
 bool ShouldResizeImageRepresentation(
     ImageLoader::ImageRepresentation::ResizeCondition resize_method,
     const gfx::Size& decoded_size,
@@ -212,9 +224,17 @@ std::vector<ImageLoader::LoadResult> LoadImagesBlocking(
 ////////////////////////////////////////////////////////////////////////////////
 // ImageLoader
 
-ImageLoader::ImageLoader() {}
+ImageLoader::ImageLoader() {
+  memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
+      FROM_HERE, base::BindRepeating(&ImageLoader::OnMemoryPressure,
+                                     base::Unretained(this)));
+  base::trace_event::MemoryDumpManager::GetInstance()->RegisterDumpProvider(
+      this, "ExtensionImageLoader", base::ThreadTaskRunnerHandle::Get());
+}
 
 ImageLoader::~ImageLoader() {
+  base::trace_event::MemoryDumpManager::GetInstance()->UnregisterDumpProvider(
+      this);
 }
 
 // static
@@ -264,12 +284,10 @@ void ImageLoader::LoadImagesAsync(
     const std::vector<ImageRepresentation>& info_list,
     ImageLoaderImageCallback callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
-      base::BindOnce(LoadImagesBlocking, info_list,
-                     LoadResourceBitmaps(extension, info_list)),
-      base::BindOnce(&ImageLoader::ReplyBack, weak_ptr_factory_.GetWeakPtr(),
-                     std::move(callback)));
+  LoadImages(extension, info_list,
+             base::BindOnce(&ImageLoader::ReplyBack,
+                            weak_ptr_factory_.GetWeakPtr(),
+                            std::move(callback)));
 }
 
 void ImageLoader::LoadImageFamilyAsync(
@@ -277,12 +295,129 @@ void ImageLoader::LoadImageFamilyAsync(
     const std::vector<ImageRepresentation>& info_list,
     ImageLoaderImageFamilyCallback callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  LoadImages(extension, info_list,
+             base::BindOnce(&ImageLoader::ReplyBackWithImageFamily,
+                            weak_ptr_factory_.GetWeakPtr(),
+                            std::move(callback)));
+}
+
+// static
+ImageLoader::CacheKey ImageLoader::GetCacheKey(
+    const ImageRepresentation& image_info) {
+  return CacheKey(image_info.resource.extension_root(),
+                  image_info.resource.relative_path(),
+                  image_info.desired_size.width(),
+                  image_info.desired_size.height(),
+                  image_info.resize_condition);
+}
+
+void ImageLoader::LoadImages(const Extension* extension,
+                             const std::vector<ImageRepresentation>& info_list,
+                             LoadResultsCallback reply) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  std::vector<LoadResult> cached_results;
+  if (GetCachedResults(info_list, &cached_results)) {
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(std::move(reply), std::move(cached_results)));
+    return;
+  }
+
+  // The files of unpacked extensions can change without a reload, so their
+  // images are not cached.
+  bool cacheable = !Manifest::IsUnpackedLocation(extension->location());
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
       base::BindOnce(LoadImagesBlocking, info_list,
                      LoadResourceBitmaps(extension, info_list)),
-      base::BindOnce(&ImageLoader::ReplyBackWithImageFamily,
-                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+      base::BindOnce(&ImageLoader::OnImagesLoaded,
+                     weak_ptr_factory_.GetWeakPtr(), cacheable,
+                     std::move(reply)));
+}
+
+bool ImageLoader::GetCachedResults(
+    const std::vector<ImageRepresentation>& info_list,
+    std::vector<LoadResult>* load_result) {
+  for (const ImageRepresentation& image : info_list) {
+    // Images without a path are skipped by LoadImagesBlocking() as well.
+    if (image.resource.relative_path().empty())
+      continue;
+    auto it = cache_.Get(GetCacheKey(image));
+    if (it == cache_.end()) {
+      ++cache_misses_;
+      load_result->clear();
+      return false;
+    }
+    ++cache_hits_;
+    load_result->push_back(
+        LoadResult(it->second.bitmap, it->second.original_size, image));
+  }
+  return !load_result->empty();
+}
+
+void ImageLoader::OnImagesLoaded(bool cacheable,
+                                 LoadResultsCallback reply,
+                                 std::vector<LoadResult> load_result) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  if (cacheable) {
+    // The cache and every caller share these pixels, so none may change them.
+    for (LoadResult& result : load_result) {
+      result.bitmap.setImmutable();
+      AddToCache(result);
+    }
+  }
+  std::move(reply).Run(load_result);
+}
+
+void ImageLoader::AddToCache(const LoadResult& result) {
+  size_t bytes = result.bitmap.computeByteSize();
+  if (bytes > kMaxCacheBytes)
+    return;
+  CacheKey key = GetCacheKey(result.image_representation);
+  auto existing = cache_.Peek(key);
+  if (existing != cache_.end()) {
+    cache_bytes_ -= existing->second.bitmap.computeByteSize();
+    cache_.Erase(existing);
+  }
+  while (cache_bytes_ + bytes > kMaxCacheBytes) {
+    auto oldest = cache_.rbegin();
+    cache_bytes_ -= oldest->second.bitmap.computeByteSize();
+    cache_.Erase(oldest);
+  }
+  // SkBitmap copies share their pixels, so the cache keeps the very pixels
+  // handed out rather than a copy of them. OnImagesLoaded() made them
+  // immutable.
+  DCHECK(result.bitmap.isImmutable());
+  cache_.Put(std::move(key), CachedImage{result.bitmap, result.original_size});
+  cache_bytes_ += bytes;
+}
+
+void ImageLoader::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  if (memory_pressure_level ==
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
+    return;
+  }
+  cache_.Clear();
+  cache_bytes_ = 0;
+}
+
+bool ImageLoader::OnMemoryDump(const base::trace_event::MemoryDumpArgs& args,
+                               base::trace_event::ProcessMemoryDump* pmd) {
+  auto* dump = pmd->CreateAllocatorDump(
+      base::StringPrintf("extensions/image_loader_cache/0x%" PRIXPTR,
+                         reinterpret_cast<uintptr_t>(this)));
+  dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameSize,
+                  base::trace_event::MemoryAllocatorDump::kUnitsBytes,
+                  cache_bytes_);
+  dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameObjectCount,
+                  base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+                  cache_.size());
+  dump->AddScalar("hits", base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+                  cache_hits_);
+  dump->AddScalar("misses",
+                  base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+                  cache_misses_);
+  return true;
 }
 
 void ImageLoader::ReplyBack(ImageLoaderImageCallback callback,
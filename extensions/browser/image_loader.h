@@ -5,12 +5,23 @@
 #ifndef EXTENSIONS_BROWSER_IMAGE_LOADER_H_
 #define EXTENSIONS_BROWSER_IMAGE_LOADER_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
 #include <set>
+#include <tuple>
+#include <vector>
 
 #include "base/callback_forward.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
+#include "base/trace_event/memory_dump_provider.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "extensions/common/extension_resource.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/base/layout.h"
 #include "ui/gfx/geometry/size.h"
 
@@ -36,7 +47,11 @@ using ImageLoaderImageFamilyCallback =
 // The views need to load their icons asynchronously might be deleted before
 // the images have loaded. If you pass your callback using a weak_ptr, this
 // will make sure the callback won't be called after the view is deleted.
-class ImageLoader : public KeyedService {
+// Decoded and resized images of packed extensions are kept in a small cache,
+// so that the icons that the action, menu and app UI load again and again are
+// read and decoded once.
+class ImageLoader : public KeyedService,
+                    public base::trace_event::MemoryDumpProvider {
  public:
   // Information about a singe image representation to load from an extension
   // resource.
@@ -78,9 +93,8 @@ class ImageLoader : public KeyedService {
   ~ImageLoader() override;
 
   // Specify image resource to load. If the loaded image is larger than
-  // |max_size| it will be resized to those dimensions. IMPORTANT NOTE: this
-  // function may call back your callback synchronously (ie before it returns)
-  // if the image was found in the cache.
+  // |max_size| it will be resized to those dimensions. The callback is always
+  // called asynchronously, even if the image was found in the cache.
   // Note this method loads a raw bitmap from the resource. All sizes given are
   // assumed to be in pixels.
   // TODO(estade): remove this in favor of LoadImageAtEveryScaleFactorAsync,
@@ -117,12 +131,65 @@ class ImageLoader : public KeyedService {
                             ImageLoaderImageFamilyCallback callback);
 
  private:
+  using LoadResultsCallback =
+      base::OnceCallback<void(const std::vector<LoadResult>&)>;
+
+  // Identifies a decoded image by its extension root, relative path, desired
+  // width and height and resize condition.
+  using CacheKey = std::tuple<base::FilePath, base::FilePath, int, int, int>;
+
+  struct CachedImage {
+    SkBitmap bitmap;
+    gfx::Size original_size;
+  };
+
+  static CacheKey GetCacheKey(const ImageRepresentation& image_info);
+
+  // Loads |info_list| from the cache if all of it is there, or else from disk,
+  // and runs |reply| with the results.
+  void LoadImages(const Extension* extension,
+                  const std::vector<ImageRepresentation>& info_list,
+                  LoadResultsCallback reply);
+
+  // Fills |load_result| from the cache and returns true if every image of
+  // |info_list| is cached.
+  bool GetCachedResults(const std::vector<ImageRepresentation>& info_list,
+                        std::vector<LoadResult>* load_result);
+
+  // Adds |load_result| to the cache if |cacheable|, then runs |reply|.
+  void OnImagesLoaded(bool cacheable,
+                      LoadResultsCallback reply,
+                      std::vector<LoadResult> load_result);
+
+  // Adds |result| to the cache, evicting the least recently used images to
+  // stay within the cache's size limit.
+  void AddToCache(const LoadResult& result);
+
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
+
+  // base::trace_event::MemoryDumpProvider:
+  bool OnMemoryDump(const base::trace_event::MemoryDumpArgs& args,
+                    base::trace_event::ProcessMemoryDump* pmd) override;
+
   void ReplyBack(ImageLoaderImageCallback callback,
                  const std::vector<LoadResult>& load_result);
 
   void ReplyBackWithImageFamily(ImageLoaderImageFamilyCallback callback,
                                 const std::vector<LoadResult>& load_result);
 
+  // The most recently used images first. Evicted by |cache_bytes_| rather than
+  // by count.
+  base::LRUCache<CacheKey, CachedImage> cache_{
+      base::LRUCache<CacheKey, CachedImage>::NO_AUTO_EVICT};
+  size_t cache_bytes_ = 0;
+
+  // The representations found in and missing from the cache, for memory-infra.
+  uint64_t cache_hits_ = 0;
+  uint64_t cache_misses_ = 0;
+
+  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
+
   base::WeakPtrFactory<ImageLoader> weak_ptr_factory_{this};
 };
 
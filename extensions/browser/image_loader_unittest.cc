@@ -133,6 +133,42 @@ TEST_F(ImageLoaderTest, LoadImage) {
             image_.ToSkBitmap()->width());
 }
 
+// Tests that loading an image again is answered from the cache, still
+// asynchronously.
+TEST_F(ImageLoaderTest, LoadCachedImage) {
+  scoped_refptr<Extension> extension(
+      CreateExtension("image_loader", ManifestLocation::kInvalidLocation));
+  ASSERT_TRUE(extension.get() != nullptr);
+
+  ExtensionResource image_resource =
+      IconsInfo::GetIconResource(extension.get(),
+                                 extension_misc::EXTENSION_ICON_SMALLISH,
+                                 ExtensionIconSet::MATCH_EXACTLY);
+  gfx::Size max_size(extension_misc::EXTENSION_ICON_SMALLISH,
+                     extension_misc::EXTENSION_ICON_SMALLISH);
+  ImageLoader loader;
+  loader.LoadImageAsync(
+      extension.get(), image_resource, max_size,
+      base::BindOnce(&ImageLoaderTest::OnImageLoaded, base::Unretained(this)));
+  WaitForImageLoad();
+  EXPECT_EQ(1, image_loaded_count());
+  ASSERT_FALSE(image_.IsEmpty());
+  const void* pixels = image_.ToSkBitmap()->getPixels();
+
+  loader.LoadImageAsync(
+      extension.get(), image_resource, max_size,
+      base::BindOnce(&ImageLoaderTest::OnImageLoaded, base::Unretained(this)));
+  EXPECT_EQ(0, image_loaded_count());
+  WaitForImageLoad();
+  EXPECT_EQ(1, image_loaded_count());
+  ASSERT_FALSE(image_.IsEmpty());
+
+  // The cached image shares the pixels of the first one, which no caller may
+  // change.
+  EXPECT_EQ(pixels, image_.ToSkBitmap()->getPixels());
+  EXPECT_TRUE(image_.ToSkBitmap()->isImmutable());
+}
+
 // Tests deleting an extension while waiting for the image to load doesn't cause
 // problems.
 TEST_F(ImageLoaderTest, DeleteExtensionWhileWaitingForCache) {
@@ -13,6 +13,7 @@
 #include "base/guid.h"
 #include "base/location.h"
 #include "base/logging.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/metrics/field_trial_params.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/observer_list.h"
@@ -272,6 +273,9 @@ ProcessManager::ProcessManager(BrowserContext* context,
                        weak_ptr_factory_.GetWeakPtr()));
   }
   content::DevToolsAgentHost::AddObserver(this);
+  memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
+      FROM_HERE, base::BindRepeating(&ProcessManager::OnMemoryPressure,
+                                     base::Unretained(this)));
 }
 
 ProcessManager::~ProcessManager() {
@@ -279,6 +283,7 @@ ProcessManager::~ProcessManager() {
 }
 
 void ProcessManager::Shutdown() {
+  memory_pressure_listener_.reset();
   extension_registry_->RemoveObserver(this);
   CloseBackgroundHosts();
   DCHECK(background_hosts_.empty());
@@ -851,6 +856,33 @@ void ProcessManager::OnLazyBackgroundPageIdle(const std::string& extension_id,
   }
 }
 
+void ProcessManager::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  if (memory_pressure_level ==
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE) {
+    return;
+  }
+
+  // Event pages that are already idle would be suspended after
+  // GetEventPageSuspendDelay() anyway. Under memory pressure, start their
+  // suspend sequence now so that their renderers go away before the system
+  // starts killing tabs instead. Persistent background pages are left alone.
+  int suspended_count = 0;
+  for (ExtensionHost* host : background_hosts_) {
+    const Extension* extension = host->extension();
+    if (!extension || !BackgroundInfo::HasLazyBackgroundPage(extension))
+      continue;
+    BackgroundPageData& data = background_page_data_[extension->id()];
+    if (data.lazy_keepalive_count > 0 || data.is_closing)
+      continue;
+    data.close_sequence_id = ++last_background_close_sequence_id_;
+    OnLazyBackgroundPageIdle(extension->id(), data.close_sequence_id);
+    ++suspended_count;
+  }
+  UMA_HISTOGRAM_COUNTS_100("Extensions.EventPagesSuspendedOnMemoryPressure",
+                           suspended_count);
+}
+
 void ProcessManager::OnLazyBackgroundPageActive(
     const std::string& extension_id) {
   if (!background_page_data_[extension_id].is_closing) {
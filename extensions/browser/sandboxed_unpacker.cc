@@ -352,6 +352,7 @@ void SandboxedUnpacker::Unzip(const base::FilePath& crx_path,
 
   DCHECK(crx_path.DirName() == temp_dir_.GetPath());
 
+  unzip_start_time_ = base::TimeTicks::Now();
   ZipFileInstaller::Create(unpacker_io_task_runner_,
                            base::BindOnce(&SandboxedUnpacker::UnzipDone, this))
       ->LoadFromZipFileInDir(crx_path, unzipped_dir);
@@ -367,6 +368,8 @@ void SandboxedUnpacker::UnzipDone(const base::FilePath& zip_file,
                   l10n_util::GetStringUTF16(IDS_EXTENSION_PACKAGE_UNZIP_ERROR));
     return;
   }
+  UMA_HISTOGRAM_TIMES("Extensions.SandboxUnpackUnzipTime",
+                      base::TimeTicks::Now() - unzip_start_time_);
   base::FilePath verified_contents_path =
       file_util::GetVerifiedContentsPath(extension_root_);
   // If the verified contents are already present in the _metadata folder, we
@@ -553,10 +556,13 @@ void SandboxedUnpacker::UnpackExtensionSucceeded(base::Value manifest) {
   manifest_ = std::move(manifest);
 
   DCHECK(!image_sanitizer_);
+  sanitize_start_time_ = base::TimeTicks::Now();
+  pending_sanitizations_ = 2;
   std::set<base::FilePath> image_paths =
       ExtensionsClient::Get()->GetBrowserImagePaths(extension_.get());
   image_sanitizer_ = ImageSanitizer::CreateAndStart(
       this, extension_root_, image_paths, unpacker_io_task_runner_);
+  ReadMessageCatalogs();
 }
 
 data_decoder::DataDecoder* SandboxedUnpacker::GetDataDecoder() {
@@ -573,8 +579,7 @@ void SandboxedUnpacker::OnImageSanitizationDone(
     ImageSanitizer::Status status,
     const base::FilePath& file_path_for_error) {
   if (status == ImageSanitizer::Status::kSuccess) {
-    // Next step is to sanitize the message catalogs.
-    ReadMessageCatalogs();
+    OnResourceSanitized();
     return;
   }
 
@@ -622,6 +627,8 @@ void SandboxedUnpacker::OnImageSanitizationDone(
 
 void SandboxedUnpacker::ReadMessageCatalogs() {
   DCHECK(unpacker_io_task_runner_->RunsTasksInCurrentSequence());
+  if (failed_)
+    return;
   if (LocaleInfo::GetDefaultLocale(extension_.get()).empty()) {
     MessageCatalogsSanitized(JsonFileSanitizer::Status::kSuccess,
                              std::string());
@@ -641,6 +648,9 @@ void SandboxedUnpacker::ReadMessageCatalogs() {
 void SandboxedUnpacker::SanitizeMessageCatalogs(
     const std::set<base::FilePath>& message_catalog_paths) {
   DCHECK(unpacker_io_task_runner_->RunsTasksInCurrentSequence());
+  // The image sanitizer may have failed while the paths were being listed.
+  if (failed_)
+    return;
   json_file_sanitizer_ = JsonFileSanitizer::CreateAndStart(
       &data_decoder_, message_catalog_paths,
       base::BindOnce(&SandboxedUnpacker::MessageCatalogsSanitized, this),
@@ -652,7 +662,7 @@ void SandboxedUnpacker::MessageCatalogsSanitized(
     const std::string& error_msg) {
   DCHECK(unpacker_io_task_runner_->RunsTasksInCurrentSequence());
   if (status == JsonFileSanitizer::Status::kSuccess) {
-    IndexAndPersistJSONRulesetsIfNeeded();
+    OnResourceSanitized();
     return;
   }
 
@@ -686,6 +696,17 @@ void SandboxedUnpacker::MessageCatalogsSanitized(
   ReportFailure(failure_reason, error);
 }
 
+void SandboxedUnpacker::OnResourceSanitized() {
+  DCHECK(unpacker_io_task_runner_->RunsTasksInCurrentSequence());
+  DCHECK_GT(pending_sanitizations_, 0);
+  if (--pending_sanitizations_ > 0)
+    return;
+
+  UMA_HISTOGRAM_TIMES("Extensions.SandboxUnpackSanitizeTime",
+                      base::TimeTicks::Now() - sanitize_start_time_);
+  IndexAndPersistJSONRulesetsIfNeeded();
+}
+
 void SandboxedUnpacker::IndexAndPersistJSONRulesetsIfNeeded() {
   DCHECK(unpacker_io_task_runner_->RunsTasksInCurrentSequence());
   DCHECK(extension_);
@@ -961,6 +982,7 @@ void SandboxedUnpacker::ReportFailure(
   UMA_HISTOGRAM_ENUMERATION(
       "Extensions.SandboxUnpackFailureReason2", reason,
       SandboxedUnpackerFailureReason::NUM_FAILURE_REASONS);
+  failed_ = true;
   Cleanup();
 
   client_->OnUnpackFailure(CrxInstallError(reason, error));
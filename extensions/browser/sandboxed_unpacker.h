@@ -14,6 +14,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/strings/string_piece.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "extensions/browser/api/declarative_net_request/install_index_helper.h"
 #include "extensions/browser/api/declarative_net_request/ruleset_install_pref.h"
@@ -219,6 +220,10 @@ class SandboxedUnpacker : public ImageSanitizer::Client {
   void MessageCatalogsSanitized(JsonFileSanitizer::Status status,
                                 const std::string& error_msg);
 
+  // Called when either the images or the message catalogs have been
+  // sanitized. Moves on to the next step once both have.
+  void OnResourceSanitized();
+
   // Reports unpack success or failure, or unzip failure.
   void ReportSuccess();
 
@@ -329,6 +334,17 @@ class SandboxedUnpacker : public ImageSanitizer::Client {
   // Used during the message catalog rewriting phase to sanitize the extension
   // provided message catalogs.
   std::unique_ptr<JsonFileSanitizer> json_file_sanitizer_;
+
+  // The number of sanitizers still running. The images and the message
+  // catalogs do not depend on each other, so they are sanitized in parallel.
+  int pending_sanitizations_ = 0;
+
+  // Set by ReportFailure(), so that steps already in flight stop there.
+  bool failed_ = false;
+
+  // The start times of the unzip and sanitization steps.
+  base::TimeTicks unzip_start_time_;
+  base::TimeTicks sanitize_start_time_;
 };
 
 }  // namespace extensions
@@ -133,8 +133,14 @@ class Handler : public content::WebContentsObserver {
       }
     }
 
-    for (content::RenderFrameHost* frame : pending_render_frames_)
-      SendExecuteCode(pass_key, params.Clone(), frame);
+    // Each message owns its params, code included, so all but the last frame
+    // get a copy and the last one takes |params| itself.
+    for (size_t i = 0; i < pending_render_frames_.size(); ++i) {
+      SendExecuteCode(pass_key,
+                      i + 1 < pending_render_frames_.size() ? params.Clone()
+                                                            : std::move(params),
+                      pending_render_frames_[i]);
+    }
 
     if (pending_render_frames_.empty())
       Finish();
@@ -282,7 +288,7 @@ class Handler : public content::WebContentsObserver {
     if (callback_) {
       std::vector<ScriptExecutor::FrameResult> all_results =
           std::move(invalid_injection_results_);
-      all_results.reserve(invalid_injection_results_.size() + results_.size());
+      all_results.reserve(all_results.size() + results_.size());
       for (auto& kv : results_)
         all_results.push_back(std::move(kv.second));
       std::move(callback_).Run(std::move(all_results));
@@ -4,6 +4,7 @@
 
 #include "extensions/browser/service_worker_task_queue.h"
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -12,8 +13,10 @@
 #include "base/bind.h"
 #include "base/containers/contains.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/power_monitor/power_monitor.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/syslog_logging.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
@@ -32,6 +35,7 @@
 #include "extensions/browser/renderer_startup_helper.h"
 #include "extensions/browser/service_worker_task_queue_factory.h"
 #include "extensions/common/constants.h"
+#include "extensions/common/extension_features.h"
 #include "extensions/common/manifest_constants.h"
 #include "extensions/common/manifest_handlers/background_info.h"
 #include "extensions/common/manifest_handlers/incognito_info.h"
@@ -55,6 +59,10 @@ const char kServiceWorkerVersion[] = "version";
 
 ServiceWorkerTaskQueue::TestObserver* g_test_observer = nullptr;
 
+// The shortest time between two wake-ups of a stopped worker while on battery
+// power, with kThrottleServiceWorkerWakeUpsOnBattery.
+constexpr base::TimeDelta kMinWakeUpIntervalOnBattery = base::Seconds(5);
+
 // ServiceWorkerRegistration state of an activated extension.
 enum class RegistrationState {
   // Not registered.
@@ -142,6 +150,14 @@ class ServiceWorkerTaskQueue::WorkerState {
   // Contains the worker's WorkerId associated with this WorkerState, once we
   // have discovered info about the worker.
   absl::optional<WorkerId> worker_id_;
+
+  // When the worker was last started while it was not running.
+  base::TimeTicks last_wake_up_time_;
+  // When the start in progress began, if the worker was not running then.
+  // Null otherwise.
+  base::TimeTicks wake_up_start_time_;
+  // Whether a start of the worker was deferred by the wake-up budget.
+  bool wake_up_deferred_ = false;
 };
 
 void ServiceWorkerTaskQueue::DidStartWorkerForScope(
@@ -371,8 +387,58 @@ void ServiceWorkerTaskQueue::AddPendingTask(
 
   // Start worker if there isn't any request to start worker with |context_id|
   // is in progress.
-  if (needs_start_worker)
+  if (!needs_start_worker)
+    return;
+
+  const base::TimeDelta wake_up_delay = GetWakeUpDelay(*worker_state);
+  if (wake_up_delay.is_zero()) {
     RunTasksAfterStartWorker(context_id);
+    return;
+  }
+  // Tasks added until then are queued behind |task| and run by the same
+  // wake-up.
+  worker_state->wake_up_deferred_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(&ServiceWorkerTaskQueue::RunDeferredWakeUp,
+                     weak_factory_.GetWeakPtr(), context_id),
+      wake_up_delay);
+}
+
+base::TimeDelta ServiceWorkerTaskQueue::GetWakeUpDelay(
+    const WorkerState& worker_state) const {
+  if (!base::FeatureList::IsEnabled(
+          extensions_features::kThrottleServiceWorkerWakeUpsOnBattery)) {
+    return base::TimeDelta();
+  }
+  // Only starting a stopped worker spins up its script, and maybe a process.
+  if (worker_state.renderer_state_ == RendererState::kStarted ||
+      worker_state.last_wake_up_time_.is_null()) {
+    return base::TimeDelta();
+  }
+  if (!base::PowerMonitor::IsInitialized() ||
+      !base::PowerMonitor::IsOnBatteryPower()) {
+    return base::TimeDelta();
+  }
+  const base::TimeDelta since_last_wake_up =
+      base::TimeTicks::Now() - worker_state.last_wake_up_time_;
+  return std::max(base::TimeDelta(),
+                  kMinWakeUpIntervalOnBattery - since_last_wake_up);
+}
+
+void ServiceWorkerTaskQueue::RunDeferredWakeUp(
+    const SequencedContextId& context_id) {
+  if (!IsCurrentSequence(context_id.first.extension_id(), context_id.second))
+    return;
+  WorkerState* worker_state = GetWorkerState(context_id);
+  DCHECK(worker_state);
+  // A re-registration may have started the worker already.
+  if (!worker_state->wake_up_deferred_)
+    return;
+  UMA_HISTOGRAM_COUNTS_100(
+      "Extensions.ServiceWorkerBackground.TasksPerDeferredWakeUp",
+      worker_state->pending_tasks_.size());
+  RunTasksAfterStartWorker(context_id);
 }
 
 void ServiceWorkerTaskQueue::ActivateExtension(const Extension* extension) {
@@ -485,6 +551,11 @@ void ServiceWorkerTaskQueue::RunTasksAfterStartWorker(
 
   WorkerState* worker_state = GetWorkerState(context_id);
   DCHECK_NE(BrowserState::kStarted, worker_state->browser_state_);
+  worker_state->wake_up_deferred_ = false;
+  if (worker_state->renderer_state_ != RendererState::kStarted) {
+    worker_state->wake_up_start_time_ = base::TimeTicks::Now();
+    worker_state->last_wake_up_time_ = worker_state->wake_up_start_time_;
+  }
 
   content::StoragePartition* partition =
       util::GetStoragePartitionForExtensionId(
@@ -634,6 +705,17 @@ void ServiceWorkerTaskQueue::RunPendingTasksIfWorkerReady(
 
   DCHECK(worker_state->has_pending_tasks())
       << "Worker ready, but no tasks to run!";
+  if (!worker_state->wake_up_start_time_.is_null()) {
+    // The worker was woken up for the tasks: time its start up to the end of
+    // its script's first run.
+    UMA_HISTOGRAM_MEDIUM_TIMES(
+        "Extensions.ServiceWorkerBackground.WakeUpTime",
+        base::TimeTicks::Now() - worker_state->wake_up_start_time_);
+    UMA_HISTOGRAM_COUNTS_100(
+        "Extensions.ServiceWorkerBackground.TasksPerWakeUp",
+        worker_state->pending_tasks_.size());
+    worker_state->wake_up_start_time_ = base::TimeTicks();
+  }
   std::vector<PendingTask> tasks;
   std::swap(worker_state->pending_tasks_, tasks);
   DCHECK(worker_state->worker_id_);
@@ -13,6 +13,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/strings/string_util.h"
+#include "base/time/time.h"
 #include "base/version.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "content/public/browser/service_worker_context.h"
@@ -185,6 +186,14 @@ class ServiceWorkerTaskQueue : public KeyedService,
 
   void RunTasksAfterStartWorker(const SequencedContextId& context_id);
 
+  // Returns how long the start of the worker of |worker_state| should wait so
+  // that a stopped worker is not woken up more often than the wake-up budget
+  // allows. Returns zero if it needn't wait.
+  base::TimeDelta GetWakeUpDelay(const WorkerState& worker_state) const;
+  // Starts the worker with |context_id| for a wake-up deferred by
+  // GetWakeUpDelay(), unless it was started in the meantime.
+  void RunDeferredWakeUp(const SequencedContextId& context_id);
+
   void DidRegisterServiceWorker(const SequencedContextId& context_id,
                                 RegistrationReason reason,
                                 base::Time start_time,
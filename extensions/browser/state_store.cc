@@ -11,6 +11,8 @@
 #include "base/bind.h"
 #include "base/location.h"
 #include "base/observer_list.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "base/time/time.h"
 #include "components/value_store/value_store_factory.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -21,6 +23,9 @@
 
 namespace {
 
+// How long writes are held back, so that repeated writes of a key coalesce.
+constexpr base::TimeDelta kCommitDelay = base::Seconds(1);
+
 std::string GetFullKey(const std::string& extension_id,
                        const std::string& key) {
   return extension_id + "." + key;
@@ -96,6 +101,12 @@ StateStore::StateStore(
 
   extension_registry_observation_.Observe(ExtensionRegistry::Get(context));
 
+#if BUILDFLAG(IS_ANDROID)
+  app_status_listener_ = base::android::ApplicationStatusListener::New(
+      base::BindRepeating(&StateStore::OnApplicationStateChange,
+                          base::Unretained(this)));
+#endif
+
   if (deferred_load) {
     // Call `Init()` asynchronously with a low priority to not delay startup.
     content::GetUIThreadTaskRunner({base::TaskPriority::USER_VISIBLE})
@@ -106,6 +117,7 @@ StateStore::StateStore(
 }
 
 StateStore::~StateStore() {
+  CommitPendingWrites();
 }
 
 void StateStore::RegisterKey(const std::string& key) {
@@ -115,9 +127,21 @@ void StateStore::RegisterKey(const std::string& key) {
 void StateStore::GetExtensionValue(const std::string& extension_id,
                                    const std::string& key,
                                    ReadCallback callback) {
+  std::string full_key = GetFullKey(extension_id, key);
+  auto pending_write = pending_writes_.find(full_key);
+  if (pending_write != pending_writes_.end()) {
+    // Answer with the value the store will hold, still asynchronously.
+    std::unique_ptr<base::Value> value;
+    if (pending_write->second)
+      value = std::make_unique<base::Value>(pending_write->second->Clone());
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(std::move(callback), std::move(value)));
+    return;
+  }
+
   task_queue_->InvokeWhenReady(base::BindOnce(
       &value_store::ValueStoreFrontend::Get, base::Unretained(store_.get()),
-      GetFullKey(extension_id, key), std::move(callback)));
+      std::move(full_key), std::move(callback)));
 }
 
 void StateStore::SetExtensionValue(const std::string& extension_id,
@@ -126,16 +150,13 @@ void StateStore::SetExtensionValue(const std::string& extension_id,
   for (TestObserver& observer : observers_)
     observer.WillSetExtensionValue(extension_id, key);
 
-  task_queue_->InvokeWhenReady(base::BindOnce(
-      &value_store::ValueStoreFrontend::Set, base::Unretained(store_.get()),
-      GetFullKey(extension_id, key), std::move(value)));
+  DCHECK(value);
+  AddPendingWrite(GetFullKey(extension_id, key), std::move(value));
 }
 
 void StateStore::RemoveExtensionValue(const std::string& extension_id,
                                       const std::string& key) {
-  task_queue_->InvokeWhenReady(base::BindOnce(
-      &value_store::ValueStoreFrontend::Remove, base::Unretained(store_.get()),
-      GetFullKey(extension_id, key)));
+  AddPendingWrite(GetFullKey(extension_id, key), nullptr);
 }
 
 void StateStore::AddObserver(TestObserver* observer) {
@@ -147,6 +168,7 @@ void StateStore::RemoveObserver(TestObserver* observer) {
 }
 
 void StateStore::FlushForTesting(base::OnceClosure flushed_callback) {
+  CommitPendingWrites();
   // Look up a key in the database. This serves as a roundtrip to the DB and
   // back; the value of the key doesn't matter.
   GetExtensionValue("fake_id", "fake_key",
@@ -184,12 +206,45 @@ void StateStore::Init() {
   task_queue_->SetReady();
 }
 
+void StateStore::AddPendingWrite(const std::string& full_key,
+                                 std::unique_ptr<base::Value> value) {
+  pending_writes_[full_key] = std::move(value);
+  if (!commit_timer_.IsRunning()) {
+    commit_timer_.Start(FROM_HERE, kCommitDelay,
+                        base::BindOnce(&StateStore::CommitPendingWrites,
+                                       base::Unretained(this)));
+  }
+}
+
+void StateStore::CommitPendingWrites() {
+  commit_timer_.Stop();
+  std::map<std::string, std::unique_ptr<base::Value>> writes;
+  writes.swap(pending_writes_);
+  for (auto& write : writes) {
+    if (write.second) {
+      task_queue_->InvokeWhenReady(base::BindOnce(
+          &value_store::ValueStoreFrontend::Set, base::Unretained(store_.get()),
+          write.first, std::move(write.second)));
+    } else {
+      task_queue_->InvokeWhenReady(
+          base::BindOnce(&value_store::ValueStoreFrontend::Remove,
+                         base::Unretained(store_.get()), write.first));
+    }
+  }
+}
+
+#if BUILDFLAG(IS_ANDROID)
+void StateStore::OnApplicationStateChange(
+    base::android::ApplicationState state) {
+  if (state == base::android::APPLICATION_STATE_HAS_STOPPED_ACTIVITIES)
+    CommitPendingWrites();
+}
+#endif
+
 void StateStore::RemoveKeysForExtension(const std::string& extension_id) {
   for (auto key = registered_keys_.begin(); key != registered_keys_.end();
        ++key) {
-    task_queue_->InvokeWhenReady(base::BindOnce(
-        &value_store::ValueStoreFrontend::Remove,
-        base::Unretained(store_.get()), GetFullKey(extension_id, *key)));
+    AddPendingWrite(GetFullKey(extension_id, *key), nullptr);
   }
 }
 
@@ -5,6 +5,8 @@
 #ifndef EXTENSIONS_BROWSER_STATE_STORE_H_
 #define EXTENSIONS_BROWSER_STATE_STORE_H_
 
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -12,10 +14,16 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/scoped_observation.h"
+#include "base/timer/timer.h"
+#include "build/build_config.h"
 #include "components/value_store/value_store_frontend.h"
 #include "extensions/browser/extension_registry.h"
 #include "extensions/browser/extension_registry_observer.h"
 
+#if BUILDFLAG(IS_ANDROID)
+#include "base/android/application_status_listener.h"
+#endif
+
 namespace content {
 class BrowserContext;
 }
@@ -68,7 +76,9 @@ class StateStore : public base::SupportsWeakPtr<StateStore>,
                          const std::string& key,
                          ReadCallback callback);
 
-  // Sets a value for a given extension and key.
+  // Sets a value for a given extension and key. Writes are held back for a
+  // moment, so that repeated writes of a key reach the store only once. Reads
+  // see them right away.
   void SetExtensionValue(const std::string& extension_id,
                          const std::string& key,
                          std::unique_ptr<base::Value> value);
@@ -92,6 +102,21 @@ class StateStore : public base::SupportsWeakPtr<StateStore>,
 
   void Init();
 
+  // Records a write of |value| to |full_key|, or its removal if |value| is
+  // null, replacing any earlier write of the key not yet committed.
+  void AddPendingWrite(const std::string& full_key,
+                       std::unique_ptr<base::Value> value);
+
+  // Hands the pending writes to |store_|.
+  void CommitPendingWrites();
+
+#if BUILDFLAG(IS_ANDROID)
+  // Commits the pending writes without waiting for |commit_timer_| once the
+  // app has no running activity left, so that an extension's last state change
+  // is not dropped with the process.
+  void OnApplicationStateChange(base::android::ApplicationState state);
+#endif
+
   // Removes all keys registered for the given extension.
   void RemoveKeysForExtension(const std::string& extension_id);
 
@@ -114,6 +139,17 @@ class StateStore : public base::SupportsWeakPtr<StateStore>,
   // Keeps track of tasks we have delayed while starting up.
   std::unique_ptr<DelayedTaskQueue> task_queue_;
 
+  // The latest uncommitted write of each full key. Null values are removals.
+  std::map<std::string, std::unique_ptr<base::Value>> pending_writes_;
+
+  // Commits |pending_writes_| a moment after the first of them.
+  base::OneShotTimer commit_timer_;
+
+#if BUILDFLAG(IS_ANDROID)
+  std::unique_ptr<base::android::ApplicationStatusListener>
+      app_status_listener_;
+#endif
+
   base::ObserverList<TestObserver>::Unchecked observers_;
 
   base::ScopedObservation<ExtensionRegistry, ExtensionRegistryObserver>
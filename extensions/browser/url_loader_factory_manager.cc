@@ -100,15 +100,20 @@ bool DoExtensionPermissionsCoverHttpOrHttpsOrigins(const Extension& extension) {
 // attention to the `isolated_world_origin` from content scripts, and using
 // SecFetchSiteValue::kNoOrigin from extensions).
 bool ShouldRelaxCors(const Extension& extension, FactoryUser factory_user) {
-  if (!DoExtensionPermissionsCoverHttpOrHttpsOrigins(extension))
-    return false;
-
+  // The factory user check is the cheap one, and it rules out the content
+  // scripts of almost every extension, so it goes before walking all of the
+  // extension's host permissions. This runs for each extension injecting into
+  // each committing navigation.
   switch (factory_user) {
     case FactoryUser::kContentScript:
-      return DoContentScriptsDependOnRelaxedCorbOrCors(extension);
+      if (!DoContentScriptsDependOnRelaxedCorbOrCors(extension))
+        return false;
+      break;
     case FactoryUser::kExtensionProcess:
-      return true;
+      break;
   }
+
+  return DoExtensionPermissionsCoverHttpOrHttpsOrigins(extension);
 }
 
 bool ShouldCreateSeparateFactoryForContentScripts(const Extension& extension) {
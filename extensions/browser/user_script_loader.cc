@@ -13,6 +13,7 @@
 #include "base/bind.h"
 #include "base/containers/cxx20_erase.h"
 #include "base/memory/writable_shared_memory_region.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/observer_list.h"
 #include "base/strings/string_util.h"
 #include "base/types/pass_key.h"
@@ -418,11 +419,19 @@ void UserScriptLoader::OnScriptsLoaded(
   // We've got scripts ready to go.
   shared_memory_ = std::move(shared_memory);
 
+  // Each update carries the whole script set of this loader's host, so a
+  // change to one script costs its size times the renderers updated.
+  int updated_renderer_count = 0;
   for (content::RenderProcessHost::iterator i(
            content::RenderProcessHost::AllHostsIterator());
        !i.IsAtEnd(); i.Advance()) {
-    SendUpdate(i.GetCurrentValue(), shared_memory_);
+    if (SendUpdate(i.GetCurrentValue(), shared_memory_))
+      ++updated_renderer_count;
   }
+  UMA_HISTOGRAM_MEMORY_KB("Extensions.UserScriptLoader.UpdateSize",
+                          shared_memory_.GetSize() / 1024);
+  UMA_HISTOGRAM_COUNTS_100("Extensions.UserScriptLoader.UpdatedRenderers",
+                           updated_renderer_count);
 
   for (auto& observer : observers_)
     observer.OnScriptsLoaded(this, browser_context_);
@@ -435,24 +444,24 @@ void UserScriptLoader::OnScriptsLoaded(
     std::move(callback).Run(this, /*error=*/absl::nullopt);
 }
 
-void UserScriptLoader::SendUpdate(
+bool UserScriptLoader::SendUpdate(
     content::RenderProcessHost* process,
     const base::ReadOnlySharedMemoryRegion& shared_memory) {
   // Make sure we only send user scripts to processes in our browser_context.
   if (!ExtensionsBrowserClient::Get()->IsSameContext(
           browser_context_, process->GetBrowserContext()))
-    return;
+    return false;
 
   // If the process is being started asynchronously, early return.  We'll end up
   // calling InitUserScripts when it's created which will call this again.
   base::ProcessHandle handle = process->GetProcess().Handle();
   if (!handle)
-    return;
+    return false;
 
   base::ReadOnlySharedMemoryRegion region_for_process =
       shared_memory.Duplicate();
   if (!region_for_process.IsValid())
-    return;
+    return false;
 
   // If the process only hosts guest frames, then those guest frames share the
   // same embedder/owner. In this case, only scripts from allowlisted hosts or
@@ -469,7 +478,7 @@ void UserScriptLoader::SendUpdate(
 
     DCHECK(found_owner);
     if (owner_host != host_id().id)
-      return;
+      return false;
   }
 
   ContentScriptTracker::WillUpdateContentScriptsInRenderer(
@@ -480,6 +489,7 @@ void UserScriptLoader::SendUpdate(
           ->GetRenderer(process);
   renderer->UpdateUserScripts(std::move(region_for_process),
                               mojom::HostID::New(host_id().type, host_id().id));
+  return true;
 }
 
 }  // namespace extensions
@@ -149,8 +149,8 @@ class UserScriptLoader : public content::RenderProcessHostCreationObserver {
                        base::ReadOnlySharedMemoryRegion shared_memory);
 
   // Sends the renderer process a new set of user scripts for this
-  // UserScriptLoader's host.
-  void SendUpdate(content::RenderProcessHost* process,
+  // UserScriptLoader's host. Returns whether the update was sent.
+  bool SendUpdate(content::RenderProcessHost* process,
                   const base::ReadOnlySharedMemoryRegion& shared_memory);
 
   bool is_loading() const {
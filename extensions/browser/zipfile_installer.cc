@@ -26,8 +26,6 @@ namespace extensions {
 
 namespace {
 
-base::FilePath additional_path;
-
 constexpr char kExtensionHandlerTempDirError[] =
     "Could not create temporary directory for zipped extension.";
 constexpr char kExtensionHandlerFileUnzipError[] =
@@ -119,7 +117,7 @@ void ZipFileInstaller::Unzip(absl::optional<base::FilePath> unzip_dir) {
 
   unzip::UnzipWithFilter(
       unzip::LaunchUnzipper(), zip_file_, *unzip_dir,
-      base::BindRepeating(&ZipFileInstaller::IsManifestFile),
+      base::BindRepeating(&ZipFileInstaller::ShouldExtractManifest, this),
       base::BindOnce(&ZipFileInstaller::ManifestUnzipped, this, *unzip_dir));
 }
 
@@ -130,19 +128,16 @@ void ZipFileInstaller::ManifestUnzipped(const base::FilePath& unzip_dir,
     return;
   }
 
-  base::FilePath new_unzip_dir;
-  new_unzip_dir = unzip_dir.Append(FILE_PATH_LITERAL("/")).Append(additional_path).Append(FILE_PATH_LITERAL("/"));
-  LOG(INFO) << "[EXTENSIONS] redressed new_unzip_dir: " << new_unzip_dir;
   base::PostTaskAndReplyWithResult(
       io_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&ReadFileContent, new_unzip_dir.Append(kManifestFilename)),
+      base::BindOnce(&ReadFileContent,
+                     GetExtensionRoot(unzip_dir).Append(kManifestFilename)),
       base::BindOnce(&ZipFileInstaller::ManifestRead, this, unzip_dir));
 }
 
 void ZipFileInstaller::ManifestRead(
     const base::FilePath& unzip_dir,
     absl::optional<std::string> manifest_content) {
-  LOG(INFO) << "[EXTENSIONS] ZipFileInstaller::ManifestRead - A";
   if (!manifest_content) {
     ReportFailure(std::string(kExtensionHandlerFileUnzipError));
     return;
@@ -218,9 +213,32 @@ void ZipFileInstaller::UnzipDone(const base::FilePath& unzip_dir,
     return;
   }
 
-  base::FilePath new_unzip_dir;
-  new_unzip_dir = unzip_dir.Append(FILE_PATH_LITERAL("/")).Append(additional_path);
-  std::move(done_callback_).Run(zip_file_, new_unzip_dir, std::string());
+  std::move(done_callback_).Run(zip_file_, GetExtensionRoot(unzip_dir),
+                                std::string());
+}
+
+bool ZipFileInstaller::ShouldExtractManifest(const base::FilePath& file_path) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!IsManifestFile(file_path))
+    return false;
+
+  // Archives often wrap the extension in a top-level directory. Treat the
+  // shallowest directory holding a manifest as the extension root, so that
+  // the manifests of bundled third-party code do not take its place.
+  base::FilePath dir = file_path.DirName();
+  if (dir.value() == base::FilePath::kCurrentDirectory)
+    dir = base::FilePath();
+  size_t depth = dir.empty() ? 0 : dir.GetComponents().size();
+  if (!manifest_dir_depth_ || depth < *manifest_dir_depth_) {
+    manifest_dir_ = dir;
+    manifest_dir_depth_ = depth;
+  }
+  return true;
+}
+
+base::FilePath ZipFileInstaller::GetExtensionRoot(
+    const base::FilePath& unzip_dir) const {
+  return manifest_dir_.empty() ? unzip_dir : unzip_dir.Append(manifest_dir_);
 }
 
 void ZipFileInstaller::ReportFailure(const std::string& error) {
@@ -247,12 +265,7 @@ bool ZipFileInstaller::ShouldExtractFile(bool is_theme,
 // static
 bool ZipFileInstaller::IsManifestFile(const base::FilePath& file_path) {
   CHECK(!file_path.IsAbsolute());
-  if (base::FilePath::CompareEqualIgnoreCase(file_path.BaseName().value(), kManifestFilename)) {
-    LOG(INFO) << "[EXTENSIONS] ZipFileInstaller::IsManifestFile (isManifest: true): " << file_path << " - dirName: " << file_path.DirName();
-    additional_path = file_path.DirName();
-    return true;
-  }
-  return base::FilePath::CompareEqualIgnoreCase(file_path.value(),
+  return base::FilePath::CompareEqualIgnoreCase(file_path.BaseName().value(),
                                                 kManifestFilename);
 }
 
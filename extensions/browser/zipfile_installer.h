@@ -71,6 +71,13 @@ class ZipFileInstaller : public base::RefCountedThreadSafe<ZipFileInstaller> {
                       const absl::optional<std::string>& error);
   void UnzipDone(const base::FilePath& unzip_dir, bool success);
 
+  // Filter for the first unzip pass: extracts the manifests and records the
+  // directory of the shallowest one in |manifest_dir_|.
+  bool ShouldExtractManifest(const base::FilePath& file_path);
+
+  // Returns the directory in |unzip_dir| that holds the extension's manifest.
+  base::FilePath GetExtensionRoot(const base::FilePath& unzip_dir) const;
+
   // On failure, report the |error| reason.
   void ReportFailure(const std::string& error);
 
@@ -81,7 +88,8 @@ class ZipFileInstaller : public base::RefCountedThreadSafe<ZipFileInstaller> {
   // extension/theme. Protects against unused or potentially hamrful files.
   static bool ShouldExtractFile(bool is_theme, const base::FilePath& file_path);
 
-  // Returns true if |file_path| points to an extension manifest.
+  // Returns true if |file_path| points to an extension manifest, at any depth
+  // of the archive.
   static bool IsManifestFile(const base::FilePath& file_path);
 
   // File containing the extension to unzip.
@@ -90,6 +98,11 @@ class ZipFileInstaller : public base::RefCountedThreadSafe<ZipFileInstaller> {
   // Task runner for file I/O.
   scoped_refptr<base::SequencedTaskRunner> io_task_runner_;
 
+  // The directory of the extension's manifest, relative to the root of the
+  // archive, and its depth. Empty if the manifest is at the root.
+  base::FilePath manifest_dir_;
+  absl::optional<size_t> manifest_dir_depth_;
+
   SEQUENCE_CHECKER(sequence_checker_);
 };
 
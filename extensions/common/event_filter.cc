@@ -62,6 +62,7 @@ EventFilter::MatcherID EventFilter::AddEventMatcher(
   if (!CreateConditionSets(matcher.get(), &condition_sets))
     return -1;
 
+  has_last_url_match_ = false;
   MatcherID id = next_id_++;
   for (const scoped_refptr<URLMatcherConditionSet>& condition_set :
        condition_sets) {
@@ -125,6 +126,7 @@ bool EventFilter::AddDictionaryAsConditionSet(
 }
 
 std::string EventFilter::RemoveEventMatcher(MatcherID id) {
+  has_last_url_match_ = false;
   auto it = id_to_event_name_.find(id);
   std::string event_name = it->second;
   // EventMatcherEntry's destructor causes the condition set ids to be removed
@@ -147,9 +149,13 @@ std::set<EventFilter::MatcherID> EventFilter::MatchEvent(
   const EventMatcherMap& matcher_map = it->second;
   const GURL& url_to_match_against =
       event_info.url ? *event_info.url : GURL::EmptyGURL();
-  std::set<base::MatcherStringPattern::ID> matching_condition_set_ids =
-      url_matcher_.MatchURL(url_to_match_against);
-  for (const auto& id_key : matching_condition_set_ids) {
+  if (!has_last_url_match_ || last_matched_url_ != url_to_match_against) {
+    last_matching_condition_set_ids_ =
+        url_matcher_.MatchURL(url_to_match_against);
+    last_matched_url_ = url_to_match_against;
+    has_last_url_match_ = true;
+  }
+  for (const auto& id_key : last_matching_condition_set_ids_) {
     auto matcher_id = condition_set_id_to_event_matcher_id_.find(id_key);
     if (matcher_id == condition_set_id_to_event_matcher_id_.end()) {
       NOTREACHED() << "id not found in condition set map (" << id_key << ")";
@@ -16,6 +16,7 @@
 #include "components/url_matcher/url_matcher.h"
 #include "extensions/common/event_matcher.h"
 #include "extensions/common/mojom/event_dispatcher.mojom-forward.h"
+#include "url/gurl.h"
 
 namespace extensions {
 
@@ -50,6 +51,9 @@ class EventFilter {
   // Match an event named |event_name| with filtering info |event_info| against
   // our set of event matchers. Returns a set of ids that correspond to the
   // event matchers that matched the event.
+  // The URL matches of the last URL are kept until a matcher is added or
+  // removed, as consecutive events are often for the same URL, e.g. the
+  // webNavigation events of one navigation.
   // TODO(koz): Add a std::string* parameter for retrieving error messages.
   std::set<MatcherID> MatchEvent(const std::string& event_name,
                                  const mojom::EventFilteringInfo& event_info,
@@ -126,6 +130,13 @@ class EventFilter {
 
   // Maps from event matcher ids to the name of the event they match on.
   std::map<MatcherID, std::string> id_to_event_name_;
+
+  // The URL most recently matched against |url_matcher_|, and the ids of the
+  // condition sets it matched. Only valid if |has_last_url_match_|.
+  mutable GURL last_matched_url_;
+  mutable std::set<base::MatcherStringPattern::ID>
+      last_matching_condition_set_ids_;
+  mutable bool has_last_url_match_ = false;
 };
 
 }  // namespace extensions
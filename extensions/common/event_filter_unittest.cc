@@ -186,6 +186,33 @@ TEST_F(EventFilterUnittest, TestMatchesOnlyAgainstPatternsForCorrectEvent) {
   }
 }
 
+TEST_F(EventFilterUnittest, RepeatedURLMatchesFollowAddedAndRemovedMatchers) {
+  int id1 = event_filter_.AddEventMatcher("event1",
+                                          HostSuffixMatcher("google.com"));
+  ASSERT_EQ(1u, event_filter_
+                    .MatchEvent("event1", google_event_, MSG_ROUTING_NONE)
+                    .count(id1));
+  ASSERT_TRUE(event_filter_.MatchEvent("event2", google_event_,
+                                       MSG_ROUTING_NONE).empty());
+
+  // A matcher added for the URL matched last is found.
+  int id2 = event_filter_.AddEventMatcher("event2",
+                                          HostSuffixMatcher("google.com"));
+  std::set<int> matches =
+      event_filter_.MatchEvent("event2", google_event_, MSG_ROUTING_NONE);
+  ASSERT_EQ(1u, matches.size());
+  ASSERT_EQ(1u, matches.count(id2));
+
+  // A removed one no longer is.
+  event_filter_.RemoveEventMatcher(id1);
+  ASSERT_TRUE(event_filter_.MatchEvent("event1", google_event_,
+                                       MSG_ROUTING_NONE).empty());
+
+  // Other URLs are still matched on their own.
+  ASSERT_TRUE(event_filter_.MatchEvent("event2", yahoo_event_,
+                                       MSG_ROUTING_NONE).empty());
+}
+
 TEST_F(EventFilterUnittest, TestGetMatcherCountForEvent) {
   ASSERT_EQ(0, event_filter_.GetMatcherCountForEventForTesting("event1"));
   int id1 = event_filter_.AddEventMatcher("event1", AllURLs());
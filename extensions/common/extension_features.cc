@@ -118,4 +118,11 @@ const base::Feature kNewWebstoreDomain{"NewWebstoreDomain",
 const base::Feature kExtensionSidePanelIntegration{
     "ExtensionSidePanelIntegration", base::FEATURE_DISABLED_BY_DEFAULT};
 
+// If enabled, a stopped extension service worker is not woken up again for
+// events sooner than a few seconds after its last wake-up while the device is
+// on battery power. Events that arrive in between are run together by the
+// next wake-up.
+const base::Feature kThrottleServiceWorkerWakeUpsOnBattery{
+    "ThrottleServiceWorkerWakeUpsOnBattery", base::FEATURE_DISABLED_BY_DEFAULT};
+
 }  // namespace extensions_features
@@ -45,6 +45,8 @@ extern const base::Feature kNewWebstoreDomain;
 
 extern const base::Feature kExtensionSidePanelIntegration;
 
+extern const base::Feature kThrottleServiceWorkerWakeUpsOnBattery;
+
 }  // namespace extensions_features
 
 #endif  // EXTENSIONS_COMMON_EXTENSION_FEATURES_H_
@@ -2,8 +2,16 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/test/values_test_util.h"
+#include "base/values.h"
 #include "extensions/common/common_manifest_handlers.h"
+#include "extensions/common/extension.h"
 #include "extensions/common/manifest_handler.h"
+#include "extensions/common/mojom/manifest.mojom-shared.h"
 #include "extensions/common/scoped_testing_manifest_handler_registry.h"
 #include "extensions/test/logging_timer.h"
 
@@ -68,4 +76,50 @@ TEST(ManifestHandlerPerfTest, MANUAL_CommonMeasureFinalization) {
   LoggingTimer::Print();
 }
 
+// Measures what InstalledLoader pays for each installed extension at
+// startup: building an Extension from its manifest in prefs, which runs
+// every registered ManifestHandler::Parse.
+TEST(ManifestHandlerPerfTest, MANUAL_CommonExtensionCreate) {
+  ScopedTestingManifestHandlerRegistry scoped_registry;
+  RegisterCommonManifestHandlers();
+  ManifestHandler::FinalizeRegistration();
+  base::Value manifest = base::test::ParseJson(R"({
+      "name": "Startup benchmark",
+      "version": "1.2.3",
+      "manifest_version": 2,
+      "default_locale": "en",
+      "background": {"scripts": ["background.js"], "persistent": false},
+      "browser_action": {"default_popup": "popup.html"},
+      "content_scripts": [{
+        "matches": ["https://*/*", "http://*/*"],
+        "js": ["content.js"],
+        "css": ["content.css"],
+        "run_at": "document_idle",
+        "all_frames": true
+      }],
+      "commands": {"_execute_browser_action": {
+        "suggested_key": {"default": "Ctrl+Shift+Y"}
+      }},
+      "content_security_policy": "script-src 'self'; object-src 'self'",
+      "icons": {"16": "icon16.png", "48": "icon48.png", "128": "icon128.png"},
+      "permissions": ["storage", "tabs", "webRequest", "<all_urls>"],
+      "web_accessible_resources": ["images/*.png", "frame.html"]
+    })");
+  ASSERT_TRUE(manifest.is_dict());
+  static constexpr char kTimerId[] = "CommonExtensionCreate";
+  for (int i = 0; i < 10000; ++i) {
+    std::string error;
+    scoped_refptr<Extension> extension;
+    {
+      LoggingTimer timer(kTimerId);
+      extension = Extension::Create(
+          base::FilePath(), mojom::ManifestLocation::kInternal,
+          base::Value::AsDictionaryValue(manifest), Extension::NO_FLAGS,
+          &error);
+    }
+    ASSERT_TRUE(extension) << error;
+  }
+  LoggingTimer::Print();
+}
+
 }  // namespace extensions
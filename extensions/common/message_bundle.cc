@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/contains.h"
@@ -79,7 +80,7 @@ bool MessageBundle::Init(const CatalogVector& locale_catalogs,
       if (!GetMessageValue(message_it.key(), message_it.value(), &value, error))
         return false;
       // Keys are not case-sensitive.
-      dictionary_[key] = value;
+      dictionary_.insert_or_assign(std::move(key), std::move(value));
     }
   }
 
@@ -241,21 +242,21 @@ bool MessageBundle::ReplaceVariables(const SubstitutionMap& variables,
       return true;
 
     // Looking for 1 in substring of ...$1$....
-    const std::string& var_name =
-      message->substr(beg_index, end_index - beg_index);
+    base::StringPiece var_name(message->data() + beg_index,
+                               end_index - beg_index);
     if (!IsValidName(var_name))
       continue;
     auto it = variables.find(base::ToLowerASCII(var_name));
     if (it == variables.end()) {
-      *error = base::StringPrintf("Variable %s%s%s used but not defined.",
-                                  var_begin_delimiter.c_str(),
-                                  var_name.c_str(),
-                                  var_end_delimiter.c_str());
+      *error = base::StringPrintf(
+          "Variable %s%s%s used but not defined.", var_begin_delimiter.c_str(),
+          std::string(var_name).c_str(), var_end_delimiter.c_str());
       return false;
     }
 
-    // Replace variable with its value.
-    std::string value = it->second;
+    // Replace variable with its value. |var_name| points into |message|, so
+    // it must not be used past this point.
+    const std::string& value = it->second;
     message->replace(beg_index - var_begin_delimiter_size,
                      end_index - beg_index + var_begin_delimiter_size +
                        var_end_delimiter.size(),
@@ -267,12 +268,11 @@ bool MessageBundle::ReplaceVariables(const SubstitutionMap& variables,
 }
 
 // static
-bool MessageBundle::IsValidName(const std::string& name) {
+bool MessageBundle::IsValidName(base::StringPiece name) {
   if (name.empty())
     return false;
 
-  std::string::const_iterator it = name.begin();
-  for (; it != name.end(); ++it) {
+  for (auto it = name.begin(); it != name.end(); ++it) {
     // Allow only ascii 0-9, a-z, A-Z, and _ in the name.
     if (!base::IsAsciiAlpha(*it) && !base::IsAsciiDigit(*it) && *it != '_' &&
         *it != '@')
@@ -12,6 +12,8 @@
 #include <string>
 #include <vector>
 
+#include "base/strings/string_piece.h"
+
 namespace base {
 class DictionaryValue;
 class Value;
@@ -99,7 +101,7 @@ class MessageBundle {
 
   // Allow only ascii 0-9, a-z, A-Z, and _ in the variable name.
   // Returns false if the input is empty or if it has illegal characters.
-  static bool IsValidName(const std::string& name);
+  static bool IsValidName(base::StringPiece name);
 
   // Getter for dictionary_.
   const SubstitutionMap* dictionary() const { return &dictionary_; }
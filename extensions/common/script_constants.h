@@ -23,6 +23,7 @@ enum class MatchOriginAsFallbackBehavior {
   // Match the origin as a fallback whenever applicable. This won't have a
   // corresponding path.
   kAlways,
+  kMaxValue = kAlways,
 };
 
 }  // namespace extensions
@@ -4,14 +4,22 @@
 
 #include "net/base/datagram_buffer.h"
 
+#include "base/bind.h"
+#include "base/location.h"
 #include "base/memory/ptr_util.h"
 
 #include <cstring>
 
 namespace net {
 
-DatagramBufferPool::DatagramBufferPool(size_t max_buffer_size)
-    : max_buffer_size_(max_buffer_size) {}
+DatagramBufferPool::DatagramBufferPool(size_t max_buffer_size,
+                                       size_t max_free_buffers)
+    : max_buffer_size_(max_buffer_size),
+      max_free_buffers_(max_free_buffers),
+      memory_pressure_listener_(
+          FROM_HERE,
+          base::BindRepeating(&DatagramBufferPool::OnMemoryPressure,
+                              base::Unretained(this))) {}
 
 DatagramBufferPool::~DatagramBufferPool() = default;
 
@@ -35,6 +43,21 @@ void DatagramBufferPool::Dequeue(DatagramBuffers* buffers) {
     return;
 
   free_list_.splice(free_list_.cend(), *buffers);
+  while (free_list_.size() > max_free_buffers_)
+    free_list_.pop_back();
+}
+
+void DatagramBufferPool::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  switch (memory_pressure_level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      break;
+
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+      free_list_.clear();
+      break;
+  }
 }
 
 DatagramBuffer::DatagramBuffer(size_t max_buffer_size)
@@ -6,7 +6,9 @@
 #define NET_BASE_DATAGRAM_BUFFER_H_
 
 #include <list>
+#include <memory>
 
+#include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
 #include "net/base/net_export.h"
 
@@ -42,9 +44,17 @@ typedef std::list<std::unique_ptr<DatagramBuffer>> DatagramBuffers;
 
 class NET_EXPORT_PRIVATE DatagramBufferPool {
  public:
+  // The default for the number of buffers kept for reuse.
+  static constexpr size_t kDefaultMaxFreeBuffers = 64;
+
   // |max_buffer_size| must be >= largest |buf_len| provided to
-  // ||New()|.
-  explicit DatagramBufferPool(size_t max_buffer_size);
+  // ||New()|. At most |max_free_buffers| buffers are kept for reuse; any
+  // more returned by |Dequeue()| are freed, so that a burst of writes does
+  // not pin its peak memory for the lifetime of the pool. The kept buffers
+  // are freed as well under memory pressure.
+  explicit DatagramBufferPool(
+      size_t max_buffer_size,
+      size_t max_free_buffers = kDefaultMaxFreeBuffers);
   DatagramBufferPool(const DatagramBufferPool&) = delete;
   DatagramBufferPool& operator=(const DatagramBufferPool&) = delete;
   virtual ~DatagramBufferPool();
@@ -56,10 +66,16 @@ class NET_EXPORT_PRIVATE DatagramBufferPool {
   void Dequeue(DatagramBuffers* buffers);
 
   size_t max_buffer_size() { return max_buffer_size_; }
+  size_t free_buffer_count() const { return free_list_.size(); }
 
  private:
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
+
   const size_t max_buffer_size_;
+  const size_t max_free_buffers_;
   DatagramBuffers free_list_;
+  base::MemoryPressureListener memory_pressure_listener_;
 };
 
 // |DatagramBuffer|s can only be created via
@@ -3,13 +3,17 @@
 // found in the LICENSE file.
 
 #include "net/base/datagram_buffer.h"
+
+#include "base/memory/memory_pressure_listener.h"
+#include "base/run_loop.h"
+#include "net/test/test_with_task_environment.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace net::test {
 
 const size_t kMaxBufferSize = 1024;
 
-class DatagramBufferTest : public testing::Test {
+class DatagramBufferTest : public TestWithTaskEnvironment {
  public:
   DatagramBufferTest() : pool_(kMaxBufferSize) {}
 
@@ -47,4 +51,39 @@ TEST_F(DatagramBufferTest, DatgramBufferPoolRecycles) {
   EXPECT_EQ(buffer2_ptr, buffers.back().get());
 }
 
+TEST_F(DatagramBufferTest, DatagramBufferPoolCapsFreeBuffers) {
+  DatagramBufferPool pool(kMaxBufferSize, 2 /* max_free_buffers */);
+  DatagramBuffers buffers;
+  const char data[] = "foo";
+  for (int i = 0; i < 5; ++i)
+    pool.Enqueue(data, sizeof(data), &buffers);
+  DatagramBuffer* buffer1_ptr = buffers.front().get();
+  pool.Dequeue(&buffers);
+  EXPECT_EQ(0u, buffers.size());
+  EXPECT_EQ(2u, pool.free_buffer_count());
+
+  // The first buffers returned are the ones kept.
+  pool.Enqueue(data, sizeof(data), &buffers);
+  EXPECT_EQ(buffer1_ptr, buffers.back().get());
+  EXPECT_EQ(1u, pool.free_buffer_count());
+}
+
+TEST_F(DatagramBufferTest, DatagramBufferPoolFreesOnMemoryPressure) {
+  DatagramBuffers buffers;
+  const char data[] = "foo";
+  pool_.Enqueue(data, sizeof(data), &buffers);
+  pool_.Enqueue(data, sizeof(data), &buffers);
+  pool_.Dequeue(&buffers);
+  EXPECT_EQ(2u, pool_.free_buffer_count());
+
+  base::MemoryPressureListener::SimulatePressureNotification(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(0u, pool_.free_buffer_count());
+
+  // The pool still hands out buffers.
+  pool_.Enqueue(data, sizeof(data), &buffers);
+  EXPECT_EQ(1u, buffers.size());
+}
+
 }  // namespace net::test
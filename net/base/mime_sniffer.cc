@@ -339,12 +339,33 @@ static bool MatchMagicNumber(base::StringPiece content,
   return false;
 }
 
+// Returns false if content starting with |first| cannot match |magic_entry|.
+// This is much cheaper than MatchMagicNumber(), and rules out all but a few
+// entries of each table, e.g. all of kSniffableTags unless |first| is '<'.
+static bool FirstByteMayMatch(char first, const MagicNumber& magic_entry) {
+  char magic_first = magic_entry.magic[0];
+  if (magic_first == '.')
+    return true;
+  if (magic_entry.mask)
+    return magic_first == (magic_entry.mask[0] & first);
+  if (magic_entry.is_string)
+    return base::ToLowerASCII(magic_first) == base::ToLowerASCII(first);
+  return magic_first == first;
+}
+
 static bool CheckForMagicNumbers(base::StringPiece content,
                                  base::span<const MagicNumber> magic_numbers,
                                  std::string* result) {
+  // No magic number is empty.
+  if (content.empty())
+    return false;
+
+  const char first = content[0];
   for (const MagicNumber& magic : magic_numbers) {
-    if (MatchMagicNumber(content, magic, result))
+    if (FirstByteMayMatch(first, magic) &&
+        MatchMagicNumber(content, magic, result)) {
       return true;
+    }
   }
   return false;
 }
@@ -4,6 +4,7 @@
 
 #include "net/base/mime_sniffer.h"
 
+#include <string>
 #include <vector>
 
 #include "base/bits.h"
@@ -11,6 +12,7 @@
 #include "base/timer/elapsed_timer.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
 
 namespace net {
 namespace {
@@ -103,5 +105,58 @@ TEST(MimeSnifferTest, PlainTextPerfTest) {
                                        elapsed_timer.Elapsed().InSecondsF());
 }
 
+// Sniffs the first kMaxBytesToSniff bytes of a mix of the responses that
+// reach SniffMimeType() without a usable Content-Type: markup after some
+// whitespace, plain text, JSON, images, and archives.
+TEST(MimeSnifferTest, ContentMixPerfTest) {
+  const size_t kWarmupIterations = 16;
+  const size_t kMeasuredIterations = 1 << 14;
+  const std::string plaintext(kRepresentativePlainText);
+  struct Content {
+    std::string data;
+    const char* type_hint;
+  };
+  std::vector<Content> contents = {
+      {"\n\n  <!DOCTYPE html><html><head><title>Hamlet</title></head>" +
+           plaintext,
+       ""},
+      {"<div class=\"player\">" + plaintext, "text/plain"},
+      {plaintext, "text/plain"},
+      {plaintext, "application/unknown"},
+      {"{\"title\": \"Hamlet\", \"text\": \"" + plaintext + "\"}",
+       "application/unknown"},
+      {"\x89PNG\x0D\x0A\x1A\x0A" + plaintext, ""},
+      {"\xFF\xD8\xFF\xE0" + plaintext, "application/octet-stream"},
+      {std::string("PK\x03\x04", 4) + plaintext, "*/*"},
+  };
+  size_t total_size = 0;
+  for (Content& content : contents) {
+    content.data.resize(kMaxBytesToSniff, ' ');
+    total_size += content.data.size();
+  }
+
+  const GURL url("https://www.example.com/hamlet");
+  auto sniff_all = [&](size_t iterations) {
+    std::string result;
+    for (size_t i = 0; i < iterations; ++i) {
+      for (const Content& content : contents) {
+        SniffMimeType(content.data, url, content.type_hint,
+                      ForceSniffFileUrlsForHtml::kDisabled, &result);
+      }
+    }
+    CHECK(!result.empty());
+  };
+
+  sniff_all(kWarmupIterations);
+  base::ElapsedTimer elapsed_timer;
+  sniff_all(kMeasuredIterations);
+  perf_test::PerfResultReporter reporter("MimeSniffer.", "ContentMix");
+  reporter.RegisterImportantMetric("throughput",
+                                   "bytesPerSecond_biggerIsBetter");
+  reporter.AddResult("throughput", static_cast<int64_t>(total_size) *
+                                       kMeasuredIterations /
+                                       elapsed_timer.Elapsed().InSecondsF());
+}
+
 }  // namespace
 }  // namespace net
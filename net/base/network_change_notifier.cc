@@ -18,6 +18,7 @@
 #include "base/strings/string_util.h"
 #include "base/synchronization/lock.h"
 #include "base/threading/thread_checker.h"
+#include "base/time/time.h"
 #include "base/timer/timer.h"
 #include "build/build_config.h"
 #include "build/chromeos_buildflags.h"
@@ -128,6 +129,7 @@ class NetworkChangeNotifier::NetworkChangeCalculator
     pending_connection_type_ = GetConnectionType();
     base::TimeDelta delay = last_announced_connection_type_ == CONNECTION_NONE
         ? params_.ip_address_offline_delay_ : params_.ip_address_online_delay_;
+    AddPendingChange();
     // Cancels any previous timer.
     timer_.Start(FROM_HERE, delay, this, &NetworkChangeCalculator::Notify);
   }
@@ -139,6 +141,7 @@ class NetworkChangeNotifier::NetworkChangeCalculator
     base::TimeDelta delay = last_announced_connection_type_ == CONNECTION_NONE
         ? params_.connection_type_offline_delay_
         : params_.connection_type_online_delay_;
+    AddPendingChange();
     // Cancels any previous timer.
     timer_.Start(FROM_HERE, delay, this, &NetworkChangeCalculator::Notify);
   }
@@ -150,8 +153,23 @@ class NetworkChangeNotifier::NetworkChangeCalculator
   }
 
  private:
+  void AddPendingChange() {
+    if (!pending_change_count_++)
+      first_pending_change_time_ = base::TimeTicks::Now();
+  }
+
   void Notify() {
     DCHECK(thread_checker_.CalledOnValidThread());
+    // Bursts of changes, e.g. from a Wi-Fi to cellular handoff, result in a
+    // single notification. Record how many changes it stands for and how long
+    // the network took to settle.
+    DCHECK_GT(pending_change_count_, 0);
+    UMA_HISTOGRAM_COUNTS_100("Net.NetworkChangeNotifier.CoalescedChanges",
+                             pending_change_count_);
+    UMA_HISTOGRAM_TIMES("Net.NetworkChangeNotifier.TimeToSettle",
+                        base::TimeTicks::Now() - first_pending_change_time_);
+    pending_change_count_ = 0;
+
     // Don't bother signaling about dead connections.
     if (have_announced_ &&
         (last_announced_connection_type_ == CONNECTION_NONE) &&
@@ -180,6 +198,10 @@ class NetworkChangeNotifier::NetworkChangeCalculator
   ConnectionType last_announced_connection_type_ = CONNECTION_NONE;
   // Value to pass to NotifyObserversOfNetworkChange when Notify is called.
   ConnectionType pending_connection_type_ = CONNECTION_NONE;
+  // Number of changes since the last call to Notify, and the time of the
+  // first of them.
+  int pending_change_count_ = 0;
+  base::TimeTicks first_pending_change_time_;
   // Used to delay notifications so duplicates can be combined.
   base::OneShotTimer timer_;
 
@@ -4,8 +4,15 @@
 
 #include "net/base/schemeful_site.h"
 
+#include <memory>
+#include <string>
+#include <utility>
+
 #include "base/check.h"
+#include "base/containers/lru_cache.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/no_destructor.h"
+#include "base/threading/thread_local.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "net/base/url_util.h"
 #include "url/gurl.h"
@@ -14,6 +21,39 @@
 
 namespace net {
 
+namespace {
+
+// The registrable domains of the hosts whose sites were last obtained on
+// the current thread. The sites of the same few hosts are obtained for each
+// request, cookie access and IsolationInfo, and each lookup otherwise walks
+// the public suffix DAFSA. A cache per thread needs no lock.
+constexpr size_t kRegisterableDomainCacheSize = 64;
+using RegisterableDomainCache = base::HashingLRUCache<std::string, std::string>;
+
+std::string GetRegisterableDomain(const url::Origin& origin) {
+  static base::NoDestructor<
+      base::ThreadLocalOwnedPointer<RegisterableDomainCache>>
+      tls_cache;
+  RegisterableDomainCache* cache = tls_cache->Get();
+  if (!cache) {
+    auto new_cache =
+        std::make_unique<RegisterableDomainCache>(kRegisterableDomainCacheSize);
+    cache = new_cache.get();
+    tls_cache->Set(std::move(new_cache));
+  }
+
+  auto it = cache->Get(origin.host());
+  if (it != cache->end())
+    return it->second;
+
+  std::string registerable_domain = GetDomainAndRegistry(
+      origin, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  cache->Put(origin.host(), registerable_domain);
+  return registerable_domain;
+}
+
+}  // namespace
+
 // Return a tuple containing:
 // * a new origin using the registerable domain of `origin` if possible and
 //   a port of 0; otherwise, the passed-in origin.
@@ -36,8 +76,7 @@ SchemefulSite::ObtainASiteResult SchemefulSite::ObtainASite(
   // meaningfully have a registerable domain for their host, so they are
   // skipped.
   if (IsStandardSchemeWithNetworkHost(origin.scheme())) {
-    registerable_domain = GetDomainAndRegistry(
-        origin, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+    registerable_domain = GetRegisterableDomain(origin);
   }
 
   // If origin's host's registrable domain is null, then return (origin's
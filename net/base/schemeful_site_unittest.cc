@@ -4,6 +4,7 @@
 
 #include "net/base/schemeful_site.h"
 
+#include "base/strings/string_number_conversions.h"
 #include "base/test/metrics/histogram_tester.h"
 #include "net/base/url_util.h"
 #include "testing/gmock/include/gmock/gmock-matchers.h"
@@ -303,6 +304,21 @@ TEST(SchemefulSiteTest, FromWire) {
       url::Origin::Create(GURL("https://example.test:1337")), &out));
 }
 
+// Obtains the sites of more hosts than the registrable domains that are
+// cached, twice, so that both cached and evicted hosts are looked up.
+TEST(SchemefulSiteTest, ManyHostsSameResults) {
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int i = 0; i < 200; ++i) {
+      std::string suffix = base::NumberToString(i);
+      EXPECT_EQ(SchemefulSite(GURL("https://a.site" + suffix + ".test")),
+                SchemefulSite(GURL("https://site" + suffix + ".test")));
+      EXPECT_EQ(SchemefulSite(GURL("https://a.site" + suffix + ".test"))
+                    .GetURL(),
+                GURL("https://site" + suffix + ".test"));
+    }
+  }
+}
+
 TEST(SchemefulSiteTest, CreateIfHasRegisterableDomain) {
   for (const auto& site : std::initializer_list<std::string>{
            "http://a.bar.test",
@@ -0,0 +1,131 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "net/http/http_cache.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/timer/elapsed_timer.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/base/test_completion_callback.h"
+#include "net/http/http_transaction.h"
+#include "net/http/http_transaction_test_util.h"
+#include "net/http/mock_http_cache.h"
+#include "net/log/net_log_with_source.h"
+#include "net/test/gtest_util.h"
+#include "net/test/test_with_task_environment.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+using net::test::IsOk;
+
+namespace net {
+
+namespace {
+
+constexpr int kBodySize = 512 * 1024;
+constexpr int kIterations = 20;
+
+// The buffer size of the first reader. Each later one reads with a smaller
+// buffer, so that it falls behind the others as in
+// SimpleGET_ParallelWritingSuccess of http_cache_unittest.cc.
+constexpr int kLargestBufferSize = 32 * 1024;
+
+struct Reader {
+  std::unique_ptr<HttpTransaction> trans;
+  TestCompletionCallback callback;
+  scoped_refptr<IOBuffer> buf;
+  int buf_len = 0;
+  int rv = OK;
+  int bytes_read = 0;
+  bool done = false;
+};
+
+class HttpCachePerfTest : public TestWithTaskEnvironment {
+ protected:
+  HttpCachePerfTest() : body_(kBodySize, 'a') {
+    transaction_.data = body_.c_str();
+    transaction_.response_headers = "Cache-Control: max-age=10000\n";
+  }
+
+  // Has |num_readers| transactions read the same response through the
+  // shared writers of one entry, all rounds of their reads interleaved.
+  void ReadShared(int num_readers) {
+    MockHttpCache cache;
+    MockHttpRequest request(transaction_);
+
+    std::vector<std::unique_ptr<Reader>> readers;
+    for (int i = 0; i < num_readers; ++i) {
+      auto& reader = readers.emplace_back(std::make_unique<Reader>());
+      ASSERT_THAT(cache.CreateTransaction(&reader->trans), IsOk());
+      reader->buf_len = kLargestBufferSize >> (i % 4);
+      reader->buf = base::MakeRefCounted<IOBuffer>(reader->buf_len);
+      reader->rv = reader->trans->Start(&request, reader->callback.callback(),
+                                        NetLogWithSource());
+    }
+    for (auto& reader : readers)
+      ASSERT_THAT(reader->callback.GetResult(reader->rv), IsOk());
+
+    int remaining = num_readers;
+    while (remaining) {
+      for (auto& reader : readers) {
+        if (!reader->done) {
+          reader->rv = reader->trans->Read(reader->buf.get(), reader->buf_len,
+                                           reader->callback.callback());
+        }
+      }
+      for (auto& reader : readers) {
+        if (reader->done)
+          continue;
+        int rv = reader->callback.GetResult(reader->rv);
+        ASSERT_GE(rv, 0);
+        reader->bytes_read += rv;
+        if (!rv) {
+          reader->done = true;
+          --remaining;
+        }
+      }
+    }
+    for (auto& reader : readers)
+      EXPECT_EQ(kBodySize, reader->bytes_read);
+  }
+
+  void MeasureReadShared(int num_readers, const char* story) {
+    base::ElapsedTimer timer;
+    for (int i = 0; i < kIterations; ++i) {
+      ReadShared(num_readers);
+      if (HasFatalFailure())
+        return;
+    }
+    perf_test::PerfResultReporter reporter("HttpCacheSharedWriters", story);
+    reporter.RegisterImportantMetric("TimePerReader", "us");
+    reporter.AddResult("TimePerReader",
+                       timer.Elapsed().InMicrosecondsF() /
+                           (kIterations * num_readers));
+  }
+
+ private:
+  const std::string body_;
+  ScopedMockTransaction transaction_{kSimpleGET_Transaction};
+};
+
+TEST_F(HttpCachePerfTest, OneReader) {
+  MeasureReadShared(1, "OneReader");
+}
+
+TEST_F(HttpCachePerfTest, FourReaders) {
+  MeasureReadShared(4, "FourReaders");
+}
+
+TEST_F(HttpCachePerfTest, SixteenReaders) {
+  MeasureReadShared(16, "SixteenReaders");
+}
+
+}  // namespace
+
+}  // namespace net
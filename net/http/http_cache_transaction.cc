@@ -2468,6 +2468,15 @@ int HttpCache::Transaction::DoCacheReadData() {
                                read_buf_len_, io_callback_);
   }
 
+  // A writer that fell behind the others may find the data it needs still in
+  // memory.
+  if (InWriters()) {
+    int rv = entry_->writers->ReadRecentData(read_offset_, read_buf_.get(),
+                                             read_buf_len_);
+    if (rv > 0)
+      return rv;
+  }
+
   return entry_->disk_entry->ReadData(kResponseContentIndex, read_offset_,
                                       read_buf_.get(), read_buf_len_,
                                       io_callback_);
@@ -2866,7 +2875,7 @@ bool HttpCache::Transaction::
       continue;
 
     // Retrieve either the cached response's "etag" or "last-modified" header.
-    std::string validator;
+    base::StringPiece validator;
     response_.headers->EnumerateHeader(
         nullptr, kValidationHeaders[i].related_response_header_name,
         &validator);
@@ -17,6 +17,7 @@
 #include "base/threading/thread_task_runner_handle.h"
 #include "crypto/secure_hash.h"
 #include "crypto/sha2.h"
+#include "net/base/io_buffer.h"
 #include "net/base/net_errors.h"
 #include "net/disk_cache/disk_cache.h"
 #include "net/http/http_cache_transaction.h"
@@ -68,6 +69,16 @@ HttpCache::Writers::TransactionInfo::~TransactionInfo() = default;
 HttpCache::Writers::TransactionInfo::TransactionInfo(const TransactionInfo&) =
     default;
 
+HttpCache::Writers::RecentChunk::RecentChunk(
+    int64_t offset,
+    scoped_refptr<IOBufferWithSize> data)
+    : offset(offset), data(std::move(data)) {}
+
+HttpCache::Writers::RecentChunk::~RecentChunk() = default;
+HttpCache::Writers::RecentChunk::RecentChunk(RecentChunk&&) = default;
+HttpCache::Writers::RecentChunk& HttpCache::Writers::RecentChunk::operator=(
+    RecentChunk&&) = default;
+
 HttpCache::Writers::Writers(HttpCache* cache, HttpCache::ActiveEntry* entry)
     : cache_(cache), entry_(entry) {
   DCHECK(cache_);
@@ -328,6 +339,33 @@ bool HttpCache::Writers::ShouldTruncate() {
   return true;
 }
 
+int HttpCache::Writers::ReadRecentData(int64_t offset,
+                                       IOBuffer* buf,
+                                       int buf_len) const {
+  if (recent_chunks_.empty() || offset < recent_chunks_.front().offset)
+    return 0;
+
+  // Start from the last chunk that begins at or before |offset|.
+  auto it = std::upper_bound(
+      recent_chunks_.begin(), recent_chunks_.end(), offset,
+      [](int64_t offset, const RecentChunk& chunk) {
+        return offset < chunk.offset;
+      });
+  --it;
+
+  int copied = 0;
+  for (; it != recent_chunks_.end() && copied < buf_len; ++it) {
+    const int64_t chunk_offset = offset + copied - it->offset;
+    if (chunk_offset >= it->data->size())
+      break;
+    const int len = static_cast<int>(
+        std::min<int64_t>(it->data->size() - chunk_offset, buf_len - copied));
+    memcpy(buf->data() + copied, it->data->data() + chunk_offset, len);
+    copied += len;
+  }
+  return copied;
+}
+
 LoadState HttpCache::Writers::GetLoadState() const {
   if (network_transaction_)
     return network_transaction_->GetLoadState();
@@ -493,6 +531,7 @@ int HttpCache::Writers::DoCacheWriteData(int num_bytes) {
     partial = all_writers_.find(active_transaction_)->second.partial;
 
   if (!partial) {
+    write_offset_ = current_size;
     rv = entry_->disk_entry->WriteData(kResponseContentIndex, current_size,
                                        read_buf_.get(), num_bytes,
                                        std::move(io_callback), true);
@@ -528,6 +567,11 @@ int HttpCache::Writers::DoCacheWriteDataComplete(int result) {
     // |active_transaction_| can continue reading from the network.
     result = write_len_;
   } else {
+    // Keep the chunk only if the data is also being written to the cache and
+    // another writer shares the entry, since only such a writer can fall
+    // behind and read it back.
+    if (write_len_ > 0 && !network_read_only_ && all_writers_.size() > 1)
+      AddRecentChunk();
     OnDataReceived(result);
   }
   return result;
@@ -618,9 +662,32 @@ void HttpCache::Writers::OnDataReceived(int result) {
   active_transaction_ = nullptr;
 }
 
+void HttpCache::Writers::AddRecentChunk() {
+  // Drop the older chunks if data was written without being kept since.
+  if (!recent_chunks_.empty() &&
+      recent_chunks_.back().offset + recent_chunks_.back().data->size() !=
+          write_offset_) {
+    recent_chunks_.clear();
+    recent_data_size_ = 0;
+  }
+
+  auto data = base::MakeRefCounted<IOBufferWithSize>(write_len_);
+  memcpy(data->data(), read_buf_->data(), write_len_);
+  recent_chunks_.emplace_back(write_offset_, std::move(data));
+  recent_data_size_ += write_len_;
+  while (recent_data_size_ > kMaxRecentDataSize) {
+    recent_data_size_ -= recent_chunks_.front().data->size();
+    recent_chunks_.pop_front();
+  }
+}
+
 void HttpCache::Writers::OnCacheWriteFailure() {
   DLOG(ERROR) << "failed to write response data to cache";
 
+  // The entry no longer matches what was read from the network.
+  recent_chunks_.clear();
+  recent_data_size_ = 0;
+
   ProcessFailure(ERR_CACHE_WRITE_FAILURE);
 
   // Now writers will only be reading from the network.
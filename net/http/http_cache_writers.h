@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 
+#include "base/containers/circular_deque.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "net/base/completion_once_callback.h"
@@ -22,6 +23,7 @@ namespace net {
 
 class HttpResponseInfo;
 class IOBuffer;
+class IOBufferWithSize;
 class PartialData;
 
 // If multiple HttpCache::Transactions are accessing the same cache entry
@@ -159,6 +161,16 @@ class NET_EXPORT_PRIVATE HttpCache::Writers {
 
   int GetTransactionsCount() const { return all_writers_.size(); }
 
+  // Copies up to |buf_len| bytes of the response body at |offset| into |buf|
+  // if they were written to the entry recently enough to still be held in
+  // memory. Returns the number of bytes copied, or 0 if |offset| is not held.
+  // This lets a transaction that fell behind the others, e.g. because it
+  // reads with a smaller buffer, skip a disk cache read.
+  int ReadRecentData(int64_t offset, IOBuffer* buf, int buf_len) const;
+
+  // The most response body bytes held in memory for ReadRecentData().
+  static constexpr int kMaxRecentDataSize = 256 * 1024;
+
  private:
   friend class WritersTest;
 
@@ -191,6 +203,17 @@ class NET_EXPORT_PRIVATE HttpCache::Writers {
 
   using TransactionMap = std::map<Transaction*, TransactionInfo>;
 
+  // A copy of response body data that was written to the entry at |offset|.
+  struct RecentChunk {
+    RecentChunk(int64_t offset, scoped_refptr<IOBufferWithSize> data);
+    ~RecentChunk();
+    RecentChunk(RecentChunk&&);
+    RecentChunk& operator=(RecentChunk&&);
+
+    int64_t offset;
+    scoped_refptr<IOBufferWithSize> data;
+  };
+
   // Runs the state transition loop. Resets and calls |callback_| on exit,
   // unless the return value is ERR_IO_PENDING.
   int DoLoop(int result);
@@ -208,6 +231,11 @@ class NET_EXPORT_PRIVATE HttpCache::Writers {
   void OnCacheWriteFailure();
   void OnDataReceived(int result);
 
+  // Keeps a copy of the |write_len_| bytes of |read_buf_| just written to the
+  // entry at |write_offset_|, evicting the oldest chunks past
+  // kMaxRecentDataSize, so that |recent_chunks_| stays contiguous.
+  void AddRecentChunk();
+
   // Completes any pending IO_PENDING read operations by copying any received
   // bytes from read_buf_ to the given buffer and posts a task to run the
   // callback with |result|.
@@ -257,6 +285,13 @@ class NET_EXPORT_PRIVATE HttpCache::Writers {
 
   int io_buf_len_ = 0;
   int write_len_ = 0;
+  // The entry offset of the ongoing cache write, for full responses.
+  int write_offset_ = 0;
+
+  // The most recent chunks of the response body written to the entry while
+  // more than one transaction shared it, in entry order and contiguous.
+  base::circular_deque<RecentChunk> recent_chunks_;
+  int recent_data_size_ = 0;
 
   // The cache transaction that is the current consumer of network_transaction_
   // ::Read or writing to the entry and is waiting for the operation to be
@@ -685,6 +685,25 @@ TEST_F(WritersTest, ReadMultipleDifferentBufferSizes1) {
   ReadVerifyTwoDifferentBufferLengths(buffer_lengths);
 }
 
+// Tests that the data a transaction with a smaller buffer fell behind on is
+// still held in memory.
+TEST_F(WritersTest, ReadRecentData) {
+  CreateWritersAddTransaction();
+  AddTransactionToExistingWriters();
+
+  std::vector<int> buffer_lengths{20, 10};
+  ReadVerifyTwoDifferentBufferLengths(buffer_lengths);
+
+  std::string expected(kSimpleGET_Transaction.data);
+  auto buf = base::MakeRefCounted<IOBuffer>(kDefaultBufferSize);
+  int rv = writers_->ReadRecentData(10, buf.get(), kDefaultBufferSize);
+  EXPECT_EQ(10, rv);
+  EXPECT_EQ(expected.substr(10, 10), std::string(buf->data(), rv));
+
+  // Nothing past the written data is held.
+  EXPECT_EQ(0, writers_->ReadRecentData(20, buf.get(), kDefaultBufferSize));
+}
+
 // Tests that ongoing Read completes even when active transaction is deleted
 // mid-read. Any transactions waiting should be able to get the read buffer.
 TEST_F(WritersTest, ReadMultipleDeleteActiveTransaction) {
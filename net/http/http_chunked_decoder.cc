@@ -61,7 +61,12 @@ const size_t HttpChunkedDecoder::kMaxLineBufLen = 16384;
 HttpChunkedDecoder::HttpChunkedDecoder() = default;
 
 int HttpChunkedDecoder::FilterBuf(char* buf, int buf_len) {
-  int result = 0;
+  // Decoded data is moved down over the chunk markers before it, to |out|.
+  // Moving each piece once, rather than the whole rest of the buffer after
+  // every marker, keeps this linear in |buf_len| for responses with many
+  // small chunks.
+  char* const start = buf;
+  char* out = buf;
 
   while (buf_len > 0) {
     if (chunk_remaining_ > 0) {
@@ -70,10 +75,12 @@ int HttpChunkedDecoder::FilterBuf(char* buf, int buf_len) {
       int num = static_cast<int>(
           std::min(chunk_remaining_, static_cast<int64_t>(buf_len)));
 
+      if (out != buf)
+        memmove(out, buf, num);
       buf_len -= num;
       chunk_remaining_ -= num;
 
-      result += num;
+      out += num;
       buf += num;
 
       // After each chunk's data there should be a CRLF.
@@ -81,6 +88,9 @@ int HttpChunkedDecoder::FilterBuf(char* buf, int buf_len) {
         chunk_terminator_remaining_ = true;
       continue;
     } else if (reached_eof_) {
+      // Keep the bytes after the final CRLF right after the decoded data.
+      if (out != buf)
+        memmove(out, buf, buf_len);
       bytes_after_eof_ += buf_len;
       break;  // Done!
     }
@@ -90,11 +100,10 @@ int HttpChunkedDecoder::FilterBuf(char* buf, int buf_len) {
       return bytes_consumed; // Error
 
     buf_len -= bytes_consumed;
-    if (buf_len > 0)
-      memmove(buf, buf + bytes_consumed, buf_len);
+    buf += bytes_consumed;
   }
 
-  return result;
+  return static_cast<int>(out - start);
 }
 
 int HttpChunkedDecoder::ScanForChunkRemaining(const char* buf, int buf_len) {
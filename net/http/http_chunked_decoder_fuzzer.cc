@@ -8,12 +8,14 @@
 #include <algorithm>
 #include <vector>
 
+#include "base/check_op.h"
 #include "net/http/http_chunked_decoder.h"
 
 // Entry point for LibFuzzer.
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
   const char* data_ptr = reinterpret_cast<const char*>(data);
   net::HttpChunkedDecoder decoder;
+  std::vector<char> decoded;
 
   // Feed data to decoder.FilterBuf() by blocks of "random" size.
   size_t block_size = 0;
@@ -39,7 +41,22 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
     int result = decoder.FilterBuf(buffer.data(), buffer.size());
     if (result < 0)
       return 0;
+    decoded.insert(decoded.end(), buffer.begin(), buffer.begin() + result);
   }
 
+  // Decoding all of the data at once must give the same result as decoding
+  // it by blocks, which moves chunk data around differently. It may fail
+  // where decoding by blocks does not, since the CR of a line split across
+  // blocks is dropped.
+  std::vector<char> buffer(data_ptr, data_ptr + size);
+  net::HttpChunkedDecoder whole_decoder;
+  int result = whole_decoder.FilterBuf(buffer.data(), buffer.size());
+  if (result < 0)
+    return 0;
+  CHECK_EQ(static_cast<int>(decoded.size()), result);
+  CHECK(std::equal(decoded.begin(), decoded.end(), buffer.begin()));
+  CHECK_EQ(decoder.reached_eof(), whole_decoder.reached_eof());
+  CHECK_EQ(decoder.bytes_after_eof(), whole_decoder.bytes_after_eof());
+
   return 0;
 }
@@ -394,6 +394,27 @@ TEST(HttpChunkedDecoderTest, MultipleExtraDataBlocks) {
   RunTest(inputs, std::size(inputs), "hello", true, 11);
 }
 
+// HttpStreamParser expects the extra bytes right after the decoded data.
+TEST(HttpChunkedDecoderTest, ExtraDataFollowsManyChunks) {
+  std::string input;
+  std::string expected_output;
+  for (char c = 'a'; c <= 'z'; ++c) {
+    input += "1\r\n";
+    input += c;
+    input += "\r\n";
+    expected_output += c;
+  }
+  input += "0\r\n\r\nextra bytes";
+
+  HttpChunkedDecoder decoder;
+  int n = decoder.FilterBuf(&input[0], static_cast<int>(input.size()));
+  ASSERT_EQ(26, n);
+  EXPECT_EQ(expected_output, input.substr(0, n));
+  EXPECT_TRUE(decoder.reached_eof());
+  ASSERT_EQ(11, decoder.bytes_after_eof());
+  EXPECT_EQ("extra bytes", input.substr(n, decoder.bytes_after_eof()));
+}
+
 // Test when the line with the chunk length is too long.
 TEST(HttpChunkedDecoderTest, LongChunkLengthLine) {
   int big_chunk_length = HttpChunkedDecoder::kMaxLineBufLen;
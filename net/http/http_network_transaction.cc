@@ -12,6 +12,7 @@
 #include "base/bind.h"
 #include "base/callback_helpers.h"
 #include "base/compiler_specific.h"
+#include "base/containers/span.h"
 #include "base/feature_list.h"
 #include "base/format_macros.h"
 #include "base/metrics/field_trial.h"
@@ -19,6 +20,7 @@
 #include "base/metrics/histogram_macros.h"
 #include "base/metrics/sparse_histogram.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
 #include "base/values.h"
@@ -107,6 +109,49 @@ void SetProxyInfoInReponse(const ProxyInfo& proxy_info,
     response_info->proxy_server = ProxyServer();
 }
 
+struct AddedResponseHeader {
+  const char* name;
+  const char* value;
+};
+
+// Lets the local NTP read responses with credentials.
+constexpr AddedResponseHeader kLocalNtpAccessHeaders[] = {
+    {"Access-Control-Allow-Origin", "chrome-search://local-ntp"},
+    {"Access-Control-Expose-Headers", "chrome-search://local-ntp"},
+    {"Access-Control-Allow-Credentials", "true"},
+    {"X-Kiwi-Processed", "Yes"},
+};
+
+struct ResponseHeaderRewriteRule {
+  // Matched against the host of the request URL, which must have no explicit
+  // port.
+  const char* host;
+  // Added to the response, each unless already present.
+  base::span<const AddedResponseHeader> added_headers;
+};
+
+constexpr ResponseHeaderRewriteRule kResponseHeaderRewriteRules[] = {
+    {"news.google.com", kLocalNtpAccessHeaders},
+    {"consent.google.com", kLocalNtpAccessHeaders},
+    {"d3ward.github.io", kLocalNtpAccessHeaders},
+};
+
+// Applies the rule for |url|'s host, if any, to |headers|.
+void RewriteResponseHeaders(const GURL& url, HttpResponseHeaders* headers) {
+  if (url.has_port())
+    return;
+  const base::StringPiece host = url.host_piece();
+  for (const ResponseHeaderRewriteRule& rule : kResponseHeaderRewriteRules) {
+    if (host != rule.host)
+      continue;
+    for (const AddedResponseHeader& header : rule.added_headers) {
+      if (!headers->HasHeader(header.name))
+        headers->AddHeader(header.name, header.value);
+    }
+    return;
+  }
+}
+
 }  // namespace
 
 const int HttpNetworkTransaction::kDrainBodyBufferSize;
@@ -1176,6 +1221,8 @@ int HttpNetworkTransaction::DoReadHeadersComplete(int result) {
     return OK;
   }
 
+  RewriteResponseHeaders(request_->url, response_.headers.get());
+
   NetLogResponseHeaders(net_log_,
                         NetLogEventType::HTTP_TRANSACTION_READ_RESPONSE_HEADERS,
                         response_.headers.get());
@@ -1715,28 +1762,6 @@ void HttpNetworkTransaction::CacheNetErrorDetailsAndResetStream() {
 }
 
 HttpResponseHeaders* HttpNetworkTransaction::GetResponseHeaders() const {
-  std::string header_value_;
-  std::string header_value_1;
-  std::string header_value_2;
-  std::string header_value_3;
-
-  if (request_ != NULL
-      && (GetHostAndOptionalPort(request_->url) == "news.google.com" || GetHostAndOptionalPort(request_->url) == "consent.google.com" || GetHostAndOptionalPort(request_->url) == "d3ward.github.io"))
-  {
-     if (response_.headers && !response_.headers->GetNormalizedHeader(
-             "Access-Control-Allow-Origin", &header_value_))
-       response_.headers->AddHeader("Access-Control-Allow-Origin", "chrome-search://local-ntp");
-     if (response_.headers && !response_.headers->GetNormalizedHeader(
-             "Access-Control-Expose-Headers", &header_value_1))
-       response_.headers->AddHeader("Access-Control-Expose-Headers", "chrome-search://local-ntp");
-     if (response_.headers && !response_.headers->GetNormalizedHeader(
-             "Access-Control-Allow-Credentials", &header_value_2))
-       response_.headers->AddHeader("Access-Control-Allow-Credentials", "true");
-     if (response_.headers && !response_.headers->GetNormalizedHeader(
-             "X-Kiwi-Processed", &header_value_3))
-       response_.headers->AddHeader("X-Kiwi-Processed", "Yes");
-  }
-
   return response_.headers.get();
 }
 
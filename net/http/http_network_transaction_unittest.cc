@@ -875,6 +875,46 @@ TEST_F(HttpNetworkTransactionTest, SimpleGETNoHeadersWeirdPort) {
   EXPECT_THAT(callback.GetResult(rv), IsError(ERR_INVALID_HTTP_RESPONSE));
 }
 
+// Responses from hosts with a header rewrite rule get the rule's headers,
+// unless the server already sent them.
+TEST_F(HttpNetworkTransactionTest, ResponseHeaderRewrite) {
+  MockWrite data_writes[] = {
+      MockWrite("GET / HTTP/1.1\r\n"
+                "Host: news.google.com\r\n"
+                "Connection: keep-alive\r\n\r\n"),
+  };
+  MockRead data_reads[] = {
+      MockRead("HTTP/1.1 200 OK\r\n"
+               "Access-Control-Allow-Credentials: false\r\n"
+               "Content-Length: 0\r\n\r\n"),
+  };
+  StaticSocketDataProvider data(data_reads, data_writes);
+  session_deps_.socket_factory->AddSocketDataProvider(&data);
+
+  std::unique_ptr<HttpNetworkSession> session(CreateSession(&session_deps_));
+  HttpNetworkTransaction trans(DEFAULT_PRIORITY, session.get());
+
+  HttpRequestInfo request;
+  request.method = "GET";
+  request.url = GURL("http://news.google.com/");
+  request.traffic_annotation =
+      net::MutableNetworkTrafficAnnotationTag(TRAFFIC_ANNOTATION_FOR_TESTS);
+
+  TestCompletionCallback callback;
+  int rv = trans.Start(&request, callback.callback(), NetLogWithSource());
+  EXPECT_THAT(callback.GetResult(rv), IsOk());
+
+  const HttpResponseHeaders* headers = trans.GetResponseInfo()->headers.get();
+  ASSERT_TRUE(headers);
+  EXPECT_TRUE(headers->HasHeaderValue("Access-Control-Allow-Origin",
+                                      "chrome-search://local-ntp"));
+  EXPECT_TRUE(
+      headers->HasHeaderValue("Access-Control-Allow-Credentials", "false"));
+  EXPECT_FALSE(
+      headers->HasHeaderValue("Access-Control-Allow-Credentials", "true"));
+  EXPECT_TRUE(headers->HasHeaderValue("X-Kiwi-Processed", "Yes"));
+}
+
 // Tests that request info can be destroyed after the headers phase is complete.
 TEST_F(HttpNetworkTransactionTest, SimpleGETNoReadDestroyRequestInfo) {
   std::unique_ptr<HttpNetworkSession> session(CreateSession(&session_deps_));
@@ -136,6 +136,47 @@ void CheckDoesNotHaveEmbeddedNulls(base::StringPiece str) {
   CHECK(!HasEmbeddedNulls(str));
 }
 
+// The names of the headers that are looked up for most responses. Each gets
+// an ID, its index plus one, when the headers are parsed, so that finding it
+// later compares IDs rather than strings.
+const char* const kWellKnownHeaderNames[] = {
+    "age",
+    "cache-control",
+    "connection",
+    "content-encoding",
+    "content-length",
+    "content-range",
+    "content-type",
+    "date",
+    "etag",
+    "expires",
+    "last-modified",
+    "location",
+    "pragma",
+    "proxy-connection",
+    "set-cookie",
+    "strict-transport-security",
+    "transfer-encoding",
+    "vary",
+};
+static_assert(std::size(kWellKnownHeaderNames) <
+                  std::numeric_limits<uint8_t>::max(),
+              "Header name IDs must fit in a uint8_t");
+
+// The ID of headers outside of kWellKnownHeaderNames.
+constexpr uint8_t kUnknownHeaderName = 0;
+
+uint8_t GetHeaderNameId(base::StringPiece name) {
+  for (size_t i = 0; i < std::size(kWellKnownHeaderNames); ++i) {
+    base::StringPiece well_known = kWellKnownHeaderNames[i];
+    if (name.size() == well_known.size() &&
+        base::EqualsCaseInsensitiveASCII(name, well_known)) {
+      return static_cast<uint8_t>(i + 1);
+    }
+  }
+  return kUnknownHeaderName;
+}
+
 }  // namespace
 
 const char HttpResponseHeaders::kContentRange[] = "Content-Range";
@@ -152,6 +193,9 @@ struct HttpResponseHeaders::ParsedHeader {
   std::string::const_iterator value_begin;
   std::string::const_iterator value_end;
 
+  // The ID of the name from kWellKnownHeaderNames, or kUnknownHeaderName.
+  uint8_t name_id = kUnknownHeaderName;
+
   // Write a representation of this object into a tracing proto.
   void WriteIntoTrace(perfetto::TracedValue context) const {
     auto dict = std::move(context).WriteDictionary();
@@ -586,6 +630,18 @@ bool HttpResponseHeaders::EnumerateHeaderLines(size_t* iter,
 bool HttpResponseHeaders::EnumerateHeader(size_t* iter,
                                           base::StringPiece name,
                                           std::string* value) const {
+  base::StringPiece value_piece;
+  if (!EnumerateHeader(iter, name, &value_piece)) {
+    value->clear();
+    return false;
+  }
+  value->assign(value_piece.data(), value_piece.size());
+  return true;
+}
+
+bool HttpResponseHeaders::EnumerateHeader(size_t* iter,
+                                          base::StringPiece name,
+                                          base::StringPiece* value) const {
   size_t i;
   if (!iter || !*iter) {
     i = FindHeader(0, name);
@@ -599,13 +655,13 @@ bool HttpResponseHeaders::EnumerateHeader(size_t* iter,
   }
 
   if (i == std::string::npos) {
-    value->clear();
+    *value = base::StringPiece();
     return false;
   }
 
   if (iter)
     *iter = i + 1;
-  value->assign(parsed_[i].value_begin, parsed_[i].value_end);
+  *value = base::MakeStringPiece(parsed_[i].value_begin, parsed_[i].value_end);
   return true;
 }
 
@@ -614,7 +670,7 @@ bool HttpResponseHeaders::HasHeaderValue(base::StringPiece name,
   // The value has to be an exact match.  This is important since
   // 'cache-control: no-cache' != 'cache-control: no-cache="foo"'
   size_t iter = 0;
-  std::string temp;
+  base::StringPiece temp;
   while (EnumerateHeader(&iter, name, &temp)) {
     if (base::EqualsCaseInsensitiveASCII(value, temp))
       return true;
@@ -747,9 +803,21 @@ void HttpResponseHeaders::ParseStatusLine(
 
 size_t HttpResponseHeaders::FindHeader(size_t from,
                                        base::StringPiece search) const {
+  const uint8_t search_id = GetHeaderNameId(search);
+  if (search_id != kUnknownHeaderName) {
+    for (size_t i = from; i < parsed_.size(); ++i) {
+      if (parsed_[i].name_id == search_id)
+        return i;
+    }
+    return std::string::npos;
+  }
+
   for (size_t i = from; i < parsed_.size(); ++i) {
-    if (parsed_[i].is_continuation())
+    // Neither continuations nor well-known headers can match |search|.
+    if (parsed_[i].is_continuation() ||
+        parsed_[i].name_id != kUnknownHeaderName) {
       continue;
+    }
     auto name =
         base::MakeStringPiece(parsed_[i].name_begin, parsed_[i].name_end);
     if (base::EqualsCaseInsensitiveASCII(search, name))
@@ -763,7 +831,7 @@ bool HttpResponseHeaders::GetCacheControlDirective(
     base::StringPiece directive,
     base::TimeDelta* result) const {
   static constexpr base::StringPiece name("cache-control");
-  std::string value;
+  base::StringPiece value;
 
   size_t directive_size = directive.size();
 
@@ -833,6 +901,10 @@ void HttpResponseHeaders::AddToParsed(std::string::const_iterator name_begin,
   header.name_end = name_end;
   header.value_begin = value_begin;
   header.value_end = value_end;
+  if (!header.is_continuation()) {
+    header.name_id =
+        GetHeaderNameId(base::MakeStringPiece(name_begin, name_end));
+  }
   parsed_.push_back(header);
 }
 
@@ -1297,7 +1369,7 @@ bool HttpResponseHeaders::IsKeepAlive() const {
 
   for (const char* header : kConnectionHeaders) {
     size_t iterator = 0;
-    std::string token;
+    base::StringPiece token;
     while (EnumerateHeader(&iterator, header, &token)) {
       for (const KeepAliveToken& keep_alive_token : kKeepAliveTokens) {
         if (base::EqualsCaseInsensitiveASCII(token, keep_alive_token.token))
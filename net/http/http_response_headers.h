@@ -219,6 +219,12 @@ class NET_EXPORT HttpResponseHeaders
                        base::StringPiece name,
                        std::string* value) const;
 
+  // Same as above, but |value| points into these headers rather than being a
+  // copy, so it is only valid until they are changed or destroyed.
+  bool EnumerateHeader(size_t* iter,
+                       base::StringPiece name,
+                       base::StringPiece* value) const;
+
   // Returns true if the response contains the specified header-value pair.
   // Both name and value are compared case insensitively.
   bool HasHeaderValue(base::StringPiece name, base::StringPiece value) const;
@@ -527,6 +527,39 @@ TEST(HttpResponseHeadersTest, EnumerateHeader_Coalesced) {
   EXPECT_FALSE(parsed->EnumerateHeader(&iter, "cache-control", &value));
 }
 
+// Well-known header names, which are matched by ID, and other names, which
+// are matched by string, are both found case-insensitively, and are not mixed
+// up with each other.
+TEST(HttpResponseHeadersTest, EnumerateHeader_StringPiece) {
+  std::string headers =
+      "HTTP/1.1 200 OK\n"
+      "X-Vary: a\n"
+      "VARY: accept-encoding, cookie\n"
+      "x-VARY: b\n";
+  HeadersToRaw(&headers);
+  auto parsed = base::MakeRefCounted<HttpResponseHeaders>(headers);
+
+  size_t iter = 0;
+  base::StringPiece value;
+  ASSERT_TRUE(parsed->EnumerateHeader(&iter, "Vary", &value));
+  EXPECT_EQ("accept-encoding", value);
+  ASSERT_TRUE(parsed->EnumerateHeader(&iter, "Vary", &value));
+  EXPECT_EQ("cookie", value);
+  EXPECT_FALSE(parsed->EnumerateHeader(&iter, "Vary", &value));
+  EXPECT_TRUE(value.empty());
+
+  iter = 0;
+  ASSERT_TRUE(parsed->EnumerateHeader(&iter, "x-vary", &value));
+  EXPECT_EQ("a", value);
+  ASSERT_TRUE(parsed->EnumerateHeader(&iter, "x-vary", &value));
+  EXPECT_EQ("b", value);
+  EXPECT_FALSE(parsed->EnumerateHeader(&iter, "x-vary", &value));
+
+  EXPECT_FALSE(parsed->HasHeader("vary2"));
+  EXPECT_FALSE(parsed->HasHeader("etag"));
+  EXPECT_TRUE(parsed->HasHeaderValue("vary", "COOKIE"));
+}
+
 TEST(HttpResponseHeadersTest, EnumerateHeader_Challenge) {
   // Even though WWW-Authenticate has commas, it should not be treated as
   // coalesced values.
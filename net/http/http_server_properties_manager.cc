@@ -209,6 +209,14 @@ HttpServerPropertiesManager::HttpServerPropertiesManager(
   net_log_.BeginEvent(NetLogEventType::HTTP_SERVER_PROPERTIES_INITIALIZATION);
 }
 
+HttpServerPropertiesManager::SerializedServer::SerializedServer() = default;
+HttpServerPropertiesManager::SerializedServer::SerializedServer(
+    SerializedServer&&) = default;
+HttpServerPropertiesManager::SerializedServer&
+HttpServerPropertiesManager::SerializedServer::operator=(SerializedServer&&) =
+    default;
+HttpServerPropertiesManager::SerializedServer::~SerializedServer() = default;
+
 HttpServerPropertiesManager::~HttpServerPropertiesManager() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 }
@@ -716,7 +724,19 @@ void HttpServerPropertiesManager::WriteToPrefs(
   // Convert |server_info_map| to a list Value and add it to
   // |http_server_properties_dict|.
   base::Value::List servers_list;
+  std::map<HttpServerProperties::ServerInfoMapKey, SerializedServer>
+      serialized_servers;
   for (const auto& [key, server_info] : server_info_map) {
+    auto cached = serialized_servers_.find(key);
+    if (cached != serialized_servers_.end() &&
+        cached->second.server_info == server_info &&
+        cached->second.expiration >= now) {
+      if (!cached->second.dict.empty())
+        servers_list.Append(cached->second.dict.Clone());
+      serialized_servers.insert(serialized_servers_.extract(cached));
+      continue;
+    }
+
     // If can't convert the NetworkIsolationKey to a value, don't save to disk.
     // Generally happens because the key is for a unique origin.
     base::Value network_isolation_key_value;
@@ -744,13 +764,25 @@ void HttpServerPropertiesManager::WriteToPrefs(
     // Don't add empty entries. This can happen if, for example, all alternative
     // services are empty, or |supports_spdy| is set to false, and all other
     // fields are not set.
-    if (server_dict.empty())
+    if (!server_dict.empty()) {
+      server_dict.Set(kServerKey, key.server.Serialize());
+      server_dict.Set(kNetworkIsolationKey,
+                      std::move(network_isolation_key_value));
+      servers_list.Append(server_dict.Clone());
+    }
+
+    if (get_canonical_suffix.Run(key.server.host()))
       continue;
-    server_dict.Set(kServerKey, key.server.Serialize());
-    server_dict.Set(kNetworkIsolationKey,
-                    std::move(network_isolation_key_value));
-    servers_list.Append(std::move(server_dict));
+    SerializedServer& serialized = serialized_servers[key];
+    serialized.server_info = server_info;
+    for (const auto& alternative_service_info : alternative_services) {
+      serialized.expiration = std::min(serialized.expiration,
+                                       alternative_service_info.expiration());
+    }
+    serialized.dict = std::move(server_dict);
   }
+  serialized_servers_ = std::move(serialized_servers);
+
   // Reverse `servers_list`. The least recently used item will be in the front.
   std::reverse(servers_list.begin(), servers_list.end());
 
@@ -5,6 +5,7 @@
 #ifndef NET_HTTP_HTTP_SERVER_PROPERTIES_MANAGER_H_
 #define NET_HTTP_HTTP_SERVER_PROPERTIES_MANAGER_H_
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -13,6 +14,8 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
+#include "base/time/time.h"
+#include "base/values.h"
 #include "net/base/host_port_pair.h"
 #include "net/base/net_export.h"
 #include "net/http/alternative_service.h"
@@ -201,6 +204,23 @@ class NET_EXPORT_PRIVATE HttpServerPropertiesManager {
 
   void OnHttpServerPropertiesLoaded();
 
+  // The pref entry of a server as last written by WriteToPrefs(), reused by
+  // later writes while the server's info is unchanged, so that only servers
+  // that changed are serialized again.
+  struct SerializedServer {
+    SerializedServer();
+    SerializedServer(SerializedServer&&);
+    SerializedServer& operator=(SerializedServer&&);
+    ~SerializedServer();
+
+    HttpServerProperties::ServerInfo server_info;
+    // The earliest expiration of the persisted alternative services, after
+    // which |dict| would hold an expired one.
+    base::Time expiration = base::Time::Max();
+    // Empty if there is nothing to persist for the server.
+    base::Value::Dict dict;
+  };
+
   std::unique_ptr<HttpServerProperties::PrefDelegate> pref_delegate_;
 
   OnPrefsLoadedCallback on_prefs_loaded_callback_;
@@ -211,6 +231,11 @@ class NET_EXPORT_PRIVATE HttpServerPropertiesManager {
 
   const NetLogWithSource net_log_;
 
+  // Servers whose host has a canonical suffix are not included, as whether
+  // their alternative services are persisted depends on the other servers.
+  std::map<HttpServerProperties::ServerInfoMapKey, SerializedServer>
+      serialized_servers_;
+
   SEQUENCE_CHECKER(sequence_checker_);
 
   base::WeakPtrFactory<HttpServerPropertiesManager> pref_load_weak_ptr_factory_{
@@ -1387,6 +1387,58 @@ TEST_F(HttpServerPropertiesManagerTest, DoNotPersistExpiredAlternativeService) {
   EXPECT_EQ("valid.example.com", *hostname);
 }
 
+// Test that the pref entry of a server that did not change is reused by later
+// writes, until one of its alternative services expires.
+TEST_F(HttpServerPropertiesManagerTest, ReuseUnchangedServerPrefs) {
+  InitializePrefs();
+
+  const base::TimeDelta update_delay =
+      HttpServerProperties::GetUpdatePrefsDelayForTesting();
+  const url::SchemeHostPort server("https", "www.example.com", 443);
+  const AlternativeService alternative_service(kProtoHTTP2, "alt.example.com",
+                                               443);
+  http_server_props_->SetAlternativeServices(
+      server, NetworkIsolationKey(),
+      {AlternativeServiceInfo::CreateHttp2AlternativeServiceInfo(
+          alternative_service, base::Time::Now() + update_delay * 2.5)});
+
+  // Returns the number of alternative services persisted for |server|.
+  auto persisted_alternative_services = [&]() -> size_t {
+    const base::Value::List* servers_list =
+        pref_delegate_->GetServerProperties()->GetDict().FindList("servers");
+    EXPECT_TRUE(servers_list);
+    for (const base::Value& server_pref : *servers_list) {
+      const base::Value::Dict& server_dict = server_pref.GetDict();
+      if (*server_dict.FindString("server") != "https://www.example.com")
+        continue;
+      const base::Value::List* altsvc_list =
+          server_dict.FindList("alternative_service");
+      return altsvc_list ? altsvc_list->size() : 0u;
+    }
+    return 0u;
+  };
+
+  FastForwardBy(update_delay);
+  EXPECT_EQ(1, pref_delegate_->GetAndClearNumPrefUpdates());
+  EXPECT_EQ(1u, persisted_alternative_services());
+
+  // Changes to other servers write the unchanged entry of |server| again.
+  http_server_props_->SetSupportsSpdy(
+      url::SchemeHostPort("https", "mail.example.com", 443),
+      NetworkIsolationKey(), true);
+  FastForwardBy(update_delay);
+  EXPECT_EQ(1, pref_delegate_->GetAndClearNumPrefUpdates());
+  EXPECT_EQ(1u, persisted_alternative_services());
+
+  // Once the alternative service has expired, it is no longer written.
+  http_server_props_->SetSupportsSpdy(
+      url::SchemeHostPort("https", "drive.example.com", 443),
+      NetworkIsolationKey(), true);
+  FastForwardBy(update_delay);
+  EXPECT_EQ(1, pref_delegate_->GetAndClearNumPrefUpdates());
+  EXPECT_EQ(0u, persisted_alternative_services());
+}
+
 // Test that expired alternative service entries on disk are ignored.
 TEST_F(HttpServerPropertiesManagerTest, DoNotLoadExpiredAlternativeService) {
   InitializePrefs();
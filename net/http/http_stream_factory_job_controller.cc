@@ -919,6 +919,8 @@ int HttpStreamFactory::JobController::DoCreateJobs() {
     main_job_is_blocked_ = true;
   }
 
+  jobs_start_time_ = base::TimeTicks::Now();
+
   if (alternative_job_) {
     alternative_job_->Start(request_->stream_type());
   }
@@ -1318,7 +1320,13 @@ void HttpStreamFactory::JobController::ReportAlternateProtocolUsage(
 
   bool is_google_host = HasGoogleHost(job->origin_url());
 
+  // Compared across networks, these show how much a race costs when QUIC is
+  // blocked, and how much it saves when QUIC works.
+  const base::TimeDelta time_to_stream =
+      base::TimeTicks::Now() - jobs_start_time_;
   if (job == main_job_.get()) {
+    UMA_HISTOGRAM_MEDIUM_TIMES("Net.HttpJob.RaceWinnerTimeToStream.MainJob",
+                               time_to_stream);
     HistogramAlternateProtocolUsage(ALTERNATE_PROTOCOL_USAGE_MAIN_JOB_WON_RACE,
                                     is_google_host);
     return;
@@ -1330,6 +1338,8 @@ void HttpStreamFactory::JobController::ReportAlternateProtocolUsage(
       return;
     }
 
+    UMA_HISTOGRAM_MEDIUM_TIMES(
+        "Net.HttpJob.RaceWinnerTimeToStream.AlternativeJob", time_to_stream);
     HistogramAlternateProtocolUsage(ALTERNATE_PROTOCOL_USAGE_WON_RACE,
                                     is_google_host);
   }
@@ -1340,6 +1350,8 @@ void HttpStreamFactory::JobController::ReportAlternateProtocolUsage(
           is_google_host);
       return;
     }
+    UMA_HISTOGRAM_MEDIUM_TIMES(
+        "Net.HttpJob.RaceWinnerTimeToStream.AlternativeJob", time_to_stream);
     HistogramAlternateProtocolUsage(
         ALTERNATE_PROTOCOL_USAGE_DNS_ALPN_H3_JOB_WON_RACE, is_google_host);
   }
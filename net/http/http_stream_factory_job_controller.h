@@ -333,6 +333,10 @@ class HttpStreamFactory::JobController
   // Set to true if the DNS HTTPS ALPN job failed on the default network.
   bool dns_alpn_h3_job_failed_on_default_network_ = false;
 
+  // When the jobs were started. Used to time how long the winning job of a
+  // race took to get a stream.
+  base::TimeTicks jobs_start_time_;
+
   // True if a Job has ever been bound to the |request_|.
   bool job_bound_ = false;
 
@@ -4348,6 +4348,9 @@ TEST_F(HttpStreamFactoryJobControllerDnsHttpsAlpnTest,
   histogram_tester.ExpectUniqueSample(
       "Net.AlternateProtocolUsage",
       ALTERNATE_PROTOCOL_USAGE_DNS_ALPN_H3_JOB_WON_RACE, 1);
+  histogram_tester.ExpectUniqueTimeSample(
+      "Net.HttpJob.RaceWinnerTimeToStream.AlternativeJob",
+      base::Milliseconds(kDefaultDelayMilliSecsForWaitingJob), 1);
 
   // The success of |dns_alpn_h3_job| deletes |main_job|.
   CheckJobsStatus(/*main_job_exists=*/false, /*alternative_job_exists=*/false,
@@ -4380,6 +4383,10 @@ TEST_F(HttpStreamFactoryJobControllerDnsHttpsAlpnTest,
   histogram_tester.ExpectUniqueSample(
       "Net.AlternateProtocolUsage", ALTERNATE_PROTOCOL_USAGE_MAIN_JOB_WON_RACE,
       1);
+  histogram_tester.ExpectTotalCount(
+      "Net.HttpJob.RaceWinnerTimeToStream.MainJob", 1);
+  histogram_tester.ExpectTotalCount(
+      "Net.HttpJob.RaceWinnerTimeToStream.AlternativeJob", 0);
 
   // The success of |main_job| doesn't delete |dns_alpn_h3_job|.
   EXPECT_TRUE(job_controller_->dns_alpn_h3_job());
@@ -4596,6 +4603,9 @@ TEST_F(HttpStreamFactoryJobControllerDnsHttpsAlpnTest,
   }
   histogram_tester.ExpectUniqueSample("Net.AlternateProtocolUsage",
                                       ALTERNATE_PROTOCOL_USAGE_NO_RACE, 1);
+  // Reusing a session is not a race.
+  histogram_tester.ExpectTotalCount(
+      "Net.HttpJob.RaceWinnerTimeToStream.AlternativeJob", 0);
 
   CheckJobsStatus(/*main_job_exists=*/false, /*alternative_job_exists=*/true,
                   /*dns_alpn_h3_job_exists=*/false,
@@ -4633,6 +4643,8 @@ TEST_F(HttpStreamFactoryJobControllerDnsHttpsAlpnTest,
   histogram_tester.ExpectUniqueSample(
       "Net.AlternateProtocolUsage",
       ALTERNATE_PROTOCOL_USAGE_DNS_ALPN_H3_JOB_WON_WITOUT_RACE, 1);
+  histogram_tester.ExpectTotalCount(
+      "Net.HttpJob.RaceWinnerTimeToStream.AlternativeJob", 0);
   CheckJobsStatus(/*main_job_exists=*/false, /*alternative_job_exists=*/false,
                   /*dns_alpn_h3_job_exists=*/true,
                   "DNS alpn H3 job must exist.");
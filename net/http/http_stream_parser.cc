@@ -40,6 +40,11 @@ namespace {
 
 const uint64_t kMaxMergedHeaderAndBodySize = 1400;
 const size_t kRequestBodyBufferSize = 1 << 14;  // 16KB
+// Used instead for bodies that are not in memory, e.g. file uploads, and are
+// larger than kRequestBodyBufferSize. Each read of those is a round trip to
+// a worker thread, so reading more at a time makes for fewer of them, and
+// fewer, larger socket writes.
+const size_t kLargeRequestBodyBufferSize = 1 << 16;  // 64KB
 
 std::string GetResponseHeaderLines(const HttpResponseHeaders& headers) {
   std::string raw_headers = headers.raw_headers();
@@ -223,8 +228,15 @@ int HttpStreamParser::SendRequest(
   request_headers_length_ = request.size();
 
   if (request_->upload_data_stream != nullptr) {
+    const UploadDataStream* upload_data_stream = request_->upload_data_stream;
+    size_t buffer_size = kRequestBodyBufferSize;
+    if (!upload_data_stream->is_chunked() &&
+        !upload_data_stream->IsInMemory() &&
+        upload_data_stream->size() > kRequestBodyBufferSize) {
+      buffer_size = kLargeRequestBodyBufferSize;
+    }
     request_body_send_buf_ =
-        base::MakeRefCounted<SeekableIOBuffer>(kRequestBodyBufferSize);
+        base::MakeRefCounted<SeekableIOBuffer>(buffer_size);
     if (request_->upload_data_stream->is_chunked()) {
       // Read buffer is adjusted to guarantee that |request_body_send_buf_| is
       // large enough to hold the encoded chunk.
@@ -22,16 +22,49 @@
 #include "net/http/http_request_headers.h"
 #include "net/http/http_request_info.h"
 #include "net/http/http_response_info.h"
+#include "net/http/http_util.h"
 #include "net/log/net_log.h"
 #include "net/log/test_net_log.h"
 #include "net/socket/fuzzed_socket.h"
 #include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
 #include "url/gurl.h"
 
+namespace {
+
+// Byte at a time version of HttpUtil::LocateEndOfHeaders(), which skips
+// between line breaks with memchr().
+size_t LocateEndOfHeadersByByte(const char* buf,
+                                size_t buf_len,
+                                bool accept_empty_header_list) {
+  char last_c = accept_empty_header_list ? '\n' : '\0';
+  bool was_lf = accept_empty_header_list;
+  for (size_t i = 0; i < buf_len; ++i) {
+    char c = buf[i];
+    if (c == '\n') {
+      if (was_lf)
+        return i + 1;
+      was_lf = true;
+    } else if (c != '\r' || last_c != '\n') {
+      was_lf = false;
+    }
+    last_c = c;
+  }
+  return std::string::npos;
+}
+
+}  // namespace
+
 // Fuzzer for HttpStreamParser.
 //
-// |data| is used to create a FuzzedSocket.
+// |data| is used to create a FuzzedSocket. The end of headers is also looked
+// for in all of |data|, checking HttpUtil's scanner against a simple one.
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  const char* data_ptr = reinterpret_cast<const char*>(data);
+  CHECK_EQ(LocateEndOfHeadersByByte(data_ptr, size, false),
+           net::HttpUtil::LocateEndOfHeaders(data_ptr, size));
+  CHECK_EQ(LocateEndOfHeadersByByte(data_ptr, size, true),
+           net::HttpUtil::LocateEndOfAdditionalHeaders(data_ptr, size));
+
   net::TestCompletionCallback callback;
   // Including an observer; even though the recorded results aren't currently
   // used, it'll ensure the netlogging code is fuzzed as well.
@@ -19,38 +19,18 @@ HttpVaryData::HttpVaryData() = default;
 
 bool HttpVaryData::Init(const HttpRequestInfo& request_info,
                         const HttpResponseHeaders& response_headers) {
-  base::MD5Context ctx;
-  base::MD5Init(&ctx);
-
   is_valid_ = false;
-  bool processed_header = false;
-
-  // Feed the MD5 context in the order of the Vary header enumeration.  If the
-  // Vary header repeats a header name, then that's OK.
-  //
-  // If the Vary header contains '*' then we can just notice it based on
-  // |cached_response_headers| in MatchesRequest(), and don't have to worry
-  // about the specific headers.  We still want an HttpVaryData around, to let
-  // us handle this case. See section 4.1 of RFC 7234.
-  //
-  size_t iter = 0;
-  std::string name = "vary", request_header;
-  while (response_headers.EnumerateHeader(&iter, name, &request_header)) {
-    if (request_header == "*") {
+  switch (DigestRequest(request_info, response_headers, &request_digest_)) {
+    case DigestResult::kNoVaryHeader:
+      return false;
+    case DigestResult::kVaryStar:
       // What's in request_digest_ will never be looked at, but make it
       // deterministic so we don't serialize out uninitialized memory content.
       memset(&request_digest_, 0, sizeof(request_digest_));
       return is_valid_ = true;
-    }
-    AddField(request_info, request_header, &ctx);
-    processed_header = true;
+    case DigestResult::kDigested:
+      return is_valid_ = true;
   }
-
-  if (!processed_header)
-    return false;
-
-  base::MD5Final(&request_digest_, &ctx);
-  return is_valid_ = true;
 }
 
 bool HttpVaryData::InitFromPickle(base::PickleIterator* iter) {
@@ -71,24 +51,57 @@ void HttpVaryData::Persist(base::Pickle* pickle) const {
 bool HttpVaryData::MatchesRequest(
     const HttpRequestInfo& request_info,
     const HttpResponseHeaders& cached_response_headers) const {
-  // Vary: * never matches.
-  if (cached_response_headers.HasHeaderValue("vary", "*"))
-    return false;
-
-  HttpVaryData new_vary_data;
-  if (!new_vary_data.Init(request_info, cached_response_headers)) {
-    // This case can happen if |this| was loaded from a cache that was populated
-    // by a build before crbug.com/469675 was fixed.
-    return false;
+  base::MD5Digest digest;
+  switch (DigestRequest(request_info, cached_response_headers, &digest)) {
+    case DigestResult::kNoVaryHeader:
+      // This case can happen if |this| was loaded from a cache that was
+      // populated by a build before crbug.com/469675 was fixed.
+      return false;
+    case DigestResult::kVaryStar:
+      // Vary: * never matches.
+      return false;
+    case DigestResult::kDigested:
+      return memcmp(&digest, &request_digest_, sizeof(request_digest_)) == 0;
+  }
+}
+
+// static
+HttpVaryData::DigestResult HttpVaryData::DigestRequest(
+    const HttpRequestInfo& request_info,
+    const HttpResponseHeaders& response_headers,
+    base::MD5Digest* digest) {
+  base::MD5Context ctx;
+  base::MD5Init(&ctx);
+  bool processed_header = false;
+
+  // Feed the MD5 context in the order of the Vary header enumeration.  If the
+  // Vary header repeats a header name, then that's OK.
+  //
+  // If the Vary header contains '*' then the request never matches, and we
+  // don't have to worry about the specific headers.  We still want an
+  // HttpVaryData around, to let us handle this case. See section 4.1 of
+  // RFC 7234.
+  //
+  size_t iter = 0;
+  base::StringPiece request_header;
+  while (response_headers.EnumerateHeader(&iter, "vary", &request_header)) {
+    if (request_header == "*")
+      return DigestResult::kVaryStar;
+    AddField(request_info, request_header, &ctx);
+    processed_header = true;
   }
-  return memcmp(&new_vary_data.request_digest_, &request_digest_,
-                sizeof(request_digest_)) == 0;
+
+  if (!processed_header)
+    return DigestResult::kNoVaryHeader;
+
+  base::MD5Final(digest, &ctx);
+  return DigestResult::kDigested;
 }
 
 // static
 std::string HttpVaryData::GetRequestValue(
     const HttpRequestInfo& request_info,
-    const std::string& request_header) {
+    base::StringPiece request_header) {
   // Unfortunately, we do not have access to all of the request headers at this
   // point.  Most notably, we do not have access to an Authorization header if
   // one will be added to the request.
@@ -102,17 +115,16 @@ std::string HttpVaryData::GetRequestValue(
 
 // static
 void HttpVaryData::AddField(const HttpRequestInfo& request_info,
-                            const std::string& request_header,
+                            base::StringPiece request_header,
                             base::MD5Context* ctx) {
-  std::string request_value = GetRequestValue(request_info, request_header);
+  base::MD5Update(ctx, GetRequestValue(request_info, request_header));
 
   // Append a character that cannot appear in the request header line so that we
   // protect against case where the concatenation of two request headers could
   // look the same for a variety of values for the individual request headers.
   // For example, "foo: 12\nbar: 3" looks like "foo: 1\nbar: 23" otherwise.
-  request_value.append(1, '\n');
-
-  base::MD5Update(ctx, request_value);
+  // Feeding it separately gives the same digest as hashing the concatenation.
+  base::MD5Update(ctx, "\n");
 }
 
 }  // namespace net
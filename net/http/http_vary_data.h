@@ -6,6 +6,7 @@
 #define NET_HTTP_HTTP_VARY_DATA_H_
 
 #include "base/hash/md5.h"
+#include "base/strings/string_piece.h"
 #include "net/base/net_export.h"
 
 namespace base {
@@ -66,13 +67,27 @@ class NET_EXPORT_PRIVATE HttpVaryData {
                       const HttpResponseHeaders& cached_response_headers) const;
 
  private:
+  enum class DigestResult {
+    // The response has no Vary header, or only empty ones.
+    kNoVaryHeader,
+    // A Vary header is '*'.
+    kVaryStar,
+    kDigested,
+  };
+
+  // Digests the values of the request headers named by the Vary headers of
+  // |response_headers| into |digest|, which is only written for kDigested.
+  static DigestResult DigestRequest(const HttpRequestInfo& request_info,
+                                    const HttpResponseHeaders& response_headers,
+                                    base::MD5Digest* digest);
+
   // Returns the corresponding request header value.
   static std::string GetRequestValue(const HttpRequestInfo& request_info,
-                                     const std::string& request_header);
+                                     base::StringPiece request_header);
 
   // Append to the MD5 context for the given request header.
   static void AddField(const HttpRequestInfo& request_info,
-                       const std::string& request_header,
+                       base::StringPiece request_header,
                        base::MD5Context* context);
 
   // A digested version of the request headers corresponding to the Vary header.
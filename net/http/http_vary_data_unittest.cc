@@ -5,7 +5,10 @@
 #include "net/http/http_vary_data.h"
 
 #include <algorithm>
+#include <cstring>
 
+#include "base/hash/md5.h"
+#include "base/pickle.h"
 #include "net/http/http_request_info.h"
 #include "net/http/http_response_headers.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -73,6 +76,25 @@ TEST(HttpVaryDataTest, MultipleInit) {
   EXPECT_FALSE(v.is_valid());
 }
 
+// The digest is persisted in the disk cache, so it must stay the MD5 of the
+// request header values, each followed by a newline.
+TEST(HttpVaryDataTest, PersistedDigest) {
+  TestTransaction t;
+  t.Init({{"Foo", "1"}, {"bar", "23"}}, "HTTP/1.1 200 OK\nVary: foo, bar\n\n");
+
+  HttpVaryData v;
+  ASSERT_TRUE(v.Init(t.request, *t.response.get()));
+  base::Pickle pickle;
+  v.Persist(&pickle);
+
+  base::MD5Digest expected;
+  base::MD5Sum("1\n23\n", 5, &expected);
+  base::PickleIterator iter(pickle);
+  const char* data;
+  ASSERT_TRUE(iter.ReadBytes(&data, sizeof(expected)));
+  EXPECT_EQ(0, memcmp(data, &expected, sizeof(expected)));
+}
+
 TEST(HttpVaryDataTest, DoesVary) {
   TestTransaction a;
   a.Init({{"Foo", "1"}}, "HTTP/1.1 200 OK\nVary: foo\n\n");
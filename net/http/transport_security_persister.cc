@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "base/base64.h"
 #include "base/bind.h"
@@ -14,8 +15,9 @@
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/json/json_reader.h"
-#include "base/json/json_writer.h"
 #include "base/location.h"
+#include "base/pickle.h"
+#include "base/ranges/algorithm.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/task_runner_util.h"
 #include "base/threading/thread_task_runner_handle.h"
@@ -31,16 +33,8 @@ namespace net {
 
 namespace {
 
-// This function converts the binary hashes to a base64 string which we can
-// include in a JSON file.
-std::string HashedDomainToExternalString(const std::string& hashed) {
-  std::string out;
-  base::Base64Encode(hashed, &out);
-  return out;
-}
-
-// This inverts |HashedDomainToExternalString|, above. It turns an external
-// string (from a JSON file) into an internal (binary) string.
+// Turns an external string (the base64 of a hashed hostname in a JSON file)
+// into an internal (binary) string.
 std::string ExternalStringToHashedDomain(const std::string& external) {
   std::string out;
   if (!base::Base64Decode(external, &out) ||
@@ -54,12 +48,21 @@ std::string ExternalStringToHashedDomain(const std::string& external) {
 // Version 2 of the on-disk format consists of a single JSON object. The
 // top-level dictionary has "version", "sts", and "expect_ct" entries. The first
 // is an integer, the latter two are unordered lists of dictionaries, each
-// representing cached data for a single host.
+// representing cached data for a single host. It is still read, but no longer
+// written.
 
 // Stored in serialized dictionary values to distinguish incompatible versions.
 // Version 1 is distinguished by the lack of an integer version value.
 const char kVersionKey[] = "version";
-const int kCurrentVersionValue = 2;
+const int kJSONVersionValue = 2;
+
+// Version 3 of the on-disk format is a base::Pickle holding the version, then
+// the number of STS entries followed by the entries, then the number of
+// Expect-CT entries followed by the entries. Hashed hostnames are stored as
+// their raw bytes, and times as microseconds since the Windows epoch, so
+// neither loading nor writing goes through JSON or base64. See
+// WriteSTSEntries() and WriteExpectCTEntries() for the layout of an entry.
+const int kCurrentVersionValue = 3;
 
 // Keys in top level serialized dictionary, for lists of STS and Expect-CT
 // entries, respectively.
@@ -67,8 +70,7 @@ const char kSTSKey[] = "sts";
 const char kExpectCTKey[] = "expect_ct";
 
 // Hostname entry, used in serialized STS and Expect-CT dictionaries. Value is
-// produced by passing hashed hostname strings to
-// HashedDomainToExternalString().
+// the base64 of the hashed hostname.
 const char kHostname[] = "host";
 
 // Key values in serialized STS entries.
@@ -101,37 +103,210 @@ bool IsDynamicExpectCTEnabled() {
       TransportSecurityState::kDynamicExpectCTFeature);
 }
 
-// Serializes STS data from |state| to a Value.
-base::Value::List SerializeSTSData(const TransportSecurityState* state) {
-  base::Value::List sts_list;
-
-  TransportSecurityState::STSStateIterator sts_iterator(*state);
-  for (; sts_iterator.HasNext(); sts_iterator.Advance()) {
-    const TransportSecurityState::STSState& sts_state =
-        sts_iterator.domain_state();
-
-    base::Value::Dict serialized;
-    serialized.Set(kHostname,
-                   HashedDomainToExternalString(sts_iterator.hostname()));
-    serialized.Set(kStsIncludeSubdomains, sts_state.include_subdomains);
-    serialized.Set(kStsObserved, sts_state.last_observed.ToDoubleT());
-    serialized.Set(kExpiry, sts_state.expiry.ToDoubleT());
-
-    switch (sts_state.upgrade_mode) {
-      case TransportSecurityState::STSState::MODE_FORCE_HTTPS:
-        serialized.Set(kMode, kForceHTTPS);
-        break;
-      case TransportSecurityState::STSState::MODE_DEFAULT:
-        serialized.Set(kMode, kDefault);
-        break;
+// Adds a deserialized STS entry to |state|, unless it has expired or is
+// invalid.
+void MaybeAddSTSEntry(const std::string& hashed,
+                      const TransportSecurityState::STSState& sts_state,
+                      base::Time current_time,
+                      TransportSecurityState* state) {
+  if (sts_state.expiry < current_time || !sts_state.ShouldUpgradeToSSL())
+    return;
+  if (hashed.size() != crypto::kSHA256Length)
+    return;
+  state->AddOrUpdateEnabledSTSHosts(hashed, sts_state);
+}
+
+// Adds a deserialized Expect-CT entry to |state|, unless it has expired or is
+// invalid.
+void MaybeAddExpectCTEntry(
+    const std::string& hashed,
+    const NetworkIsolationKey& network_isolation_key,
+    const TransportSecurityState::ExpectCTState& expect_ct_state,
+    base::Time current_time,
+    TransportSecurityState* state) {
+  if (expect_ct_state.expiry < current_time ||
+      (!expect_ct_state.enforce && expect_ct_state.report_uri.is_empty())) {
+    return;
+  }
+  if (hashed.size() != crypto::kSHA256Length)
+    return;
+
+  // If Expect-CT is not being partitioned by NetworkIsolationKey, but
+  // |network_isolation_key| is not empty, drop the entry, to avoid ambiguity
+  // and favor entries that were saved with an empty NetworkIsolationKey.
+  if (!base::FeatureList::IsEnabled(
+          features::kPartitionExpectCTStateByNetworkIsolationKey) &&
+      !network_isolation_key.IsEmpty()) {
+    return;
+  }
+
+  state->AddOrUpdateEnabledExpectCTHosts(hashed, network_isolation_key,
+                                         expect_ct_state);
+}
+
+void WriteTime(base::Time time, base::Pickle* pickle) {
+  pickle->WriteInt64(time.ToDeltaSinceWindowsEpoch().InMicroseconds());
+}
+
+bool ReadTime(base::PickleIterator* iter, base::Time* time) {
+  int64_t microseconds;
+  if (!iter->ReadInt64(&microseconds))
+    return false;
+  *time = base::Time::FromDeltaSinceWindowsEpoch(
+      base::Microseconds(microseconds));
+  return true;
+}
+
+bool ReadHashedDomain(base::PickleIterator* iter, std::string* hashed) {
+  const char* bytes;
+  if (!iter->ReadBytes(&bytes, crypto::kSHA256Length))
+    return false;
+  hashed->assign(bytes, crypto::kSHA256Length);
+  return true;
+}
+
+// Writes each STS entry of |state| as its hashed hostname, include subdomains
+// flag, last observed time, expiry and upgrade mode.
+void WriteSTSEntries(const TransportSecurityState* state,
+                     base::Pickle* pickle) {
+  uint32_t count = 0;
+  for (TransportSecurityState::STSStateIterator it(*state); it.HasNext();
+       it.Advance()) {
+    ++count;
+  }
+  pickle->WriteUInt32(count);
+
+  for (TransportSecurityState::STSStateIterator it(*state); it.HasNext();
+       it.Advance()) {
+    const TransportSecurityState::STSState& sts_state = it.domain_state();
+    DCHECK_EQ(crypto::kSHA256Length, it.hostname().size());
+    pickle->WriteBytes(it.hostname().data(), it.hostname().size());
+    pickle->WriteBool(sts_state.include_subdomains);
+    WriteTime(sts_state.last_observed, pickle);
+    WriteTime(sts_state.expiry, pickle);
+    pickle->WriteInt(static_cast<int>(sts_state.upgrade_mode));
+  }
+}
+
+// Reads the entries written by WriteSTSEntries(). Returns false if the data is
+// corrupt.
+bool ReadSTSEntries(base::PickleIterator* iter, TransportSecurityState* state) {
+  const base::Time current_time(base::Time::Now());
+
+  uint32_t count;
+  if (!iter->ReadUInt32(&count))
+    return false;
+  for (uint32_t i = 0; i < count; ++i) {
+    std::string hashed;
+    TransportSecurityState::STSState sts_state;
+    int mode;
+    if (!ReadHashedDomain(iter, &hashed) ||
+        !iter->ReadBool(&sts_state.include_subdomains) ||
+        !ReadTime(iter, &sts_state.last_observed) ||
+        !ReadTime(iter, &sts_state.expiry) || !iter->ReadInt(&mode)) {
+      return false;
+    }
+    if (mode != TransportSecurityState::STSState::MODE_FORCE_HTTPS &&
+        mode != TransportSecurityState::STSState::MODE_DEFAULT) {
+      continue;
     }
+    sts_state.upgrade_mode =
+        static_cast<TransportSecurityState::STSState::UpgradeMode>(mode);
+    MaybeAddSTSEntry(hashed, sts_state, current_time, state);
+  }
+  return true;
+}
 
-    sts_list.Append(std::move(serialized));
+// Writes each Expect-CT entry of |state| that has a persistable
+// NetworkIsolationKey as its hashed hostname, the strings of the
+// NetworkIsolationKey's value, its last observed time, expiry, enforce flag
+// and report URI.
+void WriteExpectCTEntries(TransportSecurityState* state,
+                          base::Pickle* pickle) {
+  if (!IsDynamicExpectCTEnabled()) {
+    pickle->WriteUInt32(0);
+    return;
+  }
+
+  // Don't serialize entries with transient NetworkIsolationKeys.
+  std::vector<base::Value> network_isolation_key_values;
+  for (TransportSecurityState::ExpectCTStateIterator it(*state); it.HasNext();
+       it.Advance()) {
+    base::Value value;
+    if (it.network_isolation_key().ToValue(&value))
+      network_isolation_key_values.push_back(std::move(value));
+    else
+      network_isolation_key_values.emplace_back();
+  }
+  pickle->WriteUInt32(base::ranges::count_if(
+      network_isolation_key_values,
+      [](const base::Value& value) { return value.is_list(); }));
+
+  auto value = network_isolation_key_values.begin();
+  for (TransportSecurityState::ExpectCTStateIterator it(*state); it.HasNext();
+       it.Advance(), ++value) {
+    if (!value->is_list())
+      continue;
+    const TransportSecurityState::ExpectCTState& expect_ct_state =
+        it.domain_state();
+    DCHECK_EQ(crypto::kSHA256Length, it.hostname().size());
+    pickle->WriteBytes(it.hostname().data(), it.hostname().size());
+    pickle->WriteUInt32(value->GetList().size());
+    for (const base::Value& site : value->GetList())
+      pickle->WriteString(site.GetString());
+    WriteTime(expect_ct_state.last_observed, pickle);
+    WriteTime(expect_ct_state.expiry, pickle);
+    pickle->WriteBool(expect_ct_state.enforce);
+    pickle->WriteString(expect_ct_state.report_uri.possibly_invalid_spec());
   }
-  return sts_list;
 }
 
-// Deserializes STS data from a Value created by the above method.
+// Reads the entries written by WriteExpectCTEntries(). Returns false if the
+// data is corrupt.
+bool ReadExpectCTEntries(base::PickleIterator* iter,
+                         TransportSecurityState* state) {
+  const base::Time current_time(base::Time::Now());
+
+  uint32_t count;
+  if (!iter->ReadUInt32(&count))
+    return false;
+  for (uint32_t i = 0; i < count; ++i) {
+    std::string hashed;
+    uint32_t site_count;
+    if (!ReadHashedDomain(iter, &hashed) || !iter->ReadUInt32(&site_count))
+      return false;
+    base::Value::List sites;
+    for (uint32_t j = 0; j < site_count; ++j) {
+      std::string site;
+      if (!iter->ReadString(&site))
+        return false;
+      sites.Append(std::move(site));
+    }
+
+    TransportSecurityState::ExpectCTState expect_ct_state;
+    std::string report_uri;
+    if (!ReadTime(iter, &expect_ct_state.last_observed) ||
+        !ReadTime(iter, &expect_ct_state.expiry) ||
+        !iter->ReadBool(&expect_ct_state.enforce) ||
+        !iter->ReadString(&report_uri)) {
+      return false;
+    }
+    GURL report_url(report_uri);
+    if (report_url.is_valid())
+      expect_ct_state.report_uri = report_url;
+
+    NetworkIsolationKey network_isolation_key;
+    if (!NetworkIsolationKey::FromValue(base::Value(std::move(sites)),
+                                        &network_isolation_key)) {
+      continue;
+    }
+    MaybeAddExpectCTEntry(hashed, network_isolation_key, expect_ct_state,
+                          current_time, state);
+  }
+  return true;
+}
+
+// Deserializes STS data from the "sts" list of a version 2 file.
 void DeserializeSTSData(const base::Value& sts_list,
                         TransportSecurityState* state) {
   if (!sts_list.is_list())
@@ -170,59 +345,16 @@ void DeserializeSTSData(const base::Value& sts_list,
       continue;
     }
 
-    if (sts_state.expiry < current_time || !sts_state.ShouldUpgradeToSSL())
-      continue;
-
-    std::string hashed = ExternalStringToHashedDomain(*hostname);
-    if (hashed.empty())
-      continue;
-
-    state->AddOrUpdateEnabledSTSHosts(hashed, sts_state);
-  }
-}
-
-// Serializes Expect-CT data from |state| to a Value.
-base::Value::List SerializeExpectCTData(TransportSecurityState* state) {
-  base::Value::List ct_list;
-
-  if (!IsDynamicExpectCTEnabled())
-    return ct_list;
-
-  TransportSecurityState::ExpectCTStateIterator expect_ct_iterator(*state);
-  for (; expect_ct_iterator.HasNext(); expect_ct_iterator.Advance()) {
-    const TransportSecurityState::ExpectCTState& expect_ct_state =
-        expect_ct_iterator.domain_state();
-
-    base::Value::Dict ct_entry;
-
-    base::Value network_isolation_key_value;
-    // Don't serialize entries with transient NetworkIsolationKeys.
-    if (!expect_ct_iterator.network_isolation_key().ToValue(
-            &network_isolation_key_value)) {
-      continue;
-    }
-    ct_entry.Set(kNetworkIsolationKey, std::move(network_isolation_key_value));
-
-    ct_entry.Set(kHostname,
-                 HashedDomainToExternalString(expect_ct_iterator.hostname()));
-    ct_entry.Set(kExpectCTObserved, expect_ct_state.last_observed.ToDoubleT());
-    ct_entry.Set(kExpectCTExpiry, expect_ct_state.expiry.ToDoubleT());
-    ct_entry.Set(kExpectCTEnforce, expect_ct_state.enforce);
-    ct_entry.Set(kExpectCTReportUri, expect_ct_state.report_uri.spec());
-
-    ct_list.Append(std::move(ct_entry));
+    MaybeAddSTSEntry(ExternalStringToHashedDomain(*hostname), sts_state,
+                     current_time, state);
   }
-
-  return ct_list;
 }
 
-// Deserializes Expect-CT data from a Value created by the above method.
+// Deserializes Expect-CT data from the "expect_ct" list of a version 2 file.
 void DeserializeExpectCTData(const base::Value& ct_list,
                              TransportSecurityState* state) {
   if (!ct_list.is_list())
     return;
-  bool partition_by_nik = base::FeatureList::IsEnabled(
-      features::kPartitionExpectCTStateByNetworkIsolationKey);
 
   const base::Time current_time(base::Time::Now());
 
@@ -259,29 +391,15 @@ void DeserializeExpectCTData(const base::Value& ct_list,
     if (report_uri.is_valid())
       expect_ct_state.report_uri = report_uri;
 
-    if (expect_ct_state.expiry < current_time ||
-        (!expect_ct_state.enforce && expect_ct_state.report_uri.is_empty())) {
-      continue;
-    }
-
-    std::string hashed = ExternalStringToHashedDomain(*hostname);
-    if (hashed.empty())
-      continue;
-
     NetworkIsolationKey network_isolation_key;
     if (!NetworkIsolationKey::FromValue(*network_isolation_key_value,
                                         &network_isolation_key)) {
       continue;
     }
 
-    // If Expect-CT is not being partitioned by NetworkIsolationKey, but
-    // |network_isolation_key| is not empty, drop the entry, to avoid ambiguity
-    // and favor entries that were saved with an empty NetworkIsolationKey.
-    if (!partition_by_nik && !network_isolation_key.IsEmpty())
-      continue;
-
-    state->AddOrUpdateEnabledExpectCTHosts(hashed, network_isolation_key,
-                                           expect_ct_state);
+    MaybeAddExpectCTEntry(ExternalStringToHashedDomain(*hostname),
+                          network_isolation_key, expect_ct_state, current_time,
+                          state);
   }
 }
 
@@ -350,12 +468,12 @@ void TransportSecurityPersister::OnWriteFinished(base::OnceClosure callback) {
 bool TransportSecurityPersister::SerializeData(std::string* output) {
   DCHECK(foreground_runner_->RunsTasksInCurrentSequence());
 
-  base::Value::Dict toplevel;
-  toplevel.Set(kVersionKey, kCurrentVersionValue);
-  toplevel.Set(kSTSKey, SerializeSTSData(transport_security_state_));
-  toplevel.Set(kExpectCTKey, SerializeExpectCTData(transport_security_state_));
+  base::Pickle pickle;
+  pickle.WriteInt(kCurrentVersionValue);
+  WriteSTSEntries(transport_security_state_, &pickle);
+  WriteExpectCTEntries(transport_security_state_, &pickle);
 
-  base::JSONWriter::Write(toplevel, output);
+  output->assign(static_cast<const char*>(pickle.data()), pickle.size());
   return true;
 }
 
@@ -368,6 +486,24 @@ void TransportSecurityPersister::LoadEntries(const std::string& serialized) {
 
 void TransportSecurityPersister::Deserialize(const std::string& serialized,
                                              TransportSecurityState* state) {
+  // Files written before version 3 are JSON objects.
+  if (!serialized.empty() && serialized[0] == '{') {
+    DeserializeJSON(serialized, state);
+    return;
+  }
+
+  base::Pickle pickle(serialized.data(), serialized.size());
+  base::PickleIterator iter(pickle);
+  int version;
+  if (!iter.ReadInt(&version) || version != kCurrentVersionValue)
+    return;
+  if (ReadSTSEntries(&iter, state))
+    ReadExpectCTEntries(&iter, state);
+}
+
+void TransportSecurityPersister::DeserializeJSON(
+    const std::string& serialized,
+    TransportSecurityState* state) {
   absl::optional<base::Value> value = base::JSONReader::Read(serialized);
   if (!value || !value->is_dict())
     return;
@@ -377,7 +513,7 @@ void TransportSecurityPersister::Deserialize(const std::string& serialized,
 
   // Stop if the data is out of date (or in the previous format that didn't have
   // a version number).
-  if (!version || *version != kCurrentVersionValue)
+  if (!version || *version != kJSONVersionValue)
     return;
 
   base::Value* sts_value = dict.Find(kSTSKey);
@@ -84,32 +84,20 @@ class NET_EXPORT TransportSecurityPersister
   // Serializes |transport_security_state_| into |*output|. Returns true if
   // all STS and Expect_CT states were serialized correctly.
   //
-  // The serialization format is JSON; the JSON represents a dictionary of
-  // host:DomainState pairs (host is a string). The DomainState contains
-  // the STS and Expect-CT states and is represented as a dictionary containing
-  // the following keys and value types (not all keys will always be
-  // present):
+  // The serialization format is a base::Pickle, so that neither writing nor
+  // loading the state goes through base::Value. It holds a version, then the
+  // STS entries and the Expect-CT entries, each preceded by its count. An
+  // entry holds the fields of its TransportSecurityState::STSState or
+  // ExpectCTState, with times as microseconds since the Windows epoch, and,
+  // for Expect-CT, the strings of its NetworkIsolationKey's value.
   //
-  //     "sts_include_subdomains": true|false
-  //     "created": double
-  //     "expiry": double
-  //     "mode": "default"|"force-https"
-  //             legacy value synonyms "strict" = "force-https"
-  //                                   "pinning-only" = "default"
-  //             legacy value "spdy-only" is unused and ignored
-  //     "report-uri": string
-  //     "sts_observed": double
-  //     "expect_ct": dictionary with keys:
-  //         "expect_ct_expiry": double
-  //         "expect_ct_observed": double
-  //         "expect_ct_enforce": true|false
-  //         "expect_ct_report_uri": string
+  // Entries are keyed by SHA256(TransportSecurityState::CanonicalizeHost(
+  // domain)), stored as raw bytes. The reason for hashing them is so that the
+  // stored state does not trivially reveal a user's browsing history to an
+  // attacker reading the serialized state on disk.
   //
-  // The JSON dictionary keys are strings containing
-  // Base64(SHA256(TransportSecurityState::CanonicalizeHost(domain))).
-  // The reason for hashing them is so that the stored state does not
-  // trivially reveal a user's browsing history to an attacker reading the
-  // serialized state on disk.
+  // State written by earlier versions, as a JSON dictionary with base64
+  // hashed hostnames, is still loaded.
   bool SerializeData(std::string* data) override;
 
   // Clears any existing non-static entries, and then re-populates
@@ -117,9 +105,13 @@ class NET_EXPORT TransportSecurityPersister
   void LoadEntries(const std::string& serialized);
 
  private:
-  // Populates |state| from the JSON string |serialized|.
+  // Populates |state| from |serialized|.
   static void Deserialize(const std::string& serialized,
                           TransportSecurityState* state);
+  // Populates |state| from the JSON string |serialized|, in the format written
+  // before version 3.
+  static void DeserializeJSON(const std::string& serialized,
+                              TransportSecurityState* state);
 
   void CompleteLoad(const std::string& state);
   void OnWriteFinished(base::OnceClosure callback);
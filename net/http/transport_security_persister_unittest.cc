@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/base64.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
@@ -19,6 +20,8 @@
 #include "base/task/thread_pool.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/values.h"
+#include "crypto/sha2.h"
 #include "net/base/features.h"
 #include "net/base/network_isolation_key.h"
 #include "net/base/schemeful_site.h"
@@ -224,6 +227,44 @@ TEST_P(TransportSecurityPersisterTest, SerializeData3) {
   EXPECT_EQ(count, expect_ct_saved.size());
 }
 
+// Tests that state written in the JSON format of version 2 is still loaded.
+TEST_P(TransportSecurityPersisterTest, DeserializeJSONVersion2) {
+  const base::Time expiry = base::Time::Now() + base::Seconds(1000);
+  // The hash of "www.example.test" in DNS wire format.
+  std::string encoded_host;
+  base::Base64Encode(crypto::SHA256HashString(
+                         std::string("\x03www\x07example\x04test", 18)),
+                     &encoded_host);
+
+  base::Value::Dict sts_entry;
+  sts_entry.Set("host", encoded_host);
+  sts_entry.Set("sts_include_subdomains", true);
+  sts_entry.Set("sts_observed", base::Time::Now().ToDoubleT());
+  sts_entry.Set("expiry", expiry.ToDoubleT());
+  sts_entry.Set("mode", "force-https");
+  base::Value::List sts_list;
+  sts_list.Append(std::move(sts_entry));
+  base::Value::Dict toplevel;
+  toplevel.Set("version", 2);
+  toplevel.Set("sts", std::move(sts_list));
+  std::string serialized;
+  ASSERT_TRUE(base::JSONWriter::Write(toplevel, &serialized));
+
+  persister_->LoadEntries(serialized);
+  TransportSecurityState::STSState sts_state;
+  EXPECT_TRUE(state_->GetDynamicSTSState("www.example.test", &sts_state));
+  EXPECT_TRUE(sts_state.include_subdomains);
+  EXPECT_EQ(TransportSecurityState::STSState::MODE_FORCE_HTTPS,
+            sts_state.upgrade_mode);
+
+  // It is written back in the current format, and loads the same.
+  EXPECT_TRUE(persister_->SerializeData(&serialized));
+  EXPECT_NE('{', serialized[0]);
+  persister_->LoadEntries(serialized);
+  EXPECT_EQ(1u, state_->num_sts_entries());
+  EXPECT_TRUE(state_->GetDynamicSTSState("www.example.test", &sts_state));
+}
+
 // Tests that deserializing bad data shouldn't result in any ExpectCT or STS
 // entries being added to the transport security state.
 TEST_P(TransportSecurityPersisterTest, DeserializeBadData) {
@@ -541,14 +582,14 @@ TEST_P(TransportSecurityPersisterTest,
   EXPECT_TRUE(state2.GetDynamicExpectCTState(kTestDomain, network_isolation_key,
                                              &expect_ct_state));
 
-  // Replace reference to |network_isolation_key|'s value with an invalid NIK
-  // value.
-  base::Value nik_value;
-  ASSERT_TRUE(network_isolation_key.ToValue(&nik_value));
-  std::string nik_string;
-  ASSERT_TRUE(base::JSONWriter::Write(nik_value, &nik_string));
-  base::ReplaceFirstSubstringAfterOffset(&serialized, 0, nik_string,
-                                         "\"Not a valid NIK\"");
+  // Replace the top frame site of |network_isolation_key|'s value with an
+  // invalid site of the same length, so that the rest of the data still
+  // parses.
+  const std::string site = kSite.Serialize();
+  const std::string invalid_site =
+      std::string("Not a valid NIK") + std::string(site.size() - 15, '.');
+  ASSERT_EQ(site.size(), invalid_site.size());
+  base::ReplaceFirstSubstringAfterOffset(&serialized, 0, site, invalid_site);
 
   // Load entries into the other persister.
   persister_->LoadEntries(serialized);
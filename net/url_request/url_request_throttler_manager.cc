@@ -5,6 +5,7 @@
 #include "net/url_request/url_request_throttler_manager.h"
 
 #include "base/check_op.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "net/base/url_util.h"
 #include "net/log/net_log.h"
@@ -131,6 +132,17 @@ std::string URLRequestThrottlerManager::GetIdFromUrl(const GURL& url) const {
   if (!url.is_valid())
     return url.possibly_invalid_spec();
 
+  // The path of a canonical spec ends where its query or ref starts, so
+  // unless there are credentials to drop, the ID is a prefix of the spec and
+  // the URL need not be canonicalized again without those components.
+  if (!url.has_username() && !url.has_password()) {
+    size_t id_length = url.parsed_for_possibly_invalid_spec()
+                           .CountCharactersBefore(url::Parsed::QUERY,
+                                                  /*include_delimiter=*/true);
+    return base::ToLowerASCII(
+        base::StringPiece(url.spec()).substr(0, id_length));
+  }
+
   GURL id = url.ReplaceComponents(url_id_replacements_);
   return base::ToLowerASCII(id.spec());
 }
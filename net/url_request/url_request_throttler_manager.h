@@ -5,9 +5,9 @@
 #ifndef NET_URL_REQUEST_URL_REQUEST_THROTTLER_MANAGER_H_
 #define NET_URL_REQUEST_URL_REQUEST_THROTTLER_MANAGER_H_
 
-#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 #include "base/memory/ref_counted.h"
 #include "base/threading/platform_thread.h"
@@ -107,7 +107,8 @@ class NET_EXPORT_PRIVATE URLRequestThrottlerManager
  private:
   // From each URL we generate an ID composed of the scheme, host, port and path
   // that allows us to uniquely map an entry to it.
-  typedef std::map<std::string, scoped_refptr<URLRequestThrottlerEntry> >
+  typedef std::unordered_map<std::string,
+                             scoped_refptr<URLRequestThrottlerEntry>>
       UrlEntryMap;
 
   // Maximum number of entries that we are willing to collect in our map.
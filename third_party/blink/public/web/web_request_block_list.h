@@ -0,0 +1,24 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_PUBLIC_WEB_WEB_REQUEST_BLOCK_LIST_H_
+#define THIRD_PARTY_BLINK_PUBLIC_WEB_WEB_REQUEST_BLOCK_LIST_H_
+
+#include "base/files/file.h"
+#include "base/files/memory_mapped_file.h"
+#include "third_party/blink/public/platform/web_common.h"
+
+namespace blink {
+
+// Replaces the built-in request block list with the compiled list in |region|
+// of |file|, which the browser shares with every renderer. The list is mapped
+// read-only and used in place. Must be called at most once, before the first
+// request is made. A list that cannot be mapped or is malformed is ignored.
+BLINK_EXPORT void SetRequestBlockListFile(
+    base::File file,
+    const base::MemoryMappedFile::Region& region);
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_PUBLIC_WEB_WEB_REQUEST_BLOCK_LIST_H_
@@ -5,6 +5,8 @@
 #include "third_party/blink/renderer/core/css/active_style_sheets.h"
 
 #include "third_party/blink/renderer/core/css/css_style_sheet.h"
+#include "third_party/blink/renderer/core/css/media_list.h"
+#include "third_party/blink/renderer/core/css/media_query_evaluator.h"
 #include "third_party/blink/renderer/core/css/resolver/scoped_style_resolver.h"
 #include "third_party/blink/renderer/core/css/rule_set.h"
 #include "third_party/blink/renderer/core/css/style_change_reason.h"
@@ -184,4 +186,20 @@ bool AffectedByMediaValueChange(const ActiveStyleSheetVector& active_sheets,
   return HasMediaQueries(active_sheets);
 }
 
+bool MediaQueryResultsChanged(const ActiveStyleSheetVector& active_sheets,
+                              const MediaQueryEvaluator& evaluator) {
+  for (const auto& active_sheet : active_sheets) {
+    if (const MediaQuerySet* media_queries =
+            active_sheet.first->MediaQueries()) {
+      if (evaluator.Eval(*media_queries) != !!active_sheet.second)
+        return true;
+    }
+    if (active_sheet.second &&
+        active_sheet.second->DidMediaQueryResultsChange(evaluator)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace blink
@@ -14,6 +14,7 @@
 namespace blink {
 
 class CSSStyleSheet;
+class MediaQueryEvaluator;
 class RuleSet;
 
 using ActiveStyleSheet = std::pair<Member<CSSStyleSheet>, Member<RuleSet>>;
@@ -33,6 +34,14 @@ CompareActiveStyleSheets(const ActiveStyleSheetVector& old_style_sheets,
 bool AffectedByMediaValueChange(const ActiveStyleSheetVector& active_sheets,
                                 MediaValueChange change);
 
+// Returns true if |evaluator| now gives a different result for the media
+// attribute of a sheet in |active_sheets|, or for a media query of the RuleSet
+// it was collected with. Sheets without a RuleSet are those whose media did not
+// match when they were collected.
+CORE_EXPORT bool MediaQueryResultsChanged(
+    const ActiveStyleSheetVector& active_sheets,
+    const MediaQueryEvaluator& evaluator);
+
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_CORE_CSS_ACTIVE_STYLE_SHEETS_H_
@@ -38,6 +38,7 @@
 #include "third_party/blink/renderer/core/frame/settings.h"
 #include "third_party/blink/renderer/core/html/html_anchor_element.h"
 #include "third_party/blink/renderer/core/html/html_html_element.h"
+#include "third_party/blink/renderer/core/layout/element_hider.h"
 #include "third_party/blink/renderer/core/layout/layout_theme.h"
 #include "third_party/blink/renderer/core/mathml_names.h"
 #include "third_party/blink/renderer/platform/data_resource_helper.h"
@@ -167,6 +168,8 @@ void CSSDefaultStyleSheets::PrepareForLeakDetection() {
   // Initialize the styles that have the lazily loaded style sheets.
   InitializeDefaultStyles();
   default_view_source_style_.Clear();
+  element_hiding_styles_.clear();
+  ++element_hiding_styles_version_;
 }
 
 void CSSDefaultStyleSheets::InitializeDefaultStyles() {
@@ -197,6 +200,23 @@ RuleSet* CSSDefaultStyleSheets::DefaultViewSourceStyle() {
   return default_view_source_style_;
 }
 
+const HeapVector<Member<RuleSet>>&
+CSSDefaultStyleSheets::ElementHidingStyles() {
+  const ElementHider& hider = ElementHider::Default();
+  if (element_hiding_styles_.IsEmpty() && hider.SectionCount()) {
+    element_hiding_styles_.resize(hider.SectionCount());
+    for (wtf_size_t section = 0; section < hider.SectionCount(); ++section) {
+      const String& text = hider.StyleSheetText(section);
+      if (text.IsEmpty())
+        continue;
+      element_hiding_styles_[section] = MakeGarbageCollected<RuleSet>();
+      element_hiding_styles_[section]->AddRulesFromSheet(ParseUASheet(text),
+                                                         ScreenEval());
+    }
+  }
+  return element_hiding_styles_;
+}
+
 StyleSheetContents*
 CSSDefaultStyleSheets::EnsureXHTMLMobileProfileStyleSheet() {
   if (!xhtml_mobile_profile_style_sheet_) {
@@ -446,6 +466,7 @@ void CSSDefaultStyleSheets::Trace(Visitor* visitor) const {
   visitor->Trace(default_view_source_style_);
   visitor->Trace(default_forced_color_style_);
   visitor->Trace(default_media_controls_style_);
+  visitor->Trace(element_hiding_styles_);
   visitor->Trace(default_style_sheet_);
   visitor->Trace(default_pseudo_element_style_);
   visitor->Trace(mobile_viewport_style_sheet_);
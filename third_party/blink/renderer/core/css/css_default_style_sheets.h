@@ -26,6 +26,7 @@
 
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/style/computed_style_constants.h"
+#include "third_party/blink/renderer/platform/heap/collection_support/heap_vector.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 #include "third_party/blink/renderer/platform/heap/member.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
@@ -77,6 +78,17 @@ class CSSDefaultStyleSheets final
     return default_media_controls_style_.Get();
   }
 
+  // The display:none rules of each ElementHider::Default() section, indexed
+  // by section and null for a section without a style sheet. Parsed on first
+  // use and shared by every document; StyleEngine picks the sections that
+  // apply to its document.
+  const HeapVector<Member<RuleSet>>& ElementHidingStyles();
+  // Bumped whenever the ElementHidingStyles() rule sets are discarded, so that
+  // a StyleEngine holding on to them knows to pick them up again.
+  unsigned ElementHidingStylesVersion() const {
+    return element_hiding_styles_version_;
+  }
+
   StyleSheetContents* EnsureMobileViewportStyleSheet();
   StyleSheetContents* EnsureTelevisionViewportStyleSheet();
   StyleSheetContents* EnsureXHTMLMobileProfileStyleSheet();
@@ -143,6 +155,8 @@ class CSSDefaultStyleSheets final
   Member<RuleSet> default_forced_color_style_;
   Member<RuleSet> default_pseudo_element_style_;
   Member<RuleSet> default_media_controls_style_;
+  HeapVector<Member<RuleSet>> element_hiding_styles_;
+  unsigned element_hiding_styles_version_ = 0;
 
   Member<StyleSheetContents> default_style_sheet_;
   Member<StyleSheetContents> mobile_viewport_style_sheet_;
@@ -61,6 +61,22 @@ CSSNumericLiteralValue* CSSNumericLiteralValue::Create(double value,
             MakeGarbageCollected<CSSNumericLiteralValue>(value, type));
       }
       return result;
+    case CSSPrimitiveValue::UnitType::kEms:
+      result = pool.EmCacheValue(int_value);
+      if (!result) {
+        result = pool.SetEmCacheValue(
+            int_value,
+            MakeGarbageCollected<CSSNumericLiteralValue>(value, type));
+      }
+      return result;
+    case CSSPrimitiveValue::UnitType::kRems:
+      result = pool.RemCacheValue(int_value);
+      if (!result) {
+        result = pool.SetRemCacheValue(
+            int_value,
+            MakeGarbageCollected<CSSNumericLiteralValue>(value, type));
+      }
+      return result;
     case CSSPrimitiveValue::UnitType::kNumber:
     case CSSPrimitiveValue::UnitType::kInteger:
       result = pool.NumberCacheValue(int_value);
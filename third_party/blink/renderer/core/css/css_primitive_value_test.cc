@@ -221,6 +221,20 @@ TEST_F(CSSPrimitiveValueTest, TestCanonicalizingNumberUnitCategory) {
   EXPECT_EQ(canonicalized_from_int, UnitType::kNumber);
 }
 
+TEST_F(CSSPrimitiveValueTest, PooledIntegerValues) {
+  for (UnitType type : {UnitType::kPixels, UnitType::kPercentage,
+                        UnitType::kEms, UnitType::kRems}) {
+    const CSSNumericLiteralValue* value =
+        CSSNumericLiteralValue::Create(1, type);
+    EXPECT_EQ(value, CSSNumericLiteralValue::Create(1, type));
+    EXPECT_EQ(type, value->GetType());
+    EXPECT_NE(CSSNumericLiteralValue::Create(1.5, type),
+              CSSNumericLiteralValue::Create(1.5, type));
+  }
+  EXPECT_NE(CSSNumericLiteralValue::Create(1, UnitType::kEms),
+            CSSNumericLiteralValue::Create(1, UnitType::kRems));
+}
+
 TEST_F(CSSPrimitiveValueTest, HasContainerRelativeUnits) {
   ScopedCSSContainerQueriesForTest scoped_feature(true);
 
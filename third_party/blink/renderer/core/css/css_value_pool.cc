@@ -59,6 +59,8 @@ CSSValuePool::CSSValuePool()
   identifier_value_cache_.resize(numCSSValueKeywords);
   pixel_value_cache_.resize(kMaximumCacheableIntegerValue + 1);
   percent_value_cache_.resize(kMaximumCacheableIntegerValue + 1);
+  em_value_cache_.resize(kMaximumCacheableIntegerValue + 1);
+  rem_value_cache_.resize(kMaximumCacheableIntegerValue + 1);
   number_value_cache_.resize(kMaximumCacheableIntegerValue + 1);
 }
 
@@ -77,6 +79,8 @@ void CSSValuePool::Trace(Visitor* visitor) const {
   visitor->Trace(identifier_value_cache_);
   visitor->Trace(pixel_value_cache_);
   visitor->Trace(percent_value_cache_);
+  visitor->Trace(em_value_cache_);
+  visitor->Trace(rem_value_cache_);
   visitor->Trace(number_value_cache_);
   visitor->Trace(color_value_cache_);
   visitor->Trace(font_face_value_cache_);
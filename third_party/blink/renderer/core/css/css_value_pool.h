@@ -112,6 +112,20 @@ class CORE_EXPORT CSSValuePool final : public GarbageCollected<CSSValuePool> {
       CSSNumericLiteralValue* css_value) {
     return percent_value_cache_[int_value] = css_value;
   }
+  CSSNumericLiteralValue* EmCacheValue(int int_value) {
+    return em_value_cache_[int_value];
+  }
+  CSSNumericLiteralValue* SetEmCacheValue(int int_value,
+                                          CSSNumericLiteralValue* css_value) {
+    return em_value_cache_[int_value] = css_value;
+  }
+  CSSNumericLiteralValue* RemCacheValue(int int_value) {
+    return rem_value_cache_[int_value];
+  }
+  CSSNumericLiteralValue* SetRemCacheValue(int int_value,
+                                           CSSNumericLiteralValue* css_value) {
+    return rem_value_cache_[int_value] = css_value;
+  }
   CSSNumericLiteralValue* NumberCacheValue(int int_value) {
     return number_value_cache_[int_value];
   }
@@ -163,6 +177,10 @@ class CORE_EXPORT CSSValuePool final : public GarbageCollected<CSSValuePool> {
       pixel_value_cache_;
   HeapVector<Member<CSSNumericLiteralValue>, kMaximumCacheableIntegerValue + 1>
       percent_value_cache_;
+  HeapVector<Member<CSSNumericLiteralValue>, kMaximumCacheableIntegerValue + 1>
+      em_value_cache_;
+  HeapVector<Member<CSSNumericLiteralValue>, kMaximumCacheableIntegerValue + 1>
+      rem_value_cache_;
   HeapVector<Member<CSSNumericLiteralValue>, kMaximumCacheableIntegerValue + 1>
       number_value_cache_;
 
@@ -49,6 +49,7 @@
 #include "third_party/blink/renderer/core/css/resolver/style_resolver.h"
 #include "third_party/blink/renderer/core/css/resolver/style_resolver_stats.h"
 #include "third_party/blink/renderer/core/css/resolver/style_rule_usage_tracker.h"
+#include "third_party/blink/renderer/core/css/selector_match_metrics.h"
 #include "third_party/blink/renderer/core/css/selector_statistics.h"
 #include "third_party/blink/renderer/core/css/style_engine.h"
 #include "third_party/blink/renderer/core/dom/layout_tree_builder_traversal.h"
@@ -354,6 +355,10 @@ void ElementRuleCollector::CollectMatchingRulesForListInternal(
       rule_set->ContainerQueryIntervals());
   Seeker<StyleScope> scope_seeker(rule_set->ScopeIntervals());
 
+  SelectorMatchMetrics* match_metrics =
+      context_.GetElement().GetDocument().GetSelectorMatchMetrics();
+  SelectorMatchMetrics::ScopedRuleListTimer match_timer(match_metrics);
+
   unsigned rejected = 0;
   unsigned fast_rejected = 0;
   unsigned matched = 0;
@@ -445,6 +450,11 @@ void ElementRuleCollector::CollectMatchingRulesForListInternal(
     AggregateRulePerfData(selector_statistics_collector.PerRuleStatistics());
   }
 
+  if (match_metrics) {
+    match_metrics->RecordRuleList(rejected + fast_rejected + matched,
+                                  fast_rejected, matched);
+  }
+
   StyleEngine& style_engine =
       context_.GetElement().GetDocument().GetStyleEngine();
   if (!style_engine.Stats())
@@ -164,7 +164,7 @@ bool CachedMatchedProperties::operator!=(
   return !(*this == properties);
 }
 
-void MatchedPropertiesCache::Add(const Key& key,
+bool MatchedPropertiesCache::Add(const Key& key,
                                  const ComputedStyle& style,
                                  const ComputedStyle& parent_style) {
   DCHECK(key.IsValid());
@@ -172,12 +172,16 @@ void MatchedPropertiesCache::Add(const Key& key,
   Member<CachedMatchedProperties>& cache_item =
       cache_.insert(key.hash_, nullptr).stored_value->value;
 
-  if (!cache_item)
+  bool replaced = false;
+  if (!cache_item) {
     cache_item = MakeGarbageCollected<CachedMatchedProperties>();
-  else
+  } else {
+    replaced = !!cache_item->computed_style;
     cache_item->Clear();
+  }
 
   cache_item->Set(style, parent_style, key.result_.GetMatchedProperties());
+  return replaced;
 }
 
 void MatchedPropertiesCache::Clear() {
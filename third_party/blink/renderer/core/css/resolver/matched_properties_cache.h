@@ -97,7 +97,10 @@ class CORE_EXPORT MatchedPropertiesCache {
   };
 
   const CachedMatchedProperties* Find(const Key&, const StyleResolverState&);
-  void Add(const Key&, const ComputedStyle&, const ComputedStyle& parent_style);
+  // Returns true if an existing entry with the same hash was replaced. Each
+  // hash has one entry, so elements whose matches collide, or differ only in
+  // their dependencies, take turns with it.
+  bool Add(const Key&, const ComputedStyle&, const ComputedStyle& parent_style);
 
   void Clear();
   void ClearViewportDependent();
@@ -57,10 +57,10 @@ class MatchedPropertiesCacheTestCache {
     cache_.Clear();
   }
 
-  void Add(const TestKey& key,
+  bool Add(const TestKey& key,
            const ComputedStyle& style,
            const ComputedStyle& parent_style) {
-    cache_.Add(key.InnerKey(), style, parent_style);
+    return cache_.Add(key.InnerKey(), style, parent_style);
   }
 
   const CachedMatchedProperties* Find(const TestKey& key,
@@ -143,6 +143,22 @@ TEST_F(MatchedPropertiesCacheTest, HitOnlyForAddedEntry) {
   EXPECT_FALSE(cache.Find(key2, *style, *parent));
 }
 
+TEST_F(MatchedPropertiesCacheTest, AddReportsReplacedEntry) {
+  TestCache cache(GetDocument());
+
+  auto style = CreateStyle();
+  auto parent = CreateStyle();
+  auto ensured_parent = CreateStyle();
+  ensured_parent->SetIsEnsuredInDisplayNone();
+
+  TestKey key1("color:red", 1, GetDocument());
+  TestKey key2("display:block", 2, GetDocument());
+
+  EXPECT_FALSE(cache.Add(key1, *style, *parent));
+  EXPECT_FALSE(cache.Add(key2, *style, *parent));
+  EXPECT_TRUE(cache.Add(key1, *style, *ensured_parent));
+}
+
 TEST_F(MatchedPropertiesCacheTest, EnsuredInDisplayNone) {
   TestCache cache(GetDocument());
 
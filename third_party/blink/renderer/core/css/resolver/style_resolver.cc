@@ -695,6 +695,10 @@ void StyleResolver::ForEachUARulesForElement(const Element& element,
     func(default_style_sheets.DefaultPrintStyle());
   }
 
+  // Cosmetic filtering rules, which hide ads and page annoyances.
+  for (RuleSet* rule_set : GetDocument().GetStyleEngine().ElementHidingStyle())
+    func(rule_set);
+
   // In quirks mode, we match rules from the quirks user agent sheet.
   if (GetDocument().InQuirksMode())
     func(default_style_sheets.DefaultHtmlQuirksStyle());
@@ -1811,6 +1815,11 @@ StyleResolver::CacheSuccess StyleResolver::ApplyMatchedCache(
   const CachedMatchedProperties* cached_matched_properties =
       key.IsValid() ? matched_properties_cache_.Find(key, state) : nullptr;
 
+  if (key.IsValid() && !cached_matched_properties) {
+    INCREMENT_STYLE_STATS_COUNTER(GetDocument().GetStyleEngine(),
+                                  matched_property_cache_miss, 1);
+  }
+
   AtomicString pseudo_argument = state.Style()->PseudoArgument();
   if (cached_matched_properties && MatchedPropertiesCache::IsCacheable(state)) {
     INCREMENT_STYLE_STATS_COUNTER(GetDocument().GetStyleEngine(),
@@ -1883,8 +1892,11 @@ void StyleResolver::MaybeAddToMatchedPropertiesCache(
       MatchedPropertiesCache::IsCacheable(state)) {
     INCREMENT_STYLE_STATS_COUNTER(GetDocument().GetStyleEngine(),
                                   matched_property_cache_added, 1);
-    matched_properties_cache_.Add(cache_success.key, *state.Style(),
-                                  *state.ParentStyle());
+    if (matched_properties_cache_.Add(cache_success.key, *state.Style(),
+                                      *state.ParentStyle())) {
+      INCREMENT_STYLE_STATS_COUNTER(GetDocument().GetStyleEngine(),
+                                    matched_property_cache_replaced, 1);
+    }
   }
 }
 
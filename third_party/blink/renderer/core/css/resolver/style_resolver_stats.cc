@@ -39,6 +39,8 @@ void StyleResolverStats::Reset() {
   matched_property_cache_hit = 0;
   matched_property_cache_inherited_hit = 0;
   matched_property_cache_added = 0;
+  matched_property_cache_miss = 0;
+  matched_property_cache_replaced = 0;
   rules_fast_rejected = 0;
   rules_rejected = 0;
   rules_matched = 0;
@@ -50,6 +52,9 @@ void StyleResolverStats::Reset() {
   base_styles_used = 0;
   independent_inherited_styles_propagated = 0;
   custom_properties_applied = 0;
+  rule_sets_built = 0;
+  rule_sets_reused = 0;
+  class_changes_skipped = 0;
 }
 
 std::unique_ptr<TracedValue> StyleResolverStats::ToTracedValue() const {
@@ -61,6 +66,10 @@ std::unique_ptr<TracedValue> StyleResolverStats::ToTracedValue() const {
                            matched_property_cache_inherited_hit);
   traced_value->SetInteger("matchedPropertyCacheAdded",
                            matched_property_cache_added);
+  traced_value->SetInteger("matchedPropertyCacheMiss",
+                           matched_property_cache_miss);
+  traced_value->SetInteger("matchedPropertyCacheReplaced",
+                           matched_property_cache_replaced);
   traced_value->SetInteger("rulesRejected", rules_rejected);
   traced_value->SetInteger("rulesFastRejected", rules_fast_rejected);
   traced_value->SetInteger("rulesMatched", rules_matched);
@@ -74,6 +83,9 @@ std::unique_ptr<TracedValue> StyleResolverStats::ToTracedValue() const {
                            independent_inherited_styles_propagated);
   traced_value->SetInteger("customPropertiesApplied",
                            custom_properties_applied);
+  traced_value->SetInteger("ruleSetsBuilt", rule_sets_built);
+  traced_value->SetInteger("ruleSetsReused", rule_sets_reused);
+  traced_value->SetInteger("classChangesSkipped", class_changes_skipped);
   return traced_value;
 }
 
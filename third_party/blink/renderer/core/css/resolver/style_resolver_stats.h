@@ -52,6 +52,10 @@ class StyleResolverStats {
   unsigned matched_property_cache_hit;
   unsigned matched_property_cache_inherited_hit;
   unsigned matched_property_cache_added;
+  // Lookups with a cacheable key that found no usable entry, and entries that
+  // were replaced because another entry was added under the same hash.
+  unsigned matched_property_cache_miss;
+  unsigned matched_property_cache_replaced;
   unsigned rules_fast_rejected;
   unsigned rules_rejected;
   unsigned rules_matched;
@@ -63,6 +67,14 @@ class StyleResolverStats {
   unsigned base_styles_used;
   unsigned independent_inherited_styles_propagated;
   unsigned custom_properties_applied;
+  // RuleSets built for a sheet, and RuleSets of a StyleSheetContents shared
+  // through a cache used again, by StyleEngine::RuleSetForSheet().
+  unsigned rule_sets_built;
+  unsigned rule_sets_reused;
+
+  // Class attribute changes that left the class list as it was, and so
+  // needed no invalidation, in StyleEngine::ClassChangedForElement().
+  unsigned class_changes_skipped;
 };
 
 #define INCREMENT_STYLE_STATS_COUNTER(styleEngine, counter, n) \
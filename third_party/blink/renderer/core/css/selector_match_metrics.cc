@@ -0,0 +1,46 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/selector_match_metrics.h"
+
+#include "base/rand_util.h"
+#include "services/metrics/public/cpp/metrics_utils.h"
+#include "services/metrics/public/cpp/ukm_entry_builder.h"
+#include "services/metrics/public/cpp/ukm_recorder.h"
+
+namespace blink {
+
+// static
+bool SelectorMatchMetrics::ShouldSampleDocument() {
+  return base::RandInt(0, kDocumentSampleRate - 1) == 0;
+}
+
+SelectorMatchMetrics::SelectorMatchMetrics() = default;
+
+SelectorMatchMetrics::~SelectorMatchMetrics() = default;
+
+void SelectorMatchMetrics::PublishAllMetrics(ukm::UkmRecorder* ukm_recorder,
+                                             ukm::SourceId source_id) {
+  if (!publish_once_.ShouldPublish(ukm_recorder, source_id) ||
+      !RuleListCount()) {
+    return;
+  }
+
+  ukm::UkmEntryBuilder builder(source_id, "Kiwi.SelectorMatching");
+  builder.SetMetric("RuleLists", ukm::GetExponentialBucketMinForCounts1000(
+                                     RuleListCount()));
+  builder.SetMetric("MatchAttempts",
+                    ukm::GetExponentialBucketMinForCounts1000(attempt_count_));
+  builder.SetMetric(
+      "FastRejects",
+      ukm::GetExponentialBucketMinForCounts1000(fast_reject_count_));
+  builder.SetMetric("Matches",
+                    ukm::GetExponentialBucketMinForCounts1000(match_count_));
+  builder.SetMetric("MatchTime",
+                    ukm::GetExponentialBucketMinForUserTiming(
+                        EstimatedMatchTime().InMicroseconds()));
+  builder.Record(ukm_recorder);
+}
+
+}  // namespace blink
@@ -0,0 +1,94 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_CSS_SELECTOR_MATCH_METRICS_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_CSS_SELECTOR_MATCH_METRICS_H_
+
+#include <stdint.h>
+
+#include "base/time/time.h"
+#include "services/metrics/public/cpp/ukm_source_id.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/frame/sampled_ukm_metrics.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace ukm {
+class UkmRecorder;
+}  // namespace ukm
+
+namespace blink {
+
+// Counts, for a sample of documents, the selectors matched by
+// ElementRuleCollector: how many were tried, how many SelectorFilter rejected
+// up front and how many matched. It also times a sample of the rule lists.
+// The totals are recorded as one "Kiwi.SelectorMatching" UKM event when the
+// document shuts down, to find the sites whose selectors make style recalc
+// slow. Unlike SelectorStatisticsCollector, nothing about individual
+// selectors is kept, so this is cheap enough to run outside of tracing.
+class CORE_EXPORT SelectorMatchMetrics {
+  USING_FAST_MALLOC(SelectorMatchMetrics);
+
+ public:
+  // One in this many documents is measured.
+  static constexpr int kDocumentSampleRate = 100;
+
+  // Counts a rule list matched for |metrics|, if |metrics| is non-null, and
+  // times it if it is sampled.
+  class CORE_EXPORT ScopedRuleListTimer {
+    STACK_ALLOCATED();
+
+   public:
+    explicit ScopedRuleListTimer(SelectorMatchMetrics* metrics)
+        : scope_(metrics ? &metrics->match_timer_ : nullptr) {}
+    ScopedRuleListTimer(const ScopedRuleListTimer&) = delete;
+    ScopedRuleListTimer& operator=(const ScopedRuleListTimer&) = delete;
+
+   private:
+    SampledTimer::Scope scope_;
+  };
+
+  // Returns true for about one in kDocumentSampleRate calls.
+  static bool ShouldSampleDocument();
+
+  SelectorMatchMetrics();
+  SelectorMatchMetrics(const SelectorMatchMetrics&) = delete;
+  SelectorMatchMetrics& operator=(const SelectorMatchMetrics&) = delete;
+  ~SelectorMatchMetrics();
+
+  // Records the outcome of matching one rule list against an element.
+  void RecordRuleList(uint32_t attempts,
+                      uint32_t fast_rejects,
+                      uint32_t matches) {
+    attempt_count_ += attempts;
+    fast_reject_count_ += fast_rejects;
+    match_count_ += matches;
+  }
+
+  // Records the UKM event for |source_id|, unless no rule list was matched.
+  // Later calls are no-ops.
+  void PublishAllMetrics(ukm::UkmRecorder* ukm_recorder,
+                         ukm::SourceId source_id);
+
+  uint64_t AttemptCount() const { return attempt_count_; }
+  uint64_t FastRejectCount() const { return fast_reject_count_; }
+  uint64_t MatchCount() const { return match_count_; }
+  uint32_t RuleListCount() const { return match_timer_.Count(); }
+  // The total time of the rule lists, extrapolated from the sampled ones.
+  base::TimeDelta EstimatedMatchTime() const {
+    return match_timer_.EstimatedTime();
+  }
+
+ private:
+  UkmPublishOnce publish_once_;
+
+  uint64_t attempt_count_ = 0;
+  uint64_t fast_reject_count_ = 0;
+  uint64_t match_count_ = 0;
+
+  SampledTimer match_timer_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_CSS_SELECTOR_MATCH_METRICS_H_
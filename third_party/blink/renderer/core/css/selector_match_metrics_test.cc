@@ -0,0 +1,64 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/selector_match_metrics.h"
+
+#include "components/ukm/test_ukm_recorder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+namespace {
+
+constexpr ukm::SourceId kSourceId = 1;
+
+}  // namespace
+
+TEST(SelectorMatchMetricsTest, Counts) {
+  SelectorMatchMetrics metrics;
+  metrics.RecordRuleList(10, 6, 2);
+  metrics.RecordRuleList(5, 0, 5);
+  EXPECT_EQ(15u, metrics.AttemptCount());
+  EXPECT_EQ(6u, metrics.FastRejectCount());
+  EXPECT_EQ(7u, metrics.MatchCount());
+}
+
+TEST(SelectorMatchMetricsTest, ScopedRuleListTimer) {
+  SelectorMatchMetrics metrics;
+  { SelectorMatchMetrics::ScopedRuleListTimer timer(&metrics); }
+  { SelectorMatchMetrics::ScopedRuleListTimer timer(nullptr); }
+  EXPECT_EQ(1u, metrics.RuleListCount());
+}
+
+TEST(SelectorMatchMetricsTest, PublishAllMetrics) {
+  ukm::TestUkmRecorder recorder;
+
+  // Nothing is recorded for documents that matched no rule lists.
+  SelectorMatchMetrics metrics;
+  metrics.PublishAllMetrics(&recorder, kSourceId);
+  EXPECT_EQ(0u, recorder.entries_count());
+
+  SelectorMatchMetrics matched_metrics;
+  {
+    SelectorMatchMetrics::ScopedRuleListTimer timer(&matched_metrics);
+    matched_metrics.RecordRuleList(3, 2, 1);
+  }
+  matched_metrics.PublishAllMetrics(&recorder, kSourceId);
+  matched_metrics.PublishAllMetrics(&recorder, kSourceId);
+  EXPECT_EQ(1u, recorder.entries_count());
+
+  auto entries = recorder.GetEntriesByName("Kiwi.SelectorMatching");
+  ASSERT_EQ(1u, entries.size());
+  EXPECT_EQ(kSourceId, entries[0]->source_id);
+  EXPECT_EQ(1,
+            *ukm::TestUkmRecorder::GetEntryMetric(entries[0], "RuleLists"));
+  EXPECT_EQ(3, *ukm::TestUkmRecorder::GetEntryMetric(entries[0],
+                                                     "MatchAttempts"));
+  EXPECT_EQ(2,
+            *ukm::TestUkmRecorder::GetEntryMetric(entries[0], "FastRejects"));
+  EXPECT_EQ(1, *ukm::TestUkmRecorder::GetEntryMetric(entries[0], "Matches"));
+  EXPECT_TRUE(ukm::TestUkmRecorder::EntryHasMetric(entries[0], "MatchTime"));
+}
+
+}  // namespace blink
@@ -154,6 +154,8 @@ static void CollectElementsByClassName(
     const AtomicString& class_name,
     const CSSSelector* selector,
     typename SelectorQueryTrait::OutputType& output) {
+  if (!root_node.GetDocument().MayHaveElementWithClassName(class_name))
+    return;
   SelectorChecker checker(SelectorChecker::kQueryingRules);
   for (Element& element : ElementTraversal::DescendantsOf(root_node)) {
     QUERY_STATS_INCREMENT(fast_class);
@@ -233,12 +235,16 @@ void SelectorQuery::FindTraverseRootsAndExecute(
             root_node, selector->Value(), selectors_[0], output);
         return;
       }
+      const AtomicString& class_name = selector->Value();
+      // No element of the document, so no ancestor of a match either, can
+      // have the class name.
+      if (!root_node.GetDocument().MayHaveElementWithClassName(class_name))
+        return;
       // Since there exists some ancestor element which has the class name, we
       // need to see all children of rootNode.
-      if (AncestorHasClassName(root_node, selector->Value()))
+      if (AncestorHasClassName(root_node, class_name))
         break;
 
-      const AtomicString& class_name = selector->Value();
       Element* element = ElementTraversal::FirstWithin(root_node);
       while (element) {
         QUERY_STATS_INCREMENT(fast_class);
@@ -324,6 +324,42 @@ TEST(SelectorQueryTest, QuirksModeSlowPath) {
   RunTests(*document, kTestCases);
 }
 
+TEST(SelectorQueryTest, ClassNameNotInDocument) {
+  auto* document = HTMLDocument::CreateForTest();
+  document->write(R"HTML(
+    <!DOCTYPE html>
+    <html>
+      <head></head>
+      <body>
+        <span id=first class=A>
+          <span id=a class=one></span>
+          <span id=b class=two></span>
+        </span>
+      </body>
+    </html>
+  )HTML");
+  {
+    // No element ever had the class, so nothing is traversed.
+    static const struct QueryTest kTestCases[] = {
+        {".missing", false, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {".missing", true, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {"body .missing", true, 0, {0, 0, 0, 0, 0, 0, 0}},
+        {".missing span", true, 0, {0, 0, 0, 0, 0, 0, 0}},
+    };
+    RunTests(*document, kTestCases);
+  }
+
+  document->getElementById("b")->setAttribute(html_names::kClassAttr,
+                                              "missing");
+  {
+    static const struct QueryTest kTestCases[] = {
+        {".missing", true, 1, {6, 0, 6, 0, 0, 0, 0}},
+        {".two", true, 0, {6, 0, 6, 0, 0, 0, 0}},
+    };
+    RunTests(*document, kTestCases);
+  }
+}
+
 TEST(SelectorQueryTest, DisconnectedSubtree) {
   auto* document = HTMLDocument::CreateForTest();
   Element* scope = document->CreateRawElement(html_names::kDivTag);
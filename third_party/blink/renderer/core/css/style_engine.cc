@@ -54,6 +54,7 @@
 #include "third_party/blink/renderer/core/css/invalidation/invalidation_set.h"
 #include "third_party/blink/renderer/core/css/media_feature_overrides.h"
 #include "third_party/blink/renderer/core/css/media_values.h"
+#include "third_party/blink/renderer/core/css/parser/css_parser.h"
 #include "third_party/blink/renderer/core/css/property_registration.h"
 #include "third_party/blink/renderer/core/css/property_registry.h"
 #include "third_party/blink/renderer/core/css/resolver/scoped_style_resolver.h"
@@ -92,6 +93,7 @@
 #include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/inspector/console_message.h"
 #include "third_party/blink/renderer/core/layout/adjust_for_absolute_zoom.h"
+#include "third_party/blink/renderer/core/layout/element_hider.h"
 #include "third_party/blink/renderer/core/layout/geometry/logical_size.h"
 #include "third_party/blink/renderer/core/layout/geometry/physical_size.h"
 #include "third_party/blink/renderer/core/layout/layout_object.h"
@@ -410,8 +412,14 @@ void StyleEngine::MediaQueryAffectingValueChanged(TreeScope& tree_scope,
                                                   MediaValueChange change) {
   auto* collection = StyleSheetCollectionFor(tree_scope);
   DCHECK(collection);
-  if (AffectedByMediaValueChange(collection->ActiveStyleSheets(), change))
+  const ActiveStyleSheetVector& active_sheets = collection->ActiveStyleSheets();
+  // Changes like browser controls or the color scheme often leave every query
+  // of the scope as it was. The active sheets would then be collected again
+  // just to find their RuleSets unchanged.
+  if (AffectedByMediaValueChange(active_sheets, change) &&
+      MediaQueryResultsChanged(active_sheets, EnsureMediaQueryEvaluator())) {
     SetNeedsActiveStyleUpdate(tree_scope);
+  }
 }
 
 void StyleEngine::WatchedSelectorsChanged() {
@@ -580,6 +588,7 @@ void StyleEngine::UpdateActiveStyle() {
   TRACE_EVENT0("blink", "Document::updateActiveStyle");
   UpdateViewport();
   UpdateActiveStyleSheets();
+  UpdateElementHidingStyle();
   UpdateGlobalRuleSet();
   UpdateTimelines();
 }
@@ -662,8 +671,17 @@ RuleSet* StyleEngine::RuleSetForSheet(CSSStyleSheet& sheet) {
           sheet.BaseURL())) {
     add_rule_flags = kRuleHasDocumentSecurityOrigin;
   }
-  return &sheet.Contents()->EnsureRuleSet(*media_query_evaluator_,
-                                          add_rule_flags);
+  StyleSheetContents* contents = sheet.Contents();
+  RuleSet* previous_rule_set =
+      contents->HasRuleSet() ? &contents->GetRuleSet() : nullptr;
+  RuleSet* rule_set =
+      &contents->EnsureRuleSet(*media_query_evaluator_, add_rule_flags);
+  if (rule_set == previous_rule_set) {
+    INCREMENT_STYLE_STATS_COUNTER(*this, rule_sets_reused, 1);
+  } else {
+    INCREMENT_STYLE_STATS_COUNTER(*this, rule_sets_built, 1);
+  }
+  return rule_set;
 }
 
 void StyleEngine::ClearResolvers() {
@@ -831,10 +849,18 @@ CSSStyleSheet* StyleEngine::ParseSheet(
   style_sheet = CSSStyleSheet::CreateInline(element, NullURL(), start_position,
                                             GetDocument().Encoding());
   style_sheet->Contents()->SetRenderBlocking(render_blocking_behavior);
-  style_sheet->Contents()->ParseString(text);
+  style_sheet->Contents()->ParseString(
+      text, /*allow_import_rules=*/true,
+      ShouldDeferPropertyParsing(text) ? CSSDeferPropertyParsing::kYes
+                                       : CSSDeferPropertyParsing::kNo);
   return style_sheet;
 }
 
+// static
+bool StyleEngine::ShouldDeferPropertyParsing(const String& sheet_text) {
+  return sheet_text.length() >= kMinLengthForDeferredPropertyParsing;
+}
+
 void StyleEngine::CollectUserStyleFeaturesTo(RuleFeatureSet& features) const {
   for (unsigned i = 0; i < active_user_style_sheets_.size(); ++i) {
     CSSStyleSheet* sheet = active_user_style_sheets_[i].first;
@@ -1189,6 +1215,14 @@ void StyleEngine::ClassChangedForElement(const SpaceSplitString& old_classes,
     return;
   }
 
+  // Scripts that write className every frame often write the value it already
+  // has. No class changed, so there is nothing to collect invalidation sets
+  // for.
+  if (old_classes == new_classes) {
+    INCREMENT_STYLE_STATS_COUNTER(*this, class_changes_skipped, 1);
+    return;
+  }
+
   const RuleFeatureSet& features = GetRuleFeatureSet();
 
   bool needs_schedule_invalidation = !IsSubtreeAndSiblingsStyleDirty(element);
@@ -1801,6 +1835,8 @@ void StyleEngine::CollectFeaturesTo(RuleFeatureSet& features) {
     if (RuleSet* rule_set = RuleSetForSheet(*sheet))
       features.Add(rule_set->Features());
   }
+  for (RuleSet* rule_set : ElementHidingStyle())
+    features.Add(rule_set->Features());
 }
 
 void StyleEngine::EnsureUAStyleForXrOverlay() {
@@ -1876,6 +1912,59 @@ RuleSet* StyleEngine::DefaultDocumentTransitionStyle() const {
   return ua_document_transition_style_.Get();
 }
 
+const HeapVector<Member<RuleSet>>& StyleEngine::ElementHidingStyle() {
+  if (!element_hiding_style_resolved_)
+    ResolveElementHidingStyle(ElementHidingSectionsToApply());
+  return element_hiding_style_;
+}
+
+void StyleEngine::ElementHidingSectionsChanged() {
+  // Have the next UpdateActiveStyle() compare the sections.
+  if (element_hiding_style_resolved_ && global_rule_set_)
+    global_rule_set_->MarkDirty();
+}
+
+void StyleEngine::UpdateElementHidingStyle() {
+  if (!element_hiding_style_resolved_)
+    return;
+  uint32_t sections = ElementHidingSectionsToApply();
+  if (sections == element_hiding_sections_ &&
+      element_hiding_styles_version_ ==
+          CSSDefaultStyleSheets::Instance().ElementHidingStylesVersion()) {
+    return;
+  }
+  ResolveElementHidingStyle(sections);
+  if (global_rule_set_)
+    global_rule_set_->MarkDirty();
+  MarkAllElementsForStyleRecalc(StyleChangeReasonForTracing::Create(
+      style_change_reason::kStyleSheetChange));
+}
+
+uint32_t StyleEngine::ElementHidingSectionsToApply() const {
+  const ElementHider& hider = ElementHider::Default();
+  ElementHider::SectionMask sections = GetDocument().ElementHidingSections();
+  if ((sections & hider.AdsSections()) &&
+      !ElementHider::AreAdsBlocked(GetDocument())) {
+    sections &= ~hider.AdsSections();
+  }
+  return sections;
+}
+
+void StyleEngine::ResolveElementHidingStyle(uint32_t sections) {
+  element_hiding_style_resolved_ = true;
+  element_hiding_sections_ = sections;
+  element_hiding_styles_version_ =
+      CSSDefaultStyleSheets::Instance().ElementHidingStylesVersion();
+
+  element_hiding_style_.clear();
+  const HeapVector<Member<RuleSet>>& styles =
+      CSSDefaultStyleSheets::Instance().ElementHidingStyles();
+  for (wtf_size_t section = 0; section < styles.size(); ++section) {
+    if ((sections & (1u << section)) && styles[section])
+      element_hiding_style_.push_back(styles[section]);
+  }
+}
+
 void StyleEngine::InvalidateUADocumentTransitionStyle() {
   ua_document_transition_style_ = nullptr;
 }
@@ -2881,6 +2970,7 @@ void StyleEngine::RebuildLayoutTreeForTraversalRootAncestors(Element* parent) {
 
 void StyleEngine::RebuildLayoutTree(
     RebuildTransitionPseudoTree rebuild_transition_pseudo_tree) {
+  TRACE_EVENT0("blink,blink_style", "StyleEngine::RebuildLayoutTree");
   bool propagate_to_root = false;
   {
     DCHECK(GetDocument().documentElement());
@@ -3382,6 +3472,7 @@ void StyleEngine::Trace(Visitor* visitor) const {
   visitor->Trace(vtt_originating_element_);
   visitor->Trace(parent_for_detached_subtree_);
   visitor->Trace(ua_document_transition_style_);
+  visitor->Trace(element_hiding_style_);
   visitor->Trace(style_image_cache_);
   FontSelectorClient::Trace(visitor);
 }
@@ -354,6 +354,15 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
                              PendingSheetType type,
                              RenderBlockingBehavior render_blocking_behavior);
 
+  // Inline sheets at least this long have the declarations of each rule
+  // parsed only once they are first needed, as external sheets always do.
+  // Large sheets, e.g. inlined framework CSS, mostly hold rules that match
+  // nothing on the page, so this takes most of their parsing off the path
+  // to first paint.
+  static constexpr wtf_size_t kMinLengthForDeferredPropertyParsing =
+      16 * 1024;
+  static bool ShouldDeferPropertyParsing(const String& sheet_text);
+
   void CollectFeaturesTo(RuleFeatureSet& features);
 
   void EnsureUAStyleForFullscreen();
@@ -573,6 +582,14 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   RuleSet* DefaultDocumentTransitionStyle() const;
   void InvalidateUADocumentTransitionStyle();
 
+  // The user-agent rules of the ElementHider sections that apply to the
+  // document, resolved from its host and whether ads are blocked for its frame.
+  // Resolved on first use and re-resolved by UpdateActiveStyle() when the URL,
+  // the ads content setting or the parsed rules change.
+  const HeapVector<Member<RuleSet>>& ElementHidingStyle();
+  // Called when the document's ElementHidingSections() may have changed.
+  void ElementHidingSectionsChanged();
+
   const ActiveStyleSheetVector& ActiveUserStyleSheetsForDebug() const {
     return active_user_style_sheets_;
   }
@@ -660,6 +677,11 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
 
   void UpdateActiveUserStyleSheets();
   void UpdateActiveStyleSheets();
+  // Re-resolves a resolved ElementHidingStyle() whose inputs changed and marks
+  // the document for style recalc if so.
+  void UpdateElementHidingStyle();
+  uint32_t ElementHidingSectionsToApply() const;
+  void ResolveElementHidingStyle(uint32_t sections);
   void UpdateGlobalRuleSet() {
     DCHECK(!NeedsActiveStyleSheetUpdate());
     if (global_rule_set_)
@@ -836,6 +858,15 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   // dynamically updated.
   Member<RuleSet> ua_document_transition_style_;
 
+  // See ElementHidingStyle(). The rule sets are shared with
+  // CSSDefaultStyleSheets.
+  HeapVector<Member<RuleSet>> element_hiding_style_;
+  // The sections and CSSDefaultStyleSheets::ElementHidingStylesVersion()
+  // element_hiding_style_ was resolved from.
+  uint32_t element_hiding_sections_{0};
+  unsigned element_hiding_styles_version_{0};
+  bool element_hiding_style_resolved_{false};
+
   PendingInvalidations pending_invalidations_;
 
   StyleInvalidationRoot style_invalidation_root_;
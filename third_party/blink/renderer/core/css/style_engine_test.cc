@@ -34,6 +34,7 @@
 #include "third_party/blink/renderer/core/css/resolver/scoped_style_resolver.h"
 #include "third_party/blink/renderer/core/css/resolver/style_resolver.h"
 #include "third_party/blink/renderer/core/css/resolver/style_resolver_stats.h"
+#include "third_party/blink/renderer/core/css/style_rule.h"
 #include "third_party/blink/renderer/core/css/style_sheet_contents.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/first_letter_pseudo_element.h"
@@ -61,6 +62,7 @@
 #include "third_party/blink/renderer/core/layout/layout_text_fragment.h"
 #include "third_party/blink/renderer/core/layout/layout_theme.h"
 #include "third_party/blink/renderer/core/layout/list_marker.h"
+#include "third_party/blink/renderer/core/media_type_names.h"
 #include "third_party/blink/renderer/core/page/page_animator.h"
 #include "third_party/blink/renderer/core/page/viewport_description.h"
 #include "third_party/blink/renderer/core/testing/color_scheme_helper.h"
@@ -75,6 +77,7 @@
 #include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/testing_platform_support.h"
 #include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 #include "ui/gfx/geometry/size_f.h"
 
 namespace blink {
@@ -1336,17 +1339,13 @@ TEST_F(StyleEngineTest,
   EXPECT_FALSE(GetStyleEngine().NeedsActiveStyleUpdate());
 }
 
-// TODO(futhark@chromium.org): The test cases below where all queries are either
-// "all" or "not all", we could have detected those and not trigger an active
-// stylesheet update for those cases.
-
 TEST_F(StyleEngineTest,
        MediaQueryAffectingValueChanged_StyleElementMediaNoValid) {
   GetDocument().body()->setInnerHTML(
       "<style media=',,'>div{color:pink}</style>");
   UpdateAllLifecyclePhases();
   GetStyleEngine().MediaQueryAffectingValueChanged(MediaValueChange::kOther);
-  EXPECT_TRUE(GetStyleEngine().NeedsActiveStyleUpdate());
+  EXPECT_FALSE(GetStyleEngine().NeedsActiveStyleUpdate());
 }
 
 TEST_F(StyleEngineTest, MediaQueryAffectingValueChanged_StyleElementMediaAll) {
@@ -1354,7 +1353,7 @@ TEST_F(StyleEngineTest, MediaQueryAffectingValueChanged_StyleElementMediaAll) {
       "<style media='all'>div{color:pink}</style>");
   UpdateAllLifecyclePhases();
   GetStyleEngine().MediaQueryAffectingValueChanged(MediaValueChange::kOther);
-  EXPECT_TRUE(GetStyleEngine().NeedsActiveStyleUpdate());
+  EXPECT_FALSE(GetStyleEngine().NeedsActiveStyleUpdate());
 }
 
 TEST_F(StyleEngineTest,
@@ -1363,7 +1362,7 @@ TEST_F(StyleEngineTest,
       "<style media='not all'>div{color:pink}</style>");
   UpdateAllLifecyclePhases();
   GetStyleEngine().MediaQueryAffectingValueChanged(MediaValueChange::kOther);
-  EXPECT_TRUE(GetStyleEngine().NeedsActiveStyleUpdate());
+  EXPECT_FALSE(GetStyleEngine().NeedsActiveStyleUpdate());
 }
 
 TEST_F(StyleEngineTest, MediaQueryAffectingValueChanged_StyleElementMediaType) {
@@ -1371,6 +1370,26 @@ TEST_F(StyleEngineTest, MediaQueryAffectingValueChanged_StyleElementMediaType) {
       "<style media='print'>div{color:pink}</style>");
   UpdateAllLifecyclePhases();
   GetStyleEngine().MediaQueryAffectingValueChanged(MediaValueChange::kOther);
+  EXPECT_FALSE(GetStyleEngine().NeedsActiveStyleUpdate());
+}
+
+TEST_F(StyleEngineTest, MediaQueryAffectingValueChanged_RuleResultChanged) {
+  GetDocument().body()->setInnerHTML(
+      "<style>@media print { div { color:pink } }</style>");
+  UpdateAllLifecyclePhases();
+  GetStyleEngine().MediaQueryAffectingValueChanged(MediaValueChange::kOther);
+  EXPECT_FALSE(GetStyleEngine().NeedsActiveStyleUpdate());
+
+  GetDocument().View()->SetMediaType(media_type_names::kPrint);
+  EXPECT_TRUE(GetStyleEngine().NeedsActiveStyleUpdate());
+}
+
+TEST_F(StyleEngineTest,
+       MediaQueryAffectingValueChanged_StyleElementResultChanged) {
+  GetDocument().body()->setInnerHTML(
+      "<style media='print'>div{color:pink}</style>");
+  UpdateAllLifecyclePhases();
+  GetDocument().View()->SetMediaType(media_type_names::kPrint);
   EXPECT_TRUE(GetStyleEngine().NeedsActiveStyleUpdate());
 }
 
@@ -4256,6 +4275,75 @@ TEST_F(StyleEngineTest, VideoControlsReject) {
   EXPECT_EQ(0u, stats->rules_rejected);
 }
 
+TEST_F(StyleEngineTest, RuleSetStats) {
+  StyleEngine& engine = GetStyleEngine();
+  engine.SetStatsEnabled(true);
+  StyleResolverStats* stats = engine.Stats();
+  ASSERT_TRUE(stats);
+
+  // The second sheet shares the StyleSheetContents, and so the RuleSet, of
+  // the first one through the text-to-sheet cache.
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>#target { color: green }</style>
+    <style>#target { color: green }</style>
+    <div id="target"></div>
+  )HTML");
+  UpdateAllLifecyclePhases();
+
+  EXPECT_EQ(1u, stats->rule_sets_built);
+  EXPECT_GE(stats->rule_sets_reused, 1u);
+}
+
+TEST_F(StyleEngineTest, UnchangedClassNeedsNoInvalidation) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>.a span { color: green }</style>
+    <div id="target" class="a b"></div>
+  )HTML");
+  UpdateAllLifecyclePhases();
+
+  StyleEngine& engine = GetStyleEngine();
+  engine.SetStatsEnabled(true);
+  Element* target = GetDocument().getElementById("target");
+  ASSERT_TRUE(target);
+
+  target->setAttribute(html_names::kClassAttr, "a b");
+  EXPECT_FALSE(target->NeedsStyleInvalidation());
+  EXPECT_EQ(1u, engine.Stats()->class_changes_skipped);
+
+  target->setAttribute(html_names::kClassAttr, "b");
+  EXPECT_TRUE(target->NeedsStyleInvalidation());
+  EXPECT_EQ(1u, engine.Stats()->class_changes_skipped);
+}
+
+TEST_F(StyleEngineTest, DeferPropertyParsingForLargeInlineSheets) {
+  StringBuilder large_sheet;
+  large_sheet.Append("#target { color: green }");
+  while (large_sheet.length() <
+         StyleEngine::kMinLengthForDeferredPropertyParsing) {
+    large_sheet.Append(".unused { color: red }");
+  }
+  GetDocument().body()->setInnerHTML(
+      "<style id=small>#target { background-color: green }</style>"
+      "<style id=large>" +
+      large_sheet.ToString() + "</style><div id=target></div>");
+  UpdateAllLifecyclePhases();
+
+  auto rule_at = [this](const char* id, wtf_size_t index) {
+    auto* style_element =
+        To<HTMLStyleElement>(GetDocument().getElementById(id));
+    return To<StyleRule>(
+        style_element->sheet()->Contents()->ChildRules()[index].Get());
+  };
+  EXPECT_TRUE(rule_at("small", 0)->HasParsedProperties());
+  // Of the large sheet, only the rule that matched has been parsed.
+  EXPECT_TRUE(rule_at("large", 0)->HasParsedProperties());
+  EXPECT_FALSE(rule_at("large", 1)->HasParsedProperties());
+
+  Element* target = GetDocument().getElementById("target");
+  EXPECT_EQ(MakeRGB(0, 128, 0), target->GetComputedStyle()->VisitedDependentColor(
+                                    GetCSSPropertyColor()));
+}
+
 TEST_F(StyleEngineTest, FastRejectForHostChild) {
   GetDocument().body()->setInnerHTML(R"HTML(
     <style>
@@ -5246,6 +5334,42 @@ TEST_F(StyleEngineTest, ScrollbarStyleNoExcessiveCaching) {
                            .Serialized());
 }
 
+TEST_F(StyleEngineTest, HasPseudoClassInEnsureComputedStyle) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>
+      .a:has(.b) { background-color: lime; }
+      .a { background-color: red; }
+    </style>
+    <div style="display:none">
+      <div id=div1 class='a'>
+        <div id=div2 class='a'>
+          <div id=div3 class='a'></div>
+          <div class='b'></div>
+        </div>
+      </div>
+    </div>
+  )HTML");
+  UpdateAllLifecyclePhases();
+
+  // Ensuring the style of div3 also ensures the styles of div1 and div2,
+  // which share one :has() result cache.
+  const ComputedStyle* style =
+      GetDocument().getElementById("div3")->EnsureComputedStyle();
+  ASSERT_TRUE(style);
+  EXPECT_EQ("#ff0000", style->BackgroundColor().GetColor().Serialized());
+
+  auto background_of = [this](const char* id) {
+    return GetDocument()
+        .getElementById(id)
+        ->GetComputedStyle()
+        ->BackgroundColor()
+        .GetColor()
+        .Serialized();
+  };
+  EXPECT_EQ("#00ff00", background_of("div1"));
+  EXPECT_EQ("#00ff00", background_of("div2"));
+}
+
 TEST_F(StyleEngineTest, HasPseudoClassInvalidationSkipIrrelevantClassChange) {
   GetDocument().body()->setInnerHTML(R"HTML(
     <style>.a:has(.b) { background-color: lime; }</style>
@@ -17,6 +17,7 @@
 #include "testing/perf/perf_test.h"
 #include "third_party/blink/public/platform/web_back_forward_cache_loader_helper.h"
 #include "third_party/blink/renderer/core/css/container_query_data.h"
+#include "third_party/blink/renderer/core/css/parser/css_tokenizer.h"
 #include "third_party/blink/renderer/core/css/style_change_reason.h"
 #include "third_party/blink/renderer/core/css/style_engine.h"
 #include "third_party/blink/renderer/core/css/style_sheet_contents.h"
@@ -52,6 +53,17 @@ static std::unique_ptr<DummyPageHolder> LoadDumpedPage(
   int num_sheets = 0;
   int num_bytes = 0;
 
+  // Tokenize the sheets on their own first, so that changes to the tokenizer
+  // can be told apart from changes to the rest of the parser.
+  size_t num_tokens = 0;
+  base::ElapsedTimer tokenize_timer;
+  for (const base::Value& sheet_json : *dict.FindList("stylesheets")) {
+    CSSTokenizer tokenizer(
+        WTF::String(*sheet_json.GetDict().FindString("text")));
+    num_tokens += tokenizer.TokenizeToEOF().size();
+  }
+  base::TimeDelta tokenize_time = tokenize_timer.Elapsed();
+
   base::ElapsedTimer parse_timer;
   for (const base::Value& sheet_json : *dict.FindList("stylesheets")) {
     const base::Value::Dict& sheet_dict = sheet_json.GetDict();
@@ -77,6 +89,12 @@ static std::unique_ptr<DummyPageHolder> LoadDumpedPage(
   reporter.RegisterImportantMetric("ParseTime", "us");
   reporter.AddResult("ParseTime", parse_time);
 
+  reporter.RegisterFyiMetric("NumTokens", "");
+  reporter.AddResult("NumTokens", static_cast<double>(num_tokens));
+
+  reporter.RegisterImportantMetric("TokenizeTime", "us");
+  reporter.AddResult("TokenizeTime", tokenize_time);
+
   return page;
 }
 
@@ -47,6 +47,7 @@ class StyleRuleBase;
 class StyleRuleFontFace;
 class StyleRuleImport;
 class StyleRuleNamespace;
+enum class CSSDeferPropertyParsing;
 enum class ParseSheetResult;
 
 class CORE_EXPORT StyleSheetContents final
@@ -70,6 +71,9 @@ class CORE_EXPORT StyleSheetContents final
 
   void ParseAuthorStyleSheet(const CSSStyleSheetResource*);
   ParseSheetResult ParseString(const String&, bool allow_import_rules = true);
+  ParseSheetResult ParseString(const String&,
+                               bool allow_import_rules,
+                               CSSDeferPropertyParsing);
 
   bool IsCacheableForResource() const;
   bool IsCacheableForStyleElement() const;
@@ -113,6 +113,7 @@
 #include "third_party/blink/renderer/core/css/resolver/font_builder.h"
 #include "third_party/blink/renderer/core/css/resolver/style_resolver.h"
 #include "third_party/blink/renderer/core/css/resolver/style_resolver_stats.h"
+#include "third_party/blink/renderer/core/css/selector_match_metrics.h"
 #include "third_party/blink/renderer/core/css/selector_query.h"
 #include "third_party/blink/renderer/core/css/style_change_reason.h"
 #include "third_party/blink/renderer/core/css/style_engine.h"
@@ -160,6 +161,7 @@
 #include "third_party/blink/renderer/core/dom/slot_assignment.h"
 #include "third_party/blink/renderer/core/dom/slot_assignment_engine.h"
 #include "third_party/blink/renderer/core/dom/slot_assignment_recalc_forbidden_scope.h"
+#include "third_party/blink/renderer/core/dom/space_split_string.h"
 #include "third_party/blink/renderer/core/dom/static_node_list.h"
 #include "third_party/blink/renderer/core/dom/transform_source.h"
 #include "third_party/blink/renderer/core/dom/tree_walker.h"
@@ -249,6 +251,7 @@
 #include "third_party/blink/renderer/core/intersection_observer/intersection_observer_controller.h"
 #include "third_party/blink/renderer/core/intersection_observer/intersection_observer_entry.h"
 #include "third_party/blink/renderer/core/layout/adjust_for_absolute_zoom.h"
+#include "third_party/blink/renderer/core/layout/element_hider.h"
 #include "third_party/blink/renderer/core/layout/hit_test_canvas_result.h"
 #include "third_party/blink/renderer/core/layout/hit_test_result.h"
 #include "third_party/blink/renderer/core/layout/layout_embedded_content.h"
@@ -256,6 +259,7 @@
 #include "third_party/blink/renderer/core/layout/layout_view.h"
 #include "third_party/blink/renderer/core/layout/text_autosizer.h"
 #include "third_party/blink/renderer/core/loader/anchor_element_interaction_tracker.h"
+#include "third_party/blink/renderer/core/loader/content_blocking_metrics.h"
 #include "third_party/blink/renderer/core/loader/cookie_jar.h"
 #include "third_party/blink/renderer/core/loader/document_loader.h"
 #include "third_party/blink/renderer/core/loader/frame_fetch_context.h"
@@ -2891,6 +2895,14 @@ void Document::Shutdown() {
   }
 
   GetFontMatchingMetrics()->PublishAllMetrics();
+  if (render_blocking_resource_manager_)
+    render_blocking_resource_manager_->DropDeferredFetches();
+  if (content_blocking_metrics_)
+    content_blocking_metrics_->PublishAllMetrics(UkmRecorder(), UkmSourceID());
+  if (selector_match_metrics_)
+    selector_match_metrics_->PublishAllMetrics(UkmRecorder(), UkmSourceID());
+  if (text_autosizer_)
+    text_autosizer_->Metrics().PublishAllMetrics(UkmRecorder(), UkmSourceID());
 
   GetViewportData().Shutdown();
 
@@ -4228,6 +4240,9 @@ void Document::SetURL(const KURL& url) {
   new_url = fragment_directive_->ConsumeFragmentDirective(new_url);
 
   url_ = new_url;
+  element_hiding_sections_.reset();
+  if (style_engine_)
+    style_engine_->ElementHidingSectionsChanged();
   UpdateBaseURL();
   GetContextFeatures().UrlDidChange(this);
 
@@ -4237,6 +4252,14 @@ void Document::SetURL(const KURL& url) {
   }
 }
 
+uint32_t Document::ElementHidingSections() const {
+  if (!element_hiding_sections_) {
+    element_hiding_sections_ =
+        ElementHider::Default().SectionsForHost(url_.Host());
+  }
+  return *element_hiding_sections_;
+}
+
 KURL Document::ValidBaseElementURL() const {
   if (base_element_url_.IsValid())
     return base_element_url_;
@@ -6874,6 +6897,20 @@ void Document::ElementDataCacheClearTimerFired(TimerBase*) {
   element_data_cache_.Clear();
 }
 
+void Document::DidAddClassNames(const SpaceSplitString& class_names) {
+  // Pages that generate class names keep adding new ones. Past this many the
+  // set stops being a useful filter, so give up on it.
+  constexpr wtf_size_t kMaxSeenClassNames = 4096;
+  if (seen_class_names_overflowed_)
+    return;
+  for (wtf_size_t i = 0; i < class_names.size(); ++i)
+    seen_class_names_.insert(class_names[i]);
+  if (seen_class_names_.size() > kMaxSeenClassNames) {
+    seen_class_names_overflowed_ = true;
+    seen_class_names_.clear();
+  }
+}
+
 void Document::BeginLifecycleUpdatesIfRenderingReady() {
   if (!IsActive())
     return;
@@ -7129,6 +7166,21 @@ FontMatchingMetrics* Document::GetFontMatchingMetrics() {
   return font_matching_metrics_.get();
 }
 
+ContentBlockingMetrics* Document::GetContentBlockingMetrics() {
+  if (!content_blocking_metrics_)
+    content_blocking_metrics_ = std::make_unique<ContentBlockingMetrics>();
+  return content_blocking_metrics_.get();
+}
+
+SelectorMatchMetrics* Document::GetSelectorMatchMetrics() {
+  if (!selector_match_metrics_sampled_) {
+    selector_match_metrics_sampled_ = true;
+    if (GetFrame() && SelectorMatchMetrics::ShouldSampleDocument())
+      selector_match_metrics_ = std::make_unique<SelectorMatchMetrics>();
+  }
+  return selector_match_metrics_.get();
+}
+
 bool Document::AllowInlineEventHandler(Node* node,
                                        EventListener* listener,
                                        const String& context_url,
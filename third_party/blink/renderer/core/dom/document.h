@@ -137,6 +137,7 @@ class DocumentData;
 class ElementIntersectionObserverData;
 class ComputedStyle;
 class ConsoleMessage;
+class ContentBlockingMetrics;
 class ContextFeatures;
 class CookieJar;
 class DOMImplementation;
@@ -221,11 +222,13 @@ class ScriptableDocumentParser;
 class ScriptedAnimationController;
 class ScriptedIdleTaskController;
 class SecurityOrigin;
+class SelectorMatchMetrics;
 class SelectorQueryCache;
 class SerializedScriptValue;
 class Settings;
 class SlotAssignmentEngine;
 class SnapCoordinator;
+class SpaceSplitString;
 class StyleEngine;
 class StylePropertyMapReadOnly;
 class StyleResolver;
@@ -856,6 +859,10 @@ class CORE_EXPORT Document : public ContainerNode,
   const KURL& Url() const { return url_; }
   void SetURL(const KURL&);
 
+  // The ElementHider sections that apply to this document, resolved from the
+  // host of Url() on first use.
+  uint32_t ElementHidingSections() const;
+
   // Bind the url to document.url, if unavailable bind to about:blank.
   KURL urlForBinding() const;
 
@@ -1487,6 +1494,17 @@ class CORE_EXPORT Document : public ContainerNode,
 
   ElementDataCache* GetElementDataCache() { return element_data_cache_.Get(); }
 
+  // Records the class names an element of this document was given, so that
+  // MayHaveElementWithClassName() can rule out class selectors in
+  // querySelector*() without walking the tree. The record only grows;
+  // removing a class or an element does not shrink it.
+  void DidAddClassNames(const SpaceSplitString& class_names);
+  // Returns false only if no element of this document ever had |class_name|.
+  bool MayHaveElementWithClassName(const AtomicString& class_name) const {
+    return seen_class_names_overflowed_ ||
+           seen_class_names_.Contains(class_name);
+  }
+
   void DidLoadAllScriptBlockingResources();
   void DidAddPendingParserBlockingStylesheet();
   void DidLoadAllPendingParserBlockingStylesheets();
@@ -1655,6 +1673,15 @@ class CORE_EXPORT Document : public ContainerNode,
   // attempts (both successful and not successful) by the page.
   FontMatchingMetrics* GetFontMatchingMetrics();
 
+  // Counts the requests and elements blocked by Kiwi's content blocking, and
+  // reports them through UKM when the document shuts down.
+  ContentBlockingMetrics* GetContentBlockingMetrics();
+
+  // Counts the selectors matched for this document, if it is one of those
+  // sampled, and reports them through UKM when the document shuts down.
+  // Returns nullptr for documents that are not sampled.
+  SelectorMatchMetrics* GetSelectorMatchMetrics();
+
   scoped_refptr<base::SingleThreadTaskRunner> GetTaskRunner(TaskType);
 
   StylePropertyMapReadOnly* ComputedStyleMap(Element*);
@@ -2363,6 +2390,10 @@ class CORE_EXPORT Document : public ContainerNode,
 
   Member<ElementDataCache> element_data_cache_;
 
+  HashSet<AtomicString> seen_class_names_;
+  // Set once seen_class_names_ grew too large to be worth keeping.
+  bool seen_class_names_overflowed_ = false;
+
   using LocaleIdentifierToLocaleMap =
       HashMap<AtomicString, std::unique_ptr<Locale>>;
   LocaleIdentifierToLocaleMap locale_cache_;
@@ -2402,6 +2433,13 @@ class CORE_EXPORT Document : public ContainerNode,
   // successful and not successful) by the page.
   std::unique_ptr<FontMatchingMetrics> font_matching_metrics_;
 
+  std::unique_ptr<ContentBlockingMetrics> content_blocking_metrics_;
+  // The cached result of ElementHidingSections().
+  mutable absl::optional<uint32_t> element_hiding_sections_;
+
+  std::unique_ptr<SelectorMatchMetrics> selector_match_metrics_;
+  bool selector_match_metrics_sampled_ = false;
+
 #if DCHECK_IS_ON()
   unsigned slot_assignment_recalc_forbidden_recursion_depth_ = 0;
 #endif
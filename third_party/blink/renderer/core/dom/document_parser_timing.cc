@@ -4,12 +4,22 @@
 
 #include "third_party/blink/renderer/core/dom/document_parser_timing.h"
 
+#include <algorithm>
+
+#include "base/metrics/histogram_macros.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/loader/document_loader.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 
 namespace blink {
 
+namespace {
+
+// Smaller documents are parsed too quickly for a meaningful throughput.
+constexpr size_t kMinBytesForThroughput = 64 * 1024;
+
+}  // namespace
+
 // static
 const char DocumentParserTiming::kSupplementName[] = "DocumentParserTiming";
 
@@ -35,6 +45,13 @@ void DocumentParserTiming::MarkParserStop() {
   if (parser_detached_ || parser_start_.is_null() || !parser_stop_.is_null())
     return;
   parser_stop_ = base::TimeTicks::Now();
+  if (bytes_appended_ >= kMinBytesForThroughput &&
+      append_duration_.is_positive()) {
+    int64_t append_ms = std::max<int64_t>(1, append_duration_.InMilliseconds());
+    int64_t bytes_per_ms = static_cast<int64_t>(bytes_appended_) / append_ms;
+    UMA_HISTOGRAM_COUNTS_100000("Blink.Parser.AppendThroughput", bytes_per_ms);
+    UMA_HISTOGRAM_TIMES("Blink.Parser.LongestAppend", longest_append_duration_);
+  }
   NotifyDocumentParserTimingChanged();
 }
 
@@ -43,6 +60,15 @@ void DocumentParserTiming::MarkParserDetached() {
   parser_detached_ = true;
 }
 
+void DocumentParserTiming::RecordBytesAppended(size_t bytes,
+                                               base::TimeDelta duration) {
+  if (parser_detached_ || parser_start_.is_null() || !parser_stop_.is_null())
+    return;
+  bytes_appended_ += bytes;
+  append_duration_ += duration;
+  longest_append_duration_ = std::max(longest_append_duration_, duration);
+}
+
 void DocumentParserTiming::RecordParserBlockedOnScriptLoadDuration(
     base::TimeDelta duration,
     bool script_inserted_via_document_write) {
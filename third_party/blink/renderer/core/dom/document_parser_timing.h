@@ -62,6 +62,11 @@ class DocumentParserTiming final
       base::TimeDelta duration,
       bool script_inserted_via_document_write);
 
+  // Record that the document loader handed |bytes| of the body to the parser,
+  // which spent |duration| synchronously handling them. The throughput and the
+  // longest of these calls are recorded to UMA when the parser stops.
+  void RecordBytesAppended(size_t bytes, base::TimeDelta duration);
+
   // The getters below return monotonically-increasing time, or zero if the
   // given parser event has not yet occurred.
 
@@ -109,6 +114,9 @@ class DocumentParserTiming final
   base::TimeDelta parser_blocked_on_script_execution_duration_;
   base::TimeDelta
       parser_blocked_on_script_execution_from_document_write_duration_;
+  size_t bytes_appended_ = 0;
+  base::TimeDelta append_duration_;
+  base::TimeDelta longest_append_duration_;
   bool parser_detached_ = false;
 };
 
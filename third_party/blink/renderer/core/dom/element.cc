@@ -52,6 +52,7 @@
 #include "third_party/blink/renderer/core/accessibility/ax_object_cache.h"
 #include "third_party/blink/renderer/core/animation/css/css_animations.h"
 #include "third_party/blink/renderer/core/aom/computed_accessible_node.h"
+#include "third_party/blink/renderer/core/css/check_pseudo_has_cache_scope.h"
 #include "third_party/blink/renderer/core/css/container_query_data.h"
 #include "third_party/blink/renderer/core/css/container_query_evaluator.h"
 #include "third_party/blink/renderer/core/css/css_identifier_value.h"
@@ -3248,6 +3249,7 @@ void Element::ClassAttributeChanged(const AtomicString& new_class_string) {
     const SpaceSplitString old_classes = GetElementData()->ClassNames();
     GetElementData()->SetClass(new_class_string, should_fold_case);
     const SpaceSplitString& new_classes = GetElementData()->ClassNames();
+    GetDocument().DidAddClassNames(new_classes);
     GetDocument().GetStyleEngine().ClassChangedForElement(old_classes,
                                                           new_classes, *this);
   } else {
@@ -5387,7 +5389,19 @@ void Element::AppendAttributeInternal(const QualifiedName& name,
                                       AttributeModificationReason reason) {
   if (reason != AttributeModificationReason::kBySynchronizationOfLazyAttribute)
     WillModifyAttribute(name, g_null_atom, value);
-  EnsureUniqueElementData().Attributes().Append(name, value);
+  ElementDataCache* element_data_cache = GetDocument().GetElementDataCache();
+  if (!element_data_ && element_data_cache &&
+      reason !=
+          AttributeModificationReason::kBySynchronizationOfLazyAttribute) {
+    // Elements built by script often get a single attribute, typically the
+    // same class as many of their siblings. Share its storage as
+    // ParserSetAttributes() does; later changes make a unique copy.
+    element_data_ =
+        element_data_cache->CachedShareableElementDataWithAttributes(
+            {Attribute(name, value)});
+  } else {
+    EnsureUniqueElementData().Attributes().Append(name, value);
+  }
   if (reason != AttributeModificationReason::kBySynchronizationOfLazyAttribute)
     DidAddAttribute(name, value);
 }
@@ -6644,6 +6658,11 @@ const ComputedStyle* Element::EnsureComputedStyle(
   // and the back() element is the "top-most" ancestor in the chain.
   HeapVector<Member<Element>> ancestors = CollectAncestorsToEnsure(*this);
 
+  // The styles of the ancestors and of this element are resolved against the
+  // same DOM, so they can share the :has() results found on the way, as the
+  // elements of a style recalc do.
+  CheckPseudoHasCacheScope check_pseudo_has_cache_scope(&GetDocument());
+
   Element* top = ancestors.IsEmpty() ? this : ancestors.back().Get();
   auto style_recalc_context = StyleRecalcContext::FromAncestors(*top);
 
@@ -7691,6 +7710,8 @@ void Element::DidMoveToNewDocument(Document& old_document) {
                            html_names::kClassAttr, classAttr,
                            AttributeModificationReason::kByMoveToNewDocument);
     }
+  } else if (HasClass()) {
+    GetDocument().DidAddClassNames(GetElementData()->ClassNames());
   }
   // TODO(tkent): Even if Documents' modes are same, keeping
   // ShareableElementData owned by old_document isn't right.
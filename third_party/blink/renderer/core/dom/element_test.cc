@@ -42,6 +42,27 @@ TEST_F(ElementTest, SupportsFocus) {
       << "<html> with designMode=on should be focusable.";
 }
 
+TEST_F(ElementTest, ScriptSetAttributeSharesElementData) {
+  Document& document = GetDocument();
+  // The cache lives while the document parses and a while after.
+  ASSERT_TRUE(document.GetElementDataCache());
+
+  Element* first = document.CreateRawElement(html_names::kDivTag);
+  Element* second = document.CreateRawElement(html_names::kDivTag);
+  first->setAttribute(html_names::kClassAttr, "item");
+  second->setAttribute(html_names::kClassAttr, "item");
+  EXPECT_EQ(first->GetElementData(), second->GetElementData());
+  EXPECT_FALSE(first->GetElementData()->IsUnique());
+  EXPECT_TRUE(first->HasClass());
+
+  // Further changes are made to a copy.
+  second->setAttribute(html_names::kIdAttr, "second");
+  EXPECT_NE(first->GetElementData(), second->GetElementData());
+  EXPECT_TRUE(second->GetElementData()->IsUnique());
+  EXPECT_FALSE(first->HasID());
+  EXPECT_EQ("item", second->getAttribute(html_names::kClassAttr));
+}
+
 TEST_F(ElementTest,
        GetBoundingClientRectCorrectForStickyElementsAfterInsertion) {
   Document& document = GetDocument();
@@ -9,10 +9,13 @@
 #include "third_party/blink/public/mojom/frame/lifecycle.mojom-shared.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_idle_request_options.h"
+#include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/execution_context/execution_context.h"
+#include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/core/inspector/inspector_trace_events.h"
 #include "third_party/blink/renderer/core/probe/core_probes.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/scheduler/public/thread_scheduler.h"
 #include "third_party/blink/renderer/platform/wtf/functional.h"
 #include "third_party/blink/renderer/platform/wtf/ref_counted.h"
@@ -120,6 +123,8 @@ ScriptedIdleTaskController::RegisterCallback(
 
   CallbackId id = NextCallbackId();
   idle_tasks_.Set(id, idle_task);
+  DropFinishedCallbacksFromOrder();
+  callback_order_.push_back(id);
   uint32_t timeout_millis = options->timeout();
 
   idle_task->async_task_context()->Schedule(GetExecutionContext(),
@@ -178,7 +183,57 @@ void ScriptedIdleTaskController::CallbackFired(
     return;
   }
 
+  if (callback_type != IdleDeadline::CallbackType::kCalledWhenIdle ||
+      !ShouldPackCallbacks()) {
+    RunCallback(id, deadline, callback_type);
+    return;
+  }
+
+  // Only the callbacks pending when the idle period starts may share it; the
+  // ones they register wait for the next idle period.
+  DropFinishedCallbacksFromOrder();
+  Vector<CallbackId> pending_callbacks;
+  pending_callbacks.ReserveInitialCapacity(callback_order_.size());
+  for (CallbackId pending_id : callback_order_) {
+    if (pending_id != id)
+      pending_callbacks.push_back(pending_id);
+  }
+
   RunCallback(id, deadline, callback_type);
+  RunPackedCallbacks(pending_callbacks, deadline);
+}
+
+void ScriptedIdleTaskController::RunPackedCallbacks(
+    const Vector<CallbackId>& pending_callbacks,
+    base::TimeTicks deadline) {
+  for (CallbackId id : pending_callbacks) {
+    if (paused_)
+      return;
+    // Skip the callbacks that were cancelled or already ran.
+    if (!idle_tasks_.Contains(id))
+      continue;
+    if (!typical_callback_duration_ ||
+        base::TimeTicks::Now() + *typical_callback_duration_ > deadline ||
+        scheduler_->ShouldYieldForHighPriorityWork()) {
+      return;
+    }
+    // The idle task posted for the callback finds it gone and does nothing.
+    RunCallback(id, deadline, IdleDeadline::CallbackType::kCalledWhenIdle);
+  }
+}
+
+void ScriptedIdleTaskController::DropFinishedCallbacksFromOrder() {
+  while (!callback_order_.IsEmpty() &&
+         !idle_tasks_.Contains(callback_order_.front())) {
+    callback_order_.pop_front();
+  }
+}
+
+bool ScriptedIdleTaskController::ShouldPackCallbacks() const {
+  if (!RuntimeEnabledFeatures::PackIdleCallbacksEnabled())
+    return false;
+  auto* window = DynamicTo<LocalDOMWindow>(GetExecutionContext());
+  return !window || !window->document()->hidden();
 }
 
 void ScriptedIdleTaskController::RunCallback(
@@ -212,8 +267,14 @@ void ScriptedIdleTaskController::RunCallback(
       "FireIdleCallback", inspector_idle_callback_fire_event::Data,
       GetExecutionContext(), id, allotted_time.InMillisecondsF(),
       callback_type == IdleDeadline::CallbackType::kCalledByTimeout);
+  base::TimeTicks start_time = base::TimeTicks::Now();
   idle_task->invoke(MakeGarbageCollected<IdleDeadline>(
       deadline, cross_origin_isolated_capability, callback_type));
+  base::TimeDelta duration = base::TimeTicks::Now() - start_time;
+  typical_callback_duration_ =
+      typical_callback_duration_
+          ? (*typical_callback_duration_ * 3 + duration) / 4
+          : duration;
 
   // Finally there is no need to keep the idle task alive.
   //
@@ -223,6 +284,7 @@ void ScriptedIdleTaskController::RunCallback(
 
 void ScriptedIdleTaskController::ContextDestroyed() {
   idle_tasks_.clear();
+  callback_order_.clear();
 }
 
 void ScriptedIdleTaskController::ContextLifecycleStateChanged(
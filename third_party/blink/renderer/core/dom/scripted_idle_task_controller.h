@@ -5,6 +5,7 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_DOM_SCRIPTED_IDLE_TASK_CONTROLLER_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_DOM_SCRIPTED_IDLE_TASK_CONTROLLER_H_
 
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_idle_request_callback.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/dom/idle_deadline.h"
@@ -14,6 +15,7 @@
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 #include "third_party/blink/renderer/platform/timer.h"
+#include "third_party/blink/renderer/platform/wtf/deque.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace blink {
@@ -110,9 +112,25 @@ class CORE_EXPORT ScriptedIdleTaskController
                    base::TimeTicks deadline,
                    IdleDeadline::CallbackType);
 
+  // Runs |pending_callbacks|, oldest first, in the rest of the idle period
+  // ending at |deadline|, as long as the typical callback duration still fits,
+  // instead of waiting for an idle task each.
+  void RunPackedCallbacks(const Vector<CallbackId>& pending_callbacks,
+                          base::TimeTicks deadline);
+  // Drops callbacks that already ran or were cancelled from the front of
+  // |callback_order_|.
+  void DropFinishedCallbacksFromOrder();
+  // Callbacks of hidden documents get an idle period each.
+  bool ShouldPackCallbacks() const;
+
   ThreadScheduler* scheduler_;  // Not owned.
   HeapHashMap<CallbackId, Member<IdleTask>> idle_tasks_;
   Vector<CallbackId> pending_timeouts_;
+  // The registered callbacks in registration order. May include callbacks
+  // that already ran or were cancelled.
+  Deque<CallbackId> callback_order_;
+  // A moving average of how long callbacks run, once any ran.
+  absl::optional<base::TimeDelta> typical_callback_duration_;
   CallbackId next_callback_id_;
   bool paused_;
 };
@@ -89,6 +89,9 @@ class MockScriptedIdleTaskControllerScheduler final : public ThreadScheduler {
   void SetV8Isolate(v8::Isolate* isolate) override {}
 
   void RunIdleTask() { std::move(idle_task_).Run(base::TimeTicks()); }
+  void RunIdleTaskWithDeadline(base::TimeTicks deadline) {
+    std::move(idle_task_).Run(deadline);
+  }
   bool HasIdleTask() const { return !!idle_task_; }
 
   void AdvanceTimeAndRun(base::TimeDelta delta) {
@@ -194,4 +197,57 @@ TEST_F(ScriptedIdleTaskControllerTest, RunCallbacksAsyncWhenUnpaused) {
   testing::Mock::VerifyAndClearExpectations(idle_task);
 }
 
+TEST_F(ScriptedIdleTaskControllerTest, PackCallbacksIntoIdlePeriod) {
+  MockScriptedIdleTaskControllerScheduler scheduler(ShouldYield(false));
+  ScopedSchedulerOverrider scheduler_overrider(&scheduler);
+  ScriptedIdleTaskController* controller =
+      ScriptedIdleTaskController::Create(execution_context_);
+  IdleRequestOptions* options = IdleRequestOptions::Create();
+  const base::TimeTicks far_deadline = base::TimeTicks::Now() + base::Hours(1);
+
+  // The first callback runs alone, as there is no typical duration yet.
+  Persistent<MockIdleTask> first_task(MakeGarbageCollected<MockIdleTask>());
+  controller->RegisterCallback(first_task, options);
+  EXPECT_CALL(*first_task, invoke(testing::_));
+  scheduler.RunIdleTaskWithDeadline(far_deadline);
+  testing::Mock::VerifyAndClearExpectations(first_task);
+
+  // Without idle time left, only the callback of the idle task runs.
+  Persistent<MockIdleTask> second_task(MakeGarbageCollected<MockIdleTask>());
+  Persistent<MockIdleTask> third_task(MakeGarbageCollected<MockIdleTask>());
+  controller->RegisterCallback(second_task, options);
+  controller->RegisterCallback(third_task, options);
+  EXPECT_CALL(*second_task, invoke(testing::_)).Times(0);
+  EXPECT_CALL(*third_task, invoke(testing::_));
+  scheduler.RunIdleTask();
+  testing::Mock::VerifyAndClearExpectations(second_task);
+  testing::Mock::VerifyAndClearExpectations(third_task);
+
+  // With idle time left, the pending callback runs in the same idle period.
+  Persistent<MockIdleTask> fourth_task(MakeGarbageCollected<MockIdleTask>());
+  controller->RegisterCallback(fourth_task, options);
+  EXPECT_CALL(*second_task, invoke(testing::_));
+  EXPECT_CALL(*fourth_task, invoke(testing::_));
+  scheduler.RunIdleTaskWithDeadline(far_deadline);
+  testing::Mock::VerifyAndClearExpectations(second_task);
+  testing::Mock::VerifyAndClearExpectations(fourth_task);
+
+  // A callback registered during the idle period waits for the next one.
+  Persistent<MockIdleTask> fifth_task(MakeGarbageCollected<MockIdleTask>());
+  Persistent<MockIdleTask> sixth_task(MakeGarbageCollected<MockIdleTask>());
+  controller->RegisterCallback(fifth_task, options);
+  EXPECT_CALL(*fifth_task, invoke(testing::_))
+      .WillOnce([&](IdleDeadline*) {
+        controller->RegisterCallback(sixth_task, options);
+      });
+  EXPECT_CALL(*sixth_task, invoke(testing::_)).Times(0);
+  scheduler.RunIdleTaskWithDeadline(far_deadline);
+  testing::Mock::VerifyAndClearExpectations(fifth_task);
+  testing::Mock::VerifyAndClearExpectations(sixth_task);
+
+  EXPECT_CALL(*sixth_task, invoke(testing::_));
+  scheduler.RunIdleTaskWithDeadline(far_deadline);
+  testing::Mock::VerifyAndClearExpectations(sixth_task);
+}
+
 }  // namespace blink
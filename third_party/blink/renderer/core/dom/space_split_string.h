@@ -36,6 +36,12 @@ class CORE_EXPORT SpaceSplitString {
   SpaceSplitString() = default;
   explicit SpaceSplitString(const AtomicString& string) { Set(string); }
 
+  // These compare the shared data, not the tokens. Lists set from equal
+  // strings share their data, but lists built up with Add() or Remove() may
+  // compare different even if their tokens are equal.
+  bool operator==(const SpaceSplitString& other) const {
+    return data_ == other.data_;
+  }
   bool operator!=(const SpaceSplitString& other) const {
     return data_ != other.data_;
   }
@@ -33,9 +33,12 @@
 #include "third_party/blink/public/platform/task_type.h"
 #include "third_party/blink/renderer/bindings/core/v8/scheduled_action.h"
 #include "third_party/blink/renderer/core/execution_context/execution_context.h"
+#include "third_party/blink/renderer/core/frame/local_dom_window.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/core/inspector/inspector_trace_events.h"
 #include "third_party/blink/renderer/core/probe/core_probes.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/scheduler/public/scheduling_policy.h"
 
 namespace blink {
@@ -49,6 +52,16 @@ namespace {
 constexpr int kMaxTimerNestingLevel = 5;
 constexpr base::TimeDelta kMinimumInterval = base::Milliseconds(4);
 
+// Timers of frames tagged as ads (see AdTracker) are mostly analytics and
+// polling loops, which need no precise wake-ups. Letting their short timers be
+// aligned too saves the CPU wake-ups of hundreds of timers on ad-heavy pages.
+bool ShouldAlignShortTimers(ExecutionContext* context) {
+  if (!RuntimeEnabledFeatures::AlignAdFrameTimersEnabled())
+    return false;
+  auto* window = DynamicTo<LocalDOMWindow>(context);
+  return window && window->GetFrame() && window->GetFrame()->IsAdSubframe();
+}
+
 }  // namespace
 
 int DOMTimer::Install(ExecutionContext* context,
@@ -101,7 +114,8 @@ DOMTimer::DOMTimer(ExecutionContext* context,
   // is small, to avoid being affected by ongoing experiments on delay clamping
   // MaxUnthrottledTimeoutNestingLevel and SetTimeoutZeroWithoutClamping.
   // TODO(1153139) Remove this logic one experiments have shipped.
-  bool precise = (timeout < kMinimumInterval) ||
+  bool precise = (timeout < kMinimumInterval &&
+                  !ShouldAlignShortTimers(context)) ||
                  scheduler::IsAlignWakeUpsDisabledForProcess();
 
   if (nesting_level_ >= max_nesting_level && timeout < kMinimumInterval)
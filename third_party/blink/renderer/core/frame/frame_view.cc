@@ -8,13 +8,17 @@
 #include "third_party/blink/renderer/core/frame/frame_client.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/core/frame/remote_frame.h"
+#include "third_party/blink/renderer/core/frame/settings.h"
 #include "third_party/blink/renderer/core/html/html_frame_owner_element.h"
 #include "third_party/blink/renderer/core/intersection_observer/intersection_geometry.h"
 #include "third_party/blink/renderer/core/intersection_observer/intersection_observer.h"
 #include "third_party/blink/renderer/core/layout/layout_embedded_content.h"
 #include "third_party/blink/renderer/core/layout/layout_view.h"
+#include "third_party/blink/renderer/core/page/focus_controller.h"
 #include "third_party/blink/renderer/core/page/page.h"
 #include "third_party/blink/renderer/core/page/page_animator.h"
+#include "third_party/blink/renderer/platform/geometry/length.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "ui/gfx/geometry/rect_conversions.h"
 #include "ui/gfx/geometry/transform.h"
 
@@ -85,6 +89,7 @@ void FrameView::UpdateViewportIntersection(unsigned flags,
   LayoutEmbeddedContent* owner_layout_object =
       owner_element->GetLayoutEmbeddedContent();
   bool display_locked_in_parent_frame = DisplayLockedInParentFrame();
+  bool geometry_is_clean = false;
   if (!owner_layout_object || owner_layout_object->ContentSize().IsEmpty() ||
       (flags & IntersectionObservation::kAncestorFrameIsDetachedFromLayout) ||
       display_locked_in_parent_frame) {
@@ -95,6 +100,7 @@ void FrameView::UpdateViewportIntersection(unsigned flags,
     occlusion_state = mojom::blink::FrameOcclusionState::kPossiblyOccluded;
   } else if (parent_lifecycle_state >= DocumentLifecycle::kLayoutClean &&
              !owner_document.View()->NeedsLayout()) {
+    geometry_is_clean = true;
     unsigned geometry_flags =
         IntersectionGeometry::kShouldUseReplacedContentRect;
     if (should_compute_occlusion)
@@ -240,17 +246,44 @@ void FrameView::UpdateViewportIntersection(unsigned flags,
   // We don't throttle display:none iframes unless they are cross-origin and
   // ThrottleCrossOriginIframes is enabled, because in practice they are
   // sometimes used to drive UI logic. Zero-area iframes are only throttled if
-  // they are also display:none.
+  // they are also display:none, or if the throttleZeroAreaCrossOriginFrames
+  // setting is on. Only cross-origin frames are throttled for being hidden,
+  // see LocalFrameView::CanThrottleRendering().
   bool zero_viewport_intersection = viewport_intersection.IsEmpty();
   bool is_display_none = !owner_layout_object;
-  bool has_zero_area = FrameRect().IsEmpty();
+  Settings* settings = GetFrame().GetSettings();
+  bool exempt_zero_area =
+      FrameRect().IsEmpty() &&
+      !(settings && settings->GetThrottleZeroAreaCrossOriginFrames());
   bool has_flag = RuntimeEnabledFeatures::
       ThrottleDisplayNoneAndVisibilityHiddenCrossOriginIframesEnabled();
 
   bool should_throttle =
       has_flag
-          ? (is_display_none || (zero_viewport_intersection && !has_zero_area))
-          : (!is_display_none && zero_viewport_intersection && !has_zero_area);
+          ? (is_display_none ||
+             (zero_viewport_intersection && !exempt_zero_area))
+          : (!is_display_none && zero_viewport_intersection &&
+             !exempt_zero_area);
+
+  // Same-origin frames are only throttled for being hidden when they are also
+  // far from the viewport, see LocalFrameView::CanThrottleRendering(). A frame
+  // with focus may be receiving keyboard input, so it is never far.
+  if (RuntimeEnabledFeatures::ThrottleFarOffscreenSameOriginIframesEnabled() &&
+      (geometry_is_clean || !should_throttle)) {
+    bool far_from_viewport = false;
+    if (should_throttle && owner_layout_object) {
+      Page* page = frame.GetPage();
+      if (!page || page->GetFocusController().FocusedFrame() != &frame) {
+        IntersectionGeometry far_geometry(
+            nullptr, *owner_element,
+            Vector<Length>(4, Length::Percent(kFarFromViewportMarginPercent)),
+            {IntersectionObserver::kMinimumThreshold}, {} /* target_margin */,
+            IntersectionGeometry::kShouldUseReplacedContentRect);
+        far_from_viewport = !far_geometry.IsIntersecting();
+      }
+    }
+    SetFarFromViewport(far_from_viewport);
+  }
 
   bool subtree_throttled = false;
   Frame* parent_frame = GetFrame().Tree().Parent();
@@ -69,10 +69,16 @@ class CORE_EXPORT FrameView : public EmbeddedContentView {
   bool RectInParentIsStable(const base::TimeTicks& timestamp) const;
 
  protected:
+  static constexpr float kFarFromViewportMarginPercent = 100;
+
   virtual bool NeedsViewportOffset() const { return false; }
   virtual void SetViewportIntersection(
       const mojom::blink::ViewportIntersectionState& intersection_state) = 0;
   virtual void VisibilityForThrottlingChanged() = 0;
+  // Called with whether the frame is hidden and at least
+  // kFarFromViewportMarginPercent of the viewport away from it, for
+  // ThrottleFarOffscreenSameOriginIframes.
+  virtual void SetFarFromViewport(bool far_from_viewport) {}
   virtual bool LifecycleUpdatesThrottled() const { return false; }
   void UpdateViewportIntersection(unsigned, bool);
   // FrameVisibility is tracked by the browser process, which may suppress
@@ -14,6 +14,7 @@
 #include "cc/metrics/begin_main_frame_metrics.h"
 #include "services/metrics/public/cpp/metrics_utils.h"
 #include "services/metrics/public/cpp/ukm_builders.h"
+#include "services/metrics/public/cpp/ukm_entry_builder.h"
 #include "services/metrics/public/cpp/ukm_recorder.h"
 #include "third_party/blink/public/common/metrics/document_update_reason.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
@@ -175,6 +176,7 @@ LocalFrameUkmAggregator::LocalFrameUkmAggregator(int64_t source_id,
 
 LocalFrameUkmAggregator::~LocalFrameUkmAggregator() {
   ReportUpdateTimeEvent();
+  ReportLongTaskEvents();
 }
 
 LocalFrameUkmAggregator::ScopedUkmHierarchicalTimer
@@ -250,6 +252,11 @@ void LocalFrameUkmAggregator::RecordTimerSample(size_t metric_index,
 
 void LocalFrameUkmAggregator::RecordCountSample(size_t metric_index,
                                                 int64_t count) {
+  // The lifetime total is kept for every sample, as long tasks are attributed
+  // from it.
+  DCHECK_LT(metric_index, std::size(absolute_metric_records_));
+  absolute_metric_records_[metric_index].total_count += count;
+
   static base::CpuReductionExperimentFilter filter;
   if (!filter.ShouldLogHistograms())
     return;
@@ -280,6 +287,24 @@ void LocalFrameUkmAggregator::RecordCountSample(size_t metric_index,
   }
 }
 
+void LocalFrameUkmAggregator::RecordLongTask(const LongTaskRecord& record) {
+  wtf_size_t index = 0;
+  while (index < long_tasks_.size() &&
+         long_tasks_[index].duration >= record.duration) {
+    ++index;
+  }
+  if (index == kMaxLongTasks)
+    return;
+  if (long_tasks_.size() == kMaxLongTasks)
+    long_tasks_.pop_back();
+  long_tasks_.insert(index, record);
+}
+
+base::TimeDelta LocalFrameUkmAggregator::TotalTime(size_t metric_index) const {
+  DCHECK_LT(metric_index, std::size(absolute_metric_records_));
+  return base::Microseconds(absolute_metric_records_[metric_index].total_count);
+}
+
 void LocalFrameUkmAggregator::RecordForcedLayoutSample(
     DocumentUpdateReason reason,
     base::TimeTicks start,
@@ -301,6 +326,7 @@ void LocalFrameUkmAggregator::RecordForcedLayoutSample(
   auto& record =
       absolute_metric_records_[static_cast<size_t>(kForcedStyleAndLayout)];
   record.interval_count += count;
+  record.total_count += count;
   if (in_main_frame_update_)
     record.main_frame_count += count;
   if (is_pre_fcp)
@@ -613,6 +639,27 @@ void LocalFrameUkmAggregator::ReportUpdateTimeEvent() {
   frames_since_last_report_ = 0;
 }
 
+void LocalFrameUkmAggregator::ReportLongTaskEvents() {
+  auto bucket = [](base::TimeDelta time) {
+    return ukm::GetExponentialBucketMinForUserTiming(time.InMilliseconds());
+  };
+  for (wtf_size_t rank = 0; rank < long_tasks_.size(); ++rank) {
+    const LongTaskRecord& record = long_tasks_[rank];
+    ukm::UkmEntryBuilder builder(source_id_, "Kiwi.LongTask");
+    builder.SetMetric("Rank", rank);
+    builder.SetMetric("Duration", bucket(record.duration));
+    builder.SetMetric("Style", bucket(record.style));
+    builder.SetMetric("Layout", bucket(record.layout));
+    builder.SetMetric("Paint", bucket(record.paint));
+    builder.SetMetric("Script", bucket(record.script));
+    builder.SetMetric("Blocker", bucket(record.blocker));
+    builder.SetMetric("HasIsolatedWorldScript",
+                      record.has_isolated_world_script);
+    builder.Record(recorder_);
+  }
+  long_tasks_.clear();
+}
+
 void LocalFrameUkmAggregator::ResetAllMetrics() {
   primary_metric_.reset();
   for (auto& record : absolute_metric_records_)
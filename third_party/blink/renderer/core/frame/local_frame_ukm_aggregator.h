@@ -11,6 +11,7 @@
 #include "third_party/blink/renderer/platform/instrumentation/histogram.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace base {
 class TickClock;
@@ -160,6 +161,23 @@ class CORE_EXPORT LocalFrameUkmAggregator
   // exponential bucketing.
   static int64_t ApplyBucketIfNecessary(int64_t value, unsigned metric_id);
 
+  // The time a long task of the local frame tree spent in each of its
+  // phases, as seen by PerformanceMonitor. |script| includes the style and
+  // layout forced by script, and |blocker| is the time of the content
+  // blocking checks made during the task.
+  struct LongTaskRecord {
+    base::TimeDelta duration;
+    base::TimeDelta style;
+    base::TimeDelta layout;
+    base::TimeDelta paint;
+    base::TimeDelta script;
+    base::TimeDelta blocker;
+    bool has_isolated_world_script = false;
+  };
+
+  // The number of longest tasks that are reported per aggregator.
+  static constexpr wtf_size_t kMaxLongTasks = 5;
+
   typedef struct MetricInitializationData {
     const char* const name;
     bool has_uma;
@@ -289,6 +307,15 @@ class CORE_EXPORT LocalFrameUkmAggregator
   // Record a sample for a count-based sub-metric.
   void RecordCountSample(size_t metric_index, int64_t count);
 
+  // Keeps |record| if it is one of the kMaxLongTasks longest tasks so far.
+  // They are reported as "Kiwi.LongTask" UKM events when the aggregator is
+  // destroyed.
+  void RecordLongTask(const LongTaskRecord& record);
+
+  // The time recorded for the |metric_index| timer since the aggregator was
+  // created, not reset at the end of each frame.
+  base::TimeDelta TotalTime(size_t metric_index) const;
+
   // Record a ForcedLayout sample. The reason will determine which, if any,
   // additional metrics are reported in order to diagnose the cause of
   // ForcedLayout regressions.
@@ -326,6 +353,7 @@ class CORE_EXPORT LocalFrameUkmAggregator
   std::unique_ptr<cc::BeginMainFrameMetrics> GetBeginMainFrameMetrics();
 
   bool IsBeforeFCPForTesting() const;
+  wtf_size_t LongTaskCountForTesting() const { return long_tasks_.size(); }
 
  private:
   struct AbsoluteMetricRecord {
@@ -344,6 +372,9 @@ class CORE_EXPORT LocalFrameUkmAggregator
     // Accumulated at each sample up to the time of First Contentful Paint.
     int64_t pre_fcp_aggregate = 0;
 
+    // Accumulated at each sample for the lifetime of the aggregator.
+    int64_t total_count = 0;
+
     void reset();
   };
 
@@ -364,6 +395,9 @@ class CORE_EXPORT LocalFrameUkmAggregator
   // the frame count.
   void ReportUpdateTimeEvent();
 
+  // Reports the kept long tasks, longest first. Called at destruction.
+  void ReportLongTaskEvents();
+
   // Reports the Blink.PageLoad to the UKM system. Called on the first main
   // frame after First Contentful Paint.
   void ReportPreFCPEvent();
@@ -398,6 +432,9 @@ class CORE_EXPORT LocalFrameUkmAggregator
   SampleToRecord current_sample_;
   unsigned frames_since_last_report_ = 0;
 
+  // The longest tasks so far, longest first.
+  Vector<LongTaskRecord, kMaxLongTasks> long_tasks_;
+
   // Control for the ForcedStyleAndUpdate UMA metric sampling
   unsigned mean_calls_between_forced_style_layout_uma_ = 500;
   unsigned calls_to_next_forced_style_layout_uma_ = 0;
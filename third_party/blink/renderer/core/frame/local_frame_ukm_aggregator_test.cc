@@ -9,6 +9,7 @@
 #include "base/test/test_mock_time_task_runner.h"
 #include "cc/metrics/begin_main_frame_metrics.h"
 #include "components/ukm/test_ukm_recorder.h"
+#include "services/metrics/public/cpp/metrics_utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/public/common/metrics/document_update_reason.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_intersection_observer_init.h"
@@ -572,6 +573,39 @@ TEST_F(LocalFrameUkmAggregatorTest, IterativeTimer) {
   EXPECT_EQ(GetIntervalCount(LocalFrameUkmAggregator::kPrePaint), 13);
 }
 
+TEST_F(LocalFrameUkmAggregatorTest, LongTasksAreRecorded) {
+  // Tasks of 50ms to 350ms, recorded out of order.
+  for (int i : {3, 1, 7, 5, 2, 6, 4}) {
+    LocalFrameUkmAggregator::LongTaskRecord record;
+    record.duration = base::Milliseconds(50 * i);
+    record.script = base::Milliseconds(40 * i);
+    record.has_isolated_world_script = i == 7;
+    aggregator().RecordLongTask(record);
+  }
+  EXPECT_EQ(LocalFrameUkmAggregator::kMaxLongTasks,
+            aggregator().LongTaskCountForTesting());
+  EXPECT_EQ(0u, recorder().GetEntriesByName("Kiwi.LongTask").size());
+
+  // Only the longest tasks are reported, longest first, at destruction.
+  ResetAggregator();
+  auto entries = recorder().GetEntriesByName("Kiwi.LongTask");
+  ASSERT_EQ(LocalFrameUkmAggregator::kMaxLongTasks, entries.size());
+  for (wtf_size_t rank = 0; rank < entries.size(); ++rank) {
+    const int i = 7 - static_cast<int>(rank);
+    EXPECT_EQ(static_cast<int64_t>(rank),
+              *ukm::TestUkmRecorder::GetEntryMetric(entries[rank], "Rank"));
+    EXPECT_EQ(ukm::GetExponentialBucketMinForUserTiming(50 * i),
+              *ukm::TestUkmRecorder::GetEntryMetric(entries[rank],
+                                                    "Duration"));
+    EXPECT_EQ(ukm::GetExponentialBucketMinForUserTiming(40 * i),
+              *ukm::TestUkmRecorder::GetEntryMetric(entries[rank], "Script"));
+    EXPECT_EQ(0, *ukm::TestUkmRecorder::GetEntryMetric(entries[rank],
+                                                       "Blocker"));
+    EXPECT_EQ(i == 7 ? 1 : 0, *ukm::TestUkmRecorder::GetEntryMetric(
+                                  entries[rank], "HasIsolatedWorldScript"));
+  }
+}
+
 class LocalFrameUkmAggregatorSimTest : public SimTest {
  protected:
   void ChooseNextFrameForTest() {
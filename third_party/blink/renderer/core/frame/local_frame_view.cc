@@ -35,6 +35,7 @@
 #include "base/feature_list.h"
 #include "base/memory/ptr_util.h"
 #include "base/metrics/field_trial_params.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/numerics/safe_conversions.h"
 #include "base/timer/lap_timer.h"
 #include "base/trace_event/typed_macros.h"
@@ -234,6 +235,34 @@ gfx::QuadF GetQuadForTimelinePaintEvent(const scoped_refptr<cc::Layer>& layer) {
 // has updated the url display.
 constexpr int kCommitDelayDefaultInMs = 500;  // 30 frames @ 60hz
 
+// Whether the height of the fixed-position box |object| is independent of the
+// viewport height. A content-sized header or bottom bar, for instance, only
+// has to move when browser controls show or hide.
+bool FixedPositionHeightIsIndependentOfViewport(const LayoutObject& object) {
+  const ComputedStyle& style = object.StyleRef();
+  if (!style.Top().IsAuto() && !style.Bottom().IsAuto())
+    return false;
+  if (!(style.MinHeight().IsFixed() || style.MinHeight().IsAuto()) ||
+      !(style.MaxHeight().IsFixed() || style.MaxHeight().IsNone())) {
+    return false;
+  }
+  if (style.Height().IsFixed())
+    return true;
+  if (!style.Height().IsAuto())
+    return false;
+  // The content height of a vertical box, or of a horizontal one holding an
+  // orthogonal flow, comes from an inline size that falls back to the
+  // viewport height.
+  if (!style.IsHorizontalWritingMode())
+    return false;
+  for (const LayoutObject* descendant = object.SlowFirstChild(); descendant;
+       descendant = descendant->NextInPreOrder(&object)) {
+    if (!descendant->StyleRef().IsHorizontalWritingMode())
+      return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 // The maximum number of updatePlugins iterations that should be done before
@@ -454,6 +483,8 @@ void LocalFrameView::ForAllRemoteFrameViews(
 void LocalFrameView::Dispose() {
   CHECK(!IsInPerformLayout());
 
+  RecordFarFromViewportSkippedUpdates();
+
   // TODO(dcheng): It's wrong that the frame can be detached before the
   // LocalFrameView. Figure out what's going on and fix LocalFrameView to be
   // disposed with the correct timing.
@@ -1306,8 +1337,7 @@ void LocalFrameView::MarkFixedPositionObjectsForLayout(bool width_changed,
       }
     }
     if (height_changed) {
-      if (style.Height().IsFixed() &&
-          (style.Top().IsAuto() || style.Bottom().IsAuto())) {
+      if (FixedPositionHeightIsIndependentOfViewport(*layout_object)) {
         layout_object->SetNeedsPositionedMovementLayout();
       } else {
         layout_object->SetNeedsLayoutAndFullPaintInvalidation(
@@ -2902,8 +2932,11 @@ bool LocalFrameView::PaintTree(PaintBenchmarkMode benchmark_mode,
       // Use post-order to ensure correct flag propagation for nested frames.
       kPostOrder);
 
-  ForAllThrottledLocalFrameViews(
-      [](LocalFrameView& frame_view) { frame_view.MarkIneligibleToPaint(); });
+  ForAllThrottledLocalFrameViews([](LocalFrameView& frame_view) {
+    frame_view.MarkIneligibleToPaint();
+    if (frame_view.IsThrottledAsFarFromViewport())
+      ++frame_view.far_from_viewport_skipped_updates_;
+  });
 
   bool repainted = false;
   bool needs_clear_repaint_flags = false;
@@ -4526,7 +4559,39 @@ bool LocalFrameView::CanThrottleRendering() const {
   // cross-origin frames must already communicate with asynchronous messages,
   // so they should be able to tolerate some delay in receiving replies from a
   // throttled peer.
-  return IsHiddenForThrottling() && frame_->IsCrossOriginToNearestMainFrame();
+  //
+  // With ThrottleFarOffscreenSameOriginIframes, same-origin frames are also
+  // throttled when they are far enough from the viewport that they will not be
+  // scrolled into view in the next few frames. Script forced style and layout
+  // still run in them, as throttling only applies to lifecycle updates.
+  return IsHiddenForThrottling() &&
+         (frame_->IsCrossOriginToNearestMainFrame() || far_from_viewport_);
+}
+
+bool LocalFrameView::IsThrottledAsFarFromViewport() const {
+  return far_from_viewport_ && IsHiddenForThrottling() &&
+         !lifecycle_updates_throttled_ && !IsSubtreeThrottled() &&
+         !IsDisplayLocked() && !frame_->IsCrossOriginToNearestMainFrame();
+}
+
+void LocalFrameView::SetFarFromViewport(bool far_from_viewport) {
+  if (far_from_viewport_ == far_from_viewport)
+    return;
+  bool was_throttled = CanThrottleRendering();
+  far_from_viewport_ = far_from_viewport;
+  if (!far_from_viewport_)
+    RecordFarFromViewportSkippedUpdates();
+  if (was_throttled != CanThrottleRendering())
+    RenderThrottlingStatusChanged();
+}
+
+void LocalFrameView::RecordFarFromViewportSkippedUpdates() {
+  if (!far_from_viewport_skipped_updates_)
+    return;
+  UMA_HISTOGRAM_COUNTS_10000(
+      "Blink.RenderThrottling.FarFromViewportSkippedUpdates",
+      far_from_viewport_skipped_updates_);
+  far_from_viewport_skipped_updates_ = 0;
 }
 
 void LocalFrameView::UpdateRenderThrottlingStatus(bool hidden_for_throttling,
@@ -4698,6 +4763,10 @@ LocalFrameUkmAggregator& LocalFrameView::EnsureUkmAggregator() {
   return *local_root->ukm_aggregator_;
 }
 
+LocalFrameUkmAggregator* LocalFrameView::ExistingUkmAggregator() {
+  return frame_->LocalFrameRoot().View()->ukm_aggregator_.get();
+}
+
 void LocalFrameView::ResetUkmAggregatorForTesting() {
   ukm_aggregator_.reset();
 }
@@ -745,6 +745,8 @@ class CORE_EXPORT LocalFrameView final
   // features::kLocalFrameRootPrePostFCPMetrics is enabled, creating it if
   // necessary.
   LocalFrameUkmAggregator& EnsureUkmAggregator();
+  // Like EnsureUkmAggregator(), but returns null instead of creating it.
+  LocalFrameUkmAggregator* ExistingUkmAggregator();
   void ResetUkmAggregatorForTesting();
 
   // Report the First Contentful Paint signal to the LocalFrameView.
@@ -804,6 +806,7 @@ class CORE_EXPORT LocalFrameView final
   void SetViewportIntersection(const mojom::blink::ViewportIntersectionState&
                                    intersection_state) override {}
   void VisibilityForThrottlingChanged() override;
+  void SetFarFromViewport(bool far_from_viewport) override;
   bool LifecycleUpdatesThrottled() const override {
     return lifecycle_updates_throttled_;
   }
@@ -940,6 +943,13 @@ class CORE_EXPORT LocalFrameView final
   void RunIntersectionObserverSteps();
   void RenderThrottlingStatusChanged();
 
+  // Whether the frame is same-origin to its nearest main frame and throttled
+  // only because it is far from the viewport.
+  bool IsThrottledAsFarFromViewport() const;
+  // Records how many paint lifecycle updates were skipped while the frame was
+  // throttled as far from the viewport, and resets the count.
+  void RecordFarFromViewportSkippedUpdates();
+
   // Methods to do point conversion via layoutObjects, in order to take
   // transforms into account.
   gfx::Rect ConvertToContainingEmbeddedContentView(const gfx::Rect&) const;
@@ -1122,6 +1132,10 @@ class CORE_EXPORT LocalFrameView final
   // updates (after render-blocking resources have loaded).
   bool lifecycle_updates_throttled_;
 
+  // See FrameView::SetFarFromViewport().
+  bool far_from_viewport_ = false;
+  int far_from_viewport_skipped_updates_ = 0;
+
   // Used by AllowThrottlingScope and DisallowThrottlingScope
   bool allow_throttling_ = false;
   // Used by ForceThrottlingScope
@@ -23,6 +23,7 @@
 #include "third_party/blink/renderer/core/testing/sim/sim_request.h"
 #include "third_party/blink/renderer/core/testing/sim/sim_test.h"
 #include "third_party/blink/renderer/platform/graphics/paint/paint_artifact.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
 #include "ui/gfx/geometry/size.h"
 
@@ -121,6 +122,35 @@ TEST_F(LocalFrameViewTest, SetPaintInvalidationOutOfUpdateAllLifecyclePhases) {
   EXPECT_FALSE(GetAnimationMockChromeClient().has_scheduled_animation_);
 }
 
+TEST_F(LocalFrameViewTest, ViewportHeightChangeOnlyMovesContentSizedFixed) {
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      div { position: fixed; left: 0; width: 100px; }
+    </style>
+    <div id="header" style="top: 0">Header</div>
+    <div id="bottom-bar" style="bottom: 0; height: 50px">Bottom bar</div>
+    <div id="stretched" style="top: 0; bottom: 0"></div>
+    <div id="min-height" style="top: 0; min-height: 50%"></div>
+    <div id="vertical" style="top: 0; writing-mode: vertical-rl">Vertical</div>
+    <div id="orthogonal" style="top: 0">
+      <span style="display: block; writing-mode: vertical-rl">Orthogonal</span>
+    </div>
+  )HTML");
+
+  GetDocument().View()->ViewportSizeChanged(false, true);
+  auto* header = GetLayoutObjectByElementId("header");
+  EXPECT_TRUE(header->NeedsPositionedMovementLayout());
+  EXPECT_FALSE(header->SelfNeedsLayout());
+  auto* bottom_bar = GetLayoutObjectByElementId("bottom-bar");
+  EXPECT_TRUE(bottom_bar->NeedsPositionedMovementLayout());
+  EXPECT_FALSE(bottom_bar->SelfNeedsLayout());
+  EXPECT_TRUE(GetLayoutObjectByElementId("stretched")->SelfNeedsLayout());
+  EXPECT_TRUE(GetLayoutObjectByElementId("min-height")->SelfNeedsLayout());
+  // The content height of vertical text depends on the viewport height.
+  EXPECT_TRUE(GetLayoutObjectByElementId("vertical")->SelfNeedsLayout());
+  EXPECT_TRUE(GetLayoutObjectByElementId("orthogonal")->SelfNeedsLayout());
+}
+
 // If we don't hide the tooltip on scroll, it can negatively impact scrolling
 // performance. See crbug.com/586852 for details.
 TEST_F(LocalFrameViewTest, HideTooltipWhenScrollPositionChanges) {
@@ -522,6 +552,84 @@ TEST_F(LocalFrameViewSimTest, CrossOriginPaintEligibility) {
   EXPECT_TRUE(frame_timing.FirstEligibleToPaint().is_null());
 }
 
+TEST_F(LocalFrameViewSimTest, FarOffscreenSameOriginFrameIsThrottled) {
+  ScopedThrottleFarOffscreenSameOriginIframesForTest throttle_far_frames(true);
+  WebView().MainFrameViewWidget()->Resize(gfx::Size(800, 600));
+  SimRequest resource("https://example.com/", "text/html");
+
+  LoadURL("https://example.com/");
+  resource.Complete(R"HTML(
+      <iframe id=near srcdoc="<p>Hello</p>"
+        style="position:absolute;top:700px;left:0">
+      </iframe>
+      <iframe id=far srcdoc="<p>Hello</p>"
+        style="position:absolute;top:4000px;left:0">
+      </iframe>
+    )HTML");
+
+  Document* near_document =
+      To<HTMLIFrameElement>(GetDocument().getElementById("near"))
+          ->contentDocument();
+  Document* far_document =
+      To<HTMLIFrameElement>(GetDocument().getElementById("far"))
+          ->contentDocument();
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+
+  // Both frames are hidden, but only the one more than a viewport away is
+  // throttled.
+  EXPECT_FALSE(GetDocument().View()->ShouldThrottleRenderingForTest());
+  EXPECT_FALSE(near_document->View()->ShouldThrottleRenderingForTest());
+  EXPECT_TRUE(far_document->View()->ShouldThrottleRenderingForTest());
+
+  // Bringing the frame near the viewport unthrottles it.
+  GetDocument().getElementById("far")->setAttribute(html_names::kStyleAttr,
+                                                    "position:absolute;top:0");
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  EXPECT_FALSE(far_document->View()->ShouldThrottleRenderingForTest());
+}
+
+TEST_F(LocalFrameViewSimTest, ZeroAreaCrossOriginFrameIsThrottled) {
+  SimRequest resource("https://example.com/", "text/html");
+
+  LoadURL("https://example.com/");
+  resource.Complete(R"HTML(
+      <iframe id=frame srcdoc ="<p>Hello</p>" sandbox
+        style="width:0;height:0;border:0">
+      </iframe>
+    )HTML");
+
+  auto* frame_element =
+      To<HTMLIFrameElement>(GetDocument().getElementById("frame"));
+  auto* frame_document = frame_element->contentDocument();
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+
+  EXPECT_FALSE(GetDocument().View()->ShouldThrottleRenderingForTest());
+  EXPECT_TRUE(frame_document->View()->ShouldThrottleRenderingForTest());
+}
+
+TEST_F(LocalFrameViewSimTest, ZeroAreaCrossOriginFrameThrottlingSetting) {
+  WebView().GetPage()->GetSettings().SetThrottleZeroAreaCrossOriginFrames(
+      false);
+  SimRequest resource("https://example.com/", "text/html");
+
+  LoadURL("https://example.com/");
+  resource.Complete(R"HTML(
+      <iframe id=frame srcdoc ="<p>Hello</p>" sandbox
+        style="width:0;height:0;border:0">
+      </iframe>
+    )HTML");
+
+  auto* frame_element =
+      To<HTMLIFrameElement>(GetDocument().getElementById("frame"));
+  auto* frame_document = frame_element->contentDocument();
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+
+  EXPECT_FALSE(frame_document->View()->ShouldThrottleRenderingForTest());
+}
+
 TEST_F(LocalFrameViewSimTest, NestedCrossOriginPaintEligibility) {
   // Create a document with doubly nested iframes.
   SimRequest main_resource("https://example.com/", "text/html");
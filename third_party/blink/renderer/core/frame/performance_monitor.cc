@@ -5,6 +5,7 @@
 #include "third_party/blink/renderer/core/frame/performance_monitor.h"
 
 #include "base/format_macros.h"
+#include "base/rand_util.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/renderer/bindings/core/v8/scheduled_action.h"
 #include "third_party/blink/renderer/bindings/core/v8/source_location.h"
@@ -15,12 +16,28 @@
 #include "third_party/blink/renderer/core/frame/frame.h"
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/core/frame/local_frame_ukm_aggregator.h"
+#include "third_party/blink/renderer/core/frame/local_frame_view.h"
 #include "third_party/blink/renderer/core/html/parser/html_document_parser.h"
+#include "third_party/blink/renderer/core/loader/content_blocking_metrics.h"
 #include "third_party/blink/renderer/core/probe/core_probes.h"
+#include "third_party/blink/renderer/platform/bindings/dom_wrapper_world.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "v8/include/v8-metrics.h"
 
 namespace blink {
 
+namespace {
+
+// The fraction of local roots whose long tasks are attributed.
+constexpr double kLongTaskAttributionSampleRate = 0.1;
+
+// Tasks at least this long are attributed, as for the Long Tasks API.
+constexpr base::TimeDelta kLongTaskAttributionThreshold =
+    base::Milliseconds(50);
+
+}  // namespace
+
 // static
 base::TimeDelta PerformanceMonitor::Threshold(ExecutionContext* context,
                                               Violation violation) {
@@ -71,7 +88,11 @@ PerformanceMonitor* PerformanceMonitor::InstrumentingMonitorExcludingLongTasks(
 
 PerformanceMonitor::PerformanceMonitor(LocalFrame* local_root,
                                        v8::Isolate* isolate)
-    : local_root_(local_root), isolate_(isolate) {
+    : local_root_(local_root),
+      isolate_(isolate),
+      attribution_enabled_(
+          RuntimeEnabledFeatures::LongTaskAttributionEnabled() &&
+          base::RandDouble() < kLongTaskAttributionSampleRate) {
   std::fill(std::begin(thresholds_), std::end(thresholds_), base::TimeDelta());
   Thread::Current()->AddTaskTimeObserver(this);
   local_root_->GetProbeSink()->AddPerformanceMonitor(this);
@@ -110,6 +131,8 @@ void PerformanceMonitor::Shutdown() {
     return;
   subscriptions_.clear();
   UpdateInstrumentation();
+  // The task being processed, if any, will not be seen to finish.
+  StopTimingContentBlockingChecks();
   Thread::Current()->RemoveTaskTimeObserver(this);
   local_root_->GetProbeSink()->RemovePerformanceMonitor(this);
   local_root_ = nullptr;
@@ -171,15 +194,64 @@ void PerformanceMonitor::UpdateTaskShouldBeReported(LocalFrame* frame) {
     task_should_be_reported_ = true;
 }
 
+void PerformanceMonitor::UpdateTaskIsolatedWorld() {
+  if (isolate_->InContext() &&
+      DOMWrapperWorld::Current(isolate_).IsIsolatedWorld()) {
+    task_has_isolated_world_script_ = true;
+  }
+}
+
+base::TimeDelta PerformanceMonitor::TotalPaintTime() const {
+  LocalFrameView* view = local_root_->View();
+  LocalFrameUkmAggregator* aggregator =
+      view ? view->ExistingUkmAggregator() : nullptr;
+  if (!aggregator)
+    return base::TimeDelta();
+  return aggregator->TotalTime(LocalFrameUkmAggregator::kPrePaint) +
+         aggregator->TotalTime(LocalFrameUkmAggregator::kPaint);
+}
+
+void PerformanceMonitor::StopTimingContentBlockingChecks() {
+  if (!timing_content_blocking_checks_)
+    return;
+  task_blocker_time_ = ContentBlockingMetrics::CheckTimeOnMainThread() -
+                       task_blocker_time_at_start_;
+  ContentBlockingMetrics::StopTimingAllChecks();
+  timing_content_blocking_checks_ = false;
+}
+
+void PerformanceMonitor::RecordLongTaskAttribution(base::TimeDelta task_time) {
+  if (task_time < kLongTaskAttributionThreshold)
+    return;
+  LocalFrameView* view = local_root_->View();
+  if (!view)
+    return;
+  LocalFrameUkmAggregator::LongTaskRecord record;
+  record.duration = task_time;
+  record.style = task_style_time_;
+  record.layout = task_layout_time_;
+  record.script = task_script_time_;
+  // The aggregator starts over when the local root navigates, so the totals
+  // may have gone down since the task started.
+  record.paint =
+      std::max(base::TimeDelta(), TotalPaintTime() - task_paint_time_at_start_);
+  record.blocker = task_blocker_time_;
+  record.has_isolated_world_script = task_has_isolated_world_script_;
+  view->EnsureUkmAggregator().RecordLongTask(record);
+}
+
 void PerformanceMonitor::Will(const probe::RecalculateStyle& probe) {
   UpdateTaskShouldBeReported(probe.document ? probe.document->GetFrame()
                                             : nullptr);
-  if (enabled_ && !thresholds_[kLongLayout].is_zero() && script_depth_) {
+  if (attribution_enabled_ ||
+      (enabled_ && !thresholds_[kLongLayout].is_zero() && script_depth_)) {
     probe.CaptureStartTime();
   }
 }
 
 void PerformanceMonitor::Did(const probe::RecalculateStyle& probe) {
+  if (attribution_enabled_)
+    task_style_time_ += probe.Duration();
   if (enabled_ && script_depth_ && !thresholds_[kLongLayout].is_zero()) {
     per_task_style_and_layout_time_ += probe.Duration();
   }
@@ -189,37 +261,50 @@ void PerformanceMonitor::Will(const probe::UpdateLayout& probe) {
   UpdateTaskShouldBeReported(probe.document ? probe.document->GetFrame()
                                             : nullptr);
   ++layout_depth_;
-  if (!enabled_)
-    return;
-  if (layout_depth_ > 1 || !script_depth_ || thresholds_[kLongLayout].is_zero())
+  if (layout_depth_ > 1)
     return;
-
-  probe.CaptureStartTime();
+  if (attribution_enabled_ ||
+      (enabled_ && script_depth_ && !thresholds_[kLongLayout].is_zero())) {
+    probe.CaptureStartTime();
+  }
 }
 
 void PerformanceMonitor::Did(const probe::UpdateLayout& probe) {
   --layout_depth_;
-  if (!enabled_)
+  if (layout_depth_)
     return;
-  if (!thresholds_[kLongLayout].is_zero() && script_depth_ && !layout_depth_)
+  if (attribution_enabled_)
+    task_layout_time_ += probe.Duration();
+  if (enabled_ && !thresholds_[kLongLayout].is_zero() && script_depth_)
     per_task_style_and_layout_time_ += probe.Duration();
 }
 
 void PerformanceMonitor::Will(const probe::ExecuteScript& probe) {
   WillExecuteScript(probe.context);
+  if (attribution_enabled_) {
+    UpdateTaskIsolatedWorld();
+    if (script_depth_ == 1)
+      probe.CaptureStartTime();
+  }
 }
 
 void PerformanceMonitor::Did(const probe::ExecuteScript& probe) {
+  if (attribution_enabled_ && script_depth_ == 1)
+    task_script_time_ += probe.Duration();
   DidExecuteScript();
 }
 
 void PerformanceMonitor::Will(const probe::CallFunction& probe) {
   WillExecuteScript(probe.context);
-  if (user_callback_)
+  if (attribution_enabled_)
+    UpdateTaskIsolatedWorld();
+  if (user_callback_ || (attribution_enabled_ && script_depth_ == 1))
     probe.CaptureStartTime();
 }
 
 void PerformanceMonitor::Did(const probe::CallFunction& probe) {
+  if (attribution_enabled_ && script_depth_ == 1)
+    task_script_time_ += probe.Duration();
   DidExecuteScript();
   if (!enabled_ || !user_callback_)
     return;
@@ -284,6 +369,21 @@ void PerformanceMonitor::WillProcessTask(base::TimeTicks start_time) {
   task_should_be_reported_ = false;
   v8::metrics::LongTaskStats::Reset(isolate_);
 
+  if (attribution_enabled_) {
+    task_style_time_ = base::TimeDelta();
+    task_layout_time_ = base::TimeDelta();
+    task_script_time_ = base::TimeDelta();
+    task_paint_time_at_start_ = TotalPaintTime();
+    task_blocker_time_ = base::TimeDelta();
+    task_blocker_time_at_start_ =
+        ContentBlockingMetrics::CheckTimeOnMainThread();
+    task_has_isolated_world_script_ = false;
+    if (!timing_content_blocking_checks_) {
+      ContentBlockingMetrics::StartTimingAllChecks();
+      timing_content_blocking_checks_ = true;
+    }
+  }
+
   if (!enabled_)
     return;
 
@@ -296,9 +396,13 @@ void PerformanceMonitor::WillProcessTask(base::TimeTicks start_time) {
 
 void PerformanceMonitor::DidProcessTask(base::TimeTicks start_time,
                                         base::TimeTicks end_time) {
+  StopTimingContentBlockingChecks();
   if (!task_should_be_reported_)
     return;
 
+  if (attribution_enabled_)
+    RecordLongTaskAttribution(end_time - start_time);
+
   // Do not check the value of |enabled_| before processing longtasks.
   // |enabled_| can be false while there are subscriptions to longtask
   // violations.
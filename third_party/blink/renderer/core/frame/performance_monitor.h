@@ -140,6 +140,17 @@ class CORE_EXPORT PerformanceMonitor final
   void UpdateTaskAttribution(ExecutionContext*);
   void UpdateTaskShouldBeReported(LocalFrame*);
 
+  // Notes whether the script being entered runs in an isolated world, e.g.
+  // an extension content script.
+  void UpdateTaskIsolatedWorld();
+  // The paint time of the local frame tree recorded by its UKM aggregator.
+  base::TimeDelta TotalPaintTime() const;
+  // Sets |task_blocker_time_| to the time of the content blocking checks
+  // made since WillProcessTask(), and stops timing them.
+  void StopTimingContentBlockingChecks();
+  // Passes the phase times of a long task to the UKM aggregator.
+  void RecordLongTaskAttribution(base::TimeDelta task_time);
+
   std::pair<String, DOMWindow*> SanitizedAttribution(
       const HeapHashSet<Member<Frame>>& frame_contexts,
       Frame* observer_frame);
@@ -161,6 +172,19 @@ class CORE_EXPORT PerformanceMonitor final
   v8::Isolate* const isolate_;
   bool task_has_multiple_contexts_ = false;
   bool task_should_be_reported_ = false;
+
+  // Whether the style, layout, script, paint and content blocking time of
+  // each task is measured, so that long tasks can be attributed. Decided
+  // once per local root, as only a sample of pages is measured.
+  bool attribution_enabled_ = false;
+  base::TimeDelta task_style_time_;
+  base::TimeDelta task_layout_time_;
+  base::TimeDelta task_script_time_;
+  base::TimeDelta task_paint_time_at_start_;
+  base::TimeDelta task_blocker_time_at_start_;
+  base::TimeDelta task_blocker_time_;
+  bool timing_content_blocking_checks_ = false;
+  bool task_has_isolated_world_script_ = false;
   using ClientThresholds = HeapHashMap<WeakMember<Client>, base::TimeDelta>;
   HeapHashMap<Violation,
               Member<ClientThresholds>,
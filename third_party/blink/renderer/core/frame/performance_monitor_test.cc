@@ -7,6 +7,8 @@
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/core/frame/local_frame_ukm_aggregator.h"
+#include "third_party/blink/renderer/core/frame/local_frame_view.h"
 #include "third_party/blink/renderer/core/frame/location.h"
 #include "third_party/blink/renderer/core/probe/core_probes.h"
 #include "third_party/blink/renderer/core/testing/dummy_page_holder.h"
@@ -62,6 +64,7 @@ class PerformanceMonitorTest : public testing::Test {
     monitor_->Did(probe);
   }
   bool TaskShouldBeReported() { return monitor_->task_should_be_reported_; }
+  void EnableAttribution() { monitor_->attribution_enabled_ = true; }
 
   String FrameContextURL();
   int NumUniqueFrameContextsSeen();
@@ -80,6 +83,8 @@ void PerformanceMonitorTest::SetUp() {
   page_holder_->GetDocument().SetURL(KURL("https://example.com/foo"));
   monitor_ = MakeGarbageCollected<PerformanceMonitor>(
       GetFrame(), v8::Isolate::GetCurrent());
+  // Long task attribution is sampled; tests opt in with EnableAttribution().
+  monitor_->attribution_enabled_ = false;
 
   // Create another dummy page holder and pretend this is the iframe.
   another_page_holder_ = std::make_unique<DummyPageHolder>(gfx::Size(400, 300));
@@ -220,4 +225,28 @@ TEST_F(PerformanceMonitorTest, UpdateLayoutWithDocument) {
   EXPECT_TRUE(TaskShouldBeReported());
 }
 
+TEST_F(PerformanceMonitorTest, LongTaskAttribution) {
+  EnableAttribution();
+  LocalFrameUkmAggregator& aggregator =
+      GetFrame()->View()->EnsureUkmAggregator();
+
+  // Short tasks are not attributed.
+  WillProcessTask(SecondsToTimeTicks(1234.5678));
+  UpdateLayout(&page_holder_->GetDocument());
+  DidProcessTask(SecondsToTimeTicks(1234.5678), SecondsToTimeTicks(1234.5778));
+  EXPECT_EQ(0u, aggregator.LongTaskCountForTesting());
+
+  // Nor are long tasks of unrelated contexts.
+  WillProcessTask(SecondsToTimeTicks(2234.5678));
+  UpdateLayout(&another_page_holder_->GetDocument());
+  DidProcessTask(SecondsToTimeTicks(2234.5678), SecondsToTimeTicks(2234.6678));
+  EXPECT_EQ(0u, aggregator.LongTaskCountForTesting());
+
+  WillProcessTask(SecondsToTimeTicks(3234.5678));
+  RecalculateStyle(&page_holder_->GetDocument());
+  UpdateLayout(&page_holder_->GetDocument());
+  DidProcessTask(SecondsToTimeTicks(3234.5678), SecondsToTimeTicks(3234.6678));
+  EXPECT_EQ(1u, aggregator.LongTaskCountForTesting());
+}
+
 }  // namespace blink
@@ -0,0 +1,37 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/frame/sampled_ukm_metrics.h"
+
+namespace blink {
+
+SampledTimer::Scope::Scope(SampledTimer* timer) : timer_(timer) {
+  if (!timer_)
+    return;
+  if (timer_->count_++ % kSampleInterval == 0)
+    start_ = base::TimeTicks::Now();
+}
+
+SampledTimer::Scope::~Scope() {
+  if (!start_)
+    return;
+  ++timer_->sampled_count_;
+  timer_->sampled_time_ += base::TimeTicks::Now() - *start_;
+}
+
+base::TimeDelta SampledTimer::EstimatedTime() const {
+  if (!sampled_count_)
+    return base::TimeDelta();
+  return sampled_time_ * count_ / sampled_count_;
+}
+
+bool UkmPublishOnce::ShouldPublish(ukm::UkmRecorder* ukm_recorder,
+                                   ukm::SourceId source_id) {
+  if (published_)
+    return false;
+  published_ = true;
+  return ukm_recorder && source_id != ukm::kInvalidSourceId;
+}
+
+}  // namespace blink
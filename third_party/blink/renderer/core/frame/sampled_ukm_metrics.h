@@ -0,0 +1,83 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_FRAME_SAMPLED_UKM_METRICS_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_FRAME_SAMPLED_UKM_METRICS_H_
+
+#include <stdint.h>
+
+#include "base/time/time.h"
+#include "services/metrics/public/cpp/ukm_source_id.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace ukm {
+class UkmRecorder;
+}  // namespace ukm
+
+namespace blink {
+
+// The building blocks of the per-document metrics that are recorded as one
+// UKM event when the document shuts down, e.g. ContentBlockingMetrics.
+
+// Counts the runs of an operation and times one in kSampleInterval of them,
+// so that hot paths pay for a clock read only rarely.
+class CORE_EXPORT SampledTimer {
+  DISALLOW_NEW();
+
+ public:
+  static constexpr uint32_t kSampleInterval = 16;
+
+  // Counts a run in |timer|, if |timer| is non-null, and adds the time of its
+  // scope to |timer| if the run is sampled.
+  class CORE_EXPORT Scope {
+    STACK_ALLOCATED();
+
+   public:
+    explicit Scope(SampledTimer* timer);
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    ~Scope();
+
+   private:
+    SampledTimer* const timer_;
+    absl::optional<base::TimeTicks> start_;
+  };
+
+  SampledTimer() = default;
+  SampledTimer(const SampledTimer&) = delete;
+  SampledTimer& operator=(const SampledTimer&) = delete;
+
+  uint32_t Count() const { return count_; }
+  // The total time of the runs, extrapolated from the sampled ones.
+  base::TimeDelta EstimatedTime() const;
+
+ private:
+  uint32_t count_ = 0;
+  uint32_t sampled_count_ = 0;
+  base::TimeDelta sampled_time_;
+};
+
+// Lets a document's UKM event be recorded at most once, as the document may
+// shut down its metrics from more than one place.
+class CORE_EXPORT UkmPublishOnce {
+  DISALLOW_NEW();
+
+ public:
+  UkmPublishOnce() = default;
+  UkmPublishOnce(const UkmPublishOnce&) = delete;
+  UkmPublishOnce& operator=(const UkmPublishOnce&) = delete;
+
+  // Returns true if the event should be recorded now: this is the first call
+  // and the event can be recorded for |source_id|.
+  bool ShouldPublish(ukm::UkmRecorder* ukm_recorder, ukm::SourceId source_id);
+
+ private:
+  bool published_ = false;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_FRAME_SAMPLED_UKM_METRICS_H_
@@ -0,0 +1,39 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/frame/sampled_ukm_metrics.h"
+
+#include "components/ukm/test_ukm_recorder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+TEST(SampledTimerTest, Scope) {
+  SampledTimer timer;
+  EXPECT_EQ(base::TimeDelta(), timer.EstimatedTime());
+  for (uint32_t i = 0; i < SampledTimer::kSampleInterval + 1; ++i)
+    SampledTimer::Scope scope(&timer);
+  EXPECT_EQ(SampledTimer::kSampleInterval + 1, timer.Count());
+  EXPECT_GE(timer.EstimatedTime(), base::TimeDelta());
+
+  // Without a timer, there is nothing to count.
+  SampledTimer::Scope scope(nullptr);
+}
+
+TEST(UkmPublishOnceTest, ShouldPublish) {
+  ukm::TestUkmRecorder recorder;
+
+  UkmPublishOnce publish_once;
+  EXPECT_TRUE(publish_once.ShouldPublish(&recorder, 1));
+  EXPECT_FALSE(publish_once.ShouldPublish(&recorder, 1));
+
+  // A first call that cannot record still uses up the event.
+  UkmPublishOnce invalid_publish_once;
+  EXPECT_FALSE(
+      invalid_publish_once.ShouldPublish(&recorder, ukm::kInvalidSourceId));
+  EXPECT_FALSE(invalid_publish_once.ShouldPublish(&recorder, 1));
+  EXPECT_FALSE(UkmPublishOnce().ShouldPublish(nullptr, 1));
+}
+
+}  // namespace blink
@@ -0,0 +1,352 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/layout/element_hider.h"
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "base/no_destructor.h"
+#include "third_party/blink/public/platform/web_content_settings_client.h"
+#include "third_party/blink/renderer/core/css/css_markup.h"
+#include "third_party/blink/renderer/core/css/css_property_value_set.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/style/computed_style.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+namespace {
+
+using Op = ElementHidingCondition::Op;
+
+// Sites detect ad blockers by checking whether a bait element positioned far
+// off screen was laid out. Such elements are never hidden by kAds rules.
+bool IsAdBlockerBait(const Element& element) {
+  const CSSPropertyValueSet* inline_style = element.InlineStyle();
+  return inline_style &&
+         inline_style->GetPropertyValue(CSSPropertyID::kTop) == "-5000px" &&
+         inline_style->GetPropertyValue(CSSPropertyID::kLeft) == "-5000px";
+}
+
+// The selector equivalent of IsAdBlockerBait(), appended to the selectors of
+// kAds rules. It is looser, as the inline style is matched as text.
+constexpr char kAdBlockerBaitExemption[] = ":not([style*=\"-5000px\"])";
+
+// Appended to every generated selector: like ElementHider::Evaluate(), the
+// style sheet never hides BODY, whose classes often match the rules' patterns
+// and would blank the whole page.
+constexpr char kBodyExemption[] = ":not(body)";
+
+const char* AttributeName(ElementHidingField field) {
+  switch (field) {
+    case ElementHidingField::kId:
+      return "id";
+    case ElementHidingField::kClass:
+      return "class";
+    case ElementHidingField::kType:
+      return "type";
+    case ElementHidingField::kStyle:
+      return "style";
+    case ElementHidingField::kTag:
+      break;
+  }
+  NOTREACHED();
+  return nullptr;
+}
+
+// Appends an attribute selector comparing the whole value of the |field|
+// attribute, case-sensitively as ElementHider::Evaluate() does.
+void AppendAttributeSelector(ElementHidingField field,
+                             const char* match,
+                             const String& value,
+                             StringBuilder& selector) {
+  selector.Append('[');
+  selector.Append(AttributeName(field));
+  selector.Append(match);
+  SerializeString(value, selector);
+  selector.Append(" s]");
+}
+
+// Returns the selector matching the elements |clause| holds for, or a null
+// string if one of its conditions has no selector equivalent.
+String SelectorForClause(const ElementHidingClause& clause) {
+  String tag;
+  StringBuilder selector;
+  for (const ElementHidingCondition& condition : clause.conditions) {
+    if (condition.op == Op::kNone)
+      break;
+    if (condition.op == Op::kZIndexIs)
+      return String();
+    const String value(condition.value);
+    if (condition.field == ElementHidingField::kTag) {
+      if (condition.op != Op::kEquals || !tag.IsNull())
+        return String();
+      // Type selectors ignore the case of HTML elements, whose nodeName() is
+      // upper case.
+      tag = value.LowerASCII();
+      continue;
+    }
+    switch (condition.op) {
+      case Op::kEquals:
+        if (condition.field == ElementHidingField::kId) {
+          selector.Append('#');
+          SerializeIdentifier(value, selector);
+        } else {
+          AppendAttributeSelector(condition.field, "=", value, selector);
+        }
+        break;
+      case Op::kDiffers:
+        selector.Append(":not(");
+        AppendAttributeSelector(condition.field, "=", value, selector);
+        selector.Append(')');
+        break;
+      case Op::kContains:
+        AppendAttributeSelector(condition.field, "*=", value, selector);
+        break;
+      case Op::kLacks:
+        selector.Append(":not(");
+        AppendAttributeSelector(condition.field, "*=", value, selector);
+        selector.Append(')');
+        break;
+      case Op::kZIndexIs:
+      case Op::kNone:
+        NOTREACHED();
+        break;
+    }
+  }
+  return tag.IsNull() ? selector.ToString() : tag + selector.ToString();
+}
+
+}  // namespace
+
+// static
+const ElementHider& ElementHider::Default() {
+  static const base::NoDestructor<ElementHider> hider(
+      DefaultElementHidingSections(), DefaultElementHidingExemptHosts());
+  return *hider;
+}
+
+// static
+bool ElementHider::AreAdsBlocked(const Document& document) {
+  LocalFrame* frame = document.GetFrame();
+  WebContentSettingsClient* content_settings_client =
+      frame ? frame->GetContentSettingsClient() : nullptr;
+  return !content_settings_client || !content_settings_client->AllowAds(true);
+}
+
+ElementHider::ElementHider(base::span<const ElementHidingSection> sections,
+                           base::span<const char* const> exempt_hosts) {
+  CHECK_LE(sections.size(), kMaxSections);
+
+  // kAds rules must not match the elements kExemption rules match, in the
+  // style sheet as in Evaluate().
+  StringBuilder exemptions;
+  for (const ElementHidingSection& section : sections) {
+    if (section.stage != ElementHidingStage::kExemption)
+      continue;
+    for (const ElementHidingClause& clause : section.clauses) {
+      String selector = SelectorForClause(clause);
+      DCHECK(!selector.IsNull());
+      exemptions.Append(":not(");
+      exemptions.Append(selector);
+      exemptions.Append(')');
+    }
+  }
+  exemptions.Append(kAdBlockerBaitExemption);
+  const String ads_exemptions = exemptions.ToString();
+
+  MultiPatternMatcher::Builder builders[kElementHidingFieldCount];
+  HashMap<String, uint32_t> pattern_ids[kElementHidingFieldCount];
+
+  for (wtf_size_t section_index = 0; section_index < sections.size();
+       ++section_index) {
+    const ElementHidingSection& section = sections[section_index];
+    section_hosts_.push_back(section.host ? String(section.host) : String());
+    if (section.stage == ElementHidingStage::kAds)
+      ads_sections_ |= 1u << section_index;
+
+    StringBuilder style_sheet;
+    for (const ElementHidingClause& clause : section.clauses) {
+      const uint32_t rule_index = rules_.size();
+      rules_.push_back(Rule{static_cast<uint8_t>(section_index), section.stage,
+                            conditions_.size(), 0});
+      Rule& rule = rules_.back();
+      for (const ElementHidingCondition& condition : clause.conditions) {
+        if (condition.op == Op::kNone)
+          break;
+        conditions_.push_back(condition);
+        condition_values_.push_back(condition.value ? String(condition.value)
+                                                    : String());
+        ++rule.condition_count;
+      }
+
+      // kExemption rules are also needed by the kAds rules of Evaluate().
+      if (section.stage != ElementHidingStage::kExemption) {
+        String selector = SelectorForClause(clause);
+        if (!selector.IsNull()) {
+          style_sheet.Append(selector);
+          style_sheet.Append(kBodyExemption);
+          if (section.stage == ElementHidingStage::kAds)
+            style_sheet.Append(ads_exemptions);
+          style_sheet.Append(" { display: none !important; }\n");
+          continue;
+        }
+      }
+
+      bool indexed = false;
+      for (wtf_size_t i = rule.first_condition;
+           i < rule.first_condition + rule.condition_count && !indexed; ++i) {
+        const ElementHidingCondition& condition = conditions_[i];
+        const String& value = condition_values_[i];
+        const wtf_size_t field = static_cast<wtf_size_t>(condition.field);
+        if (condition.op == Op::kEquals) {
+          rules_by_value_[field]
+              .insert(value, Vector<uint32_t>())
+              .stored_value->value.push_back(rule_index);
+          indexed = true;
+        } else if (condition.op == Op::kContains) {
+          auto result = pattern_ids[field].insert(value, 0);
+          if (result.is_new_entry) {
+            result.stored_value->value = rules_by_pattern_.size();
+            builders[field].AddPattern(value, rules_by_pattern_.size());
+            rules_by_pattern_.Grow(rules_by_pattern_.size() + 1);
+          }
+          rules_by_pattern_[result.stored_value->value].push_back(rule_index);
+          indexed = true;
+        }
+      }
+      DCHECK(indexed) << "Rule " << rule_index << " has no indexable condition";
+    }
+    style_sheet_texts_.push_back(style_sheet.ToString());
+  }
+
+  for (wtf_size_t field = 0; field < kElementHidingFieldCount; ++field)
+    matchers_[field] = builders[field].Build();
+
+  for (const char* host : exempt_hosts)
+    exempt_hosts_.push_back(host);
+}
+
+ElementHider::~ElementHider() = default;
+
+ElementHider::SectionMask ElementHider::SectionsForHost(
+    const String& host) const {
+  SectionMask sections = 0;
+  for (wtf_size_t i = 0; i < section_hosts_.size(); ++i) {
+    if (section_hosts_[i].IsNull() || host.Contains(section_hosts_[i]))
+      sections |= 1u << i;
+  }
+  for (const String& exempt_host : exempt_hosts_) {
+    if (host.Contains(exempt_host))
+      return sections & ~ads_sections_;
+  }
+  return sections;
+}
+
+ElementHider::Verdict ElementHider::Evaluate(const Element& element,
+                                             const ComputedStyle& style,
+                                             SectionMask sections) const {
+  FieldValues values;
+  auto field_value = [&values](ElementHidingField field) -> String& {
+    return values[static_cast<wtf_size_t>(field)];
+  };
+  field_value(ElementHidingField::kTag) = element.nodeName();
+  if (field_value(ElementHidingField::kTag) == "BODY")
+    return Verdict::kShow;
+  if (element.hasAttributes()) {
+    field_value(ElementHidingField::kId) = element.GetIdAttribute();
+    field_value(ElementHidingField::kClass) = element.GetClassAttribute();
+    field_value(ElementHidingField::kType) =
+        element.FastGetAttribute(html_names::kTypeAttr);
+    // Unlike FastGetAttribute(), this serializes a modified inline style.
+    field_value(ElementHidingField::kStyle) =
+        element.getAttribute(html_names::kStyleAttr);
+  }
+
+  Vector<uint32_t, 16> candidates;
+  PatternIdList patterns;
+  for (wtf_size_t field = 0; field < kElementHidingFieldCount; ++field) {
+    const String& value = values[field];
+    if (value.IsEmpty())
+      continue;
+    auto it = rules_by_value_[field].find(value);
+    if (it != rules_by_value_[field].end())
+      candidates.AppendVector(it->value);
+    if (matchers_[field].IsEmpty())
+      continue;
+    patterns.clear();
+    matchers_[field].FindAll(value, patterns);
+    for (uint32_t pattern : patterns)
+      candidates.AppendVector(rules_by_pattern_[pattern]);
+  }
+  if (candidates.IsEmpty())
+    return Verdict::kShow;
+
+  std::sort(candidates.begin(), candidates.end());
+  candidates.Shrink(static_cast<wtf_size_t>(
+      std::unique(candidates.begin(), candidates.end()) - candidates.begin()));
+
+  bool hide_if_ads_blocked = false;
+  bool exempt = false;
+  for (uint32_t rule_index : candidates) {
+    const Rule& rule = rules_[rule_index];
+    if (!(sections & (1u << rule.section)) || !Matches(rule, values, style))
+      continue;
+    switch (rule.stage) {
+      case ElementHidingStage::kAlways:
+        return Verdict::kHide;
+      case ElementHidingStage::kExemption:
+        exempt = true;
+        break;
+      case ElementHidingStage::kAds:
+        hide_if_ads_blocked = true;
+        break;
+    }
+  }
+
+  if (!hide_if_ads_blocked || exempt || IsAdBlockerBait(element))
+    return Verdict::kShow;
+  return Verdict::kHideIfAdsBlocked;
+}
+
+bool ElementHider::Matches(const Rule& rule,
+                           const FieldValues& values,
+                           const ComputedStyle& style) const {
+  for (wtf_size_t i = rule.first_condition;
+       i < rule.first_condition + rule.condition_count; ++i) {
+    const ElementHidingCondition& condition = conditions_[i];
+    const String& value = values[static_cast<wtf_size_t>(condition.field)];
+    const String& pattern = condition_values_[i];
+    bool holds = false;
+    switch (condition.op) {
+      case Op::kContains:
+        holds = value.Contains(pattern);
+        break;
+      case Op::kLacks:
+        holds = !value.Contains(pattern);
+        break;
+      case Op::kEquals:
+        holds = value == pattern;
+        break;
+      case Op::kDiffers:
+        holds = value != pattern;
+        break;
+      case Op::kZIndexIs:
+        holds = style.ZIndex() == condition.z_index;
+        break;
+      case Op::kNone:
+        NOTREACHED();
+        break;
+    }
+    if (!holds)
+      return false;
+  }
+  return true;
+}
+
+}  // namespace blink
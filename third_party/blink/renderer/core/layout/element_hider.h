@@ -0,0 +1,243 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_ELEMENT_HIDER_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_ELEMENT_HIDER_H_
+
+#include <stdint.h>
+
+#include "base/containers/span.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/loader/multi_pattern_matcher.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+class ComputedStyle;
+class Document;
+class Element;
+
+// The part of an element a condition is evaluated against. Attributes are
+// compared as a whole, e.g. the class field is the value of the class
+// attribute rather than one of the class names in it.
+enum class ElementHidingField : uint8_t {
+  kId,
+  kClass,
+  // Element::nodeName(), which is upper case for HTML elements in HTML
+  // documents.
+  kTag,
+  kType,
+  kStyle,
+};
+constexpr wtf_size_t kElementHidingFieldCount = 5;
+
+// How a rule applies.
+enum class ElementHidingStage : uint8_t {
+  // The element is hidden in every document the section applies to.
+  kAlways,
+  // A match exempts the element from kAds.
+  kExemption,
+  // The element is hidden while ads are blocked for the frame, unless the
+  // document's host is exempt or the element matches a kExemption rule.
+  kAds,
+};
+
+// A single test on an element. Built with the helpers below, e.g.
+// ClassContains("adsbygoogle").
+struct ElementHidingCondition {
+  enum class Op : uint8_t {
+    kNone,
+    // The field contains |value|.
+    kContains,
+    // The field does not contain |value|.
+    kLacks,
+    // The field is exactly |value|.
+    kEquals,
+    // The field is not exactly |value|.
+    kDiffers,
+    // The computed z-index of the element is |z_index|. |field| is unused.
+    kZIndexIs,
+  };
+
+  Op op = Op::kNone;
+  ElementHidingField field = ElementHidingField::kId;
+  const char* value = nullptr;
+  int z_index = 0;
+};
+
+constexpr ElementHidingCondition IdIs(const char* value) {
+  return {ElementHidingCondition::Op::kEquals, ElementHidingField::kId, value};
+}
+constexpr ElementHidingCondition IdIsNot(const char* value) {
+  return {ElementHidingCondition::Op::kDiffers, ElementHidingField::kId,
+          value};
+}
+constexpr ElementHidingCondition IdContains(const char* value) {
+  return {ElementHidingCondition::Op::kContains, ElementHidingField::kId,
+          value};
+}
+constexpr ElementHidingCondition IdLacks(const char* value) {
+  return {ElementHidingCondition::Op::kLacks, ElementHidingField::kId, value};
+}
+constexpr ElementHidingCondition ClassIs(const char* value) {
+  return {ElementHidingCondition::Op::kEquals, ElementHidingField::kClass,
+          value};
+}
+constexpr ElementHidingCondition ClassContains(const char* value) {
+  return {ElementHidingCondition::Op::kContains, ElementHidingField::kClass,
+          value};
+}
+constexpr ElementHidingCondition ClassLacks(const char* value) {
+  return {ElementHidingCondition::Op::kLacks, ElementHidingField::kClass,
+          value};
+}
+constexpr ElementHidingCondition TagIs(const char* value) {
+  return {ElementHidingCondition::Op::kEquals, ElementHidingField::kTag,
+          value};
+}
+constexpr ElementHidingCondition TagContains(const char* value) {
+  return {ElementHidingCondition::Op::kContains, ElementHidingField::kTag,
+          value};
+}
+constexpr ElementHidingCondition TypeContains(const char* value) {
+  return {ElementHidingCondition::Op::kContains, ElementHidingField::kType,
+          value};
+}
+constexpr ElementHidingCondition StyleContains(const char* value) {
+  return {ElementHidingCondition::Op::kContains, ElementHidingField::kStyle,
+          value};
+}
+constexpr ElementHidingCondition ZIndexIs(int z_index) {
+  return {ElementHidingCondition::Op::kZIndexIs, ElementHidingField::kId,
+          nullptr, z_index};
+}
+
+constexpr wtf_size_t kMaxElementHidingConditions = 8;
+
+// A rule: matches when all of its conditions hold. At least one condition
+// must be kContains or kEquals, which the rule is indexed by.
+struct ElementHidingClause {
+  ElementHidingCondition conditions[kMaxElementHidingConditions];
+};
+
+// A list of rules sharing the same stage and host precondition.
+struct ElementHidingSection {
+  ElementHidingStage stage;
+  // If set, the section only applies to documents whose host contains it.
+  const char* host;
+  base::span<const ElementHidingClause> clauses;
+};
+
+// The rules Kiwi ships with, in evaluation order.
+CORE_EXPORT base::span<const ElementHidingSection>
+DefaultElementHidingSections();
+
+// Documents whose host contains one of these are exempt from kAds.
+CORE_EXPORT base::span<const char* const> DefaultElementHidingExemptHosts();
+
+// Compiled form of a list of ElementHidingSections.
+//
+// Rules whose conditions all have a selector equivalent are turned into a
+// user-agent style sheet of display:none rules per section, which
+// CSSDefaultStyleSheets parses once and StyleEngine applies to the documents
+// the section applies to. Hidden elements then never get a layout object and
+// their subtrees are not styled.
+//
+// The remaining rules, e.g. those testing the z-index or a part of the tag
+// name, are consulted by LayoutObject::CreateObject() through Evaluate(). They
+// are indexed by one of their conditions: kEquals conditions through a hash
+// map of the field value, kContains conditions through a MultiPatternMatcher
+// per field, so that the cost per element does not grow with the number of
+// rules.
+//
+// Host preconditions are resolved once per document by SectionsForHost(),
+// whose result the Document caches.
+class CORE_EXPORT ElementHider {
+  USING_FAST_MALLOC(ElementHider);
+
+ public:
+  enum class Verdict {
+    kShow,
+    kHide,
+    // Hidden if ads are blocked for the element's frame.
+    kHideIfAdsBlocked,
+  };
+
+  // Bits indexed by section, as returned by SectionsForHost().
+  using SectionMask = uint32_t;
+  static constexpr wtf_size_t kMaxSections = 32;
+
+  // Returns the hider compiled from DefaultElementHidingSections() and
+  // DefaultElementHidingExemptHosts().
+  static const ElementHider& Default();
+
+  ElementHider(base::span<const ElementHidingSection> sections,
+               base::span<const char* const> exempt_hosts);
+  ElementHider(const ElementHider&) = delete;
+  ElementHider& operator=(const ElementHider&) = delete;
+  ~ElementHider();
+
+  // Whether the rules of the kAds sections apply to |document|, i.e. whether
+  // the frame's content settings block ads.
+  static bool AreAdsBlocked(const Document& document);
+
+  // The sections that apply to a document with |host|.
+  SectionMask SectionsForHost(const String& host) const;
+
+  // Evaluates |element|, whose computed style is |style|, against the rules of
+  // the |sections| of a document that are not part of a style sheet.
+  Verdict Evaluate(const Element& element,
+                   const ComputedStyle& style,
+                   SectionMask sections) const;
+
+  // The display:none rules of |section|, or an empty string if every rule of
+  // the section is evaluated by Evaluate().
+  const String& StyleSheetText(wtf_size_t section) const {
+    return style_sheet_texts_[section];
+  }
+
+  wtf_size_t SectionCount() const { return section_hosts_.size(); }
+  SectionMask AdsSections() const { return ads_sections_; }
+  wtf_size_t RuleCount() const { return rules_.size(); }
+
+ private:
+  struct Rule {
+    uint8_t section;
+    ElementHidingStage stage;
+    wtf_size_t first_condition;
+    wtf_size_t condition_count;
+  };
+
+  using FieldValues = String[kElementHidingFieldCount];
+
+  bool Matches(const Rule&,
+               const FieldValues&,
+               const ComputedStyle& style) const;
+
+  Vector<Rule> rules_;
+  Vector<ElementHidingCondition> conditions_;
+  // ElementHidingCondition::value of each condition.
+  Vector<String> condition_values_;
+  // ElementHidingSection::host of each section.
+  Vector<String> section_hosts_;
+  Vector<String> style_sheet_texts_;
+  Vector<String> exempt_hosts_;
+  SectionMask ads_sections_ = 0;
+
+  // The rules evaluated by Evaluate() indexed by a kEquals condition, by field
+  // value.
+  HashMap<String, Vector<uint32_t>> rules_by_value_[kElementHidingFieldCount];
+  // The rules evaluated by Evaluate() indexed by a kContains condition, by
+  // pattern.
+  MultiPatternMatcher matchers_[kElementHidingFieldCount];
+  Vector<Vector<uint32_t>> rules_by_pattern_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_ELEMENT_HIDER_H_
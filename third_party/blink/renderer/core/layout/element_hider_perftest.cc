@@ -0,0 +1,150 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// A benchmark of the element hiding in LayoutObject::CreateObject(). It
+// styles a dumped page, then repeatedly creates the layout object of each of
+// its styled elements, and separately evaluates the ElementHider rules for
+// them. It reads the page dumps of style_perftest.cc, which are not checked
+// in, and the tests are skipped if the files are not available. Only the
+// "html" and the optional "url" of a dump are used: the URL decides which
+// sections of rules apply.
+
+#include "third_party/blink/renderer/core/layout/element_hider.h"
+
+#include "base/command_line.h"
+#include "base/json/json_reader.h"
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element_traversal.h"
+#include "third_party/blink/renderer/core/html/html_body_element.h"
+#include "third_party/blink/renderer/core/layout/layout_object.h"
+#include "third_party/blink/renderer/core/style/computed_style.h"
+#include "third_party/blink/renderer/core/testing/dummy_page_holder.h"
+#include "third_party/blink/renderer/core/testing/scoped_allocation_counter.h"
+#include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
+
+namespace blink {
+
+namespace {
+
+void MeasureCreateObjectForDumpedPage(const char* filename, const char* label) {
+  // More iterations give more stable numbers. (If this flag does not exist,
+  // it will return the empty string.)
+  const std::string iterations_str =
+      base::CommandLine::ForCurrentProcess()->GetSwitchValueASCII(
+          "blocker-iterations");
+  const int iterations = iterations_str.empty() ? 10 : stoi(iterations_str);
+
+  scoped_refptr<SharedBuffer> serialized = test::ReadFromFile(filename);
+  absl::optional<base::Value> json = base::JSONReader::Read(
+      base::StringPiece(serialized->Data(), serialized->size()));
+  if (!json || !json->is_dict() || !json->GetDict().FindString("html")) {
+    char msg[256];
+    snprintf(msg, sizeof(msg), "Skipping %s test because %s could not be read",
+             label, filename);
+    GTEST_SKIP_(msg);
+  }
+  const base::Value::Dict& dict = json->GetDict();
+
+  auto page = std::make_unique<DummyPageHolder>(gfx::Size(800, 600));
+  Document& document = page->GetDocument();
+  if (const std::string* url = dict.FindString("url"))
+    document.SetURL(KURL(String(*url)));
+  document.body()->setInnerHTML(String(*dict.FindString("html")),
+                                ASSERT_NO_EXCEPTION);
+  document.UpdateStyleAndLayoutTreeForThisDocument();
+
+  // Elements in display:none subtrees, including those hidden by the
+  // ElementHider style sheets, are not styled and never reach CreateObject().
+  HeapVector<Member<Element>> elements;
+  for (Element& element : ElementTraversal::DescendantsOf(*document.body())) {
+    if (element.GetComputedStyle())
+      elements.push_back(&element);
+  }
+
+  const ElementHider& hider = ElementHider::Default();
+  const ElementHider::SectionMask sections = document.ElementHidingSections();
+  size_t hidden_count = 0;
+  for (Element* element : elements) {
+    if (hider.Evaluate(*element, *element->GetComputedStyle(), sections) !=
+        ElementHider::Verdict::kShow) {
+      ++hidden_count;
+    }
+  }
+
+  // CreateObject() may only be called while the layout tree is rebuilt.
+  document.Lifecycle().AdvanceTo(DocumentLifecycle::kInStyleRecalc);
+  base::TimeDelta create_time;
+  size_t create_allocations = 0;
+  {
+    ScopedAllocationCounter allocation_counter;
+    base::ElapsedTimer timer;
+    for (int i = 0; i < iterations; ++i) {
+      for (Element* element : elements) {
+        if (LayoutObject* layout_object = LayoutObject::CreateObject(
+                element, *element->GetComputedStyle(), LegacyLayout::kAuto)) {
+          layout_object->Destroy();
+        }
+      }
+    }
+    create_time = timer.Elapsed();
+    create_allocations = allocation_counter.Count();
+  }
+  document.Lifecycle().AdvanceTo(DocumentLifecycle::kStyleClean);
+
+  base::TimeDelta evaluate_time;
+  size_t evaluate_allocations = 0;
+  {
+    ScopedAllocationCounter allocation_counter;
+    base::ElapsedTimer timer;
+    for (int i = 0; i < iterations; ++i) {
+      for (Element* element : elements)
+        hider.Evaluate(*element, *element->GetComputedStyle(), sections);
+    }
+    evaluate_time = timer.Elapsed();
+    evaluate_allocations = allocation_counter.Count();
+  }
+
+  perf_test::PerfResultReporter reporter("BlinkElementHider", label);
+  reporter.RegisterFyiMetric("NumElements", "");
+  reporter.AddResult("NumElements", static_cast<double>(elements.size()));
+  reporter.RegisterFyiMetric("HiddenElements", "");
+  reporter.AddResult("HiddenElements", static_cast<double>(hidden_count));
+
+  if (elements.IsEmpty())
+    return;
+  const double element_count =
+      static_cast<double>(elements.size()) * iterations;
+  reporter.RegisterImportantMetric("CreateObjectTimePerElement", "ns");
+  reporter.AddResult("CreateObjectTimePerElement",
+                     create_time.InNanoseconds() / element_count);
+  reporter.RegisterImportantMetric("CreateObjectAllocationsPerElement",
+                                   "count");
+  reporter.AddResult("CreateObjectAllocationsPerElement",
+                     create_allocations / element_count);
+  reporter.RegisterImportantMetric("EvaluateTimePerElement", "ns");
+  reporter.AddResult("EvaluateTimePerElement",
+                     evaluate_time.InNanoseconds() / element_count);
+  reporter.RegisterImportantMetric("EvaluateAllocationsPerElement", "count");
+  reporter.AddResult("EvaluateAllocationsPerElement",
+                     evaluate_allocations / element_count);
+}
+
+}  // namespace
+
+TEST(ElementHiderPerfTest, News) {
+  MeasureCreateObjectForDumpedPage("news.json", "News");
+}
+
+TEST(ElementHiderPerfTest, Video) {
+  MeasureCreateObjectForDumpedPage("video.json", "Video");
+}
+
+TEST(ElementHiderPerfTest, Adult) {
+  MeasureCreateObjectForDumpedPage("adult.json", "Adult");
+}
+
+}  // namespace blink
@@ -0,0 +1,164 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/layout/element_hider.h"
+
+#include "third_party/blink/renderer/core/css/style_engine.h"
+#include "third_party/blink/renderer/core/html/html_element.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
+
+namespace blink {
+
+namespace {
+
+constexpr ElementHidingClause kAlwaysClauses[] = {
+    {IdIs("always")},
+    {TagContains("-PROMOTED-")},
+};
+
+constexpr ElementHidingClause kHostClauses[] = {
+    {ClassIs("host-only")},
+};
+
+constexpr ElementHidingClause kExemptionClauses[] = {
+    {IdIs("bait")},
+};
+
+constexpr ElementHidingClause kAdsClauses[] = {
+    {ClassContains("ad_"), ClassLacks("head")},
+    {ClassIs("ads"), TagIs("INS")},
+    {StyleContains("width:468"), IdIsNot("banner")},
+    {IdIs("overlay"), ZIndexIs(99)},
+    {TagContains("-AD-")},
+};
+
+constexpr ElementHidingSection kSections[] = {
+    {ElementHidingStage::kAlways, nullptr, kAlwaysClauses},
+    {ElementHidingStage::kAlways, "special.example", kHostClauses},
+    {ElementHidingStage::kExemption, nullptr, kExemptionClauses},
+    {ElementHidingStage::kAds, nullptr, kAdsClauses},
+};
+
+constexpr const char* kExemptHosts[] = {"exempt.example"};
+
+}  // namespace
+
+class ElementHiderTest : public RenderingTest {
+ protected:
+  ElementHider::Verdict Evaluate(const char* id) {
+    const Element& element = *GetElementById(id);
+    return hider_.Evaluate(element, *element.GetComputedStyle(),
+                           hider_.SectionsForHost("www.example.com"));
+  }
+
+  ElementHider hider_{kSections, kExemptHosts};
+};
+
+TEST_F(ElementHiderTest, StyleSheets) {
+  EXPECT_EQ("#always:not(body) { display: none !important; }\n",
+            hider_.StyleSheetText(0));
+  EXPECT_EQ(
+      "[class=\"host-only\" s]:not(body) { display: none !important; }\n",
+      hider_.StyleSheetText(1));
+  // kExemption rules only restrict the selectors of kAds rules.
+  EXPECT_EQ("", hider_.StyleSheetText(2));
+  EXPECT_EQ(
+      "[class*=\"ad_\" s]:not([class*=\"head\" s]):not(body)"
+      ":not(#bait):not([style*=\"-5000px\"])"
+      " { display: none !important; }\n"
+      "ins[class=\"ads\" s]:not(body)"
+      ":not(#bait):not([style*=\"-5000px\"])"
+      " { display: none !important; }\n"
+      "[style*=\"width:468\" s]:not([id=\"banner\" s]):not(body)"
+      ":not(#bait):not([style*=\"-5000px\"])"
+      " { display: none !important; }\n",
+      hider_.StyleSheetText(3));
+}
+
+TEST_F(ElementHiderTest, Hosts) {
+  const ElementHider::SectionMask sections =
+      hider_.SectionsForHost("www.example.com");
+  EXPECT_EQ(0b1101u, sections);
+  EXPECT_EQ(0b1111u, hider_.SectionsForHost("www.special.example"));
+
+  // Exempt hosts only lift the kAds rules.
+  EXPECT_EQ(0b1000u, hider_.AdsSections());
+  EXPECT_EQ(0b0101u, hider_.SectionsForHost("exempt.example"));
+}
+
+TEST_F(ElementHiderTest, Evaluate) {
+  SetBodyInnerHTML(R"HTML(
+    <x-promoted-item id="promoted"></x-promoted-item>
+    <x-ad-slot id="ad"></x-ad-slot>
+    <x-ad-slot id="bait"></x-ad-slot>
+    <x-ad-slot id="probe"
+        style="position: absolute; top: -5000px; left: -5000px"></x-ad-slot>
+    <div id="overlay" style="position: relative; z-index: 99"></div>
+    <div id="other" style="position: relative; z-index: 98"></div>
+    <div id="always"></div>
+  )HTML");
+  EXPECT_EQ(ElementHider::Verdict::kHide, Evaluate("promoted"));
+  EXPECT_EQ(ElementHider::Verdict::kHideIfAdsBlocked, Evaluate("ad"));
+  EXPECT_EQ(ElementHider::Verdict::kShow, Evaluate("bait"));
+  EXPECT_EQ(ElementHider::Verdict::kShow, Evaluate("probe"));
+  EXPECT_EQ(ElementHider::Verdict::kHideIfAdsBlocked, Evaluate("overlay"));
+  EXPECT_EQ(ElementHider::Verdict::kShow, Evaluate("other"));
+  // Rules with a selector are left to the style sheet.
+  EXPECT_EQ(ElementHider::Verdict::kShow, Evaluate("always"));
+}
+
+TEST_F(ElementHiderTest, DefaultRules) {
+  SetBodyInnerHTML(R"HTML(
+    <style>#bvSecurePageWarning { display: block !important; }</style>
+    <div id="bvSecurePageWarning"><span id="child"></span></div>
+    <ins id="ins" class="adsbygoogle"></ins>
+    <ins id="bait" class="adsbygoogle" style="top: -5000px"></ins>
+    <div id="content"></div>
+  )HTML");
+  EXPECT_GT(ElementHider::Default().RuleCount(), 300u);
+
+  // The user-agent rules win over the page's !important ones.
+  const Element& warning = *GetElementById("bvSecurePageWarning");
+  EXPECT_EQ(EDisplay::kNone, warning.GetComputedStyle()->Display());
+  EXPECT_FALSE(GetLayoutObjectByElementId("bvSecurePageWarning"));
+  // The subtree of a hidden element is not styled.
+  EXPECT_FALSE(GetElementById("child")->GetComputedStyle());
+
+  // Ads are blocked in documents without content settings.
+  EXPECT_FALSE(GetLayoutObjectByElementId("ins"));
+  EXPECT_TRUE(GetLayoutObjectByElementId("bait"));
+  EXPECT_TRUE(GetLayoutObjectByElementId("content"));
+}
+
+TEST_F(ElementHiderTest, DefaultRulesDoNotHideBody) {
+  SetBodyInnerHTML(R"HTML(<div id="billboard" class="billboard"></div>)HTML");
+  GetDocument().body()->setAttribute(html_names::kClassAttr,
+                                     "home billboard Partners");
+  UpdateAllLifecyclePhasesForTest();
+
+  // The classes of the body match default rules, which only hide the other
+  // elements.
+  EXPECT_TRUE(GetDocument().body()->GetLayoutObject());
+  EXPECT_FALSE(GetLayoutObjectByElementId("billboard"));
+}
+
+TEST_F(ElementHiderTest, DefaultRulesFollowURL) {
+  SetBodyInnerHTML(R"HTML(<div id="ads"></div>)HTML");
+  StyleEngine& style_engine = GetDocument().GetStyleEngine();
+  const wtf_size_t section_count = style_engine.ElementHidingStyle().size();
+
+  // The host-only section of the default list applies once the document moves
+  // to its host.
+  GetDocument().SetURL(KURL("https://duckduckgo.com/"));
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(section_count + 1, style_engine.ElementHidingStyle().size());
+  EXPECT_FALSE(GetLayoutObjectByElementId("ads"));
+
+  GetDocument().SetURL(KURL("https://www.example.com/"));
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(section_count, style_engine.ElementHidingStyle().size());
+}
+
+}  // namespace blink
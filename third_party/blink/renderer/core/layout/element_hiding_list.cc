@@ -0,0 +1,474 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/layout/element_hider.h"
+
+namespace blink {
+
+namespace {
+
+// kAlways
+
+constexpr ElementHidingClause kAlwaysClauses[] = {
+    {IdIs("bvSecurePageWarning")},
+    {IdIs("titleDiv"), ClassIs("cell")},
+    {IdIs("inpUrlContainer"), TagIs("SPAN")},
+    {TagIs("G-BOTTOM-SHEET")},
+    {TagContains("-PROMOTED-")},
+    {TagContains("-COMPANION-")},
+    {IdIs("mealbar:0")},
+    {IdIs("mealbar:1")},
+    {IdIs("mealbar:2")},
+    {IdIs("mealbar:3")},
+    {IdIs("CookieBannerWrapper")},
+};
+
+constexpr ElementHidingClause kDuckDuckGoClauses[] = {
+    {IdIs("ads")},
+};
+
+// kExemption
+
+// Elements sites probe for to detect ad blockers.
+constexpr ElementHidingClause kBaitClauses[] = {
+    {IdIs("adbdetect")},
+    {IdIs("banner_ad")},
+};
+
+// kAds
+
+constexpr ElementHidingClause kAdsClauses[] = {
+    {ClassContains("cc_banner")},
+    {ClassContains("cc-banner")},
+    {IdContains("privacy-policy")},
+    {ClassIs("ads"), TagIs("INS")},
+    {ClassContains("adsbygoogle"), TagIs("INS")},
+    {ClassContains("lg-cc")},
+    {ClassContains("app-recommand-layer")},
+    {ClassContains("tea-mobilebanner")},
+    {IdContains("google_ads_iframe_")},
+    {ClassContains("truste_")},
+    {ClassIs("BetterJsPopOverlay")},
+    {IdContains("ScriptRootC")},
+    {ClassContains("mobile-app-banner")},
+    {ClassContains("notification-bar"), ClassLacks("top-notification-bar")},
+    {ClassContains("as-oil")},
+    {ClassContains("cnil")},
+    {ClassContains("Cnil")},
+    {ClassContains("Partners")},
+    {ClassContains("addelivered")},
+    {ClassContains("billboard")},
+    {ClassContains("cams-widget")},
+    {IdContains("billboard")},
+    {IdIs("afap-above-nav")},
+    {IdIs("b_notificationContainer")},
+    {IdIs("bnp_ttc_div")},
+    {IdIs("AdWidgetContainer")},
+    {IdContains("onesignal")},
+    {ClassContains("site-message")},
+    {ClassContains("contributions__epic")},
+    {ClassContains("outbrain")},
+    {ClassContains("flash-message")},
+    {ClassContains("taboola")},
+    {ClassContains("evidon")},
+    {IdContains("outbrain")},
+    {IdContains("zergnet")},
+    {IdContains("taboola")},
+    {ClassContains("user-msg")},
+    {ClassContains("_Notice")},
+    {ClassContains("adspopup")},
+    {ClassContains("zergnet")},
+    {ClassContains("results--ads")},
+    {ClassContains("js-atb-banner")},
+    {IdContains("content-ad-top-zone")},
+    {IdContains("ad-header-mobile")},
+    {ClassContains("cbz-leaderboard-banner")},
+    {ClassContains("optanon-")},
+    {ClassContains("privacyBarComponent")},
+    {ClassContains("SnackBar")},
+    {ClassContains("question_page_ad")},
+    {ClassContains("TopButton pulse")},
+    {ClassContains("fbPageBanner")},
+    {ClassContains("ad_"), ClassLacks("text-ad_links"), ClassLacks("head"),
+     ClassLacks("pre-ad_container"), ClassLacks("read_"), ClassLacks("pad_"),
+     ClassLacks("oad_"), ClassLacks("ead_")},
+    {ClassIs("cbz-leaderboard-banner")},
+    {ClassIs("playerAdCtn")},
+    {ClassIs("dgpr-drop-down")},
+    {ClassIs("post-footer-meta")},
+    {ClassContains("DualPartInterstitial")},
+    {ClassContains("bst-panel-fixed")},
+    {ClassIs("xenOverlay")},
+    {IdIs("exposeMask")},
+    {ClassIs("EUCookieNotice")},
+    {ClassIs("FloatingOIA-container")},
+    {ClassIs("adContainer")},
+    {ClassIs("sharingfooter")},
+    {ClassIs("mobileHeaderPr")},
+    {ClassIs("underPlayerPr")},
+    {ClassIs("video_ad")},
+    {ClassIs("sda-container")},
+    {ClassIs("md-banner-placement")},
+    {ClassIs("smart-app-banner")},
+    {ClassIs("outeradcontainer")},
+    {ClassIs("mobile-header-space")},
+    {IdIs("bvMSABanner")},
+    {IdIs("notify-container")},
+    {IdIs("mobileFooterPr")},
+    {IdIs("gh-appBanner")},
+    {IdIs("sliding-popup")},
+    {IdIs("smart-banner")},
+    {IdIs("sharingfooter")},
+    {IdIs("privacy-consent")},
+    {IdIs("footer_tc_privacy")},
+    {IdIs("ad-footer")},
+    {IdIs("app-upsell")},
+    {IdIs("dcMaavaronDiv")},
+    {IdIs("x-home-messages")},
+    {IdIs("x-messages-btn")},
+    {IdIs("x-messages")},
+    {IdIs("bannerContainer")},
+    {IdIs("content-supp")},
+    {IdIs("content-supp-player")},
+    {IdContains("ad320x50")},
+    {ClassIs("remove-ads")},
+    {ClassIs("socialfooter")},
+    {IdContains("cookie"), IdLacks("cookie-banner")},
+    {IdContains("share-bar")},
+    {IdContains("my_web_push_")},
+    {IdContains("floatLayer1")},
+    {IdContains("floatLayer2")},
+    {IdContains("floatLayer3")},
+    {IdContains("video_ads_overdiv")},
+    {IdContains("Composite")},
+    {IdContains("header-notices")},
+    {IdContains("div-gpt-")},
+    {IdContains("gpt_unit_")},
+    {IdContains("signup_wall_wrapper")},
+    {ClassContains("vidzi_backscreen2")},
+    {ClassContains("custom-zivert-banner")},
+    {ClassContains("tab-bar-fixed")},
+    {ClassContains("320X50")},
+    {IdIs("adbtm")},
+    {IdIs("notice_banner")},
+    {IdIs("megabanner")},
+    {IdIs("surprise-full")},
+    {IdIs("surprise-sticky")},
+    // The trailing spaces are part of the class attribute.
+    {ClassIs("sticky-buttons  ")},
+    {ClassContains("lefermeur")},
+    {ClassContains("surprise-container")},
+    {ClassContains("facebok")},
+    {ClassContains("bx-campaign-")},
+    {IdIs("wp_social_popup_and_get_traffic")},
+    {IdIs("videooverlay"), ZIndexIs(999999999)},
+    {IdIs("stream-link")},
+    {IdIs("openapp")},
+    {IdIs("relatedcontent")},
+    {IdIs("app-bumper-main")},
+    {IdIs("sm_follow_us")},
+    {IdIs("topSocialPanel")},
+    {IdIs("markup")},
+    {IdIs("button3")},
+    {IdIs("html1")},
+    {IdIs("html3")},
+    {IdIs("sofascoreLiveStream")},
+    {IdIs("player-preview-container")},
+    {IdIs("___ndtvpushdiv")},
+    {IdIs("CatFish")},
+    {IdIs("social-share")},
+    {IdIs("js-gcm-notif")},
+    {IdIs("pub-banner")},
+    {IdIs("upsell-banner")},
+    {ClassIs("add__wrp")},
+    {ClassIs("anchor_ad_wrapper")},
+    {ClassIs("CookieBanner")},
+    {ClassIs("banner-container")},
+    {ClassContains("t-i-agree")},
+    {ClassContains("OUTBRAIN")},
+    {ClassContains("sticky-art")},
+    {ClassContains("sticky-bar-bottom")},
+    {ClassContains("dy-modal-container")},
+    {ClassContains("_3ySVUrHPphSj5g2JqDOctE")},
+    {ClassContains("_2eLBJDo4r_wxFuHkMXLiro")},
+    {ClassContains("social-share")},
+    {IdContains("smartbanner")},
+    {IdContains("toky")},
+    {ClassContains("smartbanner")},
+    {ClassContains("mfp-ready")},
+    {ClassContains("inlineOverlay")},
+    {ClassContains("inlinePopup")},
+    {ClassContains("popup_tosEdition")},
+    {ClassContains("upsell-dialog-lightbox")},
+    {TagIs("ytm-companion-slot")},
+    {TagContains("-companion-")},
+    {TagContains("-promoted-")},
+    {TagIs("ytd-companion-slot-renderer")},
+    {TagIs("ytd-promoted-sparkles-web-renderer")},
+    {TagIs("ytd-single-option-survey-renderer")},
+    {ClassContains("ytd-display-ad-")},
+    {ClassContains("masthead-ad")},
+    {ClassContains("ytd-companion-slot-renderer")},
+    {ClassContains("ytd-video-masthead-ad-v3-renderer")},
+    {ClassContains("ytm-promoted-sparkles-text-search-renderer")},
+    {ClassContains("ytm-promoted-sparkles-web-renderer")},
+    {ClassContains("ytp-ad-image-overlay")},
+    {ClassContains("ytd-action-companion-ad-renderer")},
+    {ClassContains("ytp-ad-overlay-container")},
+    {ClassContains("ytp-ad-progress")},
+    {ClassContains("ytd-carousel-ad-renderer")},
+    {ClassContains("ytd-player-legacy-desktop-watch-ads-renderer")},
+    {ClassContains("ytd-promoted-sparkles-text-search-renderer")},
+    {ClassContains("ytd-search-pyv-renderer")},
+    {ClassContains("ytp-ad-message-container")},
+    {ClassContains("ytp-ad-player-overlay-flyout-cta")},
+    {ClassContains("ytp-paid-content-overlay-text")},
+    {ClassIs("ads")},
+};
+
+// Ad networks, as named by the type attribute of <amp-ad>.
+constexpr ElementHidingClause kAdTypeClauses[] = {
+    {TypeContains("24smi")},
+    {TypeContains("a8")},
+    {TypeContains("a9")},
+    {TypeContains("accesstrade")},
+    {TypeContains("adagio")},
+    {TypeContains("adblade")},
+    {TypeContains("adbutler")},
+    {TypeContains("adform")},
+    {TypeContains("adfox")},
+    {TypeContains("adgeneration")},
+    {TypeContains("adhese")},
+    {TypeContains("adincube")},
+    {TypeContains("adition")},
+    {TypeContains("adman")},
+    {TypeContains("admanmedia")},
+    {TypeContains("admixer")},
+    {TypeContains("adocean")},
+    {TypeContains("adpicker")},
+    {TypeContains("adplugg")},
+    {TypeContains("adreactor")},
+    {TypeContains("ads")},
+    {TypeContains("adsnative")},
+    {TypeContains("adspeed")},
+    {TypeContains("adspirit")},
+    {TypeContains("adstir")},
+    {TypeContains("adtech")},
+    {TypeContains("adthrive")},
+    {TypeContains("aduptech")},
+    {TypeContains("adventive")},
+    {TypeContains("adverline")},
+    {TypeContains("adverticum")},
+    {TypeContains("advertserve")},
+    {TypeContains("affiliateb")},
+    {TypeContains("amoad")},
+    {TypeContains("appnexus")},
+    {TypeContains("appvador")},
+    {TypeContains("atomx")},
+    {TypeContains("bidtellect")},
+    {TypeContains("brainy")},
+    {TypeContains("bringhub")},
+    {TypeContains("broadstreetads")},
+    {TypeContains("caajainfeed")},
+    {TypeContains("capirs")},
+    {TypeContains("caprofitx")},
+    {TypeContains("cedato")},
+    {TypeContains("chargeads")},
+    {TypeContains("colombia")},
+    {TypeContains("connatix")},
+    {TypeContains("contentad")},
+    {TypeContains("criteo")},
+    {TypeContains("custom")},
+    {TypeContains("dable")},
+    {TypeContains("dianomi")},
+    {TypeContains("directadvert")},
+    {TypeContains("distroscale")},
+    {TypeContains("dotandads")},
+    {TypeContains("doubleclick")},
+    {TypeContains("eadv")},
+    {TypeContains("eas")},
+    {TypeContains("engageya")},
+    {TypeContains("eplanning")},
+    {TypeContains("ezoic")},
+    {TypeContains("f1e")},
+    {TypeContains("f1h")},
+    {TypeContains("felmat")},
+    {TypeContains("flite")},
+    {TypeContains("fluct")},
+    {TypeContains("fusion")},
+    {TypeContains("genieessp")},
+    {TypeContains("giraff")},
+    {TypeContains("gmossp")},
+    {TypeContains("gumgum")},
+    {TypeContains("holder")},
+    {TypeContains("ibillboard")},
+    {TypeContains("imedia")},
+    {TypeContains("imobile")},
+    {TypeContains("imonomy")},
+    {TypeContains("improvedigital")},
+    {TypeContains("industrybrains")},
+    {TypeContains("inmobi")},
+    {TypeContains("innity")},
+    {TypeContains("ix")},
+    {TypeContains("kargo")},
+    {TypeContains("kiosked")},
+    {TypeContains("kixer")},
+    {TypeContains("kuadio")},
+    {TypeContains("ligatus")},
+    {TypeContains("lockerdome")},
+    {TypeContains("loka")},
+    {TypeContains("mads")},
+    {TypeContains("mantis")},
+    {TypeContains("mediaimpact")},
+    {TypeContains("medianet")},
+    {TypeContains("mediavine")},
+    {TypeContains("medyanet")},
+    {TypeContains("meg")},
+    {TypeContains("microad")},
+    {TypeContains("mixpo")},
+    {TypeContains("monetizer101")},
+    {TypeContains("mytarget")},
+    {TypeContains("mywidget")},
+    {TypeContains("nativo")},
+    {TypeContains("navegg")},
+    {TypeContains("nend")},
+    {TypeContains("netletix")},
+    {TypeContains("nokta")},
+    {TypeContains("openadstream")},
+    {TypeContains("openx")},
+    {TypeContains("outbrain")},
+    {TypeContains("pixels")},
+    {TypeContains("plista")},
+    {TypeContains("polymorphicads")},
+    {TypeContains("popin")},
+    {TypeContains("postquare")},
+    {TypeContains("pubexchange")},
+    {TypeContains("pubguru")},
+    {TypeContains("pubmatic")},
+    {TypeContains("pubmine")},
+    {TypeContains("pulsepoint")},
+    {TypeContains("purch")},
+    {TypeContains("quoraad")},
+    {TypeContains("relap")},
+    {TypeContains("revcontent")},
+    {TypeContains("revjet")},
+    {TypeContains("rubicon")},
+    {TypeContains("sekindo")},
+    {TypeContains("sharethrough")},
+    {TypeContains("sklik")},
+    {TypeContains("slimcutmedia")},
+    {TypeContains("smartadserver")},
+    {TypeContains("smartclip")},
+    {TypeContains("smi2")},
+    {TypeContains("sogouad")},
+    {TypeContains("sortable")},
+    {TypeContains("sovrn")},
+    {TypeContains("spotx")},
+    {TypeContains("sunmedia")},
+    {TypeContains("swoop")},
+    {TypeContains("taboola")},
+    {TypeContains("teads")},
+    {TypeContains("triplelift")},
+    {TypeContains("trugaze")},
+    {TypeContains("uas")},
+    {TypeContains("valuecommerce")},
+    {TypeContains("videonow")},
+    {TypeContains("viralize")},
+    {TypeContains("vmfive")},
+    {TypeContains("webediads")},
+    {TypeContains("weborama")},
+    {TypeContains("widespace")},
+    {TypeContains("wpmedia")},
+    {TypeContains("xlift")},
+    {TypeContains("yahoo")},
+    {TypeContains("yahoojp")},
+    {TypeContains("yandex")},
+    {TypeContains("yengo")},
+    {TypeContains("yieldbot")},
+    {TypeContains("yieldmo")},
+    {TypeContains("yieldone")},
+    {TypeContains("yieldpro")},
+    {TypeContains("zedo")},
+    {TypeContains("zergnet")},
+    {TypeContains("zucks")},
+};
+
+// Inline sizes of the standard ad slots.
+constexpr ElementHidingClause kAdSizeClauses[] = {
+    {StyleContains("width:250")},
+    {StyleContains("width:468")},
+    {StyleContains("width: 250")},
+    {StyleContains("width: 468"), IdIsNot("banner_ad")},
+    {StyleContains("width:728px;height:90")},
+    {StyleContains("width:728px; height:90")},
+    {StyleContains("width: 728px; height: 90")},
+    {StyleContains("width:728 px; height:90")},
+    {StyleContains("width:728 px; height: 90")},
+    {StyleContains("width:320px;height:50")},
+    {StyleContains("width:320px; height:50")},
+    {StyleContains("width: 320px; height: 50")},
+    {StyleContains("width:320 px; height:50")},
+    {StyleContains("width:320 px; height: 50")},
+    {StyleContains("width:300px;height:50")},
+    {StyleContains("width:300px; height:50")},
+    {StyleContains("width: 300px; height: 50")},
+    {StyleContains("width:300 px; height:50")},
+    {StyleContains("width:300 px; height: 50")},
+    {StyleContains("width:300px;height:250")},
+    {StyleContains("width:300px; height:250")},
+    {StyleContains("width: 300px; height: 250")},
+    {StyleContains("width:300 px; height:250")},
+    {StyleContains("width:300 px; height: 250")},
+    {StyleContains("min-height:90px; max-height:90px")},
+    {StyleContains("min-height:90px; max-height:250px")},
+    {StyleContains("min-height:250px; max-height:250px")},
+    {StyleContains("min-height:300px; max-height:300px")},
+    {StyleContains("min-height:90px;max-height:90px")},
+    {StyleContains("min-height:90px;max-height:250px")},
+    {StyleContains("min-height:250px;max-height:250px")},
+    {StyleContains("min-height:300px;max-height:300px")},
+    {StyleContains("transform-origin: left bottom 0px; height: 137px;")},
+};
+
+constexpr ElementHidingSection kSections[] = {
+    {ElementHidingStage::kAlways, nullptr, kAlwaysClauses},
+    {ElementHidingStage::kAlways, "duckduckgo", kDuckDuckGoClauses},
+    {ElementHidingStage::kExemption, nullptr, kBaitClauses},
+    {ElementHidingStage::kAds, nullptr, kAdsClauses},
+    {ElementHidingStage::kAds, nullptr, kAdTypeClauses},
+    {ElementHidingStage::kAds, nullptr, kAdSizeClauses},
+};
+
+// Search engines, shops and sites whose layout depends on elements the kAds
+// rules would hide.
+constexpr const char* kExemptHosts[] = {
+    "google",
+    "kiwisearchservices.com",
+    "kiwisearchservices.net",
+    "doubleclick",
+    "bing",
+    "qwant",
+    "startpage",
+    "yahoo",
+    ".amazon.",
+    "youtube",
+    "sueddeutsche.de",
+    "find.kiwi",
+    "ecosia.org",
+    "flashx",
+    ".ebay.",
+    "kiwibrowser.org",
+};
+
+}  // namespace
+
+base::span<const ElementHidingSection> DefaultElementHidingSections() {
+  return kSections;
+}
+
+base::span<const char* const> DefaultElementHidingExemptHosts() {
+  return kExemptHosts;
+}
+
+}  // namespace blink
@@ -3,7 +3,8 @@
 // found in the LICENSE file.
 
 #include "third_party/blink/renderer/core/layout/layout_shift_region.h"
-#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+
+#include <algorithm>
 
 namespace blink {
 
@@ -35,6 +36,9 @@ struct SweepEvent {
 class BasicIntervals {
  public:
   // Add all the endpoints before creating the index.
+  void ReserveEndpoints(wtf_size_t count) {
+    endpoints_.ReserveInitialCapacity(count);
+  }
   void AddEndpoint(int endpoint);
   void CreateIndex();
 
@@ -44,14 +48,12 @@ class BasicIntervals {
   unsigned SegmentLength(Segment) const;
 
  private:
+  unsigned IndexOf(int endpoint) const;
+
+  // Sorted and de-duplicated by CreateIndex(), after which the index of an
+  // endpoint is found by binary search. This needs no allocation beyond the
+  // vector itself, unlike a hash map from endpoint to index.
   Vector<int> endpoints_;
-  // Use int64_t which is larger than real |int| since the empty value of the
-  // key is max and deleted value of the key is max - 1 in HashMap.
-  HashMap<int64_t,
-          unsigned,
-          WTF::IntHash<int64_t>,
-          WTF::UnsignedWithZeroKeyHashTraits<int64_t>>
-      endpoint_to_index_;
 
 #if DCHECK_IS_ON()
   bool has_index_ = false;
@@ -66,25 +68,27 @@ class BasicIntervals {
 
 inline void BasicIntervals::AddEndpoint(int endpoint) {
   DCHECK_HAS_INDEX(false);
-
-  // We can't index yet, but use the map to de-dupe.
-  auto ret = endpoint_to_index_.insert(endpoint, 0u);
-  if (ret.is_new_entry)
-    endpoints_.push_back(endpoint);
+  endpoints_.push_back(endpoint);
 }
 
 void BasicIntervals::CreateIndex() {
   DCHECK_HAS_INDEX(false);
   std::sort(endpoints_.begin(), endpoints_.end());
-  unsigned i = 0;
-  for (const int& e : endpoints_)
-    endpoint_to_index_.Set(e, i++);
+  endpoints_.Shrink(static_cast<wtf_size_t>(
+      std::unique(endpoints_.begin(), endpoints_.end()) - endpoints_.begin()));
 
 #if DCHECK_IS_ON()
   has_index_ = true;
 #endif
 }
 
+inline unsigned BasicIntervals::IndexOf(int endpoint) const {
+  const int* it =
+      std::lower_bound(endpoints_.begin(), endpoints_.end(), endpoint);
+  DCHECK(it != endpoints_.end() && *it == endpoint);
+  return static_cast<unsigned>(it - endpoints_.begin());
+}
+
 inline unsigned BasicIntervals::NumIntervals() const {
   DCHECK_HAS_INDEX(true);
   return endpoints_.size() - 1;
@@ -92,7 +96,7 @@ inline unsigned BasicIntervals::NumIntervals() const {
 
 inline Segment BasicIntervals::SegmentFromEndpoints(int start, int end) const {
   DCHECK_HAS_INDEX(true);
-  return Segment{endpoint_to_index_.at(start), endpoint_to_index_.at(end) - 1};
+  return Segment{IndexOf(start), IndexOf(end) - 1};
 }
 
 inline unsigned BasicIntervals::SegmentLength(Segment segment) const {
@@ -268,6 +272,7 @@ uint64_t Sweeper::Sweep() const {
 }
 
 void Sweeper::InitIntervals(BasicIntervals& y_vals) const {
+  y_vals.ReserveEndpoints(rects_.size() << 1);
   for (const gfx::Rect& rect : rects_) {
     y_vals.AddEndpoint(rect.y());
     y_vals.AddEndpoint(rect.bottom());
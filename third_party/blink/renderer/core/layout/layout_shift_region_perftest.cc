@@ -0,0 +1,59 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// A benchmark of LayoutShiftRegion::Area() for frames in which many small
+// elements shift at once, like the ad slots and lazily loaded images of a
+// long page, each contributing its old and new rect.
+
+#include "third_party/blink/renderer/core/layout/layout_shift_region.h"
+
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace blink {
+
+namespace {
+
+constexpr int kIterations = 100;
+
+void MeasureArea(int columns, int rows, const char* story) {
+  LayoutShiftRegion region;
+  for (int row = 0; row < rows; ++row) {
+    for (int column = 0; column < columns; ++column) {
+      // A 90x60 element moving down by 25px, so that its old and new rects
+      // overlap, and the new rect overlaps the next row's old one.
+      gfx::Rect old_rect(column * 100, row * 80, 90, 60);
+      region.AddRect(old_rect);
+      old_rect.Offset(0, 25);
+      region.AddRect(old_rect);
+    }
+  }
+
+  uint64_t area = 0;
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kIterations; ++i)
+    area = region.Area();
+  base::TimeDelta elapsed = timer.Elapsed();
+  EXPECT_LT(0u, area);
+
+  perf_test::PerfResultReporter reporter("BlinkLayoutShiftRegion", story);
+  reporter.RegisterFyiMetric("NumRects", "");
+  reporter.AddResult("NumRects",
+                     static_cast<double>(region.GetRects().size()));
+  reporter.RegisterImportantMetric("AreaTime", "us");
+  reporter.AddResult("AreaTime", elapsed.InMicrosecondsF() / kIterations);
+}
+
+}  // namespace
+
+TEST(LayoutShiftRegionPerfTest, FewElements) {
+  MeasureArea(4, 25, "FewElements");
+}
+
+TEST(LayoutShiftRegionPerfTest, ManyElements) {
+  MeasureArea(8, 500, "ManyElements");
+}
+
+}  // namespace blink
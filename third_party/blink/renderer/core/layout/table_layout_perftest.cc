@@ -0,0 +1,110 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// A benchmark of auto table layout for tables with many rows. It reports the
+// time of the first layout, of a relayout that only changes the table's
+// width, and of a relayout after one cell's text changed, which makes the
+// column widths be computed again from every cell.
+
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/core/dom/text.h"
+#include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+namespace {
+
+constexpr int kRows = 2000;
+constexpr int kColumns = 8;
+constexpr int kIterations = 5;
+
+String TableHTML() {
+  StringBuilder html;
+  html.Append("<table id=table>");
+  for (int row = 0; row < kRows; ++row) {
+    html.Append("<tr>");
+    for (int column = 0; column < kColumns; ++column) {
+      html.Append("<td>");
+      // Cells of different widths, so that each column has a widest cell.
+      for (int word = 0; word <= (row + column) % 5; ++word)
+        html.Append("cell text ");
+      html.Append("</td>");
+    }
+    html.Append("</tr>");
+  }
+  html.Append("</table>");
+  return html.ToString();
+}
+
+}  // namespace
+
+class TableLayoutPerfTest : public RenderingTest {
+ protected:
+  void MeasureTableLayout(const char* story) {
+    const String html = TableHTML();
+
+    base::TimeDelta first_layout_time;
+    for (int i = 0; i < kIterations; ++i) {
+      GetDocument().body()->setInnerHTML("");
+      UpdateAllLifecyclePhasesForTest();
+      GetDocument().body()->setInnerHTML(html);
+      base::ElapsedTimer timer;
+      UpdateAllLifecyclePhasesForTest();
+      first_layout_time += timer.Elapsed();
+    }
+
+    Element* table = GetDocument().getElementById("table");
+    base::TimeDelta width_change_time;
+    for (int i = 0; i < kIterations; ++i) {
+      table->setAttribute(html_names::kStyleAttr,
+                          i % 2 ? "width: 600px" : "width: 700px");
+      base::ElapsedTimer timer;
+      UpdateAllLifecyclePhasesForTest();
+      width_change_time += timer.Elapsed();
+    }
+
+    auto* text = To<Text>(table->firstElementChild()
+                              ->firstElementChild()
+                              ->firstElementChild()
+                              ->firstChild());
+    base::TimeDelta content_change_time;
+    for (int i = 0; i < kIterations; ++i) {
+      text->setData(i % 2 ? "cell" : "cell text");
+      base::ElapsedTimer timer;
+      UpdateAllLifecyclePhasesForTest();
+      content_change_time += timer.Elapsed();
+    }
+
+    perf_test::PerfResultReporter reporter("BlinkTableLayout", story);
+    reporter.RegisterImportantMetric("FirstLayoutTime", "ms");
+    reporter.AddResult("FirstLayoutTime",
+                       first_layout_time.InMillisecondsF() / kIterations);
+    reporter.RegisterImportantMetric("WidthChangeTime", "ms");
+    reporter.AddResult("WidthChangeTime",
+                       width_change_time.InMillisecondsF() / kIterations);
+    reporter.RegisterImportantMetric("ContentChangeTime", "ms");
+    reporter.AddResult("ContentChangeTime",
+                       content_change_time.InMillisecondsF() / kIterations);
+  }
+};
+
+// TableLayoutAlgorithmAuto only runs for legacy layout.
+class LegacyTableLayoutPerfTest : public TableLayoutPerfTest,
+                                  private ScopedLayoutNGForTest {
+ protected:
+  LegacyTableLayoutPerfTest() : ScopedLayoutNGForTest(false) {}
+};
+
+TEST_F(TableLayoutPerfTest, AutoTable) {
+  MeasureTableLayout("AutoTable");
+}
+
+TEST_F(LegacyTableLayoutPerfTest, AutoTable) {
+  MeasureTableLayout("LegacyAutoTable");
+}
+
+}  // namespace blink
@@ -334,6 +334,7 @@ TextAutosizer::BeginLayoutBehavior TextAutosizer::PrepareForLayout(
 
   if (!first_block_to_begin_layout_) {
     first_block_to_begin_layout_ = block;
+    metrics_.RecordLayoutPass();
     PrepareClusterStack(block->Parent());
     if (IsA<LayoutView>(block))
       CheckSuperclusterConsistency();
@@ -1434,10 +1435,12 @@ TextAutosizer::LayoutScope::LayoutScope(LayoutBlock* block,
   if (!text_autosizer_)
     return;
 
-  if (text_autosizer_->ShouldHandleLayout())
+  if (text_autosizer_->ShouldHandleLayout()) {
+    TextAutosizerMetrics::ScopedBlockTimer timer(text_autosizer_->metrics_);
     text_autosizer_->BeginLayout(block_, layouter);
-  else
+  } else {
     text_autosizer_ = nullptr;
+  }
 }
 
 TextAutosizer::LayoutScope::~LayoutScope() {
@@ -1449,6 +1452,7 @@ TextAutosizer::TableLayoutScope::TableLayoutScope(LayoutNGTableInterface* table)
     : LayoutScope(To<LayoutBlock>(table->ToMutableLayoutObject())) {
   if (text_autosizer_) {
     DCHECK(text_autosizer_->ShouldHandleLayout());
+    TextAutosizerMetrics::ScopedBlockTimer timer(text_autosizer_->metrics_);
     text_autosizer_->InflateAutoTable(table);
   }
 }
@@ -1488,6 +1492,7 @@ TextAutosizer::NGLayoutScope::NGLayoutScope(LayoutBox* box,
   // least if the autosizer is enabled.
   box_->SetLogicalWidth(inline_size);
 
+  TextAutosizerMetrics::ScopedBlockTimer timer(text_autosizer_->metrics_);
   text_autosizer_->BeginLayout(To<LayoutBlock>(box_), nullptr);
 }
 
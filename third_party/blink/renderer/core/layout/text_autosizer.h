@@ -36,6 +36,7 @@
 #include "base/dcheck_is_on.h"
 #include "third_party/blink/public/mojom/frame/text_autosizer_page_info.mojom-blink.h"
 #include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/layout/text_autosizer_metrics.h"
 #include "third_party/blink/renderer/platform/geometry/layout_unit.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_set.h"
@@ -98,6 +99,8 @@ class CORE_EXPORT TextAutosizer final : public GarbageCollected<TextAutosizer> {
 
   bool PageNeedsAutosizing() const;
 
+  TextAutosizerMetrics& Metrics() { return metrics_; }
+
   void Trace(Visitor*) const;
 
   class LayoutScope {
@@ -389,6 +392,8 @@ class CORE_EXPORT TextAutosizer final : public GarbageCollected<TextAutosizer> {
   // Inflate reports a use counter if we're autosizing a cross site iframe.
   // This flag makes sure we only check it once per layout pass.
   bool did_check_cross_site_use_count_;
+
+  TextAutosizerMetrics metrics_;
 };
 
 }  // namespace blink
@@ -0,0 +1,35 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/layout/text_autosizer_metrics.h"
+
+#include "services/metrics/public/cpp/metrics_utils.h"
+#include "services/metrics/public/cpp/ukm_entry_builder.h"
+#include "services/metrics/public/cpp/ukm_recorder.h"
+
+namespace blink {
+
+void TextAutosizerMetrics::PublishAllMetrics(ukm::UkmRecorder* ukm_recorder,
+                                             ukm::SourceId source_id) {
+  if (!publish_once_.ShouldPublish(ukm_recorder, source_id) || !BlockCount())
+    return;
+
+  ukm::UkmEntryBuilder builder(source_id, "Kiwi.TextAutosizing");
+  builder.SetMetric("LayoutPasses", ukm::GetExponentialBucketMinForCounts1000(
+                                        layout_pass_count_));
+  builder.SetMetric("Blocks",
+                    ukm::GetExponentialBucketMinForCounts1000(BlockCount()));
+  builder.SetMetric("AutosizingTime",
+                    ukm::GetExponentialBucketMinForUserTiming(
+                        EstimatedTime().InMicroseconds()));
+  if (layout_pass_count_) {
+    builder.SetMetric("AutosizingTimePerLayoutPass",
+                      ukm::GetExponentialBucketMinForUserTiming(
+                          (EstimatedTime() / layout_pass_count_)
+                              .InMicroseconds()));
+  }
+  builder.Record(ukm_recorder);
+}
+
+}  // namespace blink
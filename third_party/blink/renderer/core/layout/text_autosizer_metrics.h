@@ -0,0 +1,71 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_TEXT_AUTOSIZER_METRICS_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_TEXT_AUTOSIZER_METRICS_H_
+
+#include <stdint.h>
+
+#include "base/time/time.h"
+#include "services/metrics/public/cpp/ukm_source_id.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/frame/sampled_ukm_metrics.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace ukm {
+class UkmRecorder;
+}  // namespace ukm
+
+namespace blink {
+
+// Counts, for one document, the layout passes TextAutosizer took part in and
+// the blocks it inflated, and times a sample of those inflations. The totals
+// are recorded as one "Kiwi.TextAutosizing" UKM event when the document shuts
+// down, so that the autosizer's share of layout time on text-heavy pages can
+// be told apart from the rest of layout.
+class CORE_EXPORT TextAutosizerMetrics {
+  DISALLOW_NEW();
+
+ public:
+  // Counts a block autosized for |metrics|, and times it if it is sampled.
+  class CORE_EXPORT ScopedBlockTimer {
+    STACK_ALLOCATED();
+
+   public:
+    explicit ScopedBlockTimer(TextAutosizerMetrics& metrics)
+        : scope_(&metrics.block_timer_) {}
+    ScopedBlockTimer(const ScopedBlockTimer&) = delete;
+    ScopedBlockTimer& operator=(const ScopedBlockTimer&) = delete;
+
+   private:
+    SampledTimer::Scope scope_;
+  };
+
+  TextAutosizerMetrics() = default;
+  TextAutosizerMetrics(const TextAutosizerMetrics&) = delete;
+  TextAutosizerMetrics& operator=(const TextAutosizerMetrics&) = delete;
+
+  // Records that a layout pass started autosizing at its first block.
+  void RecordLayoutPass() { ++layout_pass_count_; }
+
+  // Records the UKM event for |source_id|, unless no block was autosized.
+  // Later calls are no-ops.
+  void PublishAllMetrics(ukm::UkmRecorder* ukm_recorder,
+                         ukm::SourceId source_id);
+
+  uint32_t LayoutPassCount() const { return layout_pass_count_; }
+  uint32_t BlockCount() const { return block_timer_.Count(); }
+  // The total time of the blocks, extrapolated from the sampled ones.
+  base::TimeDelta EstimatedTime() const { return block_timer_.EstimatedTime(); }
+
+ private:
+  UkmPublishOnce publish_once_;
+
+  uint32_t layout_pass_count_ = 0;
+  SampledTimer block_timer_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_TEXT_AUTOSIZER_METRICS_H_
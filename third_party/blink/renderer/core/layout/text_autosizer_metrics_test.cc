@@ -0,0 +1,55 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/layout/text_autosizer_metrics.h"
+
+#include "components/ukm/test_ukm_recorder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+namespace {
+
+constexpr ukm::SourceId kSourceId = 1;
+
+}  // namespace
+
+TEST(TextAutosizerMetricsTest, ScopedBlockTimer) {
+  TextAutosizerMetrics metrics;
+  metrics.RecordLayoutPass();
+  { TextAutosizerMetrics::ScopedBlockTimer timer(metrics); }
+  { TextAutosizerMetrics::ScopedBlockTimer timer(metrics); }
+  EXPECT_EQ(1u, metrics.LayoutPassCount());
+  EXPECT_EQ(2u, metrics.BlockCount());
+}
+
+TEST(TextAutosizerMetricsTest, PublishAllMetrics) {
+  ukm::TestUkmRecorder recorder;
+
+  // Nothing is recorded for documents that autosized no blocks.
+  TextAutosizerMetrics metrics;
+  metrics.RecordLayoutPass();
+  metrics.PublishAllMetrics(&recorder, kSourceId);
+  EXPECT_EQ(0u, recorder.entries_count());
+
+  TextAutosizerMetrics autosized_metrics;
+  autosized_metrics.RecordLayoutPass();
+  { TextAutosizerMetrics::ScopedBlockTimer timer(autosized_metrics); }
+  autosized_metrics.PublishAllMetrics(&recorder, kSourceId);
+  autosized_metrics.PublishAllMetrics(&recorder, kSourceId);
+  EXPECT_EQ(1u, recorder.entries_count());
+
+  auto entries = recorder.GetEntriesByName("Kiwi.TextAutosizing");
+  ASSERT_EQ(1u, entries.size());
+  EXPECT_EQ(kSourceId, entries[0]->source_id);
+  EXPECT_EQ(1, *ukm::TestUkmRecorder::GetEntryMetric(entries[0],
+                                                     "LayoutPasses"));
+  EXPECT_EQ(1, *ukm::TestUkmRecorder::GetEntryMetric(entries[0], "Blocks"));
+  EXPECT_TRUE(
+      ukm::TestUkmRecorder::EntryHasMetric(entries[0], "AutosizingTime"));
+  EXPECT_TRUE(ukm::TestUkmRecorder::EntryHasMetric(
+      entries[0], "AutosizingTimePerLayoutPass"));
+}
+
+}  // namespace blink
@@ -87,6 +87,32 @@ TEST_F(TextAutosizerTest, SimpleParagraph) {
                   autosized->GetLayoutObject()->StyleRef().ComputedFontSize());
 }
 
+TEST_F(TextAutosizerTest, Metrics) {
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      html { font-size: 16px; }
+      body { width: 800px; margin: 0; overflow-y: hidden; }
+    </style>
+    <div id='autosized'>
+      Lorem ipsum dolor sit amet, consectetur adipisicing elit, sed do
+      eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim
+      ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut
+      aliquip ex ea commodo consequat.
+    </div>
+  )HTML");
+  TextAutosizerMetrics& metrics = GetDocument().GetTextAutosizer()->Metrics();
+  uint32_t layout_passes = metrics.LayoutPassCount();
+  uint32_t blocks = metrics.BlockCount();
+  EXPECT_LT(0u, layout_passes);
+  EXPECT_LT(0u, blocks);
+
+  GetDocument().getElementById("autosized")->setAttribute(
+      html_names::kStyleAttr, "width: 400px");
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_LT(layout_passes, metrics.LayoutPassCount());
+  EXPECT_LT(blocks, metrics.BlockCount());
+}
+
 TEST_F(TextAutosizerTest, TextSizeAdjustDisablesAutosizing) {
   SetBodyInnerHTML(R"HTML(
     <style>
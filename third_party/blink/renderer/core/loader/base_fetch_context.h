@@ -24,9 +24,11 @@ namespace blink {
 
 class ClientHintsPreferences;
 class ConsoleMessage;
+class ContentBlockingMetrics;
 class DOMWrapperWorld;
 class DetachableResourceFetcherProperties;
 class KURL;
+class RequestBlockVerdictCache;
 class SecurityOrigin;
 class SubresourceFilter;
 class WebSocketHandshakeThrottle;
@@ -137,6 +139,18 @@ class CORE_EXPORT BaseFetchContext : public FetchContext {
   virtual const KURL& Url() const = 0;
   virtual ContentSecurityPolicy* GetContentSecurityPolicy() const = 0;
 
+  // Returns the cache of host-only block verdicts for the requests of this
+  // context, or nullptr if verdicts are not cached.
+  virtual RequestBlockVerdictCache* GetRequestBlockVerdictCache() const {
+    return nullptr;
+  }
+
+  // Returns the counters the request blocking checks of this context report
+  // to, or nullptr if they are not reported.
+  virtual ContentBlockingMetrics* GetContentBlockingMetrics() const {
+    return nullptr;
+  }
+
   // TODO(yhirano): Remove this.
   virtual void AddConsoleMessage(ConsoleMessage*) const = 0;
 
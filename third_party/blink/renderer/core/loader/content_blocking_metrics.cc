@@ -0,0 +1,121 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/content_blocking_metrics.h"
+
+#include <iterator>
+
+#include "services/metrics/public/cpp/metrics_utils.h"
+#include "services/metrics/public/cpp/ukm_entry_builder.h"
+#include "services/metrics/public/cpp/ukm_recorder.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
+
+namespace blink {
+
+namespace {
+
+// The UKM metric of each RequestBlockGroup, in enum order.
+constexpr const char* kHitMetricNames[] = {
+    "AllowlistHits",   "TrackerHits",     "AdsHits",      "AntiAdblockHits",
+    "ConsentHits",     "NewsletterHits",  "SurveyHits",   "ChatHits",
+    "RatingHits",      "PushHits",        "LocationHits", "AppHits",
+    "TranslationHits", "ScrollToTopHits", "VideoHits",    "SubscribeHits",
+};
+static_assert(std::size(kHitMetricNames) ==
+                  static_cast<size_t>(RequestBlockGroup::kMaxValue) + 1,
+              "Each RequestBlockGroup needs a metric name");
+
+// The UKM metrics of each Check, in enum order.
+constexpr const char* kCheckCountMetricNames[] = {"RequestChecks",
+                                                  "ElementChecks"};
+constexpr const char* kCheckTimeMetricNames[] = {"RequestCheckTime",
+                                                 "ElementCheckTime"};
+
+struct MainThreadCheckTiming {
+  unsigned timing_all_checks = 0;
+  base::TimeDelta time;
+};
+
+MainThreadCheckTiming& GetMainThreadCheckTiming() {
+  DCHECK(IsMainThread());
+  static MainThreadCheckTiming timing;
+  return timing;
+}
+
+}  // namespace
+
+ContentBlockingMetrics::ScopedCheckTimer::ScopedCheckTimer(
+    ContentBlockingMetrics* metrics,
+    Check check)
+    : scope_(metrics ? &metrics->checks_[static_cast<wtf_size_t>(check)]
+                     : nullptr) {
+  // Checks are also made on worker threads, which are never attributed.
+  if (IsMainThread() && GetMainThreadCheckTiming().timing_all_checks)
+    main_thread_start_ = base::TimeTicks::Now();
+}
+
+ContentBlockingMetrics::ScopedCheckTimer::~ScopedCheckTimer() {
+  if (main_thread_start_) {
+    GetMainThreadCheckTiming().time +=
+        base::TimeTicks::Now() - *main_thread_start_;
+  }
+}
+
+ContentBlockingMetrics::ContentBlockingMetrics() = default;
+
+ContentBlockingMetrics::~ContentBlockingMetrics() = default;
+
+void ContentBlockingMetrics::RecordRequestVerdict(
+    const RequestBlocker::Verdict& verdict) {
+  ++hit_counts_[static_cast<wtf_size_t>(verdict.group)];
+}
+
+// static
+void ContentBlockingMetrics::StartTimingAllChecks() {
+  ++GetMainThreadCheckTiming().timing_all_checks;
+}
+
+// static
+void ContentBlockingMetrics::StopTimingAllChecks() {
+  MainThreadCheckTiming& timing = GetMainThreadCheckTiming();
+  DCHECK(timing.timing_all_checks);
+  --timing.timing_all_checks;
+}
+
+// static
+base::TimeDelta ContentBlockingMetrics::CheckTimeOnMainThread() {
+  return GetMainThreadCheckTiming().time;
+}
+
+void ContentBlockingMetrics::PublishAllMetrics(ukm::UkmRecorder* ukm_recorder,
+                                               ukm::SourceId source_id) {
+  if (!publish_once_.ShouldPublish(ukm_recorder, source_id) ||
+      (!CheckCount(Check::kRequest) && !CheckCount(Check::kElement))) {
+    return;
+  }
+
+  ukm::UkmEntryBuilder builder(source_id, "Kiwi.ContentBlocking");
+  for (wtf_size_t group = 0; group < std::size(hit_counts_); ++group) {
+    if (hit_counts_[group]) {
+      builder.SetMetric(kHitMetricNames[group],
+                        ukm::GetExponentialBucketMinForCounts1000(
+                            hit_counts_[group]));
+    }
+  }
+  builder.SetMetric(
+      "HiddenElements",
+      ukm::GetExponentialBucketMinForCounts1000(hidden_element_count_));
+  for (wtf_size_t check = 0; check < kCheckCount; ++check) {
+    builder.SetMetric(
+        kCheckCountMetricNames[check],
+        ukm::GetExponentialBucketMinForCounts1000(checks_[check].Count()));
+    builder.SetMetric(kCheckTimeMetricNames[check],
+                      ukm::GetExponentialBucketMinForUserTiming(
+                          EstimatedCheckTime(static_cast<Check>(check))
+                              .InMicroseconds()));
+  }
+  builder.Record(ukm_recorder);
+}
+
+}  // namespace blink
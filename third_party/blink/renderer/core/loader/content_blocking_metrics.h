@@ -0,0 +1,105 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_CONTENT_BLOCKING_METRICS_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_CONTENT_BLOCKING_METRICS_H_
+
+#include <stdint.h>
+
+#include "base/time/time.h"
+#include "services/metrics/public/cpp/ukm_source_id.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/frame/sampled_ukm_metrics.h"
+#include "third_party/blink/renderer/core/loader/request_blocker.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace ukm {
+class UkmRecorder;
+}  // namespace ukm
+
+namespace blink {
+
+// Counts, for one document, the RequestBlocker rules that matched, by
+// RequestBlockGroup, and the elements ElementHider hid from
+// LayoutObject::CreateObject(). It also times a sample of those checks.
+// The totals are recorded as one "Kiwi.ContentBlocking" UKM event when the
+// document shuts down, so that rule groups that never fire can be pruned and
+// the main-thread cost of the checks tracked.
+class CORE_EXPORT ContentBlockingMetrics {
+  USING_FAST_MALLOC(ContentBlockingMetrics);
+
+ public:
+  enum class Check {
+    // The RequestBlocker stages of BaseFetchContext::CanRequestInternal().
+    kRequest,
+    // ElementHider::Evaluate() in LayoutObject::CreateObject().
+    kElement,
+  };
+  static constexpr wtf_size_t kCheckCount = 2;
+
+  // Counts a check made for |metrics|, if |metrics| is non-null, and times it
+  // if it is sampled. While all checks are timed, it also adds the time of
+  // its scope to CheckTimeOnMainThread().
+  class CORE_EXPORT ScopedCheckTimer {
+    STACK_ALLOCATED();
+
+   public:
+    ScopedCheckTimer(ContentBlockingMetrics* metrics, Check check);
+    ScopedCheckTimer(const ScopedCheckTimer&) = delete;
+    ScopedCheckTimer& operator=(const ScopedCheckTimer&) = delete;
+    ~ScopedCheckTimer();
+
+   private:
+    SampledTimer::Scope scope_;
+    absl::optional<base::TimeTicks> main_thread_start_;
+  };
+
+  ContentBlockingMetrics();
+  ContentBlockingMetrics(const ContentBlockingMetrics&) = delete;
+  ContentBlockingMetrics& operator=(const ContentBlockingMetrics&) = delete;
+  ~ContentBlockingMetrics();
+
+  // Records that a rule of |verdict|'s group decided a request.
+  void RecordRequestVerdict(const RequestBlocker::Verdict& verdict);
+  // Records that an element was given no layout object.
+  void RecordElementHidden() { ++hidden_element_count_; }
+
+  // Records the UKM event for |source_id|, unless nothing was counted. Later
+  // calls are no-ops.
+  void PublishAllMetrics(ukm::UkmRecorder* ukm_recorder,
+                         ukm::SourceId source_id);
+
+  uint32_t HitCount(RequestBlockGroup group) const {
+    return hit_counts_[static_cast<wtf_size_t>(group)];
+  }
+  uint32_t HiddenElementCount() const { return hidden_element_count_; }
+  uint32_t CheckCount(Check check) const {
+    return checks_[static_cast<wtf_size_t>(check)].Count();
+  }
+  // The total time of the checks, extrapolated from the sampled ones.
+  base::TimeDelta EstimatedCheckTime(Check check) const {
+    return checks_[static_cast<wtf_size_t>(check)].EstimatedTime();
+  }
+
+  // Between the calls, every check made on the main thread is timed, sampled
+  // or not, and added to CheckTimeOnMainThread(). PerformanceMonitor does so
+  // around the tasks whose time it attributes. The calls nest.
+  static void StartTimingAllChecks();
+  static void StopTimingAllChecks();
+  // The time of the main-thread checks made while all checks were timed.
+  static base::TimeDelta CheckTimeOnMainThread();
+
+ private:
+  UkmPublishOnce publish_once_;
+
+  uint32_t hit_counts_[static_cast<wtf_size_t>(RequestBlockGroup::kMaxValue) +
+                       1] = {};
+  uint32_t hidden_element_count_ = 0;
+  SampledTimer checks_[kCheckCount];
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_CONTENT_BLOCKING_METRICS_H_
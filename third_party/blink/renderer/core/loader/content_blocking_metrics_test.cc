@@ -0,0 +1,111 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/content_blocking_metrics.h"
+
+#include "components/ukm/test_ukm_recorder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+namespace {
+
+constexpr ukm::SourceId kSourceId = 1;
+
+RequestBlocker::Verdict BlockVerdict(RequestBlockGroup group) {
+  return {RequestBlockAction::kBlock, group, 0};
+}
+
+}  // namespace
+
+TEST(ContentBlockingMetricsTest, Counts) {
+  ContentBlockingMetrics metrics;
+  metrics.RecordRequestVerdict(BlockVerdict(RequestBlockGroup::kTracker));
+  metrics.RecordRequestVerdict(BlockVerdict(RequestBlockGroup::kTracker));
+  metrics.RecordRequestVerdict(BlockVerdict(RequestBlockGroup::kAds));
+  metrics.RecordElementHidden();
+  EXPECT_EQ(2u, metrics.HitCount(RequestBlockGroup::kTracker));
+  EXPECT_EQ(1u, metrics.HitCount(RequestBlockGroup::kAds));
+  EXPECT_EQ(0u, metrics.HitCount(RequestBlockGroup::kChat));
+  EXPECT_EQ(1u, metrics.HiddenElementCount());
+}
+
+TEST(ContentBlockingMetricsTest, ScopedCheckTimer) {
+  ContentBlockingMetrics metrics;
+  {
+    ContentBlockingMetrics::ScopedCheckTimer timer(
+        &metrics, ContentBlockingMetrics::Check::kRequest);
+  }
+  {
+    ContentBlockingMetrics::ScopedCheckTimer timer(
+        nullptr, ContentBlockingMetrics::Check::kElement);
+  }
+  EXPECT_EQ(1u, metrics.CheckCount(ContentBlockingMetrics::Check::kRequest));
+  EXPECT_EQ(0u, metrics.CheckCount(ContentBlockingMetrics::Check::kElement));
+  EXPECT_EQ(
+      base::TimeDelta(),
+      metrics.EstimatedCheckTime(ContentBlockingMetrics::Check::kElement));
+}
+
+TEST(ContentBlockingMetricsTest, TimingAllChecks) {
+  base::TimeDelta time_before = ContentBlockingMetrics::CheckTimeOnMainThread();
+  {
+    // Checks are not added up when nobody asked for them.
+    ContentBlockingMetrics::ScopedCheckTimer timer(
+        nullptr, ContentBlockingMetrics::Check::kRequest);
+  }
+  EXPECT_EQ(time_before, ContentBlockingMetrics::CheckTimeOnMainThread());
+
+  ContentBlockingMetrics metrics;
+  ContentBlockingMetrics::StartTimingAllChecks();
+  for (uint32_t i = 0; i < SampledTimer::kSampleInterval + 1; ++i) {
+    ContentBlockingMetrics::ScopedCheckTimer timer(
+        &metrics, ContentBlockingMetrics::Check::kElement);
+  }
+  {
+    ContentBlockingMetrics::ScopedCheckTimer timer(
+        nullptr, ContentBlockingMetrics::Check::kRequest);
+  }
+  ContentBlockingMetrics::StopTimingAllChecks();
+  EXPECT_GE(ContentBlockingMetrics::CheckTimeOnMainThread(), time_before);
+
+  // The sampling of |metrics| is unchanged.
+  EXPECT_EQ(SampledTimer::kSampleInterval + 1,
+            metrics.CheckCount(ContentBlockingMetrics::Check::kElement));
+}
+
+TEST(ContentBlockingMetricsTest, PublishAllMetrics) {
+  ukm::TestUkmRecorder recorder;
+  ContentBlockingMetrics metrics;
+
+  // Nothing is recorded for documents that made no checks.
+  metrics.PublishAllMetrics(&recorder, kSourceId);
+  EXPECT_EQ(0u, recorder.entries_count());
+
+  ContentBlockingMetrics checked_metrics;
+  {
+    ContentBlockingMetrics::ScopedCheckTimer timer(
+        &checked_metrics, ContentBlockingMetrics::Check::kRequest);
+    checked_metrics.RecordRequestVerdict(
+        BlockVerdict(RequestBlockGroup::kTracker));
+  }
+  checked_metrics.PublishAllMetrics(&recorder, kSourceId);
+  checked_metrics.PublishAllMetrics(&recorder, kSourceId);
+  EXPECT_EQ(1u, recorder.entries_count());
+
+  auto entries = recorder.GetEntriesByName("Kiwi.ContentBlocking");
+  ASSERT_EQ(1u, entries.size());
+  EXPECT_EQ(kSourceId, entries[0]->source_id);
+  EXPECT_EQ(1, *ukm::TestUkmRecorder::GetEntryMetric(entries[0],
+                                                     "TrackerHits"));
+  EXPECT_FALSE(ukm::TestUkmRecorder::EntryHasMetric(entries[0], "AdsHits"));
+  EXPECT_EQ(1, *ukm::TestUkmRecorder::GetEntryMetric(entries[0],
+                                                     "RequestChecks"));
+  EXPECT_EQ(0, *ukm::TestUkmRecorder::GetEntryMetric(entries[0],
+                                                     "ElementChecks"));
+  EXPECT_TRUE(
+      ukm::TestUkmRecorder::EntryHasMetric(entries[0], "RequestCheckTime"));
+}
+
+}  // namespace blink
@@ -64,6 +64,7 @@
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/document_init.h"
 #include "third_party/blink/renderer/core/dom/document_parser.h"
+#include "third_party/blink/renderer/core/dom/document_parser_timing.h"
 #include "third_party/blink/renderer/core/dom/events/event.h"
 #include "third_party/blink/renderer/core/dom/scriptable_document_parser.h"
 #include "third_party/blink/renderer/core/dom/weak_identifier_map.h"
@@ -1259,7 +1260,12 @@ void DocumentLoader::CommitData(const char* bytes, size_t length) {
   base::AutoReset<bool> reentrancy_protector(&in_commit_data_, true);
   if (length)
     data_received_ = true;
+  // The parser may detach, and the frame go away, while handling the bytes.
+  Document* document = frame_->GetDocument();
+  base::TimeTicks append_start = base::TimeTicks::Now();
   parser_->AppendBytes(bytes, length);
+  DocumentParserTiming::From(*document).RecordBytesAppended(
+      length, base::TimeTicks::Now() - append_start);
 }
 
 mojom::CommitResult DocumentLoader::CommitSameDocumentNavigation(
@@ -659,6 +659,17 @@ void FrameFetchContext::AddConsoleMessage(ConsoleMessage* message) const {
   document_->AddConsoleMessage(message);
 }
 
+RequestBlockVerdictCache* FrameFetchContext::GetRequestBlockVerdictCache()
+    const {
+  return &request_block_verdict_cache_;
+}
+
+ContentBlockingMetrics* FrameFetchContext::GetContentBlockingMetrics() const {
+  if (GetResourceFetcherProperties().IsDetached())
+    return nullptr;
+  return document_->GetContentBlockingMetrics();
+}
+
 WebContentSettingsClient* FrameFetchContext::GetContentSettingsClient() const {
   if (GetResourceFetcherProperties().IsDetached())
     return nullptr;
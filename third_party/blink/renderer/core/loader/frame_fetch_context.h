@@ -40,6 +40,7 @@ n * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
 #include "third_party/blink/public/mojom/service_worker/service_worker_object.mojom-blink-forward.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/loader/base_fetch_context.h"
+#include "third_party/blink/renderer/core/loader/request_block_verdict_cache.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 #include "third_party/blink/renderer/platform/loader/fetch/client_hints_preferences.h"
 #include "third_party/blink/renderer/platform/loader/fetch/fetch_parameters.h"
@@ -178,6 +179,8 @@ class CORE_EXPORT FrameFetchContext final : public BaseFetchContext,
   const KURL& Url() const override;
   ContentSecurityPolicy* GetContentSecurityPolicy() const override;
   void AddConsoleMessage(ConsoleMessage*) const override;
+  RequestBlockVerdictCache* GetRequestBlockVerdictCache() const override;
+  ContentBlockingMetrics* GetContentBlockingMetrics() const override;
 
   WebContentSettingsClient* GetContentSettingsClient() const;
   Settings* GetSettings() const;
@@ -210,6 +213,9 @@ class CORE_EXPORT FrameFetchContext final : public BaseFetchContext,
 
   // Non-null only when detached.
   Member<FrozenState> frozen_state_;
+
+  // Mutated from the const CanRequest() path.
+  mutable RequestBlockVerdictCache request_block_verdict_cache_;
 };
 
 }  // namespace blink
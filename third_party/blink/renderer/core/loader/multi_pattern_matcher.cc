@@ -0,0 +1,232 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/multi_pattern_matcher.h"
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "third_party/blink/renderer/platform/wtf/deque.h"
+
+namespace blink {
+
+MultiPatternMatcher::Builder::Builder() {
+  trie_.Grow(1);
+}
+
+MultiPatternMatcher::Builder::~Builder() = default;
+
+void MultiPatternMatcher::Builder::AddPattern(const StringView& pattern,
+                                               uint32_t id) {
+  if (pattern.IsEmpty())
+    return;
+  uint32_t node = 0;
+  for (wtf_size_t i = 0; i < pattern.length(); ++i) {
+    UChar character = pattern[i];
+    DCHECK_LE(character, 0xFF);
+    uint8_t byte = static_cast<uint8_t>(character);
+    uint32_t next = 0;
+    for (const auto& child : trie_[node].children) {
+      if (child.first == byte) {
+        next = child.second;
+        break;
+      }
+    }
+    if (!next) {
+      next = trie_.size();
+      trie_[node].children.push_back(std::make_pair(byte, next));
+      trie_.Grow(trie_.size() + 1);
+    }
+    node = next;
+  }
+  trie_[node].outputs.push_back(id);
+}
+
+MultiPatternMatcher MultiPatternMatcher::Builder::Build() {
+  MultiPatternMatcher matcher;
+  if (trie_.size() == 1)
+    return matcher;
+
+  auto find_child = [this](uint32_t node, uint8_t byte) -> uint32_t {
+    for (const auto& child : trie_[node].children) {
+      if (child.first == byte)
+        return child.second;
+    }
+    return 0;
+  };
+
+  // Breadth-first traversal, so that the failure target of a node (which is
+  // always shallower) is complete by the time the node is visited.
+  Vector<uint32_t> failure(trie_.size(), 0u);
+  Deque<uint32_t> queue;
+  for (const auto& child : trie_[0].children)
+    queue.push_back(child.second);
+  while (!queue.IsEmpty()) {
+    uint32_t node = queue.TakeFirst();
+    trie_[node].outputs.AppendVector(trie_[failure[node]].outputs);
+    for (const auto& child : trie_[node].children) {
+      uint32_t fallback = failure[node];
+      while (true) {
+        uint32_t target = find_child(fallback, child.first);
+        if (target) {
+          failure[child.second] = target;
+          break;
+        }
+        if (!fallback) {
+          failure[child.second] = 0;
+          break;
+        }
+        fallback = failure[fallback];
+      }
+      queue.push_back(child.second);
+    }
+  }
+
+  matcher.nodes_.ReserveInitialCapacity(trie_.size());
+  matcher.edge_characters_.ReserveInitialCapacity(trie_.size() - 1);
+  matcher.edge_targets_.ReserveInitialCapacity(trie_.size() - 1);
+  for (uint32_t i = 0; i < trie_.size(); ++i) {
+    TrieNode& trie_node = trie_[i];
+    std::sort(trie_node.children.begin(), trie_node.children.end());
+    Node node;
+    node.first_edge = matcher.edge_characters_.size();
+    node.edge_count = trie_node.children.size();
+    node.failure = failure[i];
+    node.first_output = matcher.outputs_.size();
+    node.output_count = trie_node.outputs.size();
+    for (const auto& child : trie_node.children) {
+      matcher.edge_characters_.push_back(child.first);
+      matcher.edge_targets_.push_back(child.second);
+    }
+    matcher.outputs_.AppendVector(trie_node.outputs);
+    matcher.nodes_.push_back(node);
+  }
+  matcher.root_transitions_.Fill(0u, kRootTransitionCount);
+  for (const auto& child : trie_[0].children)
+    matcher.root_transitions_[child.first] = child.second;
+  matcher.tables_ = {matcher.nodes_, matcher.edge_characters_,
+                     matcher.edge_targets_, matcher.outputs_,
+                     matcher.root_transitions_};
+
+  trie_.clear();
+  trie_.Grow(1);
+  return matcher;
+}
+
+// static
+absl::optional<MultiPatternMatcher> MultiPatternMatcher::FromTables(
+    const Tables& tables,
+    uint32_t pattern_count) {
+  const base::span<const Node> nodes = tables.nodes;
+  MultiPatternMatcher matcher;
+  if (nodes.empty()) {
+    if (!tables.edge_characters.empty() || !tables.edge_targets.empty() ||
+        !tables.outputs.empty() || !tables.root_transitions.empty()) {
+      return absl::nullopt;
+    }
+    return matcher;
+  }
+  if (tables.root_transitions.size() != kRootTransitionCount ||
+      tables.edge_characters.size() != tables.edge_targets.size() ||
+      tables.edge_targets.size() != nodes.size() - 1) {
+    return absl::nullopt;
+  }
+
+  // The edges must form a tree rooted at node 0, and every failure link must
+  // lead to a shallower node, so that Transition() terminates.
+  Vector<uint32_t> depth(static_cast<wtf_size_t>(nodes.size()), 0u);
+  Vector<bool> reached(static_cast<wtf_size_t>(nodes.size()), false);
+  Deque<uint32_t> queue;
+  queue.push_back(0);
+  reached[0] = true;
+  while (!queue.IsEmpty()) {
+    const uint32_t index = queue.TakeFirst();
+    const Node& node = nodes[index];
+    if (node.first_edge > tables.edge_targets.size() ||
+        node.edge_count > tables.edge_targets.size() - node.first_edge ||
+        node.first_output > tables.outputs.size() ||
+        node.output_count > tables.outputs.size() - node.first_output) {
+      return absl::nullopt;
+    }
+    for (uint32_t i = 0; i < node.edge_count; ++i) {
+      const uint32_t edge = node.first_edge + i;
+      const uint32_t target = tables.edge_targets[edge];
+      if (target >= nodes.size() || reached[target])
+        return absl::nullopt;
+      if (i && tables.edge_characters[edge - 1] >= tables.edge_characters[edge])
+        return absl::nullopt;
+      reached[target] = true;
+      depth[target] = depth[index] + 1;
+      queue.push_back(target);
+    }
+  }
+  for (uint32_t i = 0; i < nodes.size(); ++i) {
+    if (!reached[i] || nodes[i].failure >= nodes.size())
+      return absl::nullopt;
+    if (i && depth[nodes[i].failure] >= depth[i])
+      return absl::nullopt;
+  }
+  for (uint32_t target : tables.root_transitions) {
+    if (target >= nodes.size() || (target && depth[target] != 1))
+      return absl::nullopt;
+  }
+  for (uint32_t id : tables.outputs) {
+    if (id >= pattern_count)
+      return absl::nullopt;
+  }
+
+  matcher.tables_ = tables;
+  return matcher;
+}
+
+MultiPatternMatcher::MultiPatternMatcher() = default;
+MultiPatternMatcher::MultiPatternMatcher(MultiPatternMatcher&&) = default;
+MultiPatternMatcher& MultiPatternMatcher::operator=(MultiPatternMatcher&&) =
+    default;
+MultiPatternMatcher::~MultiPatternMatcher() = default;
+
+uint32_t MultiPatternMatcher::Transition(uint32_t state,
+                                         uint8_t character) const {
+  while (state) {
+    const Node& node = tables_.nodes[state];
+    const uint8_t* begin = tables_.edge_characters.data() + node.first_edge;
+    const uint8_t* end = begin + node.edge_count;
+    const uint8_t* edge = std::lower_bound(begin, end, character);
+    if (edge != end && *edge == character)
+      return tables_.edge_targets[edge - tables_.edge_characters.data()];
+    state = node.failure;
+  }
+  return tables_.root_transitions[character];
+}
+
+template <typename CharType>
+void MultiPatternMatcher::FindAllInternal(const CharType* characters,
+                                          wtf_size_t length,
+                                          PatternIdList& matches) const {
+  uint32_t state = 0;
+  for (wtf_size_t i = 0; i < length; ++i) {
+    CharType character = characters[i];
+    if (sizeof(CharType) > 1 && character > 0xFF) {
+      // Patterns are ASCII, so nothing can match across this character.
+      state = 0;
+      continue;
+    }
+    state = Transition(state, static_cast<uint8_t>(character));
+    const Node& node = tables_.nodes[state];
+    for (uint32_t j = 0; j < node.output_count; ++j)
+      matches.push_back(tables_.outputs[node.first_output + j]);
+  }
+}
+
+void MultiPatternMatcher::FindAll(const StringView& text,
+                                  PatternIdList& matches) const {
+  if (IsEmpty() || text.IsEmpty())
+    return;
+  if (text.Is8Bit())
+    FindAllInternal(text.Characters8(), text.length(), matches);
+  else
+    FindAllInternal(text.Characters16(), text.length(), matches);
+}
+
+}  // namespace blink
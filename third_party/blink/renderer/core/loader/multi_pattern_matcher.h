@@ -0,0 +1,123 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_MULTI_PATTERN_MATCHER_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_MULTI_PATTERN_MATCHER_H_
+
+#include <stdint.h>
+
+#include "base/containers/span.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_view.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+// Ids of the patterns found by MultiPatternMatcher::FindAll(). The inline
+// capacity covers the number of hits a typical URL component produces, so that
+// matching does not allocate.
+using PatternIdList = Vector<uint32_t, 32>;
+
+// An Aho-Corasick automaton that finds every occurrence of a fixed set of
+// byte patterns in a single left-to-right pass over the text, independent of
+// the number of patterns. Matching is case-sensitive, like String::Contains().
+//
+// The automaton is stored in flat arrays of plain integers so that a built
+// instance is immutable and can be shared across threads. The arrays are
+// either owned by the matcher or, for a matcher created by FromTables(), live
+// in memory owned by the caller, such as a memory-mapped block list.
+class CORE_EXPORT MultiPatternMatcher {
+  USING_FAST_MALLOC(MultiPatternMatcher);
+
+ public:
+  struct Node {
+    uint32_t first_edge;
+    uint32_t edge_count;
+    uint32_t failure;
+    uint32_t first_output;
+    uint32_t output_count;
+  };
+
+  // Node 0 is the root. Outgoing edges of a node are stored contiguously in
+  // |edge_characters| / |edge_targets|, sorted by character. |outputs| holds
+  // the pattern ids ending at a node, including those reachable through
+  // failure links, so that reporting a match never walks the failure chain.
+  // |root_transitions| is a dense transition table for the root, which almost
+  // every character of a URL passes through. All arrays are empty for a
+  // matcher without patterns.
+  struct Tables {
+    base::span<const Node> nodes;
+    base::span<const uint8_t> edge_characters;
+    base::span<const uint32_t> edge_targets;
+    base::span<const uint32_t> outputs;
+    base::span<const uint32_t> root_transitions;
+  };
+
+  class CORE_EXPORT Builder {
+    STACK_ALLOCATED();
+
+   public:
+    Builder();
+    ~Builder();
+
+    // Adds |pattern| to the set; FindAll() reports |id| for each occurrence.
+    // Patterns are expected to be ASCII. Empty patterns are ignored.
+    void AddPattern(const StringView& pattern, uint32_t id);
+
+    MultiPatternMatcher Build();
+
+   private:
+    struct TrieNode {
+      Vector<std::pair<uint8_t, uint32_t>> children;
+      Vector<uint32_t> outputs;
+    };
+
+    Vector<TrieNode> trie_;
+  };
+
+  static constexpr wtf_size_t kRootTransitionCount = 256;
+
+  // Returns a matcher using |tables| without copying them, or nullopt if they
+  // do not form a valid automaton whose pattern ids are below
+  // |pattern_count|. The tables must outlive the matcher.
+  static absl::optional<MultiPatternMatcher> FromTables(const Tables& tables,
+                                                        uint32_t pattern_count);
+
+  MultiPatternMatcher();
+  MultiPatternMatcher(MultiPatternMatcher&&);
+  MultiPatternMatcher& operator=(MultiPatternMatcher&&);
+  ~MultiPatternMatcher();
+
+  // Appends to |matches| the id of each pattern occurring in |text|. An id is
+  // appended once per occurrence, so callers interested in the set of patterns
+  // should de-duplicate.
+  void FindAll(const StringView& text, PatternIdList& matches) const;
+
+  bool IsEmpty() const { return tables_.nodes.empty(); }
+
+  const Tables& tables() const { return tables_; }
+
+ private:
+  template <typename CharType>
+  void FindAllInternal(const CharType* characters,
+                       wtf_size_t length,
+                       PatternIdList& matches) const;
+  uint32_t Transition(uint32_t state, uint8_t character) const;
+
+  // Points either into the vectors below or into memory owned by the caller.
+  Tables tables_;
+
+  // Backing storage of a matcher built by Builder.
+  Vector<Node> nodes_;
+  Vector<uint8_t> edge_characters_;
+  Vector<uint32_t> edge_targets_;
+  Vector<uint32_t> outputs_;
+  Vector<uint32_t> root_transitions_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_MULTI_PATTERN_MATCHER_H_
@@ -0,0 +1,115 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/multi_pattern_matcher.h"
+
+#include <algorithm>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+
+namespace blink {
+
+namespace {
+
+Vector<uint32_t> FindAll(const MultiPatternMatcher& matcher,
+                         const String& text) {
+  PatternIdList matches;
+  matcher.FindAll(text, matches);
+  Vector<uint32_t> result;
+  result.AppendVector(matches);
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+}  // namespace
+
+TEST(MultiPatternMatcherTest, Empty) {
+  MultiPatternMatcher::Builder builder;
+  MultiPatternMatcher matcher = builder.Build();
+  EXPECT_TRUE(matcher.IsEmpty());
+  EXPECT_TRUE(FindAll(matcher, "anything").IsEmpty());
+}
+
+TEST(MultiPatternMatcherTest, FindsEveryOccurrence) {
+  MultiPatternMatcher::Builder builder;
+  builder.AddPattern("he", 0);
+  builder.AddPattern("she", 1);
+  builder.AddPattern("his", 2);
+  builder.AddPattern("hers", 3);
+  MultiPatternMatcher matcher = builder.Build();
+
+  EXPECT_EQ(Vector<uint32_t>({0, 1, 3}), FindAll(matcher, "ushers"));
+  EXPECT_EQ(Vector<uint32_t>({2}), FindAll(matcher, "this"));
+  EXPECT_EQ(Vector<uint32_t>({0, 0}), FindAll(matcher, "hehe"));
+  EXPECT_TRUE(FindAll(matcher, "hxe").IsEmpty());
+  EXPECT_TRUE(FindAll(matcher, String()).IsEmpty());
+}
+
+TEST(MultiPatternMatcherTest, OverlappingPatterns) {
+  MultiPatternMatcher::Builder builder;
+  builder.AddPattern("ads.js", 0);
+  builder.AddPattern("s.js", 1);
+  builder.AddPattern("/ads", 2);
+  MultiPatternMatcher matcher = builder.Build();
+
+  EXPECT_EQ(Vector<uint32_t>({0, 1, 2}), FindAll(matcher, "/js/ads.js"));
+  EXPECT_EQ(Vector<uint32_t>({1}), FindAll(matcher, "/stats.js"));
+}
+
+TEST(MultiPatternMatcherTest, CaseSensitive) {
+  MultiPatternMatcher::Builder builder;
+  builder.AddPattern("adServe", 0);
+  MultiPatternMatcher matcher = builder.Build();
+
+  EXPECT_EQ(Vector<uint32_t>({0}), FindAll(matcher, "/adServe/banners"));
+  EXPECT_TRUE(FindAll(matcher, "/adserve/banners").IsEmpty());
+}
+
+TEST(MultiPatternMatcherTest, SixteenBitText) {
+  MultiPatternMatcher::Builder builder;
+  builder.AddPattern("tracker", 0);
+  MultiPatternMatcher matcher = builder.Build();
+
+  // U+2603 forces a 16-bit string and must break a partial match.
+  String text = String::FromUTF8(
+      "\xE2\x98\x83tracker\xE2\x98\x83trac\xE2\x98\x83ker");
+  ASSERT_FALSE(text.Is8Bit());
+  EXPECT_EQ(Vector<uint32_t>({0}), FindAll(matcher, text));
+}
+
+TEST(MultiPatternMatcherTest, FromTables) {
+  MultiPatternMatcher::Builder builder;
+  builder.AddPattern("ads", 0);
+  builder.AddPattern("dsp", 1);
+  MultiPatternMatcher built = builder.Build();
+
+  absl::optional<MultiPatternMatcher> matcher =
+      MultiPatternMatcher::FromTables(built.tables(), 2);
+  ASSERT_TRUE(matcher);
+  EXPECT_EQ(Vector<uint32_t>({0, 1}), FindAll(*matcher, "/adsp/"));
+
+  // Pattern ids out of range.
+  EXPECT_FALSE(MultiPatternMatcher::FromTables(built.tables(), 1));
+}
+
+TEST(MultiPatternMatcherTest, FromTablesRejectsFailureCycle) {
+  MultiPatternMatcher::Builder builder;
+  builder.AddPattern("ab", 0);
+  MultiPatternMatcher built = builder.Build();
+  const MultiPatternMatcher::Tables& tables = built.tables();
+  ASSERT_EQ(3u, tables.nodes.size());
+
+  // Point the failure link of "a" at "ab", which would make Transition() loop.
+  Vector<MultiPatternMatcher::Node> nodes;
+  nodes.Append(tables.nodes.data(),
+               static_cast<wtf_size_t>(tables.nodes.size()));
+  nodes[1].failure = 2;
+  nodes[2].failure = 1;
+  MultiPatternMatcher::Tables corrupt = tables;
+  corrupt.nodes = nodes;
+  EXPECT_FALSE(MultiPatternMatcher::FromTables(corrupt, 1));
+}
+
+}  // namespace blink
@@ -43,6 +43,7 @@
 #include "third_party/blink/renderer/core/script/modulator.h"
 #include "third_party/blink/renderer/core/script/script_loader.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
 #include "third_party/blink/renderer/platform/instrumentation/use_counter.h"
 #include "third_party/blink/renderer/platform/loader/fetch/fetch_initiator_type_names.h"
 #include "third_party/blink/renderer/platform/loader/fetch/raw_resource.h"
@@ -51,6 +52,8 @@
 #include "third_party/blink/renderer/platform/loader/link_header.h"
 #include "third_party/blink/renderer/platform/loader/subresource_integrity.h"
 #include "third_party/blink/renderer/platform/network/mime/mime_type_registry.h"
+#include "third_party/blink/renderer/platform/network/network_state_notifier.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -147,6 +150,29 @@ bool IsValidButUnsupportedAsAttribute(const String& as) {
          as == "video" || as == "worker" || as == "xslt";
 }
 
+// Prefetches are for later navigations, so on a slow network they wait for
+// the resources that block the first paint of this document.
+bool ShouldDeferPrefetch(Document& document) {
+  if (!RuntimeEnabledFeatures::DeferLinkPrefetchOnSlowNetworksEnabled())
+    return false;
+  RenderBlockingResourceManager* manager =
+      document.GetRenderBlockingResourceManager();
+  if (!manager || !manager->HasRenderBlockingResources())
+    return false;
+  WebEffectiveConnectionType connection_type =
+      GetNetworkStateNotifier().EffectiveType();
+  return WebEffectiveConnectionType::kTypeOffline <= connection_type &&
+         connection_type <= WebEffectiveConnectionType::kType3G;
+}
+
+void StartDeferredPrefetch(const LinkLoadParameters& params,
+                           Document* document,
+                           PendingLinkPreload* pending_preload) {
+  if (!document)
+    return;
+  PreloadHelper::PrefetchIfNeeded(params, *document, pending_preload);
+}
+
 }  // namespace
 
 void PreloadHelper::DnsPrefetchIfNeeded(
@@ -573,6 +599,12 @@ void PreloadHelper::PrefetchIfNeeded(const LinkLoadParameters& params,
   if (!params.rel.IsLinkPrefetch() || !params.href.IsValid() ||
       !document.GetFrame())
     return;
+  if (ShouldDeferPrefetch(document)) {
+    document.GetRenderBlockingResourceManager()->DeferLowPriorityFetch(
+        WTF::Bind(&StartDeferredPrefetch, params, WrapWeakPersistent(&document),
+                  WrapWeakPersistent(pending_preload)));
+    return;
+  }
   UseCounter::Count(document, WebFeature::kLinkRelPrefetch);
 
   ResourceRequest resource_request(params.href);
@@ -4,6 +4,7 @@
 
 #include "third_party/blink/renderer/core/loader/render_blocking_resource_manager.h"
 
+#include "base/metrics/histogram_macros.h"
 #include "third_party/blink/renderer/core/css/font_face.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/html/html_document.h"
@@ -95,7 +96,7 @@ void RenderBlockingResourceManager::RemovePendingPreload(
   if (iter == pending_preloads_.end())
     return;
   pending_preloads_.erase(iter);
-  document_->RenderBlockingResourceUnblocked();
+  ResourceUnblocked();
 }
 
 void RenderBlockingResourceManager::RemoveImperativeFontLoading() {
@@ -103,7 +104,7 @@ void RenderBlockingResourceManager::RemoveImperativeFontLoading() {
     return;
   DCHECK(imperative_font_loading_count_);
   --imperative_font_loading_count_;
-  document_->RenderBlockingResourceUnblocked();
+  ResourceUnblocked();
 }
 
 void RenderBlockingResourceManager::EnsureStartFontPreloadTimer() {
@@ -120,7 +121,37 @@ void RenderBlockingResourceManager::FontPreloadingTimerFired(TimerBase*) {
   }
   pending_preloads_.RemoveAll(short_blocking_font_preloads);
   imperative_font_loading_count_ = 0;
+  ResourceUnblocked();
+}
+
+void RenderBlockingResourceManager::DeferLowPriorityFetch(
+    base::OnceClosure fetch) {
+  DCHECK(HasRenderBlockingResources());
+  if (deferred_fetches_.IsEmpty())
+    first_fetch_deferred_time_ = base::TimeTicks::Now();
+  deferred_fetches_.push_back(std::move(fetch));
+}
+
+void RenderBlockingResourceManager::DropDeferredFetches() {
+  if (deferred_fetches_.IsEmpty())
+    return;
+  UMA_HISTOGRAM_COUNTS_100("Blink.RenderBlocking.DroppedDeferredFetches",
+                           deferred_fetches_.size());
+  deferred_fetches_.clear();
+}
+
+void RenderBlockingResourceManager::ResourceUnblocked() {
   document_->RenderBlockingResourceUnblocked();
+  if (deferred_fetches_.IsEmpty() || HasRenderBlockingResources())
+    return;
+  UMA_HISTOGRAM_COUNTS_100("Blink.RenderBlocking.DeferredFetches",
+                           deferred_fetches_.size());
+  UMA_HISTOGRAM_TIMES("Blink.RenderBlocking.FetchDeferralTime",
+                      base::TimeTicks::Now() - first_fetch_deferred_time_);
+  Vector<base::OnceClosure> fetches;
+  fetches.swap(deferred_fetches_);
+  for (auto& fetch : fetches)
+    std::move(fetch).Run();
 }
 
 void RenderBlockingResourceManager::SetFontPreloadTimeoutForTest(
@@ -156,7 +187,7 @@ bool RenderBlockingResourceManager::RemovePendingStylesheet(
   if (iter == pending_stylesheet_owner_nodes_.end())
     return false;
   pending_stylesheet_owner_nodes_.erase(iter);
-  document_->RenderBlockingResourceUnblocked();
+  ResourceUnblocked();
   return true;
 }
 
@@ -173,7 +204,7 @@ void RenderBlockingResourceManager::RemovePendingScript(
   if (iter == pending_scripts_.end())
     return;
   pending_scripts_.erase(iter);
-  document_->RenderBlockingResourceUnblocked();
+  ResourceUnblocked();
 }
 
 void RenderBlockingResourceManager::Trace(Visitor* visitor) const {
@@ -5,12 +5,14 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_RENDER_BLOCKING_RESOURCE_MANAGER_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_RENDER_BLOCKING_RESOURCE_MANAGER_H_
 
+#include "base/callback.h"
 #include "base/time/time.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_set.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 #include "third_party/blink/renderer/platform/timer.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace blink {
 
@@ -63,6 +65,14 @@ class CORE_EXPORT RenderBlockingResourceManager final
   void EnsureStartFontPreloadTimer();
   void FontPreloadingTimerFired(TimerBase*);
 
+  // Holds a low-priority fetch, such as a <link rel=prefetch> on a slow
+  // network, until no render-blocking resources are left, so that it doesn't
+  // compete with them for bandwidth. Must only be called while there are
+  // render-blocking resources.
+  void DeferLowPriorityFetch(base::OnceClosure fetch);
+  // Gives up the deferred fetches. Called when the document shuts down.
+  void DropDeferredFetches();
+
   void Trace(Visitor* visitor) const;
 
  private:
@@ -72,6 +82,13 @@ class CORE_EXPORT RenderBlockingResourceManager final
   void SetFontPreloadTimeoutForTest(base::TimeDelta timeout);
   void DisableFontPreloadTimeoutForTest();
   bool FontPreloadTimerIsActiveForTest() const;
+  wtf_size_t DeferredFetchCountForTest() const {
+    return deferred_fetches_.size();
+  }
+
+  // Notifies the document, and starts the deferred fetches once nothing
+  // blocks rendering any more.
+  void ResourceUnblocked();
 
   Member<Document> document_;
 
@@ -95,6 +112,9 @@ class CORE_EXPORT RenderBlockingResourceManager final
   HeapTaskRunnerTimer<RenderBlockingResourceManager> font_preload_timer_;
   base::TimeDelta font_preload_timeout_;
   bool font_preload_timer_has_fired_ = false;
+
+  Vector<base::OnceClosure> deferred_fetches_;
+  base::TimeTicks first_fetch_deferred_time_;
 };
 
 }  // namespace blink
@@ -13,6 +13,8 @@
 #include "third_party/blink/renderer/core/style/computed_style.h"
 #include "third_party/blink/renderer/core/testing/sim/sim_request.h"
 #include "third_party/blink/renderer/core/testing/sim/sim_test.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
+#include "third_party/blink/renderer/platform/network/network_state_notifier.h"
 #include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
 
 namespace blink {
@@ -42,6 +44,9 @@ class RenderBlockingResourceManagerTest : public SimTest {
   bool FontPreloadTimerIsActive() {
     return GetRenderBlockingResourceManager().FontPreloadTimerIsActiveForTest();
   }
+  wtf_size_t DeferredFetchCount() {
+    return GetRenderBlockingResourceManager().DeferredFetchCountForTest();
+  }
 
   Element* GetTarget() { return GetDocument().getElementById("target"); }
 
@@ -630,4 +635,40 @@ TEST_F(RenderBlockingResourceManagerTest, ParserBlockingScriptBeforeFont) {
   font_resource.Complete();
 }
 
+TEST_F(RenderBlockingResourceManagerTest, PrefetchDeferredOnSlowNetwork) {
+  GetNetworkStateNotifier().SetNetworkConnectionInfoOverride(
+      true, WebConnectionType::kWebConnectionTypeCellular2G,
+      WebEffectiveConnectionType::kType2G, 1 /* http_rtt_msec */,
+      0.05 /* max_bandwidth_mbps */);
+
+  SimRequest main_resource("https://example.com", "text/html");
+  SimSubresourceRequest style_resource("https://example.com/sheet.css",
+                                       "text/css");
+  SimSubresourceRequest prefetch_resource("https://example.com/next.html",
+                                          "text/html");
+  const KURL prefetch_url("https://example.com/next.html");
+
+  LoadURL("https://example.com");
+  main_resource.Write(R"HTML(
+    <!doctype html>
+    <link rel="stylesheet" href="sheet.css">
+    <link rel="prefetch" href="next.html">
+  )HTML");
+
+  // The prefetch waits for the render-blocking stylesheet.
+  EXPECT_TRUE(HasRenderBlockingResources());
+  EXPECT_EQ(1u, DeferredFetchCount());
+  EXPECT_FALSE(GetDocument().Fetcher()->CachedResource(prefetch_url));
+
+  style_resource.Complete("body { width: 100px; }");
+
+  EXPECT_FALSE(HasRenderBlockingResources());
+  EXPECT_EQ(0u, DeferredFetchCount());
+  EXPECT_TRUE(GetDocument().Fetcher()->CachedResource(prefetch_url));
+
+  prefetch_resource.Complete();
+  main_resource.Complete("<body>some text</body>");
+  GetNetworkStateNotifier().ClearOverride();
+}
+
 }  // namespace blink
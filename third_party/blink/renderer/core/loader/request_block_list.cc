@@ -0,0 +1,805 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/request_blocker.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint32_t kScriptOrImage =
+    ResourceTypeBit(ResourceType::kScript) |
+    ResourceTypeBit(ResourceType::kImage);
+constexpr uint8_t kRequireHostPath = kRequireHost | kRequirePath;
+constexpr uint8_t kRequireHostPathQuery =
+    kRequireHost | kRequirePath | kRequireQuery;
+
+// kEarly
+
+constexpr RequestBlockClause kEarlyTrackerClauses[] = {
+    {UrlContains("sentry.io")},
+};
+
+constexpr RequestBlockClause kEarlyAdsClauses[] = {
+    {UrlContains("serve.popads.net/c")},
+    {PathContains("watch.xml")},
+    {QueryContains("&vastref=")},
+    {HostContains("flashx"), PathLengthIs(45), PathContains(".js")},
+};
+
+constexpr RequestBlockClause kEarlyAntiAdblockClauses[] = {
+    {PathContains("ds2/js/1.min.js")},
+};
+
+constexpr RequestBlockClause kEarlyHostClauses[] = {
+    {HostContains("dev-nano.com")},
+};
+
+// Scripts sites probe for to detect ad blockers.
+constexpr RequestBlockClause kBaitScriptClauses[] = {
+    {PathContains("cast_sender.js")}, {PathContains(".ico")},
+    {PathContains("adblock.js")},     {PathContains("ads.js")},
+    {PathContains("trustguard.js")},
+};
+
+constexpr RequestBlockClause kVideoAdsAllowClauses[] = {
+    {PathContains("videojs.ads.")},
+};
+
+constexpr RequestBlockClause kAllowedHostClauses[] = {
+    {HostIs("zoover.adnetasia.com")},
+    // {HostIs("zoover.adtrackers.net")},
+    // {HostIs("ox-d.adtrackers.net")},
+    // {HostIs("serve.adtrackers.net")},
+    // {HostIs("crunchyroll.adtrackers.net")},
+    {HostContains(".bannertrack.net")},
+    {HostContains(".adtrackers.net")},
+    {HostContains(".adclixx.net")},
+    {HostContains(".adnetasia.com")},
+    {HostContains(".foxnetworks.com")},
+    {HostContains(".clickability.com")},
+    {HostContains("torrentz.")},
+    {HostIs("partnerads.ysm.yahoo.com")},
+    {HostIs("a.livesportmedia.eu")},
+    {HostIs("promote.pair.com")},
+    {HostIs("ad.mail.ru")},
+    {HostIs("adn.ebay.com")},
+    {HostIs("advertising.aol.com")},
+    {HostIs("www.gstatic.com")},
+    {HostIs("juicyads.com")},
+    {HostIs("ecosia.org")},
+    {HostIs("www.ecosia.org")},
+    {HostIs("cdn.ecosia.org")},
+    {PathIs("/favicon.ico")},
+};
+
+constexpr RequestBlockClause kAllowedServiceHostClauses[] = {
+    {HostContains("imasdk.googleapis.com")},
+    {HostContains("translate.googleapis.com")},
+    {HostContains(".google-analytics.com")},
+};
+
+constexpr RequestBlockClause kAllowedImageHostClauses[] = {
+    {HostContains(".cloudfront.net")},
+    {HostContains("push")},
+};
+
+// Anti-Anti-Adblock
+constexpr RequestBlockClause kBaitImageClauses[] = {
+    {HostContains("adn.ebay.com")},
+    {HostContains("ad.mail.ru")},
+    {HostContains("juicyads.com")},
+    {HostContains("ad.foxnetworks.com")},
+    {HostContains("partnerads.ysm.yahoo.com")},
+    {HostContains("a.livesportmedia.eu")},
+    {HostContains("agoda.net")},
+    {HostContains("advertising.aol.com")},
+    {HostContains("cas.clickability.com")},
+    {HostContains("promote.pair.com")},
+    {HostContains("ads.yahoo.com")},
+    {HostContains("ads.zynga.com")},
+    {HostContains("adsatt.abcnews.starwave.com")},
+    {HostContains("adsatt.espn.starwave.com")},
+    {HostContains("as.inbox.com")},
+};
+
+// kPageExemption
+
+constexpr RequestBlockClause kExemptPageClauses[] = {
+    {HostContains("google.")},
+    {HostContains("kiwibrowser.org")},
+    {HostContains("find.kiwi")},
+    {HostContains("ecosia.org")},
+    {HostContains("kiwisearchservices.com")},
+    {HostContains("kiwisearchservices.net")},
+    {HostContains("bing.com")},
+    {HostContains("bing.net")},
+    {HostContains("msn.com")},
+    {HostContains("lastpass.com")},
+    {HostContains("qwant.com")},
+    {HostContains("grammarly.com")},
+    {HostContains("yandex.ru")},
+    {HostContains(".amazon.")},
+    {HostContains("yandex.com")},
+    {HostContains("flashx")},
+    {HostContains("startpage.com")},
+    {HostContains(".ebay.")},
+    {HostContains("search.yahoo.")},
+    {HostContains("geo.yahoo.")},
+    {HostContains("doubleclick.net")},
+};
+
+// kServiceAllowlist
+
+constexpr RequestBlockClause kServiceClauses[] = {
+    {HostContains("google.")},
+    {HostContains("kiwibrowser.org")},
+    {HostContains("find.kiwi")},
+    {HostContains("ecosia.org")},
+    {HostContains("bing.com")},
+    {HostContains("bing.net")},
+    {HostContains("search.yahoo.")},
+    {HostContains("geo.yahoo.")},
+    {HostContains("msn.com")},
+    {HostContains("qwant.com")},
+    {HostContains("yandex.ru")},
+    {HostContains(".amazon.")},
+    {HostContains("yandex.com")},
+    {HostContains("lastpass.com")},
+    {HostContains("grammarly.com")},
+    {HostContains("flashx")},
+    {HostContains("startpage.com")},
+    {HostContains(".ebay.")},
+};
+
+// kTracker
+
+constexpr RequestBlockClause kTrackerClauses[] = {
+    {HostContains("eviltracker.net")},
+    {HostContains("trackersimulator.org")},
+    {HostContains("do-not-tracker.org")},
+    {HostContains("ad.aloodo.com")},
+    {HostContains("extremetracking.com")},
+    {HostContains("extreme-dm.com")},
+    {QueryContains("&vastref=")},
+    {PathContains("ads.xml")},
+};
+
+constexpr RequestBlockClause kConsentClauses[] = {
+    {HostContains("cookieinformation.com")},
+    {HostContains("cookie-script.com")},
+    {HostContains("cookieassistant.com")},
+    {HostContains("cookieconsent.com")},
+    {HostContains("cookieconsent.silktide.com")},
+    {HostContains("cookieq.com")},
+    {HostContains("cookiereports.com")},
+    {HostContains("consent.truste.com")},
+};
+
+// kAds
+
+constexpr RequestBlockClause kAdsClauses[] = {
+    {HostContains("addthis")},
+    {HostContains("chatango")},
+    {HostContains("sharethis")},
+    {HostContains("consensu.org")},
+    {HostContains("cookieinformation.com")},
+    {HostContains("consent.truste.com")},
+    {HostContains("consent")},
+    {HostContains("iubenda.com")},
+    {HostContains("r42tag.com")},
+    {HostContains("tm.tradetracker.net")},
+    {HostContains("cookieq.com")},
+    {HostContains("abtasty")},
+    {HostContains("scorecardresearch")},
+    {HostContains("cedexis")},
+    {HostContains("api.amplitude.com")},
+    {HostContains("krxd.net")},
+    {HostContains("acpm.fr")},
+    {HostContains(".plista.com")},
+    {HostContains(".hotjar.com")},
+    {HostContains("trustarc")},
+    {HostContains("cxense")},
+    {HostContains("chartbeat")},
+    {HostContains("quantserve")},
+    {HostContains("crwdcntrl")},
+    {HostContains("gemius")},
+    {HostContains("aticdn")},
+    {HostContains("xiti")},
+    {HostContains("ati-host")},
+    {HostContains("tiqcdn")},
+    {HostContains("floodprincipal.com")},
+    {HostContains("newrelic")},
+    {HostContains(".vntsm.com")},
+    {HostContains("ownpage")},
+    {HostContains("nuggad")},
+    {HostContains("exelate")},
+    {HostContains("goutee.top")},
+    {HostContains("digidip.net")},
+    {HostContains("tradelab.fr")},
+    {HostContains("tr.snapchat.com")},
+    {HostContains("exelator")},
+    {HostContains("minute.ly")},
+    {HostContains("ligatus")},
+    {HostContains("hubvisor")},
+    {HostContains("outbrain")},
+    {HostContains("taboola")},
+    {HostContains("mediavoice")},
+    {HostContains("criteo")},
+    {HostContains("demdex")},
+    {HostContains("viglink")},
+    // {HostContains("gigya.com")},
+    {HostContains("segment.com")},
+    {HostContains("tagcommander")},
+    {HostContains("edigitalsurvey")},
+    {HostContains("cookiematch")},
+    {HostContains("seedtag")},
+    {HostContains("estat.com")},
+    {HostContains("zebestof.com")},
+    {HostContains("kxcdn.com")},
+    {HostContains("ccmbg.com")},
+    {HostContains("push")},
+    {HostContains("exosrv.com")},
+    {HostContains("tubecorporate")},
+    {HostContains("evidon")},
+    {HostContains("optimizely.com")},
+    {HostContains("edigitalsurvey.com")},
+    {HostContains("condenastdigital.com")},
+    {HostContains("bounceexchange.com")},
+    {HostContains("zqtk.net")},
+    {HostContains("yuyue")},
+    {HostContains("ytdksb.com")},
+    {HostContains("demdex.net")},
+    {HostContains("adobedtm.com")},
+    {HostContains("tvsquared.com")},
+    {HostContains("metric")},
+    {HostContains("lijit")},
+    {HostContains("analytics")},
+    {HostContains("adsco.re")},
+    {HostContains("akstat")},
+    {HostContains("onthe.io")},
+    {HostContains("tns-counter.ru")},
+    {HostContains("onesignal")},
+    {HostContains("mgid")},
+    {HostContains("adblockanalytics")},
+    {HostContains("an.yandex.ru")},
+    {HostContains("browsiprod")},
+    {HostContains(".cloudfront.net"), PathLacks("jwplayer"),
+     PathLacks("app-min.js"), PathLacks("jquery")},
+    {PathContains("aabv121.php")},
+    {PathContains("apu.php")},
+    {PathContains("adlift")},
+    {PathContains("smartbanner")},
+    {PathContains("gampad/ads")},
+    {PathContains("gpt/pubads")},
+    {PathContains("notice.php")},
+    {PathContains("interstitial.php")},
+    {PathContains("1234.js")},
+    {PathContains("ama.js")},
+    {PathContains("/adServe/banners")},
+    {HostContains(".porn555.com"), PathContains("sw.js")},
+    {PathContains("afu.php")},
+    {PathContains("speed.php")},
+    {PathContains("nwm-dbh.min3.js")},
+    {PathContains("prebid")},
+    {PathContains("stats.php")},
+    {PathContains("zcredirect")},
+    {PathContains(".pop.js")},
+    {HostLengthIs(14), PathLengthIs(45), PathContains(".js")},
+    {UrlContains("&sw="), UrlContains("&sh="), UrlContains("&sah="),
+     UrlContains("&ww="), UrlContains("&wh="), UrlContains("&pl=")},
+    {UrlContains("&zone_id=")},
+    {UrlContains("/zone?pub=")},
+    {UrlContains(".php?OAID=")},
+    {UrlContains("/jump/next.php?r=")},
+    {UrlContains("improving.duckduckgo.com")},
+    {UrlContains("?key="), UrlContains("&uuid=")},
+    {UrlContains("&id="), UrlContains("&lm="), UrlContains("&ts="),
+     UrlContains("&dn=")},
+    {UrlContains("&id="), UrlContains("&dn="), UrlContains("&c="),
+     UrlContains("&r=")},
+};
+
+constexpr RequestBlockClause kNewsletterClauses[] = {
+    {UrlContains("sleeknotestaticcontent.sleeknote.com")},
+    {UrlContains("js.driftt.com/include/")},
+    {UrlContains("assets.ubembed.com/universalscript/")},
+    {UrlContains("lightboxcdn.com/vendor/")},
+    {UrlContains("mailocator.net/_/")},
+    {UrlContains("cdn1.pdmntn.com")},
+    {UrlContains("static.mailerlite.com/js")},
+    {UrlContains("pmdstatic.net/bundle.php")},
+    {UrlContains("front.optimonk.com/public/")},
+    {UrlContains("/wp-content/plugins/newsletter-leads")},
+    {UrlContains("downloads.mailchimp.com/js/signup-forms")},
+    {UrlContains("conduit.mailchimpapp.com/js/stores")},
+    {UrlContains("a.optmnstr.com/app/js/")},
+    {UrlContains("getsocial.io/client/")},
+    {UrlContains("static.ctctcdn.com/js/signup-form-widget")},
+    {UrlContains("cdn.justuno.com/mwgt")},
+    {UrlContains("a.mailmunch.co/app/")},
+    {UrlContains("/newsletterPopup.js")},
+    {UrlContains("/pmgnews/overlay/newsletter")},
+    {UrlContains("dotmailer-surveys.com/scripts/survey.js")},
+    {UrlContains("yieldify.com/yieldify/code.js")},
+    {UrlContains("widget.privy.com/assets/widget.js")},
+    {UrlContains("sumo.b-cdn.net")},
+    {UrlContains("chimpstatic.com/mcjs-connected/js/users")},
+    {UrlContains("assets.pcrl.co/js/")},
+    {UrlContains(
+        "/wp-content/plugins/email-subscribers/widget/es-widget-page.js")},
+    {UrlContains("youlead.pl/Scripts/Dynamic.js")},
+    {UrlContains("m8.mailplus.nl/genericservice")},
+    {UrlContains("restapi.mailplus.nl/integrationservice")},
+    {UrlContains("snrcdn.net/sdk/")},
+    {UrlContains("static.dynamicyield.com/scripts/")},
+    {UrlContains("static.newsletter2go.com/utils.js")},
+    {UrlContains("/widget/ecNewsletterPopup/")},
+    {UrlContains("a.optmstr.com/app/js/")},
+    {UrlContains("api.autopilothq.com/anywhere/")},
+    {UrlContains("c.salecycle.com/osr/config")},
+    {UrlContains("/wp-content/plugins/thrive-leads/")},
+    {UrlContains("/wp-content/plugins/bloom/")},
+    {UrlContains("js.hsleadflows.net/leadflows.js")},
+    {UrlContains("/clientlib-newsletter.js")},
+    {UrlContains("c.lytics.io/static/pathfora")},
+    {UrlContains("email-signup-form-popup.js")},
+    {UrlContains("netpeak.cloud/source/js")},
+    {UrlContains("bunting.com/call")},
+    {UrlContains("cdn.connectif.cloud/cl1/client-script/")},
+    {UrlContains("/essb-optin-booster.js")},
+    {UrlContains("f.convertkit.com")},
+    {UrlContains("assets.bounceexchange.com/assets/smart-tags")},
+    {UrlContains("api.morningcatch.net")},
+    {UrlContains("shopify.privy.com/widget.js")},
+    {UrlContains("static.klaviyo.com/onsite/js/vendors~signupForms")},
+    {UrlContains("load.sumo.com")},
+    {UrlContains("cdn.listrakbi.com/scripts/script.js")},
+    {UrlContains("/wp-content/plugins/dreamgrow-scroll-triggered-box/")},
+    {UrlContains("d3bo67muzbfgtl.cloudfront.net/edrone")},
+    {UrlContains("/newsletter_modals.min.")},
+    {OnDomain("m3medical.com"),
+     UrlContains("s.m3medical.com/popup/popup.production.js")},
+    {OnDomain("hessnatur.com"),
+     UrlContains("ajax-open-layer?layerID=/nlsublay")},
+    {OnDomain("vontobel.com"), UrlContains("NotificationDisclaimerControl.js")},
+    {OnDomain("wanderlust.co.uk"), UrlContains("list-builder.js")},
+    {OnDomain("webmd.com"), UrlContains("/amd_modules/newsletter-hover")},
+    {OnDomain("toysrus.pt"), UrlContains("/politica-privacidade/lightbox")},
+};
+
+constexpr RequestBlockClause kSurveyClauses[] = {
+    {UrlContains("nebula-cdn.kampyle.com")},
+    {UrlContains("turbo.qualaroo.com/c.js")},
+    {UrlContains("scripts.psyma.com/layer_question.php")},
+    {UrlContains("w.usabilla.com")},
+    {UrlContains("static.hotjar.com/c/hotjar")},
+    {UrlContains("scripts.psyma.com/html/layer/json_question.php")},
+    {UrlContains("visualwebsiteoptimizer.com/va_survey")},
+    {UrlContains("gateway.answerscloud.com")},
+    {UrlContains("st.getsitecontrol.com/main/runtime/")},
+    {UrlContains("survey.g.doubleclick.net/survey")},
+    {UrlContains("/opiniac.js")},
+    {UrlContains("ssl.ceneo.pl/shops/")},
+    {UrlContains("cloud.netquest.sk/scripts/widget")},
+    {UrlContains("storage.googleapis.com/outfox/ocs/surveys/")},
+    {UrlContains("kameleoon.eu/kameleoon.js")},
+    {UrlContains("invitation.opinionbar.com/wit/popups")},
+    {UrlContains("neads.delivery/opinion-seed-embed.js")},
+    {UrlContains("collect.mopinion.com/assets/surveys/")},
+    {UrlContains("/runtimejs/dist/survey/js/survey.js")},
+    {UrlContains("surveygizmobeacon.s3.amazonaws.com/beaconconfigs/")},
+    {UrlContains("cpx.smind.hr/Log/LogData")},
+    {UrlContains("widget.surveymonkey.com/collect")},
+    {UrlContains("cdn.feedbackify.com/f.js")},
+    {UrlContains("invitation.opinionbar.com/popups")},
+    {UrlContains("/bundles/Scripts/OpinionLab.js")},
+    {UrlContains("survey.nuggad.net/c/layer-html")},
+    {UrlContains("ips-invite.iperceptions.com/invitations")},
+    {UrlContains("/oo_engine.min.js")},
+    {UrlContains("userzoom.com/feedback")},
+    {UrlContains("invite.leanlab.co/invite/invite.js")},
+    {UrlContains("userreport.com/newsquest/launcher.js")},
+    {UrlContains("siteintercept.qualtrics.com")},
+    {OnDomain("lenovo.com"), UrlContains("/vendor/opinionlab/")},
+};
+
+constexpr RequestBlockClause kChatClauses[] = {
+    {UrlContains("widget.manychat.com")},
+    {UrlContains("vivocha.com/a/")},
+    {UrlContains("altocloud-sdk.com/ac.js")},
+    {UrlContains("cdn.datahub.sempro.ai")},
+    {UrlContains("whatshelp.io/widget-send-button")},
+    {UrlContains("smartsuppchat.com/loader.js")},
+    {UrlContains("chat.wmy.io/widget")},
+    {UrlContains("crdx-feedback.appspot.com")},
+    {UrlContains("widget.whisbi.com")},
+    {UrlContains("mylivechat.com/chatinline")},
+    {UrlContains("static.zdassets.com/web_widget/")},
+    {UrlContains("cdn-widget.callpage.io")},
+    {UrlContains("/wp-content/plugins/makleraccess/assets/js/chat.")},
+    {UrlContains("widget.replain.cc/dist/client.js")},
+    {UrlContains("image.providesupport.com")},
+    {UrlContains("tinka.t-mobile.at")},
+    {UrlContains("userlike-cdn-widgets.s3-eu-west-1.amazonaws.com")},
+    {UrlContains("static.helloumi.com/umiwebcha")},
+    {UrlContains("embed.tawk.to")},
+    {UrlContains("widget.uservoice.com")},
+    {UrlContains("static.olark.com/jsclient")},
+    {UrlContains("xfbml.customerchat.js")},
+    {UrlContains("v2.zopim.com")},
+    {UrlContains("widget.intercom.io/widget")},
+    {UrlContains("/lz/server.php")},
+    {UrlContains("cdn.livechatinc.com/tracking.js")},
+    {UrlContains("widgets.trustedshops.com")},
+    {UrlContains("comm100.com/chatserver")},
+    {UrlContains("salesiq.zoho.com/widget")},
+    {UrlContains("www.czater.pl/assets/modules/chat/js/chat.js")},
+    {UrlContains("node.unifiedfactory.com")},
+    {UrlContains("cdn.kustomerapp.com/cw")},
+    {UrlContains("f01.inbenta.com")},
+    {UrlContains("static.classistatic.de/oplab/oo-v")},
+    {UrlContains("lc.iadvize.com/js/dist/livechat.js")},
+    {UrlContains("chatboxes.doyoudreamup.com/Prod/")},
+    {UrlContains("chat.kundo.se/chat/")},
+    {UrlContains(".vo.msecnd.net/ius-")},
+    {UrlContains("robincontentdesktop.blob.core.windows.net/external/robin/")},
+    {UrlContains("code.jivosite.com")},
+    {UrlContains("widgets.mango-office.ru")},
+    {UrlContains("firebaseapp.com/cfc/chat.js")},
+    {UrlContains("static-ssl.kundo.se/embed.js")},
+    {UrlContains("lc.iadvize.com/iadvize.js")},
+    {UrlContains("s.acquire.io")},
+    {UrlContains("assets.livecall.io/assets/livecall-widget.js")},
+    {UrlContains("/chatlio/chatlio.js")},
+    {UrlContains("app.purechat.com/VisitorWidget")},
+    {UrlContains("widget.customerly.io/widget")},
+    {UrlContains("limetalk.com/js/widget.js")},
+    {UrlContains("code.snapengage.com/js")},
+    {UrlContains("chatbot.api.nn-group.com")},
+    {UrlContains("wchat.freshchat.com")},
+    {UrlContains("lpcdn.lpsnmedia.net/le_re/")},
+    {UrlContains("static.userback.io/widget")},
+    {UrlContains("track.freecallinc.com/freecall.js")},
+    {UrlContains("addthis.com/static/layers")},
+    {UrlContains("asset.gomoxie.solutions/concierge/synnex/client/")},
+    {UrlContains("gateway.foresee.com/code/")},
+    {UrlContains("tbcdnwidgetsprod.azureedge.net/widget/")},
+    {UrlContains("/onlinechat/js_chat/chat_functions.js")},
+    {UrlContains("/onlinechat/chat_live_interface.php")},
+    {UrlContains("app.five9.com/consoles/SocialWidget/")},
+    {UrlContains("dragoman.com/livechat/")},
+    {UrlContains("js.usemessages.com/conversations-embed.js")},
+    {UrlContains(".tidiochat.com")},
+    {UrlContains("cdn.chatio-static.com/widget/")},
+    {UrlContains("smilee.io/assets/javascripts/cobrowse.js")},
+    {UrlContains("/javascript/livechat.js")},
+    {UrlContains("vmss.boldchat.com/aid/")},
+    {UrlContains("cdn.elev.io/sdk/bootloader/v4/elevio-bootloader.js")},
+    {UrlContains("service.force.com/embeddedservice/")},
+    {UrlContains("my.salesforce.com/embeddedservice/")},
+    {UrlContains("sidecar.gitter.im/dist/")},
+    {UrlContains("client.crisp.chat")},
+    {UrlContains("snapengage.com/cdn/js/")},
+    {UrlContains("static.goqubit.com/smartserve")},
+    {UrlContains("/jquery.livehelp.js")},
+    {UrlContains("config.gorgias.io")},
+    {UrlContains("chatserver.comm100.com")},
+    {UrlContains("sb.monetate.net/img/")},
+    {UrlContains("realperson.de/system/scripts/loadchatmodul.js")},
+    {UrlContains("beacon-v2.helpscout.net")},
+    {UrlContains("wm-livechat-prod-dot-watermelonmessenger.appspot.com")},
+    {UrlContains("widget.destygo.com/destygo-webchat.js")},
+    {UrlContains("assets.freshservice.com/widget")},
+    {UrlContains("calendly.com/assets/external/widget.js")},
+    {UrlContains("/uisdk/botchat.js")},
+    {UrlContains("chat-widget.thulium.com/app/chat-loader.js")},
+    {UrlContains("assets.kayako.com/messenger")},
+    {UrlContains("static.landbot.io/landbot-widget")},
+    {UrlContains("projects.elitechnology.com/jsprojects/pggm/client")},
+    {UrlContains("humany.net/default/embed.js")},
+    {UrlContains("/js/common/tokywoky-")},
+    {UrlContains("widget.dixa.io/assets/scripts")},
+    {UrlContains("support.qualityunit.com/scripts/button.php")},
+    {UrlContains("/kapturesupport.nojquery.min.js")},
+    {UrlContains("/chat-widget/clientLibs.min.")},
+    {UrlContains("call.chatra.io/chatra.js")},
+    {UrlContains("api.asksid.ai/akzo-webchat")},
+    {UrlContains("/js/chatPanel.js")},
+    {UrlContains("videocall.te-ex.ru/js/richcall.widget.js")},
+    {UrlContains("chatbot.inbenta.com")},
+    {UrlContains("wm-livechat-2-prod-dot-watermelonmessenger.appspot.com")},
+    {UrlContains("static.triptease.io/client-integrations")},
+    {UrlContains("freshdesk.com/widget/freshwidget.js")},
+    {UrlContains("/livehelperchat-master/lhc_web/")},
+    {UrlContains("verbox.ru/support/support.js")},
+    {UrlContains("storage.googleapis.com/livezhat")},
+    {UrlContains("subiz.com/static/js/app.js")},
+    {UrlContains("cdn.rlets.com/capture_configs")},
+    {UrlContains("reachlocallivechat.com/scripts/dyns.js")},
+    {UrlContains("webchat.big-box.net/chat")},
+    {UrlContains("cdn.gubagoo.io/toolbars")},
+    {UrlContains("userreport.com/userreport.js")},
+    {UrlContains("widget.alphablues.com/widget/alphachat.js")},
+    {UrlContains("inbenta.com/assets/js/inbenta")},
+    {UrlContains("sdk.inbenta.io/chatbot")},
+    {UrlContains("liveagent.se/scripts/track.js")},
+    {UrlContains("/NetworkContacts.AskMeSEM.WebChat/")},
+    {UrlContains("googleapis.com/snapengage-eu/js")},
+    {UrlContains("messenger.ngageics.com")},
+    {UrlContains("justanswer.com/js/ja-gadget-virtual-assistant")},
+    {UrlContains("par.salesforceliveagent.com")},
+    {OnDomain("plaisio.gr"), UrlContains("scripts/pls.chat")},
+    {OnDomain("sainsburysbank.co.uk"), UrlContains("sa_emb/va.min.js")},
+    {OnDomain("vocabulix.com"), UrlContains("/contact-us.js")},
+    {OnDomain("ibm.com"), UrlContains("/cm-app/latest/cm-app.min.js")},
+    {OnDomain("ibm.com"), UrlContains("/common/digitaladvisor/cm-app/")},
+    {OnDomain("redmineup.com"), UrlContains("/helpdesk_widget/widget.js")},
+    {OnDomain("ter.sncf.com"), UrlContains("snap.snapcall.io")},
+    {OnDomain("website-bereinigung.de"),
+     UrlContains("chat.website-bereinigung.de/resource.php")},
+    {OnDomain("muziker.nl"),
+     UrlContains("support.muziker.com/scripts/track.js")},
+    {OnDomain("digistar.vn"), UrlContains("/crm/site_button")},
+    {OnDomain("analog.com"), UrlContains("custom-content-collection")},
+};
+
+constexpr RequestBlockClause kRatingClauses[] = {
+    {UrlContains("ssl.heureka.cz/direct/i/gjs.php")},
+    {UrlContains("opineo.pl/shop/slider.js")},
+    {UrlContains("https://static.arukereso.hu/widget/presenter.js")},
+    {UrlContains("cpx.smind.si/Log/")},
+    {UrlContains("widget.trustpilot.com")},
+    {UrlContains("dash.reviews.co.uk/widget/float.js")},
+    {UrlContains("dashboard.webwinkelkeur.nl/webshops/sidebar.js")},
+    {UrlContains("staticw2.yotpo.com")},
+    {UrlContains("cdn.trustami.com/widgetapi")},
+    {UrlContains("cdn.ywxi.net/js/")},
+    {UrlContains("monaviscompte.fr/widget")},
+    {UrlContains("nsg.symantec.com/Web/Seal/")},
+    {UrlContains("widget.reviews.co.uk/rich-snippet-reviews-widgets/dist.js")},
+    {UrlContains("static.pazaruvaj.com/widget")},
+    {UrlContains("avis-verifies.com/js/widget")},
+};
+
+constexpr RequestBlockClause kPushClauses[] = {
+    {UrlContains("cdn.p-n.io/pushly")},
+    {UrlContains("app3.emlgrid.com/static/sm.js")},
+    {UrlContains("webpush-desktop.chunk.js")},
+    {UrlContains("push4site.com/Static/Script/")},
+    {UrlContains("cdn.ghostmonitor.com")},
+    {UrlContains("notify.hindustantimes.com")},
+    {UrlContains("webpush.interia.pl")},
+    {UrlContains("cdn.izooto.com/scripts/")},
+    {UrlContains("js.pusher.com/")},
+    {UrlContains("push-ad.com/integration.php")},
+    {UrlContains("cdn.pushassist.com/account/assets/")},
+    {UrlContains(
+        "gadgets.ndtv.com/static/desktop/js/notification_popup-min.js")},
+    {UrlContains("pusherism.com")},
+    {UrlContains("pushnest.com")},
+    {UrlContains("getpushmonkey.com/sdk/config")},
+    {UrlContains("cdn.onesignal.com/sdks/OneSignalSDK.js")},
+    {UrlContains("pushpushgo.com/js")},
+    {UrlContains("cdn.sendpulse.com")},
+    {UrlContains("salesmanago.pl/static/sm.js")},
+    {UrlContains("cdn.pushcrew.com")},
+    {UrlContains("/streamlined-push-plugin.production.min.js")},
+    {UrlContains("app.push-ad.com")},
+    {UrlContains("/pushnotification/service-worker-script.js")},
+    {UrlContains("/sp-push-worker.js")},
+    {UrlContains("95p5qep4aq.com")},
+    {UrlContains("via.batch.com")},
+    {UrlContains("wonderpush.com/sdk/")},
+    {UrlContains("clientcdn.pushengage.com")},
+    {UrlContains("web-sdk.urbanairship.com/notify/")},
+    {UrlContains("api.sociaplus.com")},
+    {UrlContains("/plugins/tmx-push/")},
+    {UrlContains("/firebase-messaging.js")},
+    {UrlContains("pushno.com")},
+    {UrlContains("pushwhy.com")},
+    {UrlContains("pushame.com")},
+    {UrlContains("voirfilms.ws/sw.js")},
+    {UrlContains("siteswithcontent.com/js/push")},
+    {UrlContains("cdn.moengage.com/webpush")},
+    {UrlContains("brandflow.net/static/general/push-init-code.js")},
+    {UrlContains("static.cleverpush.com/channel/loader")},
+    {UrlContains("static.getback.ch/clients")},
+    {UrlContains("/PushNotifications.")},
+    {UrlContains("cdn.pushowl.com/sdks")},
+    {UrlContains("accengage.net/pushweb/")},
+    {UrlContains("cdn.foxpush.net/sdk/foxpush_SDK")},
+    {UrlContains("js.appboycdn.com/web-sdk/")},
+    {UrlContains("cdn.taboola.com/libtrc/tmg-network/loader.js")},
+    {UrlContains("/js/push_subscription.js")},
+    {UrlContains("pushwoosh.com/webpush")},
+    {UrlContains("push_service-worker.js")},
+    {UrlContains("0_ghpush_client.js")},
+    {UrlContains("pastoupt.com/ntfc.php")},
+    {UrlContains("pushsar.com/ntfc.php")},
+    {UrlContains("sdk.jeeng.com")},
+    {UrlContains("gstatic.com/firebasejs/")},
+    {OnDomain("pinterest.com"), UrlContains("/sw.js")},
+    {OnDomain(
+        "spartanien.de"), UrlContains("/public/spartanien/js/sw_handler")},
+    {OnDomain("rt.com"), UrlContains("/pushes/notification.js")},
+    {OnDomain("mitula.pt"), UrlContains("/js/subscriber")},
+    {OnDomain("alibaba.com"), UrlContains("/firebase.js")},
+    {OnDomain("1337x.is"), UrlContains("/sw.js")},
+    {OnDomain("1337x.to"), UrlContains("/sw.js")},
+    {OnDomain("ndtv.com"), UrlContains("push-main.js")},
+    {OnDomain("hardwarezone.com.sg"), UrlContains("/js/adNotice.js")},
+    {OnDomain("tut.by"), UrlContains("/push/")},
+    {OnDomain("azoresgetaways.com"), UrlContains("/firebase.min.js")},
+    {OnDomain("hoerbuch.us"), UrlContains("client-.js")},
+};
+
+constexpr RequestBlockClause kLocationClauses[] = {
+    {UrlContains("/geoPosition.min.js")},
+    {UrlContains("stat.profession.hu/static/js/geoPosition.js")},
+    {UrlContains("nero.live/tags/mwa.min.js")},
+    {UrlContains("z.moatads.com")},
+    {UrlContains("abs.proxistore.com")},
+    {UrlContains("cdn.hexago.io/tag/js/hexago.min.js")},
+    {UrlContains("/typo3temp/compressor/geoloc-")},
+    {UrlContains("/wp-content/plugins/strathcom-personalization/")},
+    {UrlContains("/web/modules/gps_location.js")},
+    {UrlContains("/lib/geoPosition/geoPosition.js")},
+    {OnDomain("byggmax.no"),
+     UrlContains("/Byggmax_Geolocation/js/closest-store-selector.js")},
+    {OnDomain(
+        "dhl.de"), UrlContains("/clientlibs/foundation/personalization/")},
+    {OnDomain("sat24.com"), UrlContains("/sat24mylocation.")},
+    {OnDomain("mcdonalds.ru"), UrlContains("api-maps.yandex.ru")},
+    {OnDomain("magniflex.cz"), UrlContains("nearest-place.js")},
+    {OnDomain("intesasanpaolo.com"), UrlContains("nearestFilialeService.js")},
+    {OnDomain("reseau-canope.fr"), UrlContains("/atelier.min.js")},
+};
+
+constexpr RequestBlockClause kAppClauses[] = {
+    {UrlContains("advinapps.com/ads-async.js")},
+    {UrlContains("cdn.branch.io/branch-latest.min.js")},
+    {UrlContains("browser-update.org/update.show.min.js")},
+    {UrlContains("js.convertflow.co/production/websites")},
+    {OnDomain("mosalingua.com"), UrlContains("/jquery.bxSlider.min.js")},
+    {OnDomain("designtaxi.com"), UrlContains("fancy-bar.js")},
+};
+
+constexpr RequestBlockClause kTranslationClauses[] = {
+    {UrlContains("translate.googleapis.com/element/TE_")},
+    {UrlContains("/wp-content/plugins/google-language-translator/")},
+};
+
+constexpr RequestBlockClause kScrollToTopClauses[] = {
+    {UrlContains("/back-to-top.js")},
+    {UrlContains("/wp-content/plugins/hms-navigationarrows/")},
+    {UrlContains("/scroll-to-top.min.js")},
+    {UrlContains("/catchresponsive-scrollup.min.js")},
+    {UrlContains("/wp-content/plugins/jcwp-scroll-to-top/")},
+};
+
+constexpr RequestBlockClause kVideoClauses[] = {
+    {UrlContains("apps.veedio.it/js/videobox")},
+    {UrlContains("/responsive-player/video-feature-sticky.js")},
+    {UrlContains("s-pt.ppstatic.pl/p/js/regionalne/plywajace_wideo.js")},
+    {UrlContains("/js/compiled/atoms/article/sticky-video.js")},
+    {UrlContains("sdk.digitalbees.it/jssdk.js")},
+    {OnDomain("dailymail.co.uk"), UrlContains("mol-adverts.js")},
+};
+
+constexpr RequestBlockClause kSubscribeClauses[] = {
+    {UrlContains("cdn.tinypass.com/api/tinypass.min.js")},
+    {UrlContains("tag.rightmessage.com")},
+    {OnDomain("latimes.com"),
+     UrlContains("tribdss.com/meter/assets/latarc-reaction")},
+};
+// kPageFilterOverride
+
+constexpr RequestBlockClause kFilterExemptPageClauses[] = {
+    {HostContains("bild.de")},
+    {HostContains("postimees.ee")},
+    {HostContains("grammarly.com")},
+    {HostContains("espn.com")},
+};
+
+// kFilterOverride
+
+constexpr RequestBlockClause kFilterOverrideClauses[] = {
+    {HostContains("api.ero-advertising.com"), PathContains("get.php")},
+    {HostContains("xvideos-cdn.com")},
+};
+
+constexpr RequestBlockSection kSections[] = {
+    {RequestBlockStage::kEarly, RequestBlockAction::kBlock,
+     RequestBlockGroup::kTracker, kAnyResourceType, kRequireHostPath,
+     kEarlyTrackerClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kBlock,
+     RequestBlockGroup::kAds, kAnyResourceType, kRequireHostPathQuery,
+     kEarlyAdsClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kBlock,
+     RequestBlockGroup::kAntiAdblock, kAnyResourceType, kRequireHostPath,
+     kEarlyAntiAdblockClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kBlock,
+     RequestBlockGroup::kAds, kAnyResourceType, kRequireHost,
+     kEarlyHostClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAntiAdblock, ResourceTypeBit(ResourceType::kScript),
+     kRequirePath, kBaitScriptClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequirePath,
+     kVideoAdsAllowClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequireHostPath,
+     kAllowedHostClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequireHost,
+     kAllowedServiceHostClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, ResourceTypeBit(ResourceType::kImage),
+     kRequireHost, kAllowedImageHostClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAntiAdblock, ResourceTypeBit(ResourceType::kImage),
+     kRequireHost, kBaitImageClauses},
+    {RequestBlockStage::kPageExemption, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequireHost,
+     kExemptPageClauses},
+    {RequestBlockStage::kServiceAllowlist, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequireHost,
+     kServiceClauses},
+    {RequestBlockStage::kTracker, RequestBlockAction::kBlock,
+     RequestBlockGroup::kTracker, kAnyResourceType, 0, kTrackerClauses},
+    {RequestBlockStage::kTracker, RequestBlockAction::kBlock,
+     RequestBlockGroup::kConsent, kAnyResourceType, kRequireHost,
+     kConsentClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kAds, kScriptOrImage, kRequireHostPathQuery,
+     kAdsClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kNewsletter, kScriptOrImage, kRequireHostPathQuery,
+     kNewsletterClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kSurvey, kScriptOrImage, kRequireHostPathQuery,
+     kSurveyClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kChat, kScriptOrImage, kRequireHostPathQuery,
+     kChatClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kRating, kScriptOrImage, kRequireHostPathQuery,
+     kRatingClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kPush, kScriptOrImage, kRequireHostPathQuery,
+     kPushClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kLocation, kScriptOrImage, kRequireHostPathQuery,
+     kLocationClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kApp, kScriptOrImage, kRequireHostPathQuery,
+     kAppClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kTranslation, kScriptOrImage, kRequireHostPathQuery,
+     kTranslationClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kScrollToTop, kScriptOrImage, kRequireHostPathQuery,
+     kScrollToTopClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kVideo, kScriptOrImage, kRequireHostPathQuery,
+     kVideoClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kSubscribe, kScriptOrImage, kRequireHostPathQuery,
+     kSubscribeClauses},
+    {RequestBlockStage::kPageFilterOverride, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequireHost,
+     kFilterExemptPageClauses},
+    {RequestBlockStage::kFilterOverride, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequireHostPathQuery,
+     kFilterOverrideClauses},
+};
+
+}  // namespace
+
+base::span<const RequestBlockSection> DefaultRequestBlockSections() {
+  return kSections;
+}
+
+}  // namespace blink
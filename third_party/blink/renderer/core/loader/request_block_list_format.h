@@ -0,0 +1,108 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCK_LIST_FORMAT_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCK_LIST_FORMAT_H_
+
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "build/build_config.h"
+#include "third_party/blink/renderer/core/loader/multi_pattern_matcher.h"
+
+// Binary layout of a compiled request block list, as written by
+// RequestBlocker::Serialize() and read in place by
+// RequestBlocker::CreateFromBuffer().
+//
+// A list is a RequestBlockListHeader followed by the arrays it refers to. The
+// arrays hold the plain structs below and the tables of MultiPatternMatcher,
+// so that a memory-mapped list is used without being parsed or copied. All
+// integers are little-endian and every array starts at a multiple of
+// kRequestBlockListAlignment from the start of the list.
+//
+// Any change to the structs below or to their meaning must bump
+// kRequestBlockListVersion; lists of another version are rejected and the
+// built-in list is used instead.
+
+#if !defined(ARCH_CPU_LITTLE_ENDIAN)
+#error "The request block list format assumes a little-endian CPU"
+#endif
+
+namespace blink {
+
+// "KRBL".
+constexpr uint32_t kRequestBlockListMagic = 0x4c42524b;
+constexpr uint32_t kRequestBlockListVersion = 1;
+constexpr uint32_t kRequestBlockListAlignment = 4;
+
+// The location of an array, as a byte offset from the start of the list and a
+// number of elements.
+struct RequestBlockListArray {
+  uint32_t offset;
+  uint32_t count;
+};
+
+struct RequestBlockListMatcher {
+  RequestBlockListArray nodes;
+  RequestBlockListArray edge_characters;
+  RequestBlockListArray edge_targets;
+  RequestBlockListArray outputs;
+  RequestBlockListArray root_transitions;
+};
+
+// One compiled condition of a rule. |op| and |field| hold a
+// RequestBlockCondition::Op and a RequestBlockField.
+struct RequestBlockListCondition {
+  uint8_t op;
+  uint8_t field;
+  uint16_t reserved;
+  uint32_t pattern;
+  // For kOnDomain, the id of the "." + domain pattern.
+  uint32_t subdomain_pattern;
+  uint32_t length;
+};
+
+// A rule: the conditions [first_condition, first_condition + condition_count)
+// must all hold. |stage|, |action| and |group| hold a RequestBlockStage, a
+// RequestBlockAction and a RequestBlockGroup.
+struct RequestBlockListRule {
+  uint8_t stage;
+  uint8_t action;
+  uint8_t group;
+  uint8_t required_fields;
+  uint32_t resource_types;
+  uint32_t first_condition;
+  uint32_t condition_count;
+};
+
+struct RequestBlockListHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t pattern_count;
+  uint32_t reserved;
+  // Indexed by RequestBlockField.
+  RequestBlockListMatcher matchers[4];
+  RequestBlockListArray rules;
+  RequestBlockListArray conditions;
+  // For each pattern, the rules it is a candidate for, as a slice
+  // [candidate_offsets[p], candidate_offsets[p + 1]) of |candidates|.
+  RequestBlockListArray candidate_offsets;
+  RequestBlockListArray candidates;
+};
+
+static_assert(sizeof(RequestBlockListCondition) == 16, "");
+static_assert(sizeof(RequestBlockListRule) == 16, "");
+static_assert(sizeof(MultiPatternMatcher::Node) == 20, "");
+static_assert(sizeof(RequestBlockListHeader) == 208, "");
+static_assert(
+    std::is_trivially_copyable<RequestBlockListHeader>::value &&
+        std::is_trivially_copyable<RequestBlockListRule>::value &&
+        std::is_trivially_copyable<RequestBlockListCondition>::value &&
+        std::is_trivially_copyable<MultiPatternMatcher::Node>::value,
+    "The list is read in place");
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCK_LIST_FORMAT_H_
@@ -0,0 +1,53 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Writes the request block list built into this tree, compiled in the format
+// of request_block_list_format.h, to the file given as argument:
+//
+//   request_block_list_generator request_block_list.bin
+//
+// This is the file the updates server serves to the browsers of the same
+// list format version, see chrome/browser/android/request_block_list_updater.h.
+// Updating a list means editing request_block_list.cc and generating it again.
+
+#include <stdio.h>
+
+#include "base/at_exit.h"
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "third_party/blink/renderer/core/loader/request_block_list_format.h"
+#include "third_party/blink/renderer/core/loader/request_blocker.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/partitions.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
+
+int main(int argc, char** argv) {
+  base::AtExitManager at_exit_manager;
+  base::CommandLine::Init(argc, argv);
+  const base::CommandLine::StringVector& args =
+      base::CommandLine::ForCurrentProcess()->GetArgs();
+  if (args.size() != 1) {
+    fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+    return 1;
+  }
+
+  WTF::Partitions::Initialize();
+  WTF::Initialize();
+
+  const blink::RequestBlocker& blocker = blink::RequestBlocker::Default();
+  Vector<uint8_t> list = blocker.Serialize();
+  // Check the list the way renderers do before handing it out.
+  if (!blink::RequestBlocker::CreateFromBuffer(list)) {
+    fprintf(stderr, "The compiled list does not load back\n");
+    return 1;
+  }
+
+  if (!base::WriteFile(base::FilePath(args[0]), list)) {
+    fprintf(stderr, "Failed to write the list\n");
+    return 1;
+  }
+  printf("Wrote %u rules in format version %u\n", blocker.RuleCount(),
+         blink::kRequestBlockListVersion);
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/request_block_verdict_cache.h"
+
+#include "base/check.h"
+#include "third_party/blink/renderer/core/loader/url_component_views.h"
+#include "third_party/blink/renderer/platform/weborigin/kurl.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hasher.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_view.h"
+
+namespace blink {
+
+namespace {
+
+// Looks up the String keys of the cache by StringView, so that hits do not
+// copy the host out of the URL.
+struct StringViewHashTranslator {
+  static unsigned GetHash(const StringView& view) {
+    return view.Is8Bit() ? StringHasher::ComputeHashAndMaskTop8Bits(
+                               view.Characters8(), view.length())
+                         : StringHasher::ComputeHashAndMaskTop8Bits(
+                               view.Characters16(), view.length());
+  }
+  static bool Equal(const String& key, const StringView& view) {
+    return EqualStringView(key, view);
+  }
+};
+
+}  // namespace
+
+RequestBlockVerdictCache::RequestBlockVerdictCache() = default;
+RequestBlockVerdictCache::~RequestBlockVerdictCache() = default;
+
+absl::optional<RequestBlocker::Verdict> RequestBlockVerdictCache::Evaluate(
+    const RequestBlocker& blocker,
+    RequestBlockStage stage,
+    const KURL& url,
+    ResourceType type) {
+  DCHECK(blocker.IsHostOnly(stage));
+  auto evaluate = [&]() {
+    RequestBlocker::Match match;
+    blocker.Scan(url, match);
+    return blocker.Evaluate(stage, match, type);
+  };
+
+  // A null host cannot be a key, and is rare enough not to need caching.
+  const StringView host = URLHostView(url);
+  if (host.IsNull())
+    return evaluate();
+
+  if (blocker_ != &blocker) {
+    hosts_.clear();
+    blocker_ = &blocker;
+  }
+  Vector<CachedVerdict, 4>* verdicts;
+  auto it = hosts_.Find<StringViewHashTranslator>(host);
+  if (it != hosts_.end()) {
+    verdicts = &it->value;
+    for (const CachedVerdict& cached : *verdicts) {
+      if (cached.stage == stage && cached.type == type)
+        return cached.verdict;
+    }
+  } else {
+    if (hosts_.size() >= kMaxHosts)
+      hosts_.clear();
+    verdicts = &hosts_.insert(host.ToString(), Vector<CachedVerdict, 4>())
+                    .stored_value->value;
+  }
+
+  absl::optional<RequestBlocker::Verdict> verdict = evaluate();
+  verdicts->push_back(CachedVerdict{stage, type, verdict});
+  return verdict;
+}
+
+}  // namespace blink
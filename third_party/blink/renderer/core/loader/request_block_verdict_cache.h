@@ -0,0 +1,61 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCK_VERDICT_CACHE_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCK_VERDICT_CACHE_H_
+
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/loader/request_blocker.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+class KURL;
+
+// Memoizes, for the requests made by one document, the RequestBlocker
+// verdicts that only depend on the host of a URL. Pages typically load many
+// resources from a handful of hosts, and the document's own URL is evaluated
+// for every request, so most lookups are answered without scanning the URL.
+class CORE_EXPORT RequestBlockVerdictCache final {
+  DISALLOW_NEW();
+
+ public:
+  RequestBlockVerdictCache();
+  RequestBlockVerdictCache(const RequestBlockVerdictCache&) = delete;
+  RequestBlockVerdictCache& operator=(const RequestBlockVerdictCache&) = delete;
+  ~RequestBlockVerdictCache();
+
+  // Returns blocker.Evaluate() of |stage| for |url| and |type|, computing it
+  // only once per host and resource type. |stage| must satisfy
+  // blocker.IsHostOnly().
+  absl::optional<RequestBlocker::Verdict> Evaluate(
+      const RequestBlocker& blocker,
+      RequestBlockStage stage,
+      const KURL& url,
+      ResourceType type);
+
+  wtf_size_t HostCount() const { return hosts_.size(); }
+
+ private:
+  struct CachedVerdict {
+    RequestBlockStage stage;
+    ResourceType type;
+    absl::optional<RequestBlocker::Verdict> verdict;
+  };
+
+  // Hosts beyond this are not worth remembering; the cache starts over.
+  static constexpr wtf_size_t kMaxHosts = 256;
+
+  const RequestBlocker* blocker_ = nullptr;
+  HashMap<String, Vector<CachedVerdict, 4>> hosts_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCK_VERDICT_CACHE_H_
@@ -0,0 +1,81 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/request_block_verdict_cache.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/weborigin/kurl.h"
+
+namespace blink {
+
+namespace {
+
+constexpr RequestBlockClause kExemptClauses[] = {
+    {HostContains("exempt.")},
+};
+
+constexpr RequestBlockClause kTrackerClauses[] = {
+    {HostContains("tracker.")},
+    {PathContains("/pixel.gif")},
+};
+
+constexpr RequestBlockSection kSections[] = {
+    {RequestBlockStage::kPageExemption, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, ResourceTypeBit(ResourceType::kScript),
+     kRequireHost, kExemptClauses},
+    {RequestBlockStage::kTracker, RequestBlockAction::kBlock,
+     RequestBlockGroup::kTracker, kAnyResourceType, kRequireHost,
+     kTrackerClauses},
+};
+
+}  // namespace
+
+TEST(RequestBlockVerdictCacheTest, HostOnlyStages) {
+  RequestBlocker blocker(kSections);
+  EXPECT_TRUE(blocker.IsHostOnly(RequestBlockStage::kPageExemption));
+  EXPECT_FALSE(blocker.IsHostOnly(RequestBlockStage::kTracker));
+  // A stage without rules never depends on anything but the host.
+  EXPECT_TRUE(blocker.IsHostOnly(RequestBlockStage::kAds));
+}
+
+TEST(RequestBlockVerdictCacheTest, CachesPerHostAndType) {
+  RequestBlocker blocker(kSections);
+  RequestBlockVerdictCache cache;
+  const RequestBlockStage stage = RequestBlockStage::kPageExemption;
+
+  auto verdict = cache.Evaluate(blocker, stage, KURL("https://exempt.test/a"),
+                                ResourceType::kScript);
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockAction::kAllow, verdict->action);
+  EXPECT_TRUE(cache.Evaluate(blocker, stage, KURL("https://exempt.test/b?c"),
+                             ResourceType::kScript));
+  EXPECT_EQ(1u, cache.HostCount());
+
+  // The section only applies to scripts.
+  EXPECT_FALSE(cache.Evaluate(blocker, stage, KURL("https://exempt.test/a"),
+                              ResourceType::kImage));
+  EXPECT_FALSE(cache.Evaluate(blocker, stage, KURL("https://other.test/a"),
+                              ResourceType::kScript));
+  EXPECT_EQ(2u, cache.HostCount());
+
+  EXPECT_FALSE(cache.Evaluate(blocker, stage, KURL(), ResourceType::kScript));
+  EXPECT_EQ(2u, cache.HostCount());
+}
+
+TEST(RequestBlockVerdictCacheTest, ClearedForAnotherBlocker) {
+  RequestBlocker blocker(kSections);
+  RequestBlocker other_blocker(base::span<const RequestBlockSection>(
+      kSections, 1));
+  RequestBlockVerdictCache cache;
+  const RequestBlockStage stage = RequestBlockStage::kPageExemption;
+
+  cache.Evaluate(blocker, stage, KURL("https://a.test/"), ResourceType::kScript);
+  cache.Evaluate(blocker, stage, KURL("https://b.test/"), ResourceType::kScript);
+  EXPECT_EQ(2u, cache.HostCount());
+  cache.Evaluate(other_blocker, stage, KURL("https://a.test/"),
+                 ResourceType::kScript);
+  EXPECT_EQ(1u, cache.HostCount());
+}
+
+}  // namespace blink
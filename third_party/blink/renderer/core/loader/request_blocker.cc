@@ -0,0 +1,424 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/request_blocker.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <utility>
+
+#include "base/check_op.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/memory/ptr_util.h"
+#include "base/no_destructor.h"
+#include "third_party/blink/renderer/core/loader/url_component_views.h"
+#include "third_party/blink/renderer/platform/weborigin/kurl.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+
+namespace blink {
+
+namespace {
+
+using Op = RequestBlockCondition::Op;
+
+static_assert(std::size(RequestBlockListHeader().matchers) ==
+                  kRequestBlockFieldCount,
+              "The list has one matcher per field");
+
+std::atomic<const RequestBlocker*> g_current_blocker{nullptr};
+
+bool IsIndexable(Op op) {
+  return op == Op::kContains || op == Op::kEquals || op == Op::kOnDomain;
+}
+
+template <typename VectorType>
+void SortAndRemoveDuplicates(VectorType& values) {
+  std::sort(values.begin(), values.end());
+  values.Shrink(static_cast<wtf_size_t>(
+      std::unique(values.begin(), values.end()) - values.begin()));
+}
+
+// Appends |values| to |output|, padded to the alignment of the format, and
+// returns where they are.
+template <typename T>
+RequestBlockListArray AppendArray(base::span<const T> values,
+                                  Vector<uint8_t>& output) {
+  RequestBlockListArray array = {output.size(),
+                                 static_cast<uint32_t>(values.size())};
+  output.Append(reinterpret_cast<const uint8_t*>(values.data()),
+                static_cast<wtf_size_t>(values.size_bytes()));
+  while (output.size() % kRequestBlockListAlignment)
+    output.push_back(0);
+  return array;
+}
+
+// Returns the elements of |data| described by |array|, or nullopt if they are
+// out of bounds or misaligned.
+template <typename T>
+absl::optional<base::span<const T>> GetArray(
+    base::span<const uint8_t> data,
+    const RequestBlockListArray& array) {
+  static_assert(alignof(T) <= kRequestBlockListAlignment, "");
+  if (array.offset % kRequestBlockListAlignment ||
+      array.offset > data.size() ||
+      array.count > (data.size() - array.offset) / sizeof(T)) {
+    return absl::nullopt;
+  }
+  return base::span<const T>(
+      reinterpret_cast<const T*>(data.data() + array.offset), array.count);
+}
+
+}  // namespace
+
+RequestBlocker::Match::Match() = default;
+RequestBlocker::Match::~Match() = default;
+
+bool RequestBlocker::Match::HasPattern(uint32_t pattern) const {
+  return std::binary_search(patterns_.begin(), patterns_.end(), pattern);
+}
+
+// static
+const RequestBlocker& RequestBlocker::Default() {
+  static const base::NoDestructor<RequestBlocker> blocker(
+      DefaultRequestBlockSections());
+  return *blocker;
+}
+
+// static
+const RequestBlocker& RequestBlocker::Current() {
+  if (const RequestBlocker* blocker =
+          g_current_blocker.load(std::memory_order_acquire)) {
+    return *blocker;
+  }
+  return Default();
+}
+
+// static
+void RequestBlocker::SetCurrent(std::unique_ptr<RequestBlocker> blocker) {
+  DCHECK(blocker);
+  const RequestBlocker* expected = nullptr;
+  if (g_current_blocker.compare_exchange_strong(expected, blocker.get(),
+                                                std::memory_order_acq_rel)) {
+    // Requests on any thread may be using it until the process exits.
+    blocker.release();
+    return;
+  }
+  NOTREACHED() << "A request block list is already installed";
+}
+
+// static
+std::unique_ptr<RequestBlocker> RequestBlocker::CreateFromBuffer(
+    base::span<const uint8_t> data) {
+  if (reinterpret_cast<uintptr_t>(data.data()) % kRequestBlockListAlignment ||
+      data.size() < sizeof(RequestBlockListHeader)) {
+    return nullptr;
+  }
+  RequestBlockListHeader header;
+  memcpy(&header, data.data(), sizeof(header));
+  if (header.magic != kRequestBlockListMagic ||
+      header.version != kRequestBlockListVersion) {
+    return nullptr;
+  }
+
+  std::unique_ptr<RequestBlocker> blocker =
+      base::WrapUnique(new RequestBlocker());
+  blocker->pattern_count_ = header.pattern_count;
+  for (wtf_size_t i = 0; i < kRequestBlockFieldCount; ++i) {
+    const RequestBlockListMatcher& arrays = header.matchers[i];
+    auto nodes = GetArray<MultiPatternMatcher::Node>(data, arrays.nodes);
+    auto edge_characters = GetArray<uint8_t>(data, arrays.edge_characters);
+    auto edge_targets = GetArray<uint32_t>(data, arrays.edge_targets);
+    auto outputs = GetArray<uint32_t>(data, arrays.outputs);
+    auto root_transitions = GetArray<uint32_t>(data, arrays.root_transitions);
+    if (!nodes || !edge_characters || !edge_targets || !outputs ||
+        !root_transitions) {
+      return nullptr;
+    }
+    absl::optional<MultiPatternMatcher> matcher =
+        MultiPatternMatcher::FromTables(
+            {*nodes, *edge_characters, *edge_targets, *outputs,
+             *root_transitions},
+            header.pattern_count);
+    if (!matcher)
+      return nullptr;
+    blocker->matchers_[i] = std::move(*matcher);
+  }
+
+  auto rules = GetArray<Rule>(data, header.rules);
+  auto conditions = GetArray<CompiledCondition>(data, header.conditions);
+  auto candidate_offsets = GetArray<uint32_t>(data, header.candidate_offsets);
+  auto candidates = GetArray<uint32_t>(data, header.candidates);
+  if (!rules || !conditions || !candidate_offsets || !candidates)
+    return nullptr;
+
+  for (const Rule& rule : *rules) {
+    if (rule.stage > static_cast<uint8_t>(RequestBlockStage::kFilterOverride) ||
+        rule.action > static_cast<uint8_t>(RequestBlockAction::kBlock) ||
+        rule.group > static_cast<uint8_t>(RequestBlockGroup::kMaxValue) ||
+        rule.first_condition > conditions->size() ||
+        rule.condition_count > conditions->size() - rule.first_condition) {
+      return nullptr;
+    }
+  }
+  for (const CompiledCondition& condition : *conditions) {
+    if (condition.op == static_cast<uint8_t>(Op::kNone) ||
+        condition.op > static_cast<uint8_t>(Op::kLengthIs) ||
+        condition.field >= kRequestBlockFieldCount ||
+        condition.pattern >= header.pattern_count ||
+        condition.subdomain_pattern >= header.pattern_count) {
+      return nullptr;
+    }
+  }
+  if (candidate_offsets->size() != header.pattern_count + size_t{1} ||
+      candidate_offsets->back() != candidates->size() ||
+      !std::is_sorted(candidate_offsets->begin(), candidate_offsets->end())) {
+    return nullptr;
+  }
+  for (uint32_t rule : *candidates) {
+    if (rule >= rules->size())
+      return nullptr;
+  }
+
+  blocker->rules_ = *rules;
+  blocker->conditions_ = *conditions;
+  blocker->candidate_offsets_ = *candidate_offsets;
+  blocker->candidates_ = *candidates;
+  blocker->ComputeHostOnlyStages();
+  return blocker;
+}
+
+// static
+std::unique_ptr<RequestBlocker> RequestBlocker::CreateFromFile(
+    std::unique_ptr<base::MemoryMappedFile> file) {
+  DCHECK(file && file->IsValid());
+  std::unique_ptr<RequestBlocker> blocker =
+      CreateFromBuffer(base::span<const uint8_t>(file->data(), file->length()));
+  if (blocker)
+    blocker->file_ = std::move(file);
+  return blocker;
+}
+
+RequestBlocker::RequestBlocker(base::span<const RequestBlockSection> sections) {
+  MultiPatternMatcher::Builder builders[kRequestBlockFieldCount];
+  HashMap<String, uint32_t> pattern_ids[kRequestBlockFieldCount];
+  Vector<Vector<uint32_t>> rules_by_pattern;
+
+  auto intern_pattern = [&](RequestBlockField field,
+                            const String& pattern) -> uint32_t {
+    wtf_size_t index = static_cast<wtf_size_t>(field);
+    auto result = pattern_ids[index].insert(pattern, pattern_count_);
+    if (result.is_new_entry) {
+      builders[index].AddPattern(pattern, pattern_count_);
+      rules_by_pattern.Grow(pattern_count_ + 1);
+      ++pattern_count_;
+    }
+    return result.stored_value->value;
+  };
+
+  for (const RequestBlockSection& section : sections) {
+    for (const RequestBlockClause& clause : section.clauses) {
+      const uint32_t rule_index = rule_storage_.size();
+      Rule rule = {static_cast<uint8_t>(section.stage),
+                   static_cast<uint8_t>(section.action),
+                   static_cast<uint8_t>(section.group),
+                   section.required_fields,
+                   section.resource_types,
+                   condition_storage_.size(),
+                   0};
+      bool indexed = false;
+      for (const RequestBlockCondition& condition : clause.conditions) {
+        if (condition.op == Op::kNone)
+          break;
+        CompiledCondition compiled = {static_cast<uint8_t>(condition.op),
+                                      static_cast<uint8_t>(condition.field),
+                                      0,
+                                      0,
+                                      0,
+                                      condition.length};
+        switch (condition.op) {
+          case Op::kContains:
+          case Op::kLacks:
+          case Op::kEquals: {
+            String value(condition.value);
+            compiled.pattern = intern_pattern(condition.field, value);
+            if (condition.op == Op::kEquals)
+              compiled.length = value.length();
+            break;
+          }
+          case Op::kOnDomain: {
+            DCHECK_EQ(condition.field, RequestBlockField::kHost);
+            String domain(condition.value);
+            compiled.pattern = intern_pattern(RequestBlockField::kHost, domain);
+            compiled.subdomain_pattern =
+                intern_pattern(RequestBlockField::kHost, "." + domain);
+            compiled.length = domain.length();
+            break;
+          }
+          case Op::kLengthIs:
+          case Op::kNone:
+            break;
+        }
+        if (!indexed && IsIndexable(condition.op)) {
+          rules_by_pattern[compiled.pattern].push_back(rule_index);
+          if (condition.op == Op::kOnDomain)
+            rules_by_pattern[compiled.subdomain_pattern].push_back(rule_index);
+          indexed = true;
+        }
+        condition_storage_.push_back(compiled);
+      }
+      DCHECK(indexed) << "Rule " << rule_index << " has no pattern to index";
+      rule.condition_count = condition_storage_.size() - rule.first_condition;
+      rule_storage_.push_back(rule);
+    }
+  }
+
+  candidate_offset_storage_.ReserveInitialCapacity(pattern_count_ + 1);
+  for (const auto& rules : rules_by_pattern) {
+    candidate_offset_storage_.push_back(candidate_storage_.size());
+    candidate_storage_.AppendVector(rules);
+  }
+  candidate_offset_storage_.push_back(candidate_storage_.size());
+
+  for (wtf_size_t i = 0; i < kRequestBlockFieldCount; ++i)
+    matchers_[i] = builders[i].Build();
+
+  rules_ = rule_storage_;
+  conditions_ = condition_storage_;
+  candidate_offsets_ = candidate_offset_storage_;
+  candidates_ = candidate_storage_;
+  ComputeHostOnlyStages();
+}
+
+RequestBlocker::RequestBlocker() = default;
+
+RequestBlocker::~RequestBlocker() = default;
+
+void RequestBlocker::ComputeHostOnlyStages() {
+  host_only_stages_ = ~0u;
+  for (const Rule& rule : rules_) {
+    bool host_only = !(rule.required_fields & ~kRequireHost);
+    for (uint32_t i = 0; i < rule.condition_count; ++i) {
+      if (conditions_[rule.first_condition + i].field !=
+          static_cast<uint8_t>(RequestBlockField::kHost)) {
+        host_only = false;
+      }
+    }
+    if (!host_only)
+      host_only_stages_ &= ~(1u << rule.stage);
+  }
+}
+
+Vector<uint8_t> RequestBlocker::Serialize() const {
+  RequestBlockListHeader header = {};
+  header.magic = kRequestBlockListMagic;
+  header.version = kRequestBlockListVersion;
+  header.pattern_count = pattern_count_;
+
+  Vector<uint8_t> output;
+  output.Grow(sizeof(header));
+  for (wtf_size_t i = 0; i < kRequestBlockFieldCount; ++i) {
+    const MultiPatternMatcher::Tables& tables = matchers_[i].tables();
+    RequestBlockListMatcher& arrays = header.matchers[i];
+    arrays.nodes = AppendArray(tables.nodes, output);
+    arrays.edge_characters = AppendArray(tables.edge_characters, output);
+    arrays.edge_targets = AppendArray(tables.edge_targets, output);
+    arrays.outputs = AppendArray(tables.outputs, output);
+    arrays.root_transitions = AppendArray(tables.root_transitions, output);
+  }
+  header.rules = AppendArray(rules_, output);
+  header.conditions = AppendArray(conditions_, output);
+  header.candidate_offsets = AppendArray(candidate_offsets_, output);
+  header.candidates = AppendArray(candidates_, output);
+
+  memcpy(output.data(), &header, sizeof(header));
+  return output;
+}
+
+void RequestBlocker::Scan(const KURL& url, Match& match) const {
+  match.present_fields_ = 0;
+  match.patterns_.clear();
+  match.candidate_rules_.clear();
+  if (url.IsNull())
+    return;
+
+  const StringView fields[kRequestBlockFieldCount] = {
+      URLHostView(url), URLPathView(url), URLQueryView(url), url.GetString()};
+  for (wtf_size_t i = 0; i < kRequestBlockFieldCount; ++i) {
+    match.lengths_[i] = fields[i].length();
+    if (fields[i].IsNull())
+      continue;
+    match.present_fields_ |= 1 << i;
+    matchers_[i].FindAll(fields[i], match.patterns_);
+  }
+  SortAndRemoveDuplicates(match.patterns_);
+
+  for (uint32_t pattern : match.patterns_) {
+    for (uint32_t i = candidate_offsets_[pattern];
+         i < candidate_offsets_[pattern + 1]; ++i) {
+      match.candidate_rules_.push_back(candidates_[i]);
+    }
+  }
+  SortAndRemoveDuplicates(match.candidate_rules_);
+}
+
+absl::optional<RequestBlocker::Verdict> RequestBlocker::Evaluate(
+    RequestBlockStage stage,
+    const Match& match,
+    ResourceType type) const {
+  for (uint32_t index : match.candidate_rules_) {
+    const Rule& rule = rules_[index];
+    if (rule.stage != static_cast<uint8_t>(stage) ||
+        !(rule.resource_types & ResourceTypeBit(type))) {
+      continue;
+    }
+    if ((match.present_fields_ & rule.required_fields) != rule.required_fields)
+      continue;
+    if (Matches(rule, match)) {
+      return Verdict{static_cast<RequestBlockAction>(rule.action),
+                     static_cast<RequestBlockGroup>(rule.group), index};
+    }
+  }
+  return absl::nullopt;
+}
+
+bool RequestBlocker::Matches(const Rule& rule, const Match& match) const {
+  for (uint32_t i = 0; i < rule.condition_count; ++i) {
+    const CompiledCondition& condition = conditions_[rule.first_condition + i];
+    const wtf_size_t length = match.lengths_[condition.field];
+    bool satisfied = false;
+    switch (static_cast<Op>(condition.op)) {
+      case Op::kContains:
+        satisfied = match.HasPattern(condition.pattern);
+        break;
+      case Op::kLacks:
+        satisfied = !match.HasPattern(condition.pattern);
+        break;
+      case Op::kEquals:
+        satisfied =
+            length == condition.length && match.HasPattern(condition.pattern);
+        break;
+      case Op::kOnDomain:
+        satisfied = match.HasPattern(condition.subdomain_pattern) ||
+                    (length == condition.length &&
+                     match.HasPattern(condition.pattern));
+        break;
+      case Op::kLengthIs:
+        satisfied = length == condition.length;
+        break;
+      case Op::kNone:
+        NOTREACHED();
+        break;
+    }
+    if (!satisfied)
+      return false;
+  }
+  return true;
+}
+
+}  // namespace blink
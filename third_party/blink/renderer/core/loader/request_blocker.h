@@ -0,0 +1,305 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCKER_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCKER_H_
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "base/containers/span.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/loader/multi_pattern_matcher.h"
+#include "third_party/blink/renderer/core/loader/request_block_list_format.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace base {
+class MemoryMappedFile;
+}  // namespace base
+
+namespace blink {
+
+class KURL;
+
+// The URL component a condition is evaluated against.
+enum class RequestBlockField : uint8_t {
+  kHost,
+  kPath,
+  kQuery,
+  kUrl,
+};
+constexpr wtf_size_t kRequestBlockFieldCount = 4;
+
+// Bits of RequestBlockSection::required_fields, indexed by RequestBlockField.
+// A section only applies when each of the listed URL components is non-null.
+constexpr uint8_t kRequireHost = 1 << 0;
+constexpr uint8_t kRequirePath = 1 << 1;
+constexpr uint8_t kRequireQuery = 1 << 2;
+
+// Where in BaseFetchContext::CanRequestInternal() a rule is evaluated. Within
+// a stage, rules are evaluated in list order and the first match wins.
+enum class RequestBlockStage : uint8_t {
+  // Before the security checks. Rules either block or allow the request.
+  kEarly,
+  // Evaluated against the URL of the document issuing the request. A match
+  // allows every request the document makes.
+  kPageExemption,
+  // Requests to the browser's own services, search engines and a few sites
+  // that break without their ads or trackers, allowed from any document that
+  // has a host.
+  kServiceAllowlist,
+  // After the security checks. Blocks trackers and consent dialogs regardless
+  // of whether ad blocking is active for the frame.
+  kTracker,
+  // Ads and page annoyances, applied while ad blocking is active.
+  kAds,
+  // Evaluated against the URL of the document issuing the request. A match
+  // overrides a block by the SubresourceFilter.
+  kPageFilterOverride,
+  // Requests allowed despite a block by the SubresourceFilter.
+  kFilterOverride,
+};
+
+enum class RequestBlockAction : uint8_t {
+  kAllow,
+  kBlock,
+};
+
+// What a rule is meant to catch. Only used for reporting.
+enum class RequestBlockGroup : uint8_t {
+  kAllowlist,
+  kTracker,
+  kAds,
+  kAntiAdblock,
+  kConsent,
+  kNewsletter,
+  kSurvey,
+  kChat,
+  kRating,
+  kPush,
+  kLocation,
+  kApp,
+  kTranslation,
+  kScrollToTop,
+  kVideo,
+  kSubscribe,
+  kMaxValue = kSubscribe,
+};
+
+// A single test on a URL component. Built with the helpers below, e.g.
+// HostContains("tracker.example").
+struct RequestBlockCondition {
+  enum class Op : uint8_t {
+    kNone,
+    // The component contains |value|.
+    kContains,
+    // The component does not contain |value|.
+    kLacks,
+    // The component is exactly |value|.
+    kEquals,
+    // The host is |value| or contains "." followed by |value|.
+    kOnDomain,
+    // The component is |length| characters long.
+    kLengthIs,
+  };
+
+  Op op = Op::kNone;
+  RequestBlockField field = RequestBlockField::kHost;
+  const char* value = nullptr;
+  uint32_t length = 0;
+};
+
+constexpr RequestBlockCondition HostContains(const char* value) {
+  return {RequestBlockCondition::Op::kContains, RequestBlockField::kHost,
+          value};
+}
+constexpr RequestBlockCondition PathContains(const char* value) {
+  return {RequestBlockCondition::Op::kContains, RequestBlockField::kPath,
+          value};
+}
+constexpr RequestBlockCondition QueryContains(const char* value) {
+  return {RequestBlockCondition::Op::kContains, RequestBlockField::kQuery,
+          value};
+}
+constexpr RequestBlockCondition UrlContains(const char* value) {
+  return {RequestBlockCondition::Op::kContains, RequestBlockField::kUrl,
+          value};
+}
+constexpr RequestBlockCondition PathLacks(const char* value) {
+  return {RequestBlockCondition::Op::kLacks, RequestBlockField::kPath, value};
+}
+constexpr RequestBlockCondition HostIs(const char* value) {
+  return {RequestBlockCondition::Op::kEquals, RequestBlockField::kHost, value};
+}
+constexpr RequestBlockCondition PathIs(const char* value) {
+  return {RequestBlockCondition::Op::kEquals, RequestBlockField::kPath, value};
+}
+constexpr RequestBlockCondition OnDomain(const char* value) {
+  return {RequestBlockCondition::Op::kOnDomain, RequestBlockField::kHost,
+          value};
+}
+constexpr RequestBlockCondition HostLengthIs(uint32_t length) {
+  return {RequestBlockCondition::Op::kLengthIs, RequestBlockField::kHost,
+          nullptr, length};
+}
+constexpr RequestBlockCondition PathLengthIs(uint32_t length) {
+  return {RequestBlockCondition::Op::kLengthIs, RequestBlockField::kPath,
+          nullptr, length};
+}
+
+constexpr wtf_size_t kMaxRequestBlockConditions = 6;
+
+// A rule: matches when all of its conditions hold. At least one condition
+// must be kContains, kEquals or kOnDomain, which the rule is indexed by.
+struct RequestBlockClause {
+  RequestBlockCondition conditions[kMaxRequestBlockConditions];
+};
+
+constexpr uint32_t ResourceTypeBit(ResourceType type) {
+  return 1u << static_cast<uint32_t>(type);
+}
+constexpr uint32_t kAnyResourceType = ~0u;
+
+// A list of rules sharing the same stage, outcome and preconditions.
+struct RequestBlockSection {
+  RequestBlockStage stage;
+  RequestBlockAction action;
+  RequestBlockGroup group;
+  // Mask of ResourceTypeBit() values the section applies to.
+  uint32_t resource_types;
+  uint8_t required_fields;
+  base::span<const RequestBlockClause> clauses;
+};
+
+// The rules Kiwi ships with, in evaluation order.
+CORE_EXPORT base::span<const RequestBlockSection> DefaultRequestBlockSections();
+
+// Compiled form of a list of RequestBlockSections. Each URL component is
+// scanned once with a MultiPatternMatcher built from every pattern of that
+// component, and only the rules indexed by a pattern that occurs are
+// evaluated, so the cost of a lookup does not grow with the number of rules.
+//
+// The compiled form can be written out with Serialize() and used in place
+// from a memory-mapped file, so that renderers share a single copy of a list
+// that is updated independently of the binary.
+//
+// A RequestBlocker is immutable once built and may be used from any thread.
+class CORE_EXPORT RequestBlocker {
+  USING_FAST_MALLOC(RequestBlocker);
+
+ public:
+  // The patterns found in a URL and the rules they make candidates. Computed
+  // once per URL by Scan() and then evaluated for each stage.
+  class CORE_EXPORT Match {
+    STACK_ALLOCATED();
+
+   public:
+    Match();
+    ~Match();
+
+    bool HasPattern(uint32_t pattern) const;
+
+   private:
+    friend class RequestBlocker;
+
+    uint8_t present_fields_ = 0;
+    wtf_size_t lengths_[kRequestBlockFieldCount] = {};
+    // Sorted and de-duplicated.
+    PatternIdList patterns_;
+    Vector<uint32_t, 16> candidate_rules_;
+  };
+
+  struct Verdict {
+    RequestBlockAction action;
+    RequestBlockGroup group;
+    // Index of the rule in list order.
+    uint32_t rule;
+  };
+
+  // Returns the blocker compiled from DefaultRequestBlockSections().
+  static const RequestBlocker& Default();
+
+  // Returns the blocker installed with SetCurrent(), or Default() if there is
+  // none.
+  static const RequestBlocker& Current();
+
+  // Makes |blocker| the one returned by Current() for the rest of the process
+  // lifetime. May be called at most once, before requests are made.
+  static void SetCurrent(std::unique_ptr<RequestBlocker> blocker);
+
+  // Returns a blocker reading the list written by Serialize() in place, or
+  // nullptr if |data| is not a well-formed list of the current version.
+  // |data| must outlive the blocker.
+  static std::unique_ptr<RequestBlocker> CreateFromBuffer(
+      base::span<const uint8_t> data);
+
+  // Same as CreateFromBuffer() for the contents of |file|, which the blocker
+  // keeps mapped.
+  static std::unique_ptr<RequestBlocker> CreateFromFile(
+      std::unique_ptr<base::MemoryMappedFile> file);
+
+  explicit RequestBlocker(base::span<const RequestBlockSection> sections);
+  RequestBlocker(const RequestBlocker&) = delete;
+  RequestBlocker& operator=(const RequestBlocker&) = delete;
+  ~RequestBlocker();
+
+  void Scan(const KURL& url, Match& match) const;
+
+  // Returns the first rule of |stage| that matches, if any.
+  absl::optional<Verdict> Evaluate(RequestBlockStage stage,
+                                   const Match& match,
+                                   ResourceType type) const;
+
+  // Returns the list in the format of request_block_list_format.h.
+  Vector<uint8_t> Serialize() const;
+
+  // Whether every rule of |stage| only tests the host of a URL, so that its
+  // verdict is the same for all URLs with the same host.
+  bool IsHostOnly(RequestBlockStage stage) const {
+    return host_only_stages_ & (1u << static_cast<uint32_t>(stage));
+  }
+
+  wtf_size_t RuleCount() const {
+    return static_cast<wtf_size_t>(rules_.size());
+  }
+  wtf_size_t PatternCount() const { return pattern_count_; }
+
+ private:
+  using Rule = RequestBlockListRule;
+  using CompiledCondition = RequestBlockListCondition;
+
+  RequestBlocker();
+
+  void ComputeHostOnlyStages();
+  bool Matches(const Rule&, const Match&) const;
+
+  MultiPatternMatcher matchers_[kRequestBlockFieldCount];
+  uint32_t pattern_count_ = 0;
+  // Bits indexed by RequestBlockStage.
+  uint32_t host_only_stages_ = 0;
+  // These point either into the vectors below or into a serialized list.
+  base::span<const Rule> rules_;
+  base::span<const CompiledCondition> conditions_;
+  // For each pattern, the rules it is a candidate for, as a slice
+  // [candidate_offsets_[p], candidate_offsets_[p + 1]) of |candidates_|.
+  base::span<const uint32_t> candidate_offsets_;
+  base::span<const uint32_t> candidates_;
+
+  // Backing storage of a blocker compiled from RequestBlockSections.
+  Vector<Rule> rule_storage_;
+  Vector<CompiledCondition> condition_storage_;
+  Vector<uint32_t> candidate_offset_storage_;
+  Vector<uint32_t> candidate_storage_;
+
+  // The file a blocker created by CreateFromFile() reads from.
+  std::unique_ptr<base::MemoryMappedFile> file_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_REQUEST_BLOCKER_H_
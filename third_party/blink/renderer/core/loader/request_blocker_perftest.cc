@@ -0,0 +1,186 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// A benchmark of the request blocking in BaseFetchContext::CanRequest().
+// It replays recorded request URLs, grouped by the page that issued them,
+// through the FrameFetchContext of a document with the page's URL. Like
+// style_perftest.cc, it depends on external JSON files that are not checked
+// in, and the tests are skipped if the files are not available. Each file
+// has the form
+//
+//   {"pages": [{"url": "https://www.example.com/",
+//               "requests": [{"url": "https://cdn.example.com/a.js",
+//                             "type": "script"}, ...]}, ...]}
+//
+// where "type" is one of the keys of kResourceTypes.
+
+#include "third_party/blink/renderer/core/loader/base_fetch_context.h"
+
+#include "base/command_line.h"
+#include "base/json/json_reader.h"
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/testing/dummy_page_holder.h"
+#include "third_party/blink/renderer/core/testing/scoped_allocation_counter.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_loader_options.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_request.h"
+#include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
+
+namespace blink {
+
+namespace {
+
+struct ResourceTypeName {
+  const char* name;
+  ResourceType type;
+};
+
+constexpr ResourceTypeName kResourceTypes[] = {
+    {"script", ResourceType::kScript}, {"image", ResourceType::kImage},
+    {"stylesheet", ResourceType::kCSSStyleSheet},
+    {"font", ResourceType::kFont},     {"xhr", ResourceType::kRaw},
+    {"media", ResourceType::kVideo},   {"manifest", ResourceType::kManifest},
+};
+
+struct RecordedRequest {
+  KURL url;
+  ResourceType type;
+};
+
+struct RecordedPage {
+  KURL url;
+  Vector<RecordedRequest> requests;
+};
+
+ResourceType ResourceTypeFromName(const std::string& name) {
+  for (const ResourceTypeName& entry : kResourceTypes) {
+    if (name == entry.name)
+      return entry.type;
+  }
+  return ResourceType::kRaw;
+}
+
+absl::optional<Vector<RecordedPage>> ReadRecordedPages(const char* filename) {
+  scoped_refptr<SharedBuffer> serialized = test::ReadFromFile(filename);
+  absl::optional<base::Value> json = base::JSONReader::Read(
+      base::StringPiece(serialized->Data(), serialized->size()));
+  if (!json || !json->is_dict() || !json->GetDict().FindList("pages"))
+    return absl::nullopt;
+
+  Vector<RecordedPage> pages;
+  for (const base::Value& page_json : *json->GetDict().FindList("pages")) {
+    const base::Value::Dict& page_dict = page_json.GetDict();
+    RecordedPage& page = pages.emplace_back();
+    page.url = KURL(String(*page_dict.FindString("url")));
+    for (const base::Value& request_json : *page_dict.FindList("requests")) {
+      const base::Value::Dict& request_dict = request_json.GetDict();
+      page.requests.push_back(RecordedRequest{
+          KURL(String(*request_dict.FindString("url"))),
+          ResourceTypeFromName(*request_dict.FindString("type"))});
+    }
+  }
+  return pages;
+}
+
+void MeasureCanRequestForRecordedPages(const char* filename,
+                                       const char* label) {
+  // More iterations give more stable numbers. (If this flag does not exist,
+  // it will return the empty string.)
+  const std::string iterations_str =
+      base::CommandLine::ForCurrentProcess()->GetSwitchValueASCII(
+          "blocker-iterations");
+  const int iterations = iterations_str.empty() ? 10 : stoi(iterations_str);
+
+  absl::optional<Vector<RecordedPage>> pages = ReadRecordedPages(filename);
+  if (!pages) {
+    char msg[256];
+    snprintf(msg, sizeof(msg), "Skipping %s test because %s could not be read",
+             label, filename);
+    GTEST_SKIP_(msg);
+  }
+
+  base::TimeDelta elapsed;
+  size_t allocations = 0;
+  size_t request_count = 0;
+  size_t blocked_count = 0;
+  for (const RecordedPage& page : *pages) {
+    // A fresh document per page, so that the verdicts its FrameFetchContext
+    // caches per host are not carried over from other pages.
+    auto page_holder = std::make_unique<DummyPageHolder>(gfx::Size(800, 600));
+    Document& document = page_holder->GetDocument();
+    document.SetURL(page.url);
+    const BaseFetchContext& context =
+        static_cast<const BaseFetchContext&>(document.Fetcher()->Context());
+    const ResourceLoaderOptions options(nullptr /* world */);
+
+    Vector<ResourceRequest> requests;
+    for (const RecordedRequest& recorded : page.requests) {
+      ResourceRequest& request = requests.emplace_back(recorded.url);
+      request.SetRequestorOrigin(document.Fetcher()
+                                     ->GetProperties()
+                                     .GetFetchClientSettingsObject()
+                                     .GetSecurityOrigin());
+    }
+
+    auto replay = [&]() {
+      size_t blocked = 0;
+      for (wtf_size_t i = 0; i < requests.size(); ++i) {
+        if (context.CanRequest(page.requests[i].type, requests[i],
+                               page.requests[i].url, options,
+                               ReportingDisposition::kSuppressReporting,
+                               absl::nullopt)) {
+          ++blocked;
+        }
+      }
+      return blocked;
+    };
+
+    // The first replay fills the caches, as the first requests of a page
+    // would.
+    blocked_count += replay();
+
+    ScopedAllocationCounter allocation_counter;
+    base::ElapsedTimer timer;
+    for (int i = 0; i < iterations; ++i)
+      replay();
+    elapsed += timer.Elapsed();
+    allocations += allocation_counter.Count();
+    request_count += requests.size() * iterations;
+  }
+
+  perf_test::PerfResultReporter reporter("BlinkRequestBlocker", label);
+  reporter.RegisterFyiMetric("NumRequests", "");
+  reporter.AddResult("NumRequests",
+                     static_cast<double>(request_count / iterations));
+  reporter.RegisterFyiMetric("BlockedRequests", "");
+  reporter.AddResult("BlockedRequests", static_cast<double>(blocked_count));
+
+  if (!request_count)
+    return;
+  reporter.RegisterImportantMetric("TimePerRequest", "ns");
+  reporter.AddResult("TimePerRequest", elapsed.InNanoseconds() /
+                                           static_cast<double>(request_count));
+  reporter.RegisterImportantMetric("AllocationsPerRequest", "count");
+  reporter.AddResult("AllocationsPerRequest",
+                     allocations / static_cast<double>(request_count));
+}
+
+}  // namespace
+
+TEST(RequestBlockerPerfTest, News) {
+  MeasureCanRequestForRecordedPages("blocker_requests_news.json", "News");
+}
+
+TEST(RequestBlockerPerfTest, Video) {
+  MeasureCanRequestForRecordedPages("blocker_requests_video.json", "Video");
+}
+
+TEST(RequestBlockerPerfTest, Adult) {
+  MeasureCanRequestForRecordedPages("blocker_requests_adult.json", "Adult");
+}
+
+}  // namespace blink
@@ -0,0 +1,256 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/request_blocker.h"
+
+#include <string.h>
+
+#include <memory>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/weborigin/kurl.h"
+
+namespace blink {
+
+namespace {
+
+constexpr RequestBlockClause kBlockClauses[] = {
+    {HostContains("tracker.")},
+    {OnDomain("news.example"), UrlContains("/popup.js")},
+    {HostContains(".cdn.example"), PathLacks("player")},
+    {HostLengthIs(11), PathContains(".js")},
+};
+
+constexpr RequestBlockClause kAllowClauses[] = {
+    {HostIs("tracker.allowed.example")},
+    {PathIs("/favicon.ico")},
+};
+
+constexpr RequestBlockClause kQueryClauses[] = {
+    {UrlContains("&sw="), UrlContains("&sh=")},
+};
+
+constexpr RequestBlockSection kSections[] = {
+    {RequestBlockStage::kEarly, RequestBlockAction::kAllow,
+     RequestBlockGroup::kAllowlist, kAnyResourceType, kRequireHost,
+     kAllowClauses},
+    {RequestBlockStage::kEarly, RequestBlockAction::kBlock,
+     RequestBlockGroup::kTracker, kAnyResourceType, kRequireHost,
+     kBlockClauses},
+    {RequestBlockStage::kAds, RequestBlockAction::kBlock,
+     RequestBlockGroup::kAds, ResourceTypeBit(ResourceType::kScript),
+     kRequireQuery, kQueryClauses},
+};
+
+class RequestBlockerTest : public testing::Test {
+ protected:
+  absl::optional<RequestBlocker::Verdict> Evaluate(
+      RequestBlockStage stage,
+      const char* url,
+      ResourceType type = ResourceType::kScript) {
+    RequestBlocker::Match match;
+    blocker_.Scan(KURL(url), match);
+    return blocker_.Evaluate(stage, match, type);
+  }
+
+  bool IsBlocked(const char* url) {
+    auto verdict = Evaluate(RequestBlockStage::kEarly, url);
+    return verdict && verdict->action == RequestBlockAction::kBlock;
+  }
+
+  RequestBlocker blocker_{kSections};
+};
+
+}  // namespace
+
+TEST_F(RequestBlockerTest, Contains) {
+  EXPECT_TRUE(IsBlocked("https://tracker.example.com/t.gif"));
+  EXPECT_TRUE(IsBlocked("https://www.tracker.example.com/"));
+  EXPECT_FALSE(IsBlocked("https://example.com/tracker./"));
+}
+
+TEST_F(RequestBlockerTest, FirstMatchWins) {
+  auto verdict =
+      Evaluate(RequestBlockStage::kEarly, "https://tracker.allowed.example/");
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockAction::kAllow, verdict->action);
+  EXPECT_EQ(0u, verdict->rule);
+
+  // HostIs() is an exact match.
+  EXPECT_TRUE(IsBlocked("https://tracker.allowed.example.org/"));
+}
+
+TEST_F(RequestBlockerTest, OnDomain) {
+  EXPECT_TRUE(IsBlocked("https://news.example/js/popup.js"));
+  EXPECT_TRUE(IsBlocked("https://www.news.example/js/popup.js"));
+  EXPECT_FALSE(IsBlocked("https://othernews.example/js/popup.js"));
+  EXPECT_FALSE(IsBlocked("https://news.example/js/main.js"));
+}
+
+TEST_F(RequestBlockerTest, Lacks) {
+  EXPECT_TRUE(IsBlocked("https://a.cdn.example/banner.js"));
+  EXPECT_FALSE(IsBlocked("https://a.cdn.example/player.js"));
+}
+
+TEST_F(RequestBlockerTest, Length) {
+  EXPECT_TRUE(IsBlocked("https://abcdefg.com/x.js"));
+  EXPECT_FALSE(IsBlocked("https://abcdefgh.com/x.js"));
+  EXPECT_FALSE(IsBlocked("https://abcdefg.com/x.css"));
+}
+
+TEST_F(RequestBlockerTest, StagesAndResourceTypes) {
+  const char* url = "https://example.com/pop?a=1&sw=1&sh=2";
+  EXPECT_FALSE(Evaluate(RequestBlockStage::kEarly, url));
+  EXPECT_TRUE(Evaluate(RequestBlockStage::kAds, url, ResourceType::kScript));
+  EXPECT_FALSE(Evaluate(RequestBlockStage::kAds, url, ResourceType::kImage));
+  EXPECT_FALSE(Evaluate(RequestBlockStage::kAds,
+                        "https://example.com/pop?a=1&sw=1"));
+}
+
+TEST_F(RequestBlockerTest, RequiredFields) {
+  // The patterns occur in the fragment, but the section requires a query.
+  EXPECT_FALSE(
+      Evaluate(RequestBlockStage::kAds, "https://example.com/pop#&sw=1&sh=2"));
+}
+
+TEST_F(RequestBlockerTest, NullURL) {
+  RequestBlocker::Match match;
+  blocker_.Scan(KURL(), match);
+  EXPECT_FALSE(blocker_.Evaluate(RequestBlockStage::kEarly, match,
+                                 ResourceType::kScript));
+}
+
+TEST_F(RequestBlockerTest, SerializeRoundTrip) {
+  Vector<uint8_t> data = blocker_.Serialize();
+  std::unique_ptr<RequestBlocker> loaded =
+      RequestBlocker::CreateFromBuffer(data);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(blocker_.RuleCount(), loaded->RuleCount());
+  EXPECT_EQ(blocker_.PatternCount(), loaded->PatternCount());
+
+  RequestBlocker::Match match;
+  loaded->Scan(KURL("https://www.news.example/js/popup.js"), match);
+  auto verdict =
+      loaded->Evaluate(RequestBlockStage::kEarly, match, ResourceType::kScript);
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockAction::kBlock, verdict->action);
+  EXPECT_EQ(RequestBlockGroup::kTracker, verdict->group);
+
+  loaded->Scan(KURL("https://example.com/pop?a=1&sw=1&sh=2"), match);
+  EXPECT_TRUE(
+      loaded->Evaluate(RequestBlockStage::kAds, match, ResourceType::kScript));
+  EXPECT_FALSE(
+      loaded->Evaluate(RequestBlockStage::kAds, match, ResourceType::kImage));
+}
+
+TEST_F(RequestBlockerTest, CreateFromBufferRejectsMalformedData) {
+  const Vector<uint8_t> data = blocker_.Serialize();
+  EXPECT_FALSE(RequestBlocker::CreateFromBuffer({}));
+  EXPECT_FALSE(RequestBlocker::CreateFromBuffer(
+      base::span<const uint8_t>(data.data(), data.size() - 4)));
+
+  RequestBlockListHeader header;
+  memcpy(&header, data.data(), sizeof(header));
+  auto create_with_header = [&](const RequestBlockListHeader& modified) {
+    Vector<uint8_t> copy = data;
+    memcpy(copy.data(), &modified, sizeof(modified));
+    return RequestBlocker::CreateFromBuffer(copy);
+  };
+  EXPECT_TRUE(create_with_header(header));
+
+  RequestBlockListHeader modified = header;
+  modified.version = kRequestBlockListVersion + 1;
+  EXPECT_FALSE(create_with_header(modified));
+
+  modified = header;
+  modified.matchers[0].nodes.offset += 2;
+  EXPECT_FALSE(create_with_header(modified));
+
+  modified = header;
+  modified.rules.count += 1000;
+  EXPECT_FALSE(create_with_header(modified));
+
+  modified = header;
+  modified.pattern_count -= 1;
+  EXPECT_FALSE(create_with_header(modified));
+
+  // A candidate referring to a rule that does not exist.
+  Vector<uint8_t> copy = data;
+  ASSERT_GT(header.candidates.count, 0u);
+  const uint32_t bad_rule = header.rules.count;
+  memcpy(copy.data() + header.candidates.offset, &bad_rule, sizeof(bad_rule));
+  EXPECT_FALSE(RequestBlocker::CreateFromBuffer(copy));
+}
+
+TEST(DefaultRequestBlockerTest, Rules) {
+  const RequestBlocker& blocker = RequestBlocker::Default();
+  EXPECT_GT(blocker.RuleCount(), 500u);
+
+  auto evaluate = [&](RequestBlockStage stage, const char* url,
+                      ResourceType type) {
+    RequestBlocker::Match match;
+    blocker.Scan(KURL(url), match);
+    return blocker.Evaluate(stage, match, type);
+  };
+
+  auto verdict = evaluate(RequestBlockStage::kEarly,
+                          "https://o123.ingest.sentry.io/api/",
+                          ResourceType::kRaw);
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockAction::kBlock, verdict->action);
+
+  verdict = evaluate(RequestBlockStage::kEarly,
+                     "https://example.com/js/ads.js", ResourceType::kScript);
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockAction::kAllow, verdict->action);
+
+  verdict = evaluate(RequestBlockStage::kAds,
+                     "https://static.hotjar.com/c/hotjar-1.js?sv=6",
+                     ResourceType::kScript);
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockGroup::kAds, verdict->group);
+
+  verdict = evaluate(RequestBlockStage::kAds,
+                     "https://embed.tawk.to/123/default?x=1",
+                     ResourceType::kScript);
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockGroup::kChat, verdict->group);
+
+  EXPECT_TRUE(evaluate(RequestBlockStage::kPageExemption,
+                       "https://www.google.com/search", ResourceType::kImage));
+  // Requests to search engines and a few services are let through from
+  // every page.
+  verdict = evaluate(RequestBlockStage::kServiceAllowlist,
+                     "https://cdn.ecosia.org/assets/app.js",
+                     ResourceType::kScript);
+  ASSERT_TRUE(verdict);
+  EXPECT_EQ(RequestBlockAction::kAllow, verdict->action);
+  EXPECT_TRUE(evaluate(RequestBlockStage::kServiceAllowlist,
+                       "https://www.bing.com/sa/simg/favicon.ico",
+                       ResourceType::kImage));
+  EXPECT_TRUE(evaluate(RequestBlockStage::kServiceAllowlist,
+                       "https://www.ebay.de/static/app.js",
+                       ResourceType::kScript));
+  EXPECT_FALSE(evaluate(RequestBlockStage::kAds,
+                        "https://example.com/index.js?v=1",
+                        ResourceType::kScript));
+
+  // The stages evaluated against the document URL can be cached per host.
+  EXPECT_TRUE(blocker.IsHostOnly(RequestBlockStage::kPageExemption));
+  EXPECT_TRUE(blocker.IsHostOnly(RequestBlockStage::kServiceAllowlist));
+  EXPECT_TRUE(blocker.IsHostOnly(RequestBlockStage::kPageFilterOverride));
+  EXPECT_FALSE(blocker.IsHostOnly(RequestBlockStage::kAds));
+}
+
+TEST(DefaultRequestBlockerTest, SerializeRoundTrip) {
+  const RequestBlocker& blocker = RequestBlocker::Default();
+  Vector<uint8_t> data = blocker.Serialize();
+  std::unique_ptr<RequestBlocker> loaded =
+      RequestBlocker::CreateFromBuffer(data);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(blocker.RuleCount(), loaded->RuleCount());
+  EXPECT_EQ(data, loaded->Serialize());
+}
+
+}  // namespace blink
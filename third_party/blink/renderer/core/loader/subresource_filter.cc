@@ -35,6 +35,18 @@ String GetErrorStringForDisallowedLoad(const KURL& url) {
   return builder.ToString();
 }
 
+// A URL every ruleset shipped with Kiwi disallows. The filter exposes no
+// activation level, so whether it blocks is derived from the policy for this
+// URL.
+constexpr char kActivationProbeUrl[] = "http://sitescout.com";
+
+bool ComputeIsAdBlockingActive(WebDocumentSubresourceFilter& filter) {
+  return filter.GetLoadPolicy(KURL(kActivationProbeUrl),
+                              mojom::blink::RequestContextType::
+                                  XML_HTTP_REQUEST) ==
+         WebDocumentSubresourceFilter::kDisallow;
+}
+
 }  // namespace
 
 SubresourceFilter::SubresourceFilter(
@@ -43,6 +55,7 @@ SubresourceFilter::SubresourceFilter(
     : execution_context_(execution_context),
       subresource_filter_(std::move(subresource_filter)) {
   DCHECK(subresource_filter_);
+  is_ad_blocking_active_ = ComputeIsAdBlockingActive(*subresource_filter_);
   // Report the main resource as an ad if the subresource filter is
   // associated with an ad subframe.
   if (auto* window = DynamicTo<LocalDOMWindow>(execution_context_.Get())) {
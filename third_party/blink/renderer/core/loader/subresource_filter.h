@@ -43,6 +43,12 @@ class CORE_EXPORT SubresourceFilter final
   // Reports the resource request id as an ad to the |subresource_filter_|.
   void ReportAdRequestId(int request_id);
 
+  // Whether the filter blocks the loads it matches, as opposed to not being
+  // enabled for the document or only reporting matches (dry run). The
+  // activation of a document does not change after commit, so this is
+  // computed once when the filter is created.
+  bool IsAdBlockingActive() const { return is_ad_blocking_active_; }
+
   virtual void Trace(Visitor*) const;
 
  private:
@@ -58,6 +64,8 @@ class CORE_EXPORT SubresourceFilter final
   std::pair<std::pair<KURL, mojom::blink::RequestContextType>,
             WebDocumentSubresourceFilter::LoadPolicy>
       last_resource_check_result_;
+
+  bool is_ad_blocking_active_ = false;
 };
 
 }  // namespace blink
@@ -0,0 +1,44 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/loader/url_component_views.h"
+
+#include <algorithm>
+
+#include "base/check_op.h"
+
+namespace blink {
+
+namespace {
+
+// Mirrors KURL::ComponentString().
+StringView ComponentView(const KURL& url, const url::Component& component) {
+  if (!url.IsValid() || component.len <= 0)
+    return StringView();
+  // The offsets count bytes of the canonical UTF-8 spec. They only differ from
+  // the characters of a 16-bit string in the fragment, which comes last, so
+  // as in String::Substring(), clamping the length to the string is enough.
+  const String& string = url.GetString();
+  const unsigned begin = static_cast<unsigned>(component.begin);
+  DCHECK_LE(begin, string.length());
+  return StringView(string, begin,
+                    std::min(static_cast<unsigned>(component.len),
+                             string.length() - begin));
+}
+
+}  // namespace
+
+StringView URLHostView(const KURL& url) {
+  return ComponentView(url, url.GetParsed().host);
+}
+
+StringView URLPathView(const KURL& url) {
+  return ComponentView(url, url.GetParsed().path);
+}
+
+StringView URLQueryView(const KURL& url) {
+  return ComponentView(url, url.GetParsed().query);
+}
+
+}  // namespace blink
@@ -0,0 +1,25 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_URL_COMPONENT_VIEWS_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_URL_COMPONENT_VIEWS_H_
+
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/weborigin/kurl.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_view.h"
+
+namespace blink {
+
+// Views of the components of a KURL, backed by KURL::GetString() and the
+// offsets of KURL::GetParsed(). Unlike KURL::Host(), KURL::GetPath() and
+// KURL::Query(), which copy the component into a new String, they do not
+// allocate. Each view is null where the matching KURL accessor returns a null
+// string, and is only valid as long as the KURL is alive and unmodified.
+CORE_EXPORT StringView URLHostView(const KURL& url);
+CORE_EXPORT StringView URLPathView(const KURL& url);
+CORE_EXPORT StringView URLQueryView(const KURL& url);
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LOADER_URL_COMPONENT_VIEWS_H_
@@ -0,0 +1,31 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/public/web/web_request_block_list.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/logging.h"
+#include "third_party/blink/renderer/core/loader/request_blocker.h"
+
+namespace blink {
+
+void SetRequestBlockListFile(base::File file,
+                             const base::MemoryMappedFile::Region& region) {
+  auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+  if (!mapped_file->Initialize(std::move(file), region)) {
+    DLOG(WARNING) << "Failed to map the request block list";
+    return;
+  }
+  std::unique_ptr<RequestBlocker> blocker =
+      RequestBlocker::CreateFromFile(std::move(mapped_file));
+  if (!blocker) {
+    DLOG(WARNING) << "Ignoring a malformed request block list";
+    return;
+  }
+  RequestBlocker::SetCurrent(std::move(blocker));
+}
+
+}  // namespace blink
@@ -5,6 +5,7 @@
 #include "third_party/blink/renderer/core/paint/cull_rect_updater.h"
 
 #include "base/auto_reset.h"
+#include "base/metrics/histogram_macros.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/core/frame/local_frame_view.h"
 #include "third_party/blink/renderer/core/layout/layout_embedded_content.h"
@@ -137,6 +138,8 @@ void CullRectUpdater::Update() {
 
   DCHECK(starting_layer_.IsRootLayer());
   UpdateInternal(CullRect::Infinite());
+  UMA_HISTOGRAM_COUNTS_10000("Blink.CullRect.VisitedLayers", visited_layers_);
+  UMA_HISTOGRAM_COUNTS_10000("Blink.CullRect.UpdatedLayers", updated_layers_);
 #if DCHECK_IS_ON()
   if (VLOG_IS_ON(2)) {
     VLOG(2) << "PaintLayer tree after cull rect update:";
@@ -173,6 +176,7 @@ void CullRectUpdater::UpdateRecursively(PaintLayer& layer,
   if (layer.IsUnderSVGHiddenContainer())
     return;
 
+  visited_layers_++;
   bool should_proactively_update = ShouldProactivelyUpdate(layer);
   bool force_update_children =
       should_proactively_update || layer.ForcesChildrenCullRectUpdate() ||
@@ -291,6 +295,7 @@ void CullRectUpdater::UpdateForDescendants(PaintLayer& layer,
 
 bool CullRectUpdater::UpdateForSelf(PaintLayer& layer,
                                     const PaintLayer& parent_painting_layer) {
+  updated_layers_++;
   const auto& first_parent_fragment =
       parent_painting_layer.GetLayoutObject().FirstFragment();
   auto& first_fragment =
@@ -63,6 +63,12 @@ class CORE_EXPORT CullRectUpdater {
   bool force_proactive_update_ = false;
   bool subtree_is_out_of_cull_rect_ = false;
   bool subtree_should_use_infinite_cull_rect_ = false;
+
+  // The layers walked by Update(), and those of them whose cull rects were
+  // recomputed. Recorded by Update() to show how much of the layer tree a
+  // cull rect update touches, e.g. on scroll.
+  int visited_layers_ = 0;
+  int updated_layers_ = 0;
 };
 
 // Used when painting with a custom top-level cull rect, e.g. when printing a
@@ -4,6 +4,7 @@
 
 #include "third_party/blink/renderer/core/paint/cull_rect_updater.h"
 
+#include "base/test/metrics/histogram_tester.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/core/paint/paint_controller_paint_test.h"
@@ -31,6 +32,19 @@ CullRect GetCullRect(const PaintLayer& layer) {
   return layer.GetLayoutObject().FirstFragment().GetCullRect();
 }
 
+TEST_F(CullRectUpdaterTest, LayerCountMetrics) {
+  base::HistogramTester histogram_tester;
+  SetBodyInnerHTML(R"HTML(
+    <div style="position: relative; z-index: 1"></div>
+    <div style="position: relative; z-index: 1"></div>
+    <div style="position: relative; z-index: 1"></div>
+  )HTML");
+
+  // The new layers need their cull rects computed.
+  EXPECT_LE(3, histogram_tester.GetTotalSum("Blink.CullRect.VisitedLayers"));
+  EXPECT_LE(3, histogram_tester.GetTotalSum("Blink.CullRect.UpdatedLayers"));
+}
+
 TEST_F(CullRectUpdaterTest, FixedPositionUnderClipPath) {
   GetDocument().View()->Resize(800, 600);
   SetBodyInnerHTML(R"HTML(
@@ -0,0 +1,50 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/testing/scoped_allocation_counter.h"
+
+#include <atomic>
+
+#include "base/allocator/partition_allocator/partition_alloc_hooks.h"
+
+namespace blink {
+
+namespace {
+
+std::atomic<size_t> g_allocation_count{0};
+std::atomic<size_t> g_allocated_bytes{0};
+
+void OnAllocation(void* address, size_t size, const char* type_name) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void OnFree(void* address) {}
+
+}  // namespace
+
+ScopedAllocationCounter::ScopedAllocationCounter() {
+  Reset();
+  partition_alloc::PartitionAllocHooks::SetObserverHooks(&OnAllocation,
+                                                         &OnFree);
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter() {
+  partition_alloc::PartitionAllocHooks::SetObserverHooks(nullptr, nullptr);
+}
+
+size_t ScopedAllocationCounter::Count() const {
+  return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+size_t ScopedAllocationCounter::Bytes() const {
+  return g_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+void ScopedAllocationCounter::Reset() {
+  g_allocation_count.store(0, std::memory_order_relaxed);
+  g_allocated_bytes.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace blink
@@ -0,0 +1,37 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_TESTING_SCOPED_ALLOCATION_COUNTER_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_TESTING_SCOPED_ALLOCATION_COUNTER_H_
+
+#include <stddef.h>
+
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace blink {
+
+// Counts the PartitionAlloc allocations made on any thread while it is alive,
+// through the PartitionAlloc observer hooks. Oilpan allocations are not
+// counted. Only one counter may exist at a time, and none while a heap
+// profiler has installed its own hooks.
+class ScopedAllocationCounter {
+  STACK_ALLOCATED();
+
+ public:
+  ScopedAllocationCounter();
+  ScopedAllocationCounter(const ScopedAllocationCounter&) = delete;
+  ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
+  ~ScopedAllocationCounter();
+
+  // The number of allocations, and their total size, since the counter was
+  // created or last reset.
+  size_t Count() const;
+  size_t Bytes() const;
+
+  void Reset();
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_TESTING_SCOPED_ALLOCATION_COUNTER_H_
@@ -5,6 +5,7 @@
 #include "third_party/blink/renderer/platform/disk_data_allocator.h"
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 
 #include "base/logging.h"
@@ -31,32 +32,47 @@ void DiskDataAllocator::set_may_write_for_testing(bool may_write) {
   may_write_ = may_write;
 }
 
+void DiskDataAllocator::AddFreeChunk(int64_t start_offset, size_t size) {
+  auto result = free_chunks_.insert({start_offset, size});
+  DCHECK(result.second);
+  auto by_size_result = free_chunks_by_size_.insert({size, start_offset});
+  DCHECK(by_size_result.second);
+}
+
+void DiskDataAllocator::RemoveFreeChunk(
+    std::map<int64_t, size_t>::iterator chunk) {
+  size_t erased = free_chunks_by_size_.erase({chunk->second, chunk->first});
+  DCHECK_EQ(1u, erased);
+  free_chunks_.erase(chunk);
+}
+
 DiskDataMetadata DiskDataAllocator::FindChunk(size_t size) {
   // Try to reuse some space. Policy:
   // 1. Exact fit
   // 2. Worst fit
+  // Among chunks of the chosen size, the one with the lowest offset is used.
+  // Both lookups are logarithmic in the number of free chunks, which matters
+  // as the lock is held here while many images and strings are parked.
   DiskDataMetadata chosen_chunk{-1, 0};
 
-  size_t worst_fit_size = 0;
-  for (const auto& chunk : free_chunks_) {
-    size_t chunk_size = chunk.second;
-    if (size == chunk_size) {
-      chosen_chunk = {chunk.first, chunk.second};
-      break;
-    } else if (chunk_size > size && chunk_size > worst_fit_size) {
-      chosen_chunk = {chunk.first, chunk.second};
-      worst_fit_size = chunk.second;
-    }
+  auto exact_fit = free_chunks_by_size_.lower_bound(
+      {size, std::numeric_limits<int64_t>::min()});
+  if (exact_fit != free_chunks_by_size_.end() && exact_fit->first == size) {
+    chosen_chunk = {exact_fit->second, exact_fit->first};
+  } else if (!free_chunks_by_size_.empty() &&
+             free_chunks_by_size_.rbegin()->first > size) {
+    auto worst_fit = free_chunks_by_size_.lower_bound(
+        {free_chunks_by_size_.rbegin()->first,
+         std::numeric_limits<int64_t>::min()});
+    chosen_chunk = {worst_fit->second, worst_fit->first};
   }
 
   if (chosen_chunk.start_offset() != -1) {
     free_chunks_size_ -= size;
-    free_chunks_.erase(chosen_chunk.start_offset());
+    RemoveFreeChunk(free_chunks_.find(chosen_chunk.start_offset()));
     if (chosen_chunk.size() > size) {
-      std::pair<int64_t, size_t> remainder_chunk = {
-          chosen_chunk.start_offset() + size, chosen_chunk.size() - size};
-      auto result = free_chunks_.insert(remainder_chunk);
-      DCHECK(result.second);
+      AddFreeChunk(chosen_chunk.start_offset() + size,
+                   chosen_chunk.size() - size);
       chosen_chunk.size_ = size;
     }
   } else {
@@ -83,7 +99,7 @@ void DiskDataAllocator::ReleaseChunk(const DiskDataMetadata& metadata) {
     if (left_chunk_end == chunk.start_offset()) {
       chunk = {left->first, left->second + chunk.size()};
       free_chunks_size_ -= left->second;
-      free_chunks_.erase(left);
+      RemoveFreeChunk(left);
     }
   }
 
@@ -95,12 +111,11 @@ void DiskDataAllocator::ReleaseChunk(const DiskDataMetadata& metadata) {
     if (right->first == chunk_end) {
       chunk = {chunk.start_offset(), chunk.size() + right->second};
       free_chunks_size_ -= right->second;
-      free_chunks_.erase(right);
+      RemoveFreeChunk(right);
     }
   }
 
-  auto result = free_chunks_.insert({chunk.start_offset(), chunk.size()});
-  DCHECK(result.second);
+  AddFreeChunk(chunk.start_offset(), chunk.size());
   free_chunks_size_ += chunk.size();
 }
 
@@ -7,6 +7,8 @@
 
 #include <map>
 #include <memory>
+#include <set>
+#include <utility>
 
 #include "base/dcheck_is_on.h"
 #include "base/files/file.h"
@@ -80,6 +82,11 @@ class PLATFORM_EXPORT DiskDataAllocator : public mojom::blink::DiskAllocator {
   void set_may_write_for_testing(bool may_write) LOCKS_EXCLUDED(lock_);
 
  private:
+  // Keep |free_chunks_| and |free_chunks_by_size_| in sync.
+  void AddFreeChunk(int64_t start_offset, size_t size)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void RemoveFreeChunk(std::map<int64_t, size_t>::iterator chunk)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
   DiskDataMetadata FindChunk(size_t size) EXCLUSIVE_LOCKS_REQUIRED(lock_);
   void ReleaseChunk(const DiskDataMetadata& metadata)
       EXCLUSIVE_LOCKS_REQUIRED(lock_);
@@ -97,6 +104,9 @@ class PLATFORM_EXPORT DiskDataAllocator : public mojom::blink::DiskAllocator {
   base::Lock lock_;
   // Using a std::map because we rely on |{lower,upper}_bound()|.
   std::map<int64_t, size_t> free_chunks_ GUARDED_BY(lock_);
+  // The chunks of |free_chunks_| as (size, start offset), so that
+  // |FindChunk()| does not have to scan all of them.
+  std::set<std::pair<size_t, int64_t>> free_chunks_by_size_ GUARDED_BY(lock_);
   size_t free_chunks_size_ GUARDED_BY(lock_);
 
  private:
@@ -35,6 +35,11 @@ class InMemoryDataAllocator : public DiskDataAllocator {
       free_size += p.second;
 
     EXPECT_EQ(free_size, free_chunks_size_);
+    EXPECT_EQ(free_chunks_.size(), free_chunks_by_size_.size());
+    for (const auto& p : free_chunks_by_size_) {
+      auto it = free_chunks_.find(p.second);
+      EXPECT_TRUE(it != free_chunks_.end() && it->second == p.first);
+    }
 
     return free_chunks_;
   }
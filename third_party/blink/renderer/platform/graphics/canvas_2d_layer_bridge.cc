@@ -48,12 +48,19 @@
 #include "third_party/blink/renderer/platform/graphics/static_bitmap_image.h"
 #include "third_party/blink/renderer/platform/graphics/unaccelerated_static_bitmap_image.h"
 #include "third_party/blink/renderer/platform/graphics/web_graphics_context_3d_provider_wrapper.h"
+#include "third_party/blink/renderer/platform/image-encoders/image_encoder.h"
 #include "third_party/blink/renderer/platform/instrumentation/histogram.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
+#include "third_party/blink/renderer/platform/scheduler/public/post_cross_thread_task.h"
+#include "third_party/blink/renderer/platform/scheduler/public/thread.h"
 #include "third_party/blink/renderer/platform/scheduler/public/thread_scheduler.h"
+#include "third_party/blink/renderer/platform/scheduler/public/worker_pool.h"
+#include "third_party/blink/renderer/platform/wtf/cross_thread_functional.h"
 #include "third_party/blink/renderer/platform/wtf/functional.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 #include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkSurface.h"
 
 namespace blink {
@@ -175,6 +182,51 @@ static void LoseContextInBackgroundForTestingWrapper(
   LoseContextInBackgroundWrapper(std::move(bridge), base::TimeTicks());
 }
 
+namespace {
+
+// A hibernation snapshot on its way to and from the worker pool.
+struct HibernationImageCompression {
+  USING_FAST_MALLOC(HibernationImageCompression);
+
+ public:
+  base::WeakPtr<Canvas2DLayerBridge> bridge;
+  scoped_refptr<base::SingleThreadTaskRunner> reply_task_runner;
+  sk_sp<SkImage> image;
+  sk_sp<SkData> encoded;
+};
+
+void DidCompressHibernationImageWrapper(
+    std::unique_ptr<HibernationImageCompression> compression) {
+  if (compression->bridge) {
+    compression->bridge->DidCompressHibernationImage(
+        std::move(compression->image), std::move(compression->encoded));
+  }
+}
+
+void CompressHibernationImageInBackground(
+    std::unique_ptr<HibernationImageCompression> compression) {
+  TRACE_EVENT0("blink",
+               "Canvas2DLayerBridge::CompressHibernationImageInBackground");
+  SkPixmap pixmap;
+  Vector<uint8_t> encoded;
+  // Favor speed over size: a canvas' contents are mostly flat areas, which
+  // even the fastest zlib level shrinks well.
+  SkPngEncoder::Options options;
+  options.fFilterFlags = SkPngEncoder::FilterFlag::kSub;
+  options.fZLibLevel = 1;
+  if (compression->image->peekPixels(&pixmap) &&
+      ImageEncoder::Encode(&encoded, pixmap, options)) {
+    compression->encoded = SkData::MakeWithCopy(encoded.data(), encoded.size());
+  }
+  scoped_refptr<base::SingleThreadTaskRunner> reply_task_runner =
+      compression->reply_task_runner;
+  PostCrossThreadTask(*reply_task_runner, FROM_HERE,
+                      CrossThreadBindOnce(&DidCompressHibernationImageWrapper,
+                                          std::move(compression)));
+}
+
+}  // namespace
+
 void Canvas2DLayerBridge::Hibernate() {
   DCHECK(!IsHibernating());
   DCHECK(hibernation_scheduled_);
@@ -229,6 +281,38 @@ void Canvas2DLayerBridge::Hibernate() {
   if (resource_host_)
     resource_host_->SetNeedsCompositingUpdate();
   logger_->DidStartHibernating();
+
+  if (RuntimeEnabledFeatures::CanvasCompressHibernatedImageEnabled() &&
+      hibernation_image_) {
+    auto compression = std::make_unique<HibernationImageCompression>();
+    compression->bridge = weak_ptr_factory_.GetWeakPtr();
+    compression->reply_task_runner = Thread::Current()->GetTaskRunner();
+    compression->image = hibernation_image_;
+    worker_pool::PostTask(
+        FROM_HERE, {base::TaskPriority::BEST_EFFORT},
+        CrossThreadBindOnce(&CompressHibernationImageInBackground,
+                            std::move(compression)));
+  }
+}
+
+void Canvas2DLayerBridge::DidCompressHibernationImage(sk_sp<SkImage> image,
+                                                      sk_sp<SkData> encoded) {
+  // The canvas may have been restored, or hibernated again, meanwhile.
+  if (!encoded || image != hibernation_image_)
+    return;
+  const size_t decoded_size = image->imageInfo().computeMinByteSize();
+  if (encoded->size() >= decoded_size)
+    return;
+  sk_sp<SkImage> compressed_image = SkImage::MakeFromEncoded(encoded);
+  if (!compressed_image)
+    return;
+  UMA_HISTOGRAM_MEMORY_KB("Blink.Canvas.HibernationCompression.SavedKB",
+                          (decoded_size - encoded->size()) / 1024);
+  hibernation_image_ = std::move(compressed_image);
+}
+
+bool Canvas2DLayerBridge::IsHibernationImageCompressedForTesting() const {
+  return hibernation_image_ && hibernation_image_->isLazyGenerated();
 }
 
 void Canvas2DLayerBridge::LoseContext() {
@@ -51,6 +51,7 @@
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/size.h"
 
+class SkData;
 struct SkImageInfo;
 
 namespace cc {
@@ -111,6 +112,11 @@ class PLATFORM_EXPORT Canvas2DLayerBridge : public cc::TextureLayerClient {
   // canvas is in an invisible tab.
   void LoseContext();
   bool IsHibernating() const { return hibernation_image_ != nullptr; }
+  // Replaces the hibernation snapshot with |encoded|, a PNG of
+  // |image|, if |image| is still the snapshot and |encoded| is smaller. The
+  // encoded snapshot is only decoded again when the canvas is drawn or read.
+  void DidCompressHibernationImage(sk_sp<SkImage> image, sk_sp<SkData> encoded);
+  bool IsHibernationImageCompressedForTesting() const;
 
   bool HasRecordedDrawCommands() { return have_recorded_draw_commands_; }
 
@@ -31,6 +31,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/run_loop.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/task/thread_pool/thread_pool_instance.h"
 #include "build/build_config.h"
 #include "cc/layers/texture_layer.h"
 #include "cc/paint/paint_flags.h"
@@ -559,6 +560,39 @@ TEST_F(Canvas2DLayerBridgeTest, SnapshotWhileHibernating) {
   bridge->SetIsInHiddenPage(false);
 }
 
+TEST_F(Canvas2DLayerBridgeTest, CompressedHibernationImage) {
+  if (!Canvas2DLayerBridge::IsHibernationEnabled())
+    GTEST_SKIP();
+
+  ScopedCanvasCompressHibernatedImageForTest compress_hibernated_image(true);
+  ScopedTestingPlatformSupport<GpuMemoryBufferTestPlatform> platform;
+  std::unique_ptr<Canvas2DLayerBridge> bridge =
+      MakeBridge(gfx::Size(300, 300), RasterMode::kGPU, kNonOpaque);
+  bridge->DontUseIdleSchedulingForTesting();
+  DrawSomething(bridge.get());
+
+  bridge->SetIsInHiddenPage(true);
+  platform->RunUntilIdle();
+  EXPECT_TRUE(bridge->IsHibernating());
+
+  // Let the worker pool compress the snapshot and reply.
+  base::ThreadPoolInstance::Get()->FlushForTesting();
+  platform->RunUntilIdle();
+  EXPECT_TRUE(bridge->IsHibernating());
+  EXPECT_TRUE(bridge->IsHibernationImageCompressedForTesting());
+
+  // Snapshots of the compressed image are decoded on demand.
+  scoped_refptr<StaticBitmapImage> image = bridge->NewImageSnapshot();
+  ASSERT_TRUE(image);
+  EXPECT_FALSE(image->IsTextureBacked());
+  image = nullptr;
+
+  bridge->SetIsInHiddenPage(false);
+  EXPECT_TRUE(bridge->IsAccelerated());
+  EXPECT_FALSE(bridge->IsHibernating());
+  EXPECT_TRUE(bridge->IsValid());
+}
+
 TEST_F(Canvas2DLayerBridgeTest, TeardownWhileHibernationIsPending) {
   if (!Canvas2DLayerBridge::IsHibernationEnabled())
     GTEST_SKIP();
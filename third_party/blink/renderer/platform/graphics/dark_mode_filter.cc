@@ -9,6 +9,8 @@
 #include "base/check_op.h"
 #include "base/command_line.h"
 #include "base/containers/lru_cache.h"
+#include "base/containers/span.h"
+#include "base/hash/hash.h"
 #include "base/notreached.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/public/common/switches.h"
@@ -16,10 +18,16 @@
 #include "third_party/blink/renderer/platform/graphics/dark_mode_color_filter.h"
 #include "third_party/blink/renderer/platform/graphics/dark_mode_image_cache.h"
 #include "third_party/blink/renderer/platform/graphics/dark_mode_image_classifier.h"
+#include "third_party/blink/renderer/platform/graphics/dark_mode_settings_builder.h"
 #include "third_party/blink/renderer/platform/graphics/image.h"
 #include "third_party/blink/renderer/platform/instrumentation/histogram.h"
 #include "third_party/blink/renderer/platform/wtf/hash_functions.h"
+#include "third_party/blink/renderer/platform/wtf/shared_buffer.h"
+#include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
+#include "third_party/blink/renderer/platform/wtf/thread_specific.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
 #include "third_party/skia/include/core/SkColorFilter.h"
+#include "third_party/skia/include/core/SkRect.h"
 
 #include "third_party/skia/include/effects/SkColorMatrix.h"
 
@@ -46,6 +54,91 @@ bool ShouldUseRasterSidePath(Image* image) {
   return image->IsBitmapImage();
 }
 
+// The key of a classification in the SharedClassificationCache: the |src|
+// rect of the image whose encoded data has |data_size| bytes and hashes to
+// |content_hash|. Keys are compared in full, so that rects of an image never
+// collide with each other.
+struct SharedClassificationKey {
+  bool operator==(const SharedClassificationKey& other) const {
+    return content_hash == other.content_hash &&
+           data_size == other.data_size && src == other.src;
+  }
+
+  size_t content_hash;
+  size_t data_size;
+  SkIRect src;
+};
+
+struct SharedClassificationKeyHash {
+  size_t operator()(const SharedClassificationKey& key) const {
+    return base::HashInts(
+        base::HashInts(key.content_hash, key.data_size),
+        base::HashInts(base::HashInts(key.src.x(), key.src.y()),
+                       base::HashInts(key.src.width(), key.src.height())));
+  }
+};
+
+// Classifications of complete bitmap images, shared by all Images of the
+// renderer, so that a logo or sprite drawn by many pages or documents is
+// decoded and sampled only once. Classifications do not depend on the
+// DarkModeSettings, so the cache is independent of the DarkModeFilter.
+using SharedClassificationCache =
+    base::HashingLRUCache<SharedClassificationKey,
+                          DarkModeResult,
+                          SharedClassificationKeyHash>;
+
+SharedClassificationCache& GetSharedClassificationCache() {
+  DCHECK(IsMainThread());
+  DEFINE_STATIC_LOCAL(SharedClassificationCache, cache, (kMaxCacheSize));
+  return cache;
+}
+
+// Returns the key of |src| of |image| in the SharedClassificationCache, or
+// nullopt if |image| is not a complete bitmap image.
+absl::optional<SharedClassificationKey> GetSharedClassificationKey(
+    Image* image,
+    const SkIRect& src) {
+  if (!image->IsBitmapImage() || !image->CurrentFrameIsComplete() ||
+      !image->HasData()) {
+    return absl::nullopt;
+  }
+  scoped_refptr<SharedBuffer> data = image->Data();
+  DarkModeImageCache* cache = image->GetDarkModeImageCache();
+  if (!cache->ContentHash()) {
+    size_t content_hash = data->size();
+    for (const auto& span : *data)
+      content_hash = base::HashInts(content_hash,
+                                    base::FastHash(base::as_bytes(span)));
+    cache->SetContentHash(content_hash);
+  }
+  return SharedClassificationKey{*cache->ContentHash(), data->size(), src};
+}
+
+absl::optional<DarkModeResult> GetSharedClassification(Image* image,
+                                                       const SkIRect& src) {
+  absl::optional<SharedClassificationKey> key =
+      GetSharedClassificationKey(image, src);
+  if (!key)
+    return absl::nullopt;
+  SharedClassificationCache& shared_cache = GetSharedClassificationCache();
+  auto it = shared_cache.Get(*key);
+  if (it == shared_cache.end())
+    return absl::nullopt;
+  return it->second;
+}
+
+void AddSharedClassification(Image* image,
+                             const SkIRect& src,
+                             DarkModeResult classification) {
+  // Images that could not be decoded or sampled may succeed another time.
+  if (classification == DarkModeResult::kNotClassified)
+    return;
+  if (absl::optional<SharedClassificationKey> key =
+          GetSharedClassificationKey(image, src)) {
+    GetSharedClassificationCache().Put(*key, classification);
+  }
+}
+
 sk_sp<SkColorFilter> GetDarkModeFilterForImageOnMainThread(
     DarkModeFilter* filter,
     Image* image,
@@ -57,6 +150,10 @@ sk_sp<SkColorFilter> GetDarkModeFilterForImageOnMainThread(
   DCHECK(cache);
   if (cache->Exists(rounded_src)) {
     color_filter = cache->Get(rounded_src);
+  } else if (absl::optional<DarkModeResult> classification =
+                 GetSharedClassification(image, rounded_src)) {
+    color_filter = filter->ImageFilterForClassification(*classification);
+    cache->Add(rounded_src, color_filter);
   } else {
     // Performance warning: Calling AsSkBitmapForCurrentFrame() will
     // synchronously decode image.
@@ -64,7 +161,8 @@ sk_sp<SkColorFilter> GetDarkModeFilterForImageOnMainThread(
         image->AsSkBitmapForCurrentFrame(kDoNotRespectImageOrientation);
     SkPixmap pixmap;
     bitmap.peekPixels(&pixmap);
-    color_filter = filter->GenerateImageFilter(pixmap, rounded_src);
+    DarkModeResult result = filter->ClassifyImage(pixmap, rounded_src);
+    color_filter = filter->ImageFilterForClassification(result);
 
     // Using blink side dark mode for images, it is hard to implement
     // caching mechanism for partially loaded bitmap image content, as
@@ -73,8 +171,10 @@ sk_sp<SkColorFilter> GetDarkModeFilterForImageOnMainThread(
     // default frame is completely received. This will help get correct
     // classification results for incremental content received for the given
     // image.
-    if (!image->IsBitmapImage() || image->CurrentFrameIsComplete())
+    if (!image->IsBitmapImage() || image->CurrentFrameIsComplete()) {
       cache->Add(rounded_src, color_filter);
+      AddSharedClassification(image, rounded_src, result);
+    }
   }
   return color_filter;
 }
@@ -123,6 +223,18 @@ DarkModeFilter::DarkModeFilter(const DarkModeSettings& settings)
 
 DarkModeFilter::~DarkModeFilter() {}
 
+// static
+DarkModeFilter& DarkModeFilter::ForCurrentThread() {
+  DEFINE_THREAD_SAFE_STATIC_LOCAL(
+      ThreadSpecific<std::unique_ptr<DarkModeFilter>>, filter, ());
+  std::unique_ptr<DarkModeFilter>& thread_filter = *filter;
+  if (!thread_filter) {
+    thread_filter =
+        std::make_unique<DarkModeFilter>(GetCurrentDarkModeSettings());
+  }
+  return *thread_filter;
+}
+
 DarkModeFilter::ImmutableData::ImmutableData(const DarkModeSettings& settings)
     : settings(settings),
       foreground_classifier(nullptr),
@@ -209,11 +321,19 @@ bool DarkModeFilter::ShouldApplyFilterToImage(ImageType type) const {
 sk_sp<SkColorFilter> DarkModeFilter::GenerateImageFilter(
     const SkPixmap& pixmap,
     const SkIRect& src) const {
+  return ImageFilterForClassification(ClassifyImage(pixmap, src));
+}
+
+DarkModeResult DarkModeFilter::ClassifyImage(const SkPixmap& pixmap,
+                                             const SkIRect& src) const {
   DCHECK(immutable_.settings.image_policy == DarkModeImagePolicy::kFilterSmart);
-  DCHECK(immutable_.image_filter);
+  return immutable_.image_classifier->Classify(pixmap, src);
+}
 
-  return (immutable_.image_classifier->Classify(pixmap, src) ==
-          DarkModeResult::kApplyFilter)
+sk_sp<SkColorFilter> DarkModeFilter::ImageFilterForClassification(
+    DarkModeResult classification) const {
+  DCHECK(immutable_.image_filter);
+  return classification == DarkModeResult::kApplyFilter
              ? immutable_.image_filter
              : nullptr;
 }
@@ -31,6 +31,12 @@ class PLATFORM_EXPORT DarkModeFilter {
   explicit DarkModeFilter(const DarkModeSettings& settings);
   ~DarkModeFilter();
 
+  // Returns the filter for GetCurrentDarkModeSettings() shared by all painting
+  // on the current thread. GraphicsContext and Gradient live for one paint, so
+  // a filter of their own would rebuild the color filters and start with an
+  // empty inverted color cache every time.
+  static DarkModeFilter& ForCurrentThread();
+
   enum class ElementRole { kForeground, kListSymbol, kBackground, kSVG };
   enum class ImageType { kNone, kIcon, kSeparator, kPhoto };
 
@@ -53,6 +59,13 @@ class PLATFORM_EXPORT DarkModeFilter {
   sk_sp<SkColorFilter> GenerateImageFilter(const SkPixmap& pixmap,
                                            const SkIRect& src) const;
 
+  // The two steps of GenerateImageFilter(), for callers that cache the
+  // classification. ClassifyImage() is thread-safe.
+  DarkModeResult ClassifyImage(const SkPixmap& pixmap,
+                               const SkIRect& src) const;
+  sk_sp<SkColorFilter> ImageFilterForClassification(
+      DarkModeResult classification) const;
+
   void ApplyFilterToImage(Image* image,
                           cc::PaintFlags* flags,
                           const SkRect& src);
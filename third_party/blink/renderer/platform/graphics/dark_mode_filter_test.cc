@@ -122,5 +122,10 @@ TEST(DarkModeFilterTest, InvertedColorCacheZeroMaxKeys) {
   EXPECT_EQ(2u, filter.GetInvertedColorCacheSizeForTesting());
 }
 
+TEST(DarkModeFilterTest, ForCurrentThreadIsShared) {
+  EXPECT_EQ(&DarkModeFilter::ForCurrentThread(),
+            &DarkModeFilter::ForCurrentThread());
+}
+
 }  // namespace
 }  // namespace blink
@@ -8,6 +8,7 @@
 #include <unordered_map>
 
 #include "base/hash/hash.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/skia/include/core/SkColorFilter.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -43,6 +44,11 @@ class PLATFORM_EXPORT DarkModeImageCache {
 
   void Clear() { cache_.clear(); }
 
+  // A hash of the image's encoded data, which keys its classifications in the
+  // renderer-wide cache of DarkModeFilter. Set once the image is complete.
+  const absl::optional<size_t>& ContentHash() const { return content_hash_; }
+  void SetContentHash(size_t content_hash) { content_hash_ = content_hash; }
+
  private:
   struct DarkModeKeyHash;
   struct DarkModeKey {
@@ -68,6 +74,7 @@ class PLATFORM_EXPORT DarkModeImageCache {
   };
 
   std::unordered_map<DarkModeKey, sk_sp<SkColorFilter>, DarkModeKeyHash> cache_;
+  absl::optional<size_t> content_hash_;
 };
 
 }  // namespace blink
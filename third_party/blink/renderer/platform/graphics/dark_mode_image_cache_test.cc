@@ -51,4 +51,16 @@ TEST_F(DarkModeImageCacheTest, Caching) {
   EXPECT_EQ(cache.Size(), 1u);
 }
 
+TEST_F(DarkModeImageCacheTest, ContentHash) {
+  DarkModeImageCache cache;
+  EXPECT_FALSE(cache.ContentHash());
+  cache.SetContentHash(42u);
+  ASSERT_TRUE(cache.ContentHash());
+  EXPECT_EQ(*cache.ContentHash(), 42u);
+
+  // Clearing the classifications keeps the hash of the image data.
+  cache.Clear();
+  EXPECT_EQ(*cache.ContentHash(), 42u);
+}
+
 }  // namespace blink
@@ -4,7 +4,7 @@
 
 #include "third_party/blink/renderer/platform/graphics/dark_mode_image_classifier.h"
 
-#include <set>
+#include <bitset>
 
 #include "base/memory/singleton.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -108,7 +108,11 @@ void DarkModeImageClassifier::GetSamples(const SkPixmap& pixmap,
   }
 
   sampled_pixels->clear();
-  std::vector<SkIRect> foreground_blocks;
+  sampled_pixels->reserve(num_sampled_pixels);
+  int foreground_blocks = 0;
+  // Reused across blocks, so that sampling does not allocate per block.
+  std::vector<SkColor> block_samples;
+  block_samples.reserve(pixels_per_block);
 
   for (int y = 0; y < num_blocks_y; y++) {
     for (int x = 0; x < num_blocks_x; x++) {
@@ -117,7 +121,6 @@ void DarkModeImageClassifier::GetSamples(const SkPixmap& pixmap,
                             horizontal_grid[x + 1] - horizontal_grid[x],
                             vertical_grid[y + 1] - vertical_grid[y]);
 
-      std::vector<SkColor> block_samples;
       int block_transparent_pixels;
       GetBlockSamples(pixmap, block, pixels_per_block, &block_samples,
                       &block_transparent_pixels);
@@ -127,7 +130,7 @@ void DarkModeImageClassifier::GetSamples(const SkPixmap& pixmap,
                              block_samples.end());
       if (opaque_pixels >
           kMinOpaquePixelPercentageForForeground * pixels_per_block) {
-        foreground_blocks.push_back(block);
+        foreground_blocks++;
       }
       blocks_count++;
     }
@@ -136,7 +139,7 @@ void DarkModeImageClassifier::GetSamples(const SkPixmap& pixmap,
   *transparency_ratio = static_cast<float>(transparent_pixels) /
                         (transparent_pixels + opaque_pixels);
   *background_ratio =
-      1.0 - static_cast<float>(foreground_blocks.size()) / blocks_count;
+      1.0 - static_cast<float>(foreground_blocks) / blocks_count;
 }
 
 // Selects samples at regular intervals from a block of the image.
@@ -199,7 +202,8 @@ DarkModeImageClassifier::Features DarkModeImageClassifier::ComputeFeatures(
 float DarkModeImageClassifier::ComputeColorBucketsRatio(
     const std::vector<SkColor>& sampled_pixels,
     const ColorMode color_mode) const {
-  std::set<uint16_t> buckets;
+  // A bit per possible bucket; a tree set costs an allocation per bucket.
+  std::bitset<4096> buckets;
 
   // If image is in color, use 4 bits per color channel, otherwise 4 bits for
   // illumination.
@@ -208,7 +212,7 @@ float DarkModeImageClassifier::ComputeColorBucketsRatio(
       uint16_t bucket = ((SkColorGetR(sample) >> 4) << 8) +
                         ((SkColorGetG(sample) >> 4) << 4) +
                         ((SkColorGetB(sample) >> 4));
-      buckets.insert(bucket);
+      buckets.set(bucket);
     }
   } else {
     for (const SkColor& sample : sampled_pixels) {
@@ -216,14 +220,14 @@ float DarkModeImageClassifier::ComputeColorBucketsRatio(
           (SkColorGetR(sample) * 5 + SkColorGetG(sample) * 3 +
            SkColorGetB(sample) * 2) /
           10;
-      buckets.insert(illumination / 16);
+      buckets.set(illumination / 16);
     }
   }
 
   // Using 4 bit per channel representation of each color bucket, there would be
   // 2^4 buckets for grayscale images and 2^12 for color images.
   const float max_buckets[] = {16, 4096};
-  return static_cast<float>(buckets.size()) /
+  return static_cast<float>(buckets.count()) /
          max_buckets[color_mode == ColorMode::kColor];
 }
 
@@ -0,0 +1,71 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/graphics/dark_mode_image_classifier.h"
+
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/platform/graphics/bitmap_image.h"
+#include "third_party/blink/renderer/platform/testing/testing_platform_support.h"
+#include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
+#include "third_party/blink/renderer/platform/wtf/shared_buffer.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace blink {
+
+namespace {
+
+constexpr int kIterations = 1000;
+
+class DarkModeImageClassifierPerfTest : public testing::Test {
+ protected:
+  // Classifies the whole of the image in |file_name| repeatedly, and reports
+  // the time per classification under |story|.
+  void MeasureClassify(const String& file_name, const char* story) {
+    scoped_refptr<SharedBuffer> image_data =
+        test::ReadFromFile(test::BlinkWebTestsDir() + file_name);
+    ASSERT_TRUE(image_data && image_data->size());
+    scoped_refptr<BitmapImage> image = BitmapImage::Create();
+    image->SetData(image_data, true);
+    SkBitmap bitmap =
+        image->AsSkBitmapForCurrentFrame(kDoNotRespectImageOrientation);
+    SkPixmap pixmap;
+    ASSERT_TRUE(bitmap.peekPixels(&pixmap));
+    SkIRect src = SkIRect::MakeWH(image->width(), image->height());
+
+    DarkModeImageClassifier classifier;
+    base::ElapsedTimer timer;
+    for (int i = 0; i < kIterations; ++i)
+      classifier.Classify(pixmap, src);
+    perf_test::PerfResultReporter reporter("BlinkDarkModeImageClassifier",
+                                           story);
+    reporter.RegisterImportantMetric("TimePerClassify", "us");
+    reporter.AddResult("TimePerClassify",
+                       timer.Elapsed().InMicrosecondsF() / kIterations);
+  }
+
+ private:
+  ScopedTestingPlatformSupport<TestingPlatformSupport> platform_;
+};
+
+}  // namespace
+
+// A small icon with few colors and transparent pixels.
+TEST_F(DarkModeImageClassifierPerfTest, Icon) {
+  MeasureClassify("/images/resources/twitter_favicon.ico", "Icon");
+}
+
+// A large image, sampled at the full kMaxSampledPixels.
+TEST_F(DarkModeImageClassifierPerfTest, LargeGrid) {
+  MeasureClassify("/images/resources/grid-large.png", "LargeGrid");
+}
+
+// A colorful, photo-like image, which fills many color buckets.
+TEST_F(DarkModeImageClassifierPerfTest, Photo) {
+  MeasureClassify("/images/resources/blue-wheel-srgb-color-profile.png",
+                  "Photo");
+}
+
+}  // namespace blink
@@ -29,7 +29,6 @@
 
 #include <algorithm>
 #include "third_party/abseil-cpp/absl/types/optional.h"
-#include "third_party/blink/renderer/platform/graphics/dark_mode_settings_builder.h"
 #include "third_party/blink/renderer/platform/graphics/graphics_context.h"
 #include "third_party/blink/renderer/platform/graphics/paint/paint_shader.h"
 #include "third_party/blink/renderer/platform/graphics/skia/skia_utils.h"
@@ -192,11 +191,7 @@ void Gradient::ApplyToFlags(cc::PaintFlags& flags,
 }
 
 DarkModeFilter& Gradient::EnsureDarkModeFilter() {
-  if (!dark_mode_filter_) {
-    dark_mode_filter_ =
-        std::make_unique<DarkModeFilter>(GetCurrentDarkModeSettings());
-  }
-  return *dark_mode_filter_;
+  return DarkModeFilter::ForCurrentThread();
 }
 
 namespace {
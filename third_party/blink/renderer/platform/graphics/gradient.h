@@ -148,7 +148,6 @@ class PLATFORM_EXPORT Gradient : public RefCounted<Gradient> {
   mutable Vector<ColorStop, 2> stops_;
   mutable bool stops_sorted_;
   bool is_dark_mode_enabled_ = false;
-  std::unique_ptr<DarkModeFilter> dark_mode_filter_;
 
   mutable sk_sp<PaintShader> cached_shader_;
   mutable sk_sp<SkColorFilter> color_filter_;
@@ -162,11 +162,9 @@ void GraphicsContext::CopyConfigFrom(GraphicsContext& other) {
 }
 
 DarkModeFilter* GraphicsContext::GetDarkModeFilter() {
-  if (!dark_mode_filter_) {
-    dark_mode_filter_ =
-        std::make_unique<DarkModeFilter>(GetCurrentDarkModeSettings());
-  }
-  return dark_mode_filter_.get();
+  if (dark_mode_filter_for_test_)
+    return dark_mode_filter_for_test_.get();
+  return &DarkModeFilter::ForCurrentThread();
 }
 
 DarkModeFilter* GraphicsContext::GetDarkModeFilterForImage(
@@ -181,7 +179,7 @@ DarkModeFilter* GraphicsContext::GetDarkModeFilterForImage(
 
 void GraphicsContext::UpdateDarkModeSettingsForTest(
     const DarkModeSettings& settings) {
-  dark_mode_filter_ = std::make_unique<DarkModeFilter>(settings);
+  dark_mode_filter_for_test_ = std::make_unique<DarkModeFilter>(settings);
 }
 
 void GraphicsContext::Save() {
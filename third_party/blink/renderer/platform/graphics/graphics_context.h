@@ -625,7 +625,8 @@ class PLATFORM_EXPORT GraphicsContext {
 
   float device_scale_factor_ = 1.0f;
 
-  std::unique_ptr<DarkModeFilter> dark_mode_filter_;
+  // Replaces the shared DarkModeFilter::ForCurrentThread() in tests.
+  std::unique_ptr<DarkModeFilter> dark_mode_filter_for_test_;
 
   bool printing_ = false;
   bool in_drawing_recorder_ = false;
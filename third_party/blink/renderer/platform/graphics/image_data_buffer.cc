@@ -42,12 +42,36 @@
 #include "third_party/blink/renderer/platform/wtf/text/base64.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
 #include "third_party/skia/include/core/SkSurface.h"
 #include "third_party/skia/include/core/SkSwizzle.h"
 #include "third_party/skia/include/encode/SkJpegEncoder.h"
 
 namespace blink {
 
+namespace {
+
+// Data URLs longer than this are not cached, to bound the memory retained.
+constexpr wtf_size_t kMaxCachedDataURLLength = 4 * 1024 * 1024;
+
+// The last data URL encoded on the main thread. Pages and extensions often
+// call toDataURL() repeatedly on an unchanged canvas, whose snapshots then
+// share a content id.
+struct CachedDataURL {
+  PaintImage::ContentId content_id = PaintImage::kInvalidContentId;
+  ImageEncodingMimeType mime_type = kMimeTypePng;
+  double quality = 0;
+  String data_url;
+};
+
+CachedDataURL& MainThreadCachedDataURL() {
+  DCHECK(IsMainThread());
+  DEFINE_STATIC_LOCAL(CachedDataURL, cached_data_url, ());
+  return cached_data_url;
+}
+
+}  // namespace
+
 ImageDataBuffer::ImageDataBuffer(scoped_refptr<StaticBitmapImage> image) {
   if (!image)
     return;
@@ -103,6 +127,7 @@ ImageDataBuffer::ImageDataBuffer(scoped_refptr<StaticBitmapImage> image) {
   }
   is_valid_ = true;
   size_ = gfx::Size(image->width(), image->height());
+  content_id_ = paint_image.GetContentIdForFrame(0);
 }
 
 ImageDataBuffer::ImageDataBuffer(const SkPixmap& pixmap)
@@ -170,12 +195,24 @@ bool ImageDataBuffer::EncodeImageInternal(const ImageEncodingMimeType mime_type,
 String ImageDataBuffer::ToDataURL(const ImageEncodingMimeType mime_type,
                                   const double& quality) const {
   DCHECK(is_valid_);
+  CachedDataURL* cached = nullptr;
+  if (content_id_ != PaintImage::kInvalidContentId && IsMainThread()) {
+    cached = &MainThreadCachedDataURL();
+    if (cached->content_id == content_id_ && cached->mime_type == mime_type &&
+        cached->quality == quality) {
+      return cached->data_url;
+    }
+  }
+
   Vector<unsigned char> result;
   if (!EncodeImageInternal(mime_type, quality, &result, pixmap_))
     return "data:,";
 
-  return "data:" + ImageEncodingMimeTypeName(mime_type) + ";base64," +
-         Base64Encode(result);
+  String data_url = "data:" + ImageEncodingMimeTypeName(mime_type) +
+                    ";base64," + Base64Encode(result);
+  if (cached && data_url.length() <= kMaxCachedDataURLLength)
+    *cached = {content_id_, mime_type, quality, data_url};
+  return data_url;
 }
 
 }  // namespace blink
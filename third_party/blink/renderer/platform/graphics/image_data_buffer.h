@@ -78,6 +78,9 @@ class PLATFORM_EXPORT ImageDataBuffer {
 
   sk_sp<SkImage> retained_image_;
   SkPixmap pixmap_;
+  // The content of the StaticBitmapImage the pixels were read from, if any.
+  // Keys the cache of ToDataURL().
+  PaintImage::ContentId content_id_ = PaintImage::kInvalidContentId;
   bool is_valid_ = false;
   gfx::Size size_;
 };
@@ -25,10 +25,12 @@
 
 #include "third_party/blink/renderer/platform/graphics/image_decoding_store.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "base/bind.h"
 #include "base/synchronization/lock.h"
+#include "base/system/sys_info.h"
 #include "third_party/blink/renderer/platform/graphics/image_frame_generator.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 #include "third_party/blink/renderer/platform/wtf/threading.h"
@@ -37,12 +39,21 @@ namespace blink {
 
 namespace {
 
-static const size_t kDefaultMaxTotalSizeOfHeapEntries = 32 * 1024 * 1024;
+static const size_t kMinTotalSizeOfHeapEntries = 16 * 1024 * 1024;
+static const size_t kMaxTotalSizeOfHeapEntries = 64 * 1024 * 1024;
+
+// The default limit is 1/128th of physical memory, so 32 MiB on a 4 GiB
+// device as before, and less on the low-end devices that miss it most.
+size_t DefaultMaxTotalSizeOfHeapEntries() {
+  return static_cast<size_t>(std::clamp<uint64_t>(
+      base::SysInfo::AmountOfPhysicalMemory() / 128, kMinTotalSizeOfHeapEntries,
+      kMaxTotalSizeOfHeapEntries));
+}
 
 }  // namespace
 
 ImageDecodingStore::ImageDecodingStore()
-    : heap_limit_in_bytes_(kDefaultMaxTotalSizeOfHeapEntries),
+    : heap_limit_in_bytes_(DefaultMaxTotalSizeOfHeapEntries()),
       heap_memory_usage_in_bytes_(0),
       memory_pressure_listener_(
           FROM_HERE,
@@ -75,8 +86,15 @@ bool ImageDecodingStore::LockDecoder(
   DecoderCacheMap::iterator iter =
       decoder_cache_map_.find(DecoderCacheEntry::MakeCacheKey(
           generator, scaled_size, alpha_option, client_id));
-  if (iter == decoder_cache_map_.end())
+  if (iter == decoder_cache_map_.end()) {
+    ++decoder_cache_misses_;
+    TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink.image_decoding"),
+                   "ImageDecodingStoreDecoderMisses", decoder_cache_misses_);
     return false;
+  }
+  ++decoder_cache_hits_;
+  TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink.image_decoding"),
+                 "ImageDecodingStoreDecoderHits", decoder_cache_hits_);
 
   DecoderCacheEntry* cache_entry = iter->value.get();
 
@@ -196,6 +214,21 @@ int ImageDecodingStore::CacheEntries() {
   return decoder_cache_map_.size();
 }
 
+uint64_t ImageDecodingStore::DecoderCacheHits() {
+  base::AutoLock lock(lock_);
+  return decoder_cache_hits_;
+}
+
+uint64_t ImageDecodingStore::DecoderCacheMisses() {
+  base::AutoLock lock(lock_);
+  return decoder_cache_misses_;
+}
+
+uint64_t ImageDecodingStore::DecoderEvictions() {
+  base::AutoLock lock(lock_);
+  return decoder_evictions_;
+}
+
 void ImageDecodingStore::Prune() {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("blink.image_decoding"),
                "ImageDecodingStore::prune");
@@ -222,6 +255,12 @@ void ImageDecodingStore::Prune() {
       cache_entry = cache_entry->Next();
     }
 
+    if (!cache_entries_to_delete.IsEmpty()) {
+      decoder_evictions_ += cache_entries_to_delete.size();
+      TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink.image_decoding"),
+                     "ImageDecodingStoreDecoderEvictions", decoder_evictions_);
+    }
+
     // Remove from cache list as well.
     RemoveFromCacheListInternal(cache_entries_to_delete);
   }
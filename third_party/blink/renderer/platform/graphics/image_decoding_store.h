@@ -279,6 +279,14 @@ class PLATFORM_EXPORT ImageDecodingStore final {
   int CacheEntries();
   int DecoderCacheEntries();
 
+  // Lifetime counts of LockDecoder() calls that found or missed a decoder,
+  // and of decoders evicted by the cache limit or Clear(). A miss means the
+  // image is decoded again from its data. Also traced as counters in
+  // "disabled-by-default-blink.image_decoding".
+  uint64_t DecoderCacheHits();
+  uint64_t DecoderCacheMisses();
+  uint64_t DecoderEvictions();
+
  private:
   void Prune();
 
@@ -346,6 +354,9 @@ class PLATFORM_EXPORT ImageDecodingStore final {
 
   size_t heap_limit_in_bytes_ GUARDED_BY(lock_);
   size_t heap_memory_usage_in_bytes_ GUARDED_BY(lock_);
+  uint64_t decoder_cache_hits_ GUARDED_BY(lock_) = 0;
+  uint64_t decoder_cache_misses_ GUARDED_BY(lock_) = 0;
+  uint64_t decoder_evictions_ GUARDED_BY(lock_) = 0;
 
   // A listener to global memory pressure events.
   base::MemoryPressureListener memory_pressure_listener_;
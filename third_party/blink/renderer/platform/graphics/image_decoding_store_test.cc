@@ -131,6 +131,39 @@ TEST_F(ImageDecodingStoreTest, evictDecoder) {
   EXPECT_FALSE(ImageDecodingStore::Instance().MemoryUsageInBytes());
 }
 
+TEST_F(ImageDecodingStoreTest, Statistics) {
+  ImageDecodingStore& store = ImageDecodingStore::Instance();
+  const uint64_t hits = store.DecoderCacheHits();
+  const uint64_t misses = store.DecoderCacheMisses();
+  const uint64_t evictions = store.DecoderEvictions();
+
+  const SkISize size = SkISize::Make(1, 1);
+  ImageDecoder* test_decoder;
+  EXPECT_FALSE(store.LockDecoder(generator_.get(), size,
+                                 ImageDecoder::kAlphaPremultiplied,
+                                 cc::PaintImage::kDefaultGeneratorClientId,
+                                 &test_decoder));
+  EXPECT_EQ(misses + 1, store.DecoderCacheMisses());
+
+  auto decoder = std::make_unique<MockImageDecoder>(this);
+  decoder->SetSize(1, 1);
+  store.InsertDecoder(generator_.get(),
+                      cc::PaintImage::kDefaultGeneratorClientId,
+                      std::move(decoder));
+  EXPECT_TRUE(store.LockDecoder(generator_.get(), size,
+                                ImageDecoder::kAlphaPremultiplied,
+                                cc::PaintImage::kDefaultGeneratorClientId,
+                                &test_decoder));
+  store.UnlockDecoder(generator_.get(),
+                      cc::PaintImage::kDefaultGeneratorClientId, test_decoder);
+  EXPECT_EQ(hits + 1, store.DecoderCacheHits());
+  EXPECT_EQ(evictions, store.DecoderEvictions());
+
+  EvictOneCache();
+  EXPECT_EQ(evictions + 1, store.DecoderEvictions());
+  EXPECT_EQ(misses + 1, store.DecoderCacheMisses());
+}
+
 TEST_F(ImageDecodingStoreTest, decoderInUseNotEvicted) {
   auto decoder1 = std::make_unique<MockImageDecoder>(this);
   auto decoder2 = std::make_unique<MockImageDecoder>(this);
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+# Copyright 2022 The Chromium Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Adds the events of kiwi_ukm.xml to ukm.xml for gen_builders.py.
+
+The Kiwi events are kept out of ukm.xml, so that it can be updated from
+upstream as is. The merged configuration is only written to the build
+directory.
+"""
+
+import argparse
+import sys
+import xml.dom.minidom
+
+
+def _EventNames(config):
+  return {
+      event.getAttribute('name')
+      for event in config.getElementsByTagName('event')
+  }
+
+
+def Merge(upstream_path, kiwi_path, output_path):
+  upstream = xml.dom.minidom.parse(upstream_path)
+  kiwi = xml.dom.minidom.parse(kiwi_path)
+
+  duplicates = _EventNames(upstream) & _EventNames(kiwi)
+  if duplicates:
+    raise ValueError('Events defined twice: %s' %
+                     ', '.join(sorted(duplicates)))
+
+  upstream_config = upstream.documentElement
+  for event in kiwi.documentElement.getElementsByTagName('event'):
+    upstream_config.appendChild(upstream.importNode(event, deep=True))
+
+  with open(output_path, 'w', encoding='utf-8') as output:
+    upstream.writexml(output, encoding='utf-8')
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__)
+  parser.add_argument('--upstream', required=True, help='Path to ukm.xml.')
+  parser.add_argument('--kiwi', required=True, help='Path to kiwi_ukm.xml.')
+  parser.add_argument('--output',
+                      required=True,
+                      help='Path of the merged configuration.')
+  args = parser.parse_args()
+  Merge(args.upstream, args.kiwi, args.output)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())